@@ -200,25 +200,8 @@ namespace TitaniumWindows
 		    : Titanium::GlobalObject::Timer(callback, _interval), callback__(callback)
 		{
 			TITANIUM_LOG_DEBUG("Timer: ctor");
-
-			std::chrono::milliseconds interval = _interval;
-			// Avoid zero interval
-			if (interval.count() == 0) {
-				interval = std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(100));
-			}
-
-			// A Windows::Foundation::TimeSpan is a time period expressed in
-			// 100-nanosecond units.
-			//
-			// Reference:
-			// http://msdn.microsoft.com/en-us/library/windows/apps/windows.foundation.timespan
-			std::chrono::duration<std::chrono::nanoseconds::rep, std::ratio_multiply<std::ratio<100>, std::nano>> timer_interval_ticks = interval;
-			TITANIUM_LOG_DEBUG("Timer: ctor: timer_interval_ticks = ", timer_interval_ticks.count());
-
-			Windows::Foundation::TimeSpan time_span;
-			time_span.Duration = timer_interval_ticks.count();
 			dispatcher_timer__ = ref new Windows::UI::Xaml::DispatcherTimer();
-			dispatcher_timer__->Interval = time_span;
+			updateDispatcherInterval(_interval);
 		}
 
 		virtual ~Timer()
@@ -270,7 +253,35 @@ namespace TitaniumWindows
 			}
 		}
 
+		virtual void set_interval(const std::chrono::milliseconds& interval) TITANIUM_NOEXCEPT override final
+		{
+			Titanium::GlobalObject::Timer::set_interval(interval);
+			updateDispatcherInterval(interval);
+		}
+
 	private:
+		void updateDispatcherInterval(const std::chrono::milliseconds& _interval) TITANIUM_NOEXCEPT
+		{
+			std::chrono::milliseconds interval = _interval;
+			// Avoid zero interval. TitaniumKit arms the timer for the next due
+			// timeout, so zero means as soon as possible.
+			if (interval.count() == 0) {
+				interval = std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(1));
+			}
+
+			// A Windows::Foundation::TimeSpan is a time period expressed in
+			// 100-nanosecond units.
+			//
+			// Reference:
+			// http://msdn.microsoft.com/en-us/library/windows/apps/windows.foundation.timespan
+			std::chrono::duration<std::chrono::nanoseconds::rep, std::ratio_multiply<std::ratio<100>, std::nano>> timer_interval_ticks = interval;
+			TITANIUM_LOG_DEBUG("Timer: timer_interval_ticks = ", timer_interval_ticks.count());
+
+			Windows::Foundation::TimeSpan time_span;
+			time_span.Duration = timer_interval_ticks.count();
+			dispatcher_timer__->Interval = time_span;
+		}
+
 #pragma warning(push)
 #pragma warning(disable : 4251)
 		Titanium::GlobalObject::Callback_t callback__;
@@ -64,6 +64,7 @@ namespace TitaniumWindows
 
 		virtual Titanium::Network::TYPE get_networkType() const TITANIUM_NOEXCEPT override final;
 		virtual bool get_online() const TITANIUM_NOEXCEPT override final;
+		virtual Titanium::Network::ConnectionPoolStats getConnectionPoolStats() TITANIUM_NOEXCEPT override final;
 
 		virtual void enableEvent(const std::string& event_name) TITANIUM_NOEXCEPT override final;
 		virtual void disableEvent(const std::string& event_name) TITANIUM_NOEXCEPT override final;
@@ -9,6 +9,7 @@
 
 #include "TitaniumWindows_Network_EXPORT.h"
 #include "Titanium/Network/HTTPClient.hpp"
+#include "Titanium/Network/ConnectionPool.hpp"
 #include <ppltasks.h>
 #include <Robuffer.h>
 #include <boost/algorithm/string.hpp>
@@ -21,6 +22,32 @@ namespace TitaniumWindows
 	{
 		using namespace HAL;
 
+		/*!
+		  @struct
+		  @discussion A WinRT HttpClient handed out by the connection pool. WinRT keeps
+		  sockets and TLS sessions alive per filter, so giving the same client to later
+		  requests for the same host reuses them.
+		*/
+		struct PooledHttpClient
+		{
+			Windows::Web::Http::Filters::HttpBaseProtocolFilter^ filter;
+			Windows::Web::Http::HttpClient^ client;
+		};
+
+		/*!
+		  @struct
+		  @discussion Outcome of a coalesced GET, handed to every client that joined it.
+		*/
+		struct CoalescedResponse
+		{
+			std::uint32_t status { 0 };
+			std::map<const std::string, std::string> headers;
+			std::shared_ptr<const std::vector<std::uint8_t>> data;
+			std::int32_t errorCode { 0 };
+			std::string error;
+			bool success { true };
+		};
+
 		/*!
 		  @class HTTPClient
 		  @ingroup Titanium.Network.HTTPClient
@@ -46,6 +73,22 @@ namespace TitaniumWindows
 #endif
 
 			static void JSExportInitialize();
+
+			/*!
+			  @method
+			  @abstract ConnectionPool
+			  @discussion Process-wide pool of HttpClients keyed by scheme, host and port.
+			  Requests without credentials take their client from here.
+			*/
+			static Titanium::Network::ConnectionPool<PooledHttpClient>& ConnectionPool();
+
+			/*!
+			  @method
+			  @abstract Coalescer
+			  @discussion Process-wide registry of coalesced GETs in flight.
+			*/
+			static Titanium::Network::RequestCoalescer<CoalescedResponse>& Coalescer();
+
 			// methods
 			virtual void abort() TITANIUM_NOEXCEPT override final;
 			virtual void clearCookies(const std::string& url) TITANIUM_NOEXCEPT override final;
@@ -54,6 +97,8 @@ namespace TitaniumWindows
 			virtual void send() TITANIUM_NOEXCEPT override final;
 			virtual void send(const std::map<std::string, JSValue>& postDataPairs, const bool& useMultipartForm) TITANIUM_NOEXCEPT override final;
 			virtual void send(const std::string& postDataStr) TITANIUM_NOEXCEPT override final;
+			virtual void send(const std::shared_ptr<Titanium::Blob>& blob) TITANIUM_NOEXCEPT override final;
+			virtual void send(const std::shared_ptr<Titanium::Filesystem::File>& file) TITANIUM_NOEXCEPT override final;
 			virtual void setRequestHeader(const std::string& name, const std::string& value) TITANIUM_NOEXCEPT override final;
 			// properties
 			virtual std::string get_allResponseHeaders() const TITANIUM_NOEXCEPT override final;
@@ -77,8 +122,9 @@ namespace TitaniumWindows
 			Windows::UI::Xaml::DispatcherTimer^ dispatcherTimer__;
 			// responseStream__ - holds response string, the stream is not exposed
 			Windows::Storage::Streams::IBuffer^ responseStream__;
-			// responseDataLen__ - count of character contained in data vector
-			long responseDataLen__ { 0 };
+			// responseFileStream__ - when the file property is set the response is written here chunk by chunk
+			// instead of being collected in responseData__
+			Windows::Storage::Streams::IOutputStream^ responseFileStream__;
 			// timeoutSpan__ - the span in milliseconds during which the request is active
 			Windows::Foundation::TimeSpan timeoutSpan__;
 			// responseHeaders__ - the collection of key value pairs returned from the server
@@ -97,11 +143,25 @@ namespace TitaniumWindows
 			std::map<const std::string, std::string, lexicographicalComparator> requestHeaders__;
 
 			bool disposed__ { false };
+
+			// pooled__ - true when the request gets its HttpClient from the connection pool
+			bool pooled__ { false };
+			Titanium::Network::ConnectionKey connectionKey__;
+			// connection__ - the pooled client leased for the request in flight
+			std::shared_ptr<PooledHttpClient> connection__;
+			// coalesceKey__ - set while this client leads a coalesced GET
+			std::string coalesceKey__;
+			// connectionTicket__ - set while the request waits for a pooled client
+			Titanium::Network::WaitTicket connectionTicket__ { 0 };
+			// followKey__, coalesceTicket__ - set while this client waits for the response of a coalesced GET
+			std::string followKey__;
+			Titanium::Network::WaitTicket coalesceTicket__ { 0 };
 #pragma warning(pop)
 
 			void startDispatcherTimer();
 			task<Windows::Storage::Streams::IBuffer^> HTTPClient::HTTPResultAsync(Windows::Storage::Streams::IInputStream^ stream, concurrency::cancellation_token token);
-			Windows::Storage::Streams::IBuffer^ charVecToBuffer(std::vector<std::uint8_t> char_vector);
+			task<Windows::Storage::Streams::IOutputStream^> openResponseFileAsync(const std::string& path, concurrency::cancellation_token token);
+			Windows::Storage::Streams::IBuffer^ charVecToBuffer(const std::vector<std::uint8_t>& char_vector);
 
 			void SerializeHeaders(Windows::Web::Http::HttpResponseMessage^ response);
 			void SerializeHeaderCollection(Windows::Foundation::Collections::IIterable<Windows::Foundation::Collections::IKeyValuePair<::Platform::String^, ::Platform::String^>^>^ headers);
@@ -109,6 +169,12 @@ namespace TitaniumWindows
 			void addCookiesToRequest();
 
 			void send(Windows::Web::Http::IHttpContent^ content);
+			void sendRequest(Windows::Web::Http::HttpRequestMessage^ request, const std::string& responseFilePath);
+			void releaseConnection(const bool& reusable);
+			void completeCoalesced(const CoalescedResponse& response);
+			// Withdraws the request from the connection pool and the coalescer
+			void cancelWaiting();
+			void applyCoalescedResponse(const CoalescedResponse& response);
 		};
 	} // namespace Network
 } // namespace TitaniumWindows
@@ -8,8 +8,12 @@
 #include "TitaniumWindows/Network/HTTPClient.hpp"
 #include "Titanium/detail/TiLogger.hpp"
 
+#include "Titanium/FilesystemModule.hpp"
+#include "Titanium/Filesystem/File.hpp"
+
 #include <collection.h>
 #include <ppl.h>
+#include <wrl/client.h>
 #include "TitaniumWindows/Utility.hpp"
 #include "TitaniumWindows/LogForwarder.hpp"
 #include "TitaniumWindows/WindowsMacros.hpp"
@@ -20,6 +24,27 @@ namespace TitaniumWindows
 {
 	namespace Network
 	{
+		// Raw pointer to the storage behind an IBuffer, so we can copy in and out of it
+		// without going through DataReader/DataWriter.
+		static std::uint8_t* GetBufferBytes(Windows::Storage::Streams::IBuffer^ buffer)
+		{
+			Microsoft::WRL::ComPtr<Windows::Storage::Streams::IBufferByteAccess> byteAccess;
+			reinterpret_cast<IInspectable*>(buffer)->QueryInterface(IID_PPV_ARGS(&byteAccess));
+			std::uint8_t* bytes = nullptr;
+			byteAccess->Buffer(&bytes);
+			return bytes;
+		}
+
+		static std::shared_ptr<PooledHttpClient> CreatePooledHttpClient(const Titanium::Network::ConnectionKey&)
+		{
+			auto connection = std::make_shared<PooledHttpClient>();
+			connection->filter = ref new Windows::Web::Http::Filters::HttpBaseProtocolFilter();
+			connection->filter->AllowAutoRedirect = true;
+			connection->filter->CacheControl->ReadBehavior = Windows::Web::Http::Filters::HttpCacheReadBehavior::MostRecent;
+			connection->client = ref new Windows::Web::Http::HttpClient(connection->filter);
+			return connection;
+		}
+
 		HTTPClient::HTTPClient(const JSContext& js_context) TITANIUM_NOEXCEPT
 		    : Titanium::Network::HTTPClient(js_context)
 		    , cancellationTokenSource__(concurrency::cancellation_token_source())
@@ -31,6 +56,7 @@ namespace TitaniumWindows
 		{
 			TITANIUM_LOG_DEBUG("TitaniumWindows::Network::HTTPClient::dtor");
 			abort();
+			releaseConnection(false);
 
 			filter__ = nullptr;
 			httpClient__ = nullptr;
@@ -43,9 +69,23 @@ namespace TitaniumWindows
 			JSExport<HTTPClient>::SetParent(JSExport<Titanium::Network::HTTPClient>::Class());
 		}
 
+		Titanium::Network::ConnectionPool<PooledHttpClient>& HTTPClient::ConnectionPool()
+		{
+			// Same per-host limit as browsers use
+			static Titanium::Network::ConnectionPool<PooledHttpClient> pool(6, std::chrono::seconds(30));
+			return pool;
+		}
+
+		Titanium::Network::RequestCoalescer<CoalescedResponse>& HTTPClient::Coalescer()
+		{
+			static Titanium::Network::RequestCoalescer<CoalescedResponse> coalescer;
+			return coalescer;
+		}
+
 		void HTTPClient::abort() TITANIUM_NOEXCEPT
 		{
 			cancellationTokenSource__.cancel();
+			cancelWaiting();
 
 			if (dispatcherTimer__ != nullptr && dispatcherTimer__->IsEnabled) {
 				dispatcherTimer__->Stop();
@@ -94,8 +134,16 @@ namespace TitaniumWindows
 			}
 
 			location__ = location;
+			resetResponse();
+			responseFileStream__ = nullptr;
+			cancelWaiting();
+			releaseConnection(false);
+
+			// Requests with credentials keep a client of their own, everything else shares
+			// pooled clients. filter__ is still needed for the (app-wide) cookie manager.
+			pooled__ = username__.empty();
 			filter__ = ref new Windows::Web::Http::Filters::HttpBaseProtocolFilter();
-			httpClient__ = ref new Windows::Web::Http::HttpClient(filter__);
+			httpClient__ = pooled__ ? nullptr : ref new Windows::Web::Http::HttpClient(filter__);
 			cancellationTokenSource__ = concurrency::cancellation_token_source();
 			filter__->AllowAutoRedirect = true;
 			filter__->CacheControl->ReadBehavior = Windows::Web::Http::Filters::HttpCacheReadBehavior::MostRecent;
@@ -137,7 +185,7 @@ namespace TitaniumWindows
 					if (value.IsObject()) {
 						auto blob_ptr = static_cast<JSObject>(value).GetPrivate<Titanium::Blob>();
 						if (blob_ptr != nullptr) {
-							Windows::Web::Http::HttpBufferContent^ fileContent = ref new Windows::Web::Http::HttpBufferContent(charVecToBuffer(blob_ptr->getData()));
+							Windows::Web::Http::HttpBufferContent^ fileContent = ref new Windows::Web::Http::HttpBufferContent(charVecToBuffer(blob_ptr->getDataRef()));
 							const auto mimeType = blob_ptr->get_mimeType();
 							if (!mimeType.empty()) {
 								fileContent->Headers->ContentType = ref new Windows::Web::Http::Headers::HttpMediaTypeHeaderValue(TitaniumWindows::Utility::ConvertString(mimeType));
@@ -187,9 +235,63 @@ namespace TitaniumWindows
 			send(postData);
 		}
 
+		void HTTPClient::send(const std::shared_ptr<Titanium::Blob>& blob) TITANIUM_NOEXCEPT
+		{
+			if (method__ == Titanium::Network::RequestMethod::Get) {
+				TITANIUM_MODULE_LOG_WARN("HTTPClient::send: Data found during a GET request. Method will be changed to POST.");
+				method__ = Titanium::Network::RequestMethod::Post;
+			}
+
+			auto postData = ref new Windows::Web::Http::HttpBufferContent(charVecToBuffer(blob->getDataRef()));
+			const auto mimeType = blob->get_mimeType();
+			if (!mimeType.empty()) {
+				postData->Headers->ContentType = ref new Windows::Web::Http::Headers::HttpMediaTypeHeaderValue(TitaniumWindows::Utility::ConvertString(mimeType));
+			}
+			send(postData);
+		}
+
+		void HTTPClient::send(const std::shared_ptr<Titanium::Filesystem::File>& file) TITANIUM_NOEXCEPT
+		{
+			if (method__ == Titanium::Network::RequestMethod::Get) {
+				TITANIUM_MODULE_LOG_WARN("HTTPClient::send: Data found during a GET request. Method will be changed to POST.");
+				method__ = Titanium::Network::RequestMethod::Post;
+			}
+
+			// Stream the file from disk as the request body instead of reading it into memory first
+			const auto path = TitaniumWindows::Utility::ConvertUTF8String(file->get_nativePath());
+			const auto token = cancellationTokenSource__.get_token();
+			// clang-format off
+			create_task(Windows::Storage::StorageFile::GetFileFromPathAsync(path), token)
+				.then([token](Windows::Storage::StorageFile^ storageFile) {
+				return create_task(storageFile->OpenSequentialReadAsync(), token);
+			}).then([this](task<Windows::Storage::Streams::IInputStream^> streamTask) {
+				try {
+					send(ref new Windows::Web::Http::HttpStreamContent(streamTask.get()));
+				} catch (const task_canceled&) {
+					onerror(-1, "Session Cancelled", false);
+				} catch (Platform::Exception^ ex) {
+					std::string error(TitaniumWindows::Utility::ConvertString(ex->Message));
+					onerror(ex->HResult, error, false);
+				}
+			});
+			// clang-format on
+		}
+
 		void HTTPClient::send(Windows::Web::Http::IHttpContent^ content)
 		{
 			auto uri = ref new Windows::Foundation::Uri(TitaniumWindows::Utility::ConvertString(location__));
+
+			// Resolve the download target while we are still on the JS thread
+			std::string responseFilePath;
+			if (!file__.empty()) {
+				const auto js_filesystem = get_context().JSEvaluateScript("Ti.Filesystem");
+				const auto filesystem_obj = static_cast<JSObject>(js_filesystem).CallAsConstructor();
+				const auto Filesystem = filesystem_obj.GetPrivate<Titanium::FilesystemModule>();
+				const auto target = Filesystem->getFile(get_context(), file__);
+				if (target) {
+					responseFilePath = target->get_nativePath();
+				}
+			}
 			
 			// Set up the request
 			Windows::Web::Http::HttpRequestMessage^ request;
@@ -213,6 +315,74 @@ namespace TitaniumWindows
 			}
 			setRequestHeaders(request);
 
+			// An identical GET already in flight shares its response with us
+			if (coalesce__ && method__ == Titanium::Network::RequestMethod::Get && content == nullptr && responseFilePath.empty()) {
+				const auto key = location__ + "\n" + TitaniumWindows::Utility::ConvertUTF8String(request->Headers->ToString());
+				const std::weak_ptr<HTTPClient> owner = get_object().GetPrivate<HTTPClient>();
+				const auto ticket = std::make_shared<Titanium::Network::WaitTicket>(0);
+				const auto leading = Coalescer().Join(key, [owner, ticket](const CoalescedResponse& response) {
+					TitaniumWindows::Utility::RunOnUIThread([owner, ticket, response] {
+						// Skip clients that were aborted or collected while following
+						const auto client = owner.lock();
+						if (client && client->coalesceTicket__ == *ticket) {
+							client->coalesceTicket__ = 0;
+							client->applyCoalescedResponse(response);
+						}
+					});
+				}, *ticket);
+				if (!leading) {
+					followKey__ = key;
+					coalesceTicket__ = *ticket;
+					return;
+				}
+				coalesceKey__ = key;
+			}
+
+			if (pooled__) {
+				connectionKey__ = Titanium::Network::ConnectionKey_from_url(location__);
+				const std::weak_ptr<HTTPClient> owner = get_object().GetPrivate<HTTPClient>();
+				const auto key = connectionKey__;
+				const auto ticket = std::make_shared<Titanium::Network::WaitTicket>(0);
+				const auto connection = ConnectionPool().Acquire(connectionKey__, CreatePooledHttpClient, [owner, key, ticket, request, responseFilePath](const std::shared_ptr<PooledHttpClient>& connection) {
+					// A client was released for our host, possibly on a worker thread
+					TitaniumWindows::Utility::RunOnUIThread([owner, key, ticket, request, responseFilePath, connection] {
+						const auto client = owner.lock();
+						if (!client || client->connectionTicket__ != *ticket) {
+							// Aborted or collected after the pool handed it over, pass it on
+							if (connection) {
+								ConnectionPool().Release(key, connection, true);
+							}
+							return;
+						}
+						client->connectionTicket__ = 0;
+						if (connection == nullptr) {
+							CoalescedResponse failed;
+							failed.success = false;
+							failed.errorCode = -1;
+							failed.error = "Unable to connect";
+							client->onerror(failed.errorCode, failed.error, false);
+							client->completeCoalesced(failed);
+							return;
+						}
+						client->connection__ = connection;
+						client->httpClient__ = connection->client;
+						client->sendRequest(request, responseFilePath);
+					});
+				}, *ticket);
+				if (connection == nullptr) {
+					// At the per-host limit, the request goes out once a client is released
+					connectionTicket__ = *ticket;
+					return;
+				}
+				connection__ = connection;
+				httpClient__ = connection->client;
+			}
+
+			sendRequest(request, responseFilePath);
+		}
+
+		void HTTPClient::sendRequest(Windows::Web::Http::HttpRequestMessage^ request, const std::string& responseFilePath)
+		{
 			auto operation = httpClient__->SendRequestAsync(request);
 
 			// Startup a timer that will abort the request after the timeout period is reached.
@@ -231,21 +401,35 @@ namespace TitaniumWindows
 
 				return create_task(response->Content->ReadAsInputStreamAsync(), token);
 			}, task_continuation_context::use_arbitrary())
-				.then([this, token](Windows::Storage::Streams::IInputStream^ stream) {
+				.then([this, token, responseFilePath](Windows::Storage::Streams::IInputStream^ stream) {
 				interruption_point();
 
 				readyState__ = Titanium::Network::RequestState::Loading;
 				onreadystatechange(readyState__);
 				// FIXME Fire ondatastream/onsendstream callbacks throughout!
 
-				return HTTPResultAsync(stream, token);
+				if (responseFilePath.empty()) {
+					return HTTPResultAsync(stream, token);
+				}
+				return openResponseFileAsync(responseFilePath, token).then([this, stream, token](Windows::Storage::Streams::IOutputStream^ output) {
+					responseFileStream__ = output;
+					return HTTPResultAsync(stream, token);
+				}, task_continuation_context::use_arbitrary());
 			}, task_continuation_context::use_arbitrary())
 				.then([this](task<Windows::Storage::Streams::IBuffer^> previousTask) {
+				CoalescedResponse shared;
 				try {
 					// Check if any previous task threw an exception.
 					previousTask.get();
+					releaseConnection(true);
 
 					readyState__ = Titanium::Network::RequestState::Done;
+					if (!coalesceKey__.empty()) {
+						shared.status = status__;
+						shared.headers = responseHeaders__;
+						shared.data = std::make_shared<const std::vector<std::uint8_t>>(getResponseBytes());
+					}
+
 					if (!disposed__ && httpClient__) {
 						onreadystatechange(readyState__);
 
@@ -266,26 +450,106 @@ namespace TitaniumWindows
 					}
 				}
 				catch (const task_canceled&) {
+					releaseConnection(false);
+					shared.success = false;
+					shared.errorCode = -1;
+					shared.error = "Session Cancelled";
 					if (!disposed__ && httpClient__) {
 						onerror(-1, "Session Cancelled", false);
 					}
 				}
 				catch (Platform::Exception^ ex) {
+					releaseConnection(false);
+					std::string error(TitaniumWindows::Utility::ConvertString(ex->Message));
+					shared.success = false;
+					shared.errorCode = ex->HResult;
+					shared.error = error;
 					if (!disposed__ && httpClient__) {
-						std::string error(TitaniumWindows::Utility::ConvertString(ex->Message));
 						onerror(ex->HResult, error, false);
 					}
 				}
 				catch (const std::exception& e) {
+					releaseConnection(false);
+					std::string error(e.what());
+					shared.success = false;
+					shared.errorCode = -1;
+					shared.error = error;
 					if (!disposed__ && httpClient__) {
-						std::string error(e.what());
 						onerror(-1, error, false);
 					}
 				}
+				completeCoalesced(shared);
 			}, task_continuation_context::use_arbitrary());
 			// clang-format on
 		}
 
+		void HTTPClient::releaseConnection(const bool& reusable)
+		{
+			if (connection__) {
+				const auto connection = connection__;
+				connection__ = nullptr;
+				ConnectionPool().Release(connectionKey__, connection, reusable);
+			}
+		}
+
+		void HTTPClient::completeCoalesced(const CoalescedResponse& response)
+		{
+			if (!coalesceKey__.empty()) {
+				const auto key = coalesceKey__;
+				coalesceKey__.clear();
+				Coalescer().Complete(key, response);
+			}
+		}
+
+		void HTTPClient::cancelWaiting()
+		{
+			if (connectionTicket__ != 0) {
+				const auto ticket = connectionTicket__;
+				connectionTicket__ = 0;
+				ConnectionPool().Cancel(connectionKey__, ticket);
+
+				// A leader that never got to send still owes its followers a response
+				CoalescedResponse cancelled;
+				cancelled.success = false;
+				cancelled.errorCode = -1;
+				cancelled.error = "Session Cancelled";
+				completeCoalesced(cancelled);
+			}
+			if (coalesceTicket__ != 0) {
+				const auto ticket = coalesceTicket__;
+				coalesceTicket__ = 0;
+				Coalescer().Leave(followKey__, ticket);
+				followKey__.clear();
+			}
+		}
+
+		void HTTPClient::applyCoalescedResponse(const CoalescedResponse& response)
+		{
+			followKey__.clear();
+			if (disposed__) {
+				return;
+			}
+
+			resetResponse();
+			status__ = response.status;
+			responseHeaders__ = response.headers;
+			if (response.data) {
+				responseData__ = *response.data;
+			}
+
+			readyState__ = Titanium::Network::RequestState::Done;
+			onreadystatechange(readyState__);
+
+			if (!response.success) {
+				onerror(response.errorCode, response.error, false);
+			} else if (onerror__ && onerror__.IsObject() && static_cast<JSObject>(onerror__).IsFunction() && status__ >= 400 && status__ <= 599) {
+				onerror(status__, "HTTP Error", false);
+			} else {
+				onload(0, "Response has been loaded.", true);
+			}
+			ondatastream(1.0);
+		}
+
 		void HTTPClient::setRequestHeader(const std::string& key, const std::string& value) TITANIUM_NOEXCEPT
 		{
 			auto it = requestHeaders__.find(key);
@@ -355,7 +619,8 @@ namespace TitaniumWindows
 
 		task<Windows::Storage::Streams::IBuffer^> HTTPClient::HTTPResultAsync(Windows::Storage::Streams::IInputStream^ stream, concurrency::cancellation_token token)
 		{
-			Windows::Storage::Streams::IBuffer^ responseBuffer = ref new Windows::Storage::Streams::Buffer(1000); // Default size from MS samples
+			// The read size starts at MinReadSize and grows while reads keep filling it
+			Windows::Storage::Streams::IBuffer^ responseBuffer = ref new Windows::Storage::Streams::Buffer(static_cast<unsigned int>(nextReadSize()));
 			// clang-format off
 			return create_task(stream->ReadAsync(responseBuffer, responseBuffer->Capacity, Windows::Storage::Streams::InputStreamOptions::Partial), token)
 				.then([=](task<Windows::Storage::Streams::IBuffer^> readTask) {
@@ -371,23 +636,32 @@ namespace TitaniumWindows
 					});
 				}
 
-				if (contentLength__ != -1 && contentLength__ != 0) {
-					ondatastream(responseBuffer->Length / contentLength__);
-				} else {
-					ondatastream(-1.0); // chunked encoding was used
+				// ReadAsync may hand back a different buffer than the one passed in
+				const auto buffer = readTask.get();
+
+				if (buffer->Length == 0) {
+					if (responseFileStream__ != nullptr) {
+						return create_task(responseFileStream__->FlushAsync(), token).then([this, buffer](bool) {
+							delete responseFileStream__;
+							responseFileStream__ = nullptr;
+							return buffer;
+						}, task_continuation_context::use_arbitrary());
+					}
+					// FIXME How do we pass the token on in case of readTask?
+					return readTask;
 				}
 
-				if (responseBuffer->Length) {
-					auto reader = ::Windows::Storage::Streams::DataReader::FromBuffer(responseBuffer);
-					responseData__.resize(responseDataLen__ + responseBuffer->Length);
-					reader->ReadBytes(
-						::Platform::ArrayReference<std::uint8_t>(
-						&responseData__[responseDataLen__], responseBuffer->Length));
-					responseDataLen__ += responseBuffer->Length;
+				if (responseFileStream__ != nullptr) {
+					reportDataReceived(buffer->Length);
+					// Write the chunk straight through to the target file, it never touches responseData__
+					return create_task(responseFileStream__->WriteAsync(buffer), token).then([this, stream, token](unsigned int) {
+						return HTTPResultAsync(stream, token);
+					}, task_continuation_context::use_arbitrary());
 				}
-				
-				// FIXME How do we pass the token on in case of readTask?
-				return responseBuffer->Length ? HTTPResultAsync(stream, token) : readTask;
+
+				appendResponseData(GetBufferBytes(buffer), buffer->Length);
+
+				return HTTPResultAsync(stream, token);
 			}, task_continuation_context::use_arbitrary());
 			// clang-format on
 		}
@@ -407,13 +681,36 @@ namespace TitaniumWindows
 			}
 		}
 
-		Windows::Storage::Streams::IBuffer^ HTTPClient::charVecToBuffer(std::vector<std::uint8_t> char_vector)
+		task<Windows::Storage::Streams::IOutputStream^> HTTPClient::openResponseFileAsync(const std::string& path, concurrency::cancellation_token token)
 		{
 			using namespace Windows::Storage;
-			int size = char_vector.size();
-			const auto writer = ref new Streams::DataWriter(ref new Streams::InMemoryRandomAccessStream());
-			writer->WriteBytes(::Platform::ArrayReference<std::uint8_t>(&char_vector[0], size));
-			return writer->DetachBuffer();
+			const auto separator = path.find_last_of("\\");
+			const auto folder = TitaniumWindows::Utility::ConvertUTF8String(separator == std::string::npos ? "" : path.substr(0, separator));
+			const auto name = TitaniumWindows::Utility::ConvertUTF8String(separator == std::string::npos ? path : path.substr(separator + 1));
+			// clang-format off
+			return create_task(StorageFolder::GetFolderFromPathAsync(folder), token)
+				.then([name, token](StorageFolder^ storageFolder) {
+				return create_task(storageFolder->CreateFileAsync(name, CreationCollisionOption::ReplaceExisting), token);
+			}, task_continuation_context::use_arbitrary())
+				.then([token](StorageFile^ storageFile) {
+				return create_task(storageFile->OpenAsync(FileAccessMode::ReadWrite), token);
+			}, task_continuation_context::use_arbitrary())
+				.then([](Streams::IRandomAccessStream^ stream) {
+				return stream->GetOutputStreamAt(0);
+			}, task_continuation_context::use_arbitrary());
+			// clang-format on
+		}
+
+		Windows::Storage::Streams::IBuffer^ HTTPClient::charVecToBuffer(const std::vector<std::uint8_t>& char_vector)
+		{
+			// One copy straight into the IBuffer storage
+			const auto size = static_cast<unsigned int>(char_vector.size());
+			const auto buffer = ref new Windows::Storage::Streams::Buffer(size);
+			if (size > 0) {
+				std::memcpy(GetBufferBytes(buffer), char_vector.data(), size);
+			}
+			buffer->Length = size;
+			return buffer;
 		}
 
 		void HTTPClient::SerializeHeaders(Windows::Web::Http::HttpResponseMessage^ response)
@@ -430,6 +727,7 @@ namespace TitaniumWindows
 			} else {
 				contentLength__ = -1;  // chunked encoding
 			}
+			beginResponse(contentLength__);
 
 			readyState__ = Titanium::Network::RequestState::Headers_Received;
 			onreadystatechange(Titanium::Network::RequestState::Headers_Received);
@@ -5,6 +5,7 @@
  */
 
 #include "TitaniumWindows/Network.hpp"
+#include "TitaniumWindows/Network/HTTPClient.hpp"
 #include "Titanium/detail/TiLogger.hpp"
 
 namespace TitaniumWindows
@@ -74,6 +75,13 @@ namespace TitaniumWindows
 		return false;
 	}
 
+	Titanium::Network::ConnectionPoolStats NetworkModule::getConnectionPoolStats() TITANIUM_NOEXCEPT
+	{
+		auto stats = TitaniumWindows::Network::HTTPClient::ConnectionPool().get_stats();
+		stats.coalesced = TitaniumWindows::Network::HTTPClient::Coalescer().get_coalesced();
+		return stats;
+	}
+
 	void NetworkModule::JSExportInitialize()
 	{
 		JSExport<NetworkModule>::SetClassVersion(1);
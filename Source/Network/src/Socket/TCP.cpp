@@ -44,6 +44,10 @@ namespace TitaniumWindows
 			{
 				if (!socket__) {
 					socket__ = ref new StreamSocket();
+					socket__->Control->NoDelay = noDelay__;
+					if (sendBufferSize__ > 0) {
+						socket__->Control->OutboundBufferSizeInBytes = sendBufferSize__;
+					}
 					hostname__ = ref new HostName(TitaniumWindows::Utility::ConvertString(host__));
 					const auto port = TitaniumWindows::Utility::ConvertString(std::to_string(port__));
 
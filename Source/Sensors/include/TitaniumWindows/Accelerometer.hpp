@@ -9,6 +9,8 @@
 
 #include "Titanium/Accelerometer.hpp"
 #include "TitaniumWindows_Sensors_EXPORT.h"
+#include <atomic>
+#include <memory>
 
 namespace TitaniumWindows
 {
@@ -44,6 +46,10 @@ namespace TitaniumWindows
 		Windows::Devices::Sensors::Accelerometer^ accelerometer_;
 
 		Windows::Foundation::EventRegistrationToken update_event_;
+
+		// Readings since the last dispatch; only the first one posts to the
+		// UI thread, which then reads the newest and reports the rest as dropped.
+		std::shared_ptr<std::atomic<std::uint32_t>> pending_readings_;
 	};
 
 }  // namespace TitaniumWindows
@@ -13,6 +13,7 @@ namespace TitaniumWindows
 {
 	Accelerometer::Accelerometer(const JSContext& js_context) TITANIUM_NOEXCEPT
 	    : Titanium::Accelerometer(js_context)
+	    , pending_readings_(std::make_shared<std::atomic<std::uint32_t>>(0))
 	{
 		TITANIUM_LOG_DEBUG("TitaniumWindows::Accelerometer::ctor");
 	}
@@ -41,10 +42,20 @@ namespace TitaniumWindows
 			// Capture Window::Current here because getting it outside of UI thread seems always return nullptr
 			const auto current = Windows::UI::Xaml::Window::Current;
 			const auto self = this;
+			const auto pending = pending_readings_;
 
 			using namespace std::placeholders;
-			const auto updateCallback = [current, self](Windows::Devices::Sensors::Accelerometer^ sender, Windows::Devices::Sensors::AccelerometerReadingChangedEventArgs^ e) {
-				const auto dispatchedCallback = [current, self]() {
+			const auto updateCallback = [current, self, pending](Windows::Devices::Sensors::Accelerometer^ sender, Windows::Devices::Sensors::AccelerometerReadingChangedEventArgs^ e) {
+				// A dispatch is already on its way and will pick up this reading
+				if (pending->fetch_add(1) != 0) {
+					return;
+				}
+				const auto dispatchedCallback = [current, self, pending]() {
+					const auto readings = pending->exchange(0);
+					static const auto update = Titanium::Module::InternEvent("update");
+					if (!self->hasEventListener(update)) {
+						return;
+					}
 					const auto ctx = self->get_context();
 					auto obj = ctx.CreateObject();
 					const auto reading = self->accelerometer_->GetCurrentReading();
@@ -61,14 +72,17 @@ namespace TitaniumWindows
 					obj.SetProperty("x", ctx.CreateNumber(reading->AccelerationX));
 					obj.SetProperty("y", ctx.CreateNumber(reading->AccelerationY));
 					obj.SetProperty("z", ctx.CreateNumber(reading->AccelerationZ));
+					obj.SetProperty("dropped", ctx.CreateNumber(readings > 1 ? readings - 1 : 0));
 
-					self->fireEvent("update", obj);
+					self->fireEvent(update, obj);
 				};
 
 				if (current) {
 					current->Dispatcher->RunAsync(
 						Windows::UI::Core::CoreDispatcherPriority::Normal,
 						ref new Windows::UI::Core::DispatchedHandler(dispatchedCallback));
+				} else {
+					pending->store(0);
 				}
 			};
 
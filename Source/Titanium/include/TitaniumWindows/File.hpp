@@ -49,6 +49,7 @@ namespace TitaniumWindows
 			virtual bool exists() TITANIUM_NOEXCEPT override;
 			virtual std::string extension() TITANIUM_NOEXCEPT override;
 			virtual std::vector<std::string> getDirectoryListing() TITANIUM_NOEXCEPT override;
+			virtual bool enumerateDirectory(const Titanium::Filesystem::DirectoryListingOptions& options, const std::function<bool(const Titanium::Filesystem::DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT override;
 			virtual bool isDirectory() TITANIUM_NOEXCEPT override;
 			virtual bool isFile() TITANIUM_NOEXCEPT override;
 			virtual std::chrono::milliseconds modificationTimestamp() TITANIUM_NOEXCEPT override;
@@ -117,6 +118,10 @@ namespace TitaniumWindows
 
 			Windows::Storage::FileProperties::BasicProperties^ getStorageProperties(Windows::Storage::IStorageItem^ file) const;
 
+			// Lists folder with one item query per directory, prefetching basic
+			// properties when stats are requested, instead of one File per entry.
+			bool enumerateFolder(Windows::Storage::StorageFolder^ folder, const std::string& prefix, const Titanium::Filesystem::DirectoryListingOptions& options, const std::function<bool(const Titanium::Filesystem::DirectoryEntry&)>& visitor) const;
+
 			// Get StorageFolder from path. Returns nullptr if access denied or
 			// there's no such file.
 			Windows::Storage::StorageFolder^ getFolderFromPathSync(::Platform::String^ filename) const;
@@ -433,6 +433,106 @@ namespace TitaniumWindows
 			return filenames;
 		}
 
+		bool File::enumerateDirectory(const Titanium::Filesystem::DirectoryListingOptions& options, const std::function<bool(const Titanium::Filesystem::DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT
+		{
+			if (!isFolder()) {
+				return true;
+			}
+			return enumerateFolder(folder_, "", options, visitor);
+		}
+
+		bool File::enumerateFolder(StorageFolder^ folder, const std::string& prefix, const Titanium::Filesystem::DirectoryListingOptions& options, const std::function<bool(const Titanium::Filesystem::DirectoryEntry&)>& visitor) const
+		{
+			IVectorView<IStorageItem^>^ items = nullptr;
+			try {
+				Windows::Foundation::IAsyncOperation<IVectorView<IStorageItem^>^>^ operation;
+				const auto query_options = ref new Search::QueryOptions();
+				query_options->FolderDepth = Search::FolderDepth::Shallow;
+				if (options.withStats) {
+					query_options->SetPropertyPrefetch(FileProperties::PropertyPrefetchOptions::BasicProperties, ref new Platform::Collections::Vector<Platform::String^>());
+				}
+				if (folder->AreQueryOptionsSupported(query_options)) {
+					operation = folder->CreateItemQueryWithOptions(query_options)->GetItemsAsync();
+				} else {
+					operation = folder->GetItemsAsync();
+				}
+
+				concurrency::event event;
+				create_task(operation).then([&items, &event](task<IVectorView<IStorageItem^>^> task) {
+						try {
+							items = task.get();
+						}
+						catch (Platform::Exception^ ex) {
+							TITANIUM_LOG_DEBUG(TitaniumWindows::Utility::ConvertString(ex->Message));
+						}
+						event.set();
+					},
+					concurrency::task_continuation_context::use_arbitrary());
+				event.wait();
+			} catch (Platform::Exception^ ex) {
+				TITANIUM_LOG_DEBUG(TitaniumWindows::Utility::ConvertString(ex->Message));
+			}
+
+			if (items == nullptr) {
+				return true;
+			}
+
+			// Ask for the properties of every item together and wait once; the query prefetched them
+			std::vector<FileProperties::BasicProperties^> stats;
+			if (options.withStats && items->Size > 0) {
+				std::vector<task<FileProperties::BasicProperties^>> requests;
+				requests.reserve(items->Size);
+				for (const auto item : items) {
+					requests.push_back(create_task(item->GetBasicPropertiesAsync()).then([](task<FileProperties::BasicProperties^> task) -> FileProperties::BasicProperties^ {
+							try {
+								return task.get();
+							}
+							catch (Platform::Exception^ ex) {
+								TITANIUM_LOG_DEBUG(TitaniumWindows::Utility::ConvertString(ex->Message));
+							}
+							return nullptr;
+						},
+						concurrency::task_continuation_context::use_arbitrary()));
+				}
+				concurrency::event event;
+				when_all(requests.begin(), requests.end()).then([&stats, &event](task<std::vector<FileProperties::BasicProperties^>> task) {
+						try {
+							stats = task.get();
+						}
+						catch (Platform::Exception^ ex) {
+							TITANIUM_LOG_DEBUG(TitaniumWindows::Utility::ConvertString(ex->Message));
+						}
+						event.set();
+					},
+					concurrency::task_continuation_context::use_arbitrary());
+				event.wait();
+			}
+
+			for (unsigned int i = 0; i < items->Size; i++) {
+				const auto item = items->GetAt(i);
+				const auto name = TitaniumWindows::Utility::ConvertString(item->Name);
+
+				Titanium::Filesystem::DirectoryEntry entry;
+				entry.name = prefix + name;
+				entry.isDirectory = item->IsOfType(StorageItemTypes::Folder);
+				if (options.withStats) {
+					const auto properties = i < stats.size() ? stats.at(i) : nullptr;
+					entry.hasStats = true;
+					if (properties != nullptr) {
+						entry.size = entry.isDirectory ? 0 : properties->Size;
+						entry.modificationTimestamp = TitaniumWindows::Utility::GetMSecSinceEpoch(properties->DateModified);
+					}
+				}
+				if (Titanium::Filesystem::DirectoryListingOptions_matches(options, name) && !visitor(entry)) {
+					return false;
+				}
+				if (options.recursive && entry.isDirectory && !enumerateFolder(safe_cast<StorageFolder^>(item), entry.name + "/", options, visitor)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
 		bool File::isDirectory() TITANIUM_NOEXCEPT
 		{
 			if (denied_) {
@@ -90,6 +90,8 @@ namespace TitaniumWindows
 
 	Application::Application() : js_context__(js_context_group__.CreateContext(JSExport<TitaniumWindows::GlobalObject>::Class()))
 	{
+		// Log messages are written by a background thread, don't lose them to std::terminate
+		Titanium::detail::TiLoggerInstallCrashHandler();
 	}
 
 	Application::Application(::Platform::String^ seed) : Application::Application()
@@ -102,6 +104,8 @@ namespace TitaniumWindows
 
 	Application::~Application()
 	{
+		// Stop the log writer here rather than from a static destructor in the DLL
+		Titanium::detail::TiLoggerShutdown();
 	}
 
 	void Application::OnLaunched(LaunchActivatedEventArgs ^ args)
@@ -388,6 +392,9 @@ namespace TitaniumWindows
 			}
 		}
 
+		// The process may be terminated while suspended
+		Titanium::detail::TiLoggerFlushAll();
+
 		deferral->Complete();
 	}
 
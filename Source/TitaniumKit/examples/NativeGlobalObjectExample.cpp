@@ -17,6 +17,7 @@ void NativeGlobalObjectExample::add_require(const std::string& name, const std::
 bool NativeGlobalObjectExample::requiredModuleExists(const std::string& path) const TITANIUM_NOEXCEPT
 {
 	TITANIUM_LOG_DEBUG("GlobalObjectDelegateExample::requiredModuleExists for ", path);
+	++exists_count__;
 	return (require_resource__.find(path) != require_resource__.end());
 }
 
@@ -29,11 +30,12 @@ std::string NativeGlobalObjectExample::readRequiredModule(const JSObject& parent
 	return require_resource__.at(path);
 }
 
+// Runs on the example's virtual clock, see advance_clock
 class NativeGlobalObjectTimerExample final : public Titanium::GlobalObject::Timer
 {
 public:
-	NativeGlobalObjectTimerExample(Titanium::GlobalObject::Callback_t callback, const std::chrono::milliseconds& interval)
-	    : Timer(callback, interval), callback__(callback)
+	NativeGlobalObjectTimerExample(Titanium::GlobalObject::Callback_t callback, const std::chrono::milliseconds& interval, const std::chrono::milliseconds& clock)
+	    : Timer(callback, interval), callback__(callback), clock__(clock)
 	{
 		TITANIUM_LOG_DEBUG("NativeGlobalObjectTimerExample: ctor");
 	}
@@ -46,21 +48,61 @@ public:
 	virtual void Start() TITANIUM_NOEXCEPT override final
 	{
 		TITANIUM_LOG_DEBUG("NativeGlobalObjectTimerExample::Start");
+		running__ = true;
+		next__ = clock__ + get_interval();
 	}
 
 	virtual void Stop() TITANIUM_NOEXCEPT override final
 	{
 		TITANIUM_LOG_DEBUG("NativeGlobalObjectTimerExample::Stop");
+		running__ = false;
+	}
+
+	// Fires at most once per call, like a platform timer that fell behind
+	bool Tick() TITANIUM_NOEXCEPT
+	{
+		if (running__ && clock__ >= next__) {
+			next__ = clock__ + get_interval();
+			callback__();
+			return true;
+		}
+		return false;
 	}
 
 private:
 	Titanium::GlobalObject::Callback_t callback__;
+	const std::chrono::milliseconds& clock__;
+	std::chrono::milliseconds next__;
+	bool running__ { false };
 };
 
+void NativeGlobalObjectExample::advance_clock(const std::chrono::milliseconds& by) TITANIUM_NOEXCEPT
+{
+	const auto end = clock__ + by;
+	while (clock__ < end) {
+		clock__ += std::min(timerResolution(), end - clock__);
+		// Timers may be created while ticking
+		const auto timers = timers__;
+		for (const auto& weak : timers) {
+			const auto timer = weak.lock();
+			if (timer && timer->Tick()) {
+				timer_fired_count__++;
+			}
+		}
+	}
+}
+
+std::chrono::milliseconds NativeGlobalObjectExample::timerNow() const TITANIUM_NOEXCEPT
+{
+	return clock__;
+}
+
 std::shared_ptr<Titanium::GlobalObject::Timer> NativeGlobalObjectExample::CreateTimer(Titanium::GlobalObject::Callback_t callback, const std::chrono::milliseconds& interval) const TITANIUM_NOEXCEPT
 {
 	TITANIUM_LOG_DEBUG("NativeGlobalObjectExample::CreateTimer");
-	return std::make_shared<NativeGlobalObjectTimerExample>(callback, interval);
+	const auto timer = std::make_shared<NativeGlobalObjectTimerExample>(callback, interval, clock__);
+	timers__.push_back(timer);
+	return timer;
 }
 
 NativeGlobalObjectExample::NativeGlobalObjectExample(const JSContext& js_context) TITANIUM_NOEXCEPT
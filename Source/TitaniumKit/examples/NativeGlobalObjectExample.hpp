@@ -11,9 +11,12 @@
 
 #include "Titanium/GlobalObject.hpp"
 #include <unordered_map>
+#include <vector>
 
 using namespace HAL;
 
+class NativeGlobalObjectTimerExample;
+
 /*!
  @class
  
@@ -25,6 +28,28 @@ class NativeGlobalObjectExample final : public Titanium::GlobalObject, public JS
 public:
 	void add_require(const std::string& name, const std::string& body) TITANIUM_NOEXCEPT;
 
+	// Number of requiredModuleExists calls so far
+	std::size_t get_exists_count() const TITANIUM_NOEXCEPT
+	{
+		return exists_count__;
+	}
+
+	// Number of times a Timer fired so far
+	std::size_t get_timer_fired_count() const TITANIUM_NOEXCEPT
+	{
+		return timer_fired_count__;
+	}
+
+	// Number of Timers created so far
+	std::size_t get_timer_count() const TITANIUM_NOEXCEPT
+	{
+		return timers__.size();
+	}
+
+	// Moves the virtual clock forward one timer resolution at a time,
+	// ticking every running Timer on the way
+	void advance_clock(const std::chrono::milliseconds& by) TITANIUM_NOEXCEPT;
+
 	NativeGlobalObjectExample(const JSContext&) TITANIUM_NOEXCEPT;
 
 	virtual ~NativeGlobalObjectExample() TITANIUM_NOEXCEPT;  //= default;
@@ -41,9 +66,14 @@ protected:
 	virtual std::string readRequiredModule(const JSObject& parent, const std::string& path) const override final;
 	virtual bool requiredModuleExists(const std::string& path) const TITANIUM_NOEXCEPT override final;
 	virtual std::shared_ptr<Timer> CreateTimer(Callback_t callback, const std::chrono::milliseconds& interval) const TITANIUM_NOEXCEPT override final;
+	virtual std::chrono::milliseconds timerNow() const TITANIUM_NOEXCEPT override final;
 
 private:
 	std::unordered_map<std::string, std::string> require_resource__;
+	mutable std::size_t exists_count__ { 0 };
+	std::chrono::milliseconds clock__ { 0 };
+	std::size_t timer_fired_count__ { 0 };
+	mutable std::vector<std::weak_ptr<NativeGlobalObjectTimerExample>> timers__;
 };
 
 #endif  // _TITANIUM_EXAMPLES_NATIVEGLOBALOBJECTEXAMPLE_HPP_
@@ -20,6 +20,38 @@ void NativeViewLayoutDelegate::set_backgroundColor(const std::string& background
 	TITANIUM_LOG_DEBUG("NativeViewExample:: set_backgroundColor(", backgroundColor, ")");
 }
 
+void NativeViewLayoutDelegate::set_top(const std::string& top) TITANIUM_NOEXCEPT
+{
+	ViewLayoutDelegate::set_top(top);
+	requestLayout();
+}
+
+void NativeViewLayoutDelegate::set_left(const std::string& left) TITANIUM_NOEXCEPT
+{
+	ViewLayoutDelegate::set_left(left);
+	requestLayout();
+}
+
+void NativeViewLayoutDelegate::set_width(const std::string& width) TITANIUM_NOEXCEPT
+{
+	ViewLayoutDelegate::set_width(width);
+	requestLayout();
+}
+
+void NativeViewLayoutDelegate::set_height(const std::string& height) TITANIUM_NOEXCEPT
+{
+	ViewLayoutDelegate::set_height(height);
+	requestLayout();
+}
+
+void NativeViewLayoutDelegate::requestLayout(const bool& fire_event)
+{
+	if (holdLayoutRequest(fire_event)) {
+		return;
+	}
+	++layoutCount__;
+}
+
 NativeViewExample::NativeViewExample(const JSContext& js_context) TITANIUM_NOEXCEPT
     : Titanium::UI::View(js_context)
 {
@@ -32,6 +64,14 @@ void NativeViewExample::postInitialize(JSObject& js_object)
 	Titanium::UI::View::setLayoutDelegate<NativeViewLayoutDelegate>(js_object);
 }
 
+void NativeViewExample::postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments)
+{
+	Titanium::UI::View::postCallAsConstructor(js_context, arguments);
+	// The base sets the default delegate; keep the native one, as platforms do
+	auto this_object = get_object();
+	Titanium::UI::View::setLayoutDelegate<NativeViewLayoutDelegate>(this_object);
+}
+
 NativeViewExample::~NativeViewExample() TITANIUM_NOEXCEPT
 {
 	TITANIUM_LOG_DEBUG("NativeViewExample:: dtor ", this);
@@ -21,6 +21,21 @@ public:
 	virtual ~NativeViewLayoutDelegate() = default;
 	
 	virtual void set_backgroundColor(const std::string&) TITANIUM_NOEXCEPT override;
+
+	// Geometry changes lay the view out, as they do on a platform
+	virtual void set_top(const std::string&) TITANIUM_NOEXCEPT override;
+	virtual void set_left(const std::string&) TITANIUM_NOEXCEPT override;
+	virtual void set_width(const std::string&) TITANIUM_NOEXCEPT override;
+	virtual void set_height(const std::string&) TITANIUM_NOEXCEPT override;
+	virtual void requestLayout(const bool& fire_event = false) override;
+
+	std::uint32_t get_layoutCount() const
+	{
+		return layoutCount__;
+	}
+
+private:
+	std::uint32_t layoutCount__ { 0 };
 };
 
 /*!
@@ -45,6 +60,7 @@ public:
 	static void JSExportInitialize();
 	
 	virtual void postInitialize(JSObject& js_object) override;
+	virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
 };
 
 #endif  // _TITANIUM_EXAMPLES_NATIVEVIEW_HPP_
@@ -151,8 +151,17 @@ namespace Titanium
 		virtual std::shared_ptr<Titanium::Blob> transformImage(const std::uint32_t& scaledWidth, const std::uint32_t scaledHeight, const Titanium::UI::Dimension& crop) TITANIUM_NOEXCEPT;
 
 		virtual void construct(const std::vector<std::uint8_t>& data) TITANIUM_NOEXCEPT;
+		virtual void construct(std::vector<std::uint8_t>&& data) TITANIUM_NOEXCEPT;
 		virtual std::vector<std::uint8_t> getData() TITANIUM_NOEXCEPT;
 
+		/*!
+		  @method
+		  @abstract getDataRef
+		  @discussion Read-only view of the bytes held by this blob. Unlike getData
+		  this does not copy, so prefer it when the data is only being read.
+		*/
+		virtual const std::vector<std::uint8_t>& getDataRef() const TITANIUM_NOEXCEPT;
+
 		virtual void release() TITANIUM_NOEXCEPT;
 
 		Blob(const JSContext&) TITANIUM_NOEXCEPT;
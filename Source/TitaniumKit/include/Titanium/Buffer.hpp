@@ -78,6 +78,15 @@ namespace Titanium
 		*/
 		virtual std::vector<std::uint8_t> get_data(const std::uint32_t& offset, const std::uint32_t& size) TITANIUM_NOEXCEPT;
 
+		/*!
+		@method
+		@abstract getDataRef
+		@discussion Storage of this buffer, without copying it, so native I/O can
+		read into or write from it in place. The reference is only good until
+		the buffer is resized.
+		*/
+		virtual std::vector<std::uint8_t>& getDataRef() TITANIUM_NOEXCEPT;
+
 		/*!
 		  @method
 		  @abstract append
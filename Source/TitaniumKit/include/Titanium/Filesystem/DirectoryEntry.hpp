@@ -0,0 +1,64 @@
+/**
+ * TitaniumKit DirectoryEntry
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_FILESYSTEM_DIRECTORYENTRY_HPP_
+#define _TITANIUM_FILESYSTEM_DIRECTORYENTRY_HPP_
+
+#include "Titanium/detail/TiBase.hpp"
+#include <chrono>
+
+namespace Titanium
+{
+	namespace Filesystem
+	{
+		using namespace HAL;
+
+		/*!
+		  @struct
+		  @discussion Options for Titanium.Filesystem.File.listDirectory.
+		  recursive descends into sub directories, withStats fills in size and
+		  modificationTimestamp for every entry, and filter is a wildcard
+		  pattern ('*' and '?') matched against the entry name. batchSize is
+		  kept between 1 and 4096.
+		*/
+		struct DirectoryListingOptions
+		{
+			bool recursive { false };
+			bool withStats { false };
+			std::string filter;
+			std::uint32_t batchSize { 256 };
+		};
+
+		/*!
+		  @struct
+		  @discussion One entry returned from Titanium.Filesystem.File.listDirectory.
+		  name is relative to the listed directory and uses '/' as separator.
+		  size and modificationTimestamp are only valid when hasStats is true.
+		*/
+		struct DirectoryEntry
+		{
+			std::string name;
+			bool isDirectory { false };
+			bool hasStats { false };
+			std::uint64_t size { 0 };
+			std::chrono::milliseconds modificationTimestamp { 0 };
+		};
+
+		/*!
+		  @function
+		  @discussion Returns true if name matches the wildcard pattern. An empty
+		  pattern matches everything.
+		*/
+		TITANIUMKIT_EXPORT bool DirectoryListingOptions_matches(const DirectoryListingOptions& options, const std::string& name) TITANIUM_NOEXCEPT;
+
+		TITANIUMKIT_EXPORT DirectoryListingOptions js_to_DirectoryListingOptions(const JSObject& object);
+		TITANIUMKIT_EXPORT JSObject DirectoryEntry_to_js(const JSContext& js_context, const DirectoryEntry& entry);
+
+	} // namespace Filesystem
+} // namespace Titanium
+#endif // _TITANIUM_FILESYSTEM_DIRECTORYENTRY_HPP_
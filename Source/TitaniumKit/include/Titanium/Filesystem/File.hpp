@@ -9,6 +9,7 @@
 
 #include "Titanium/Module.hpp"
 #include "Titanium/Filesystem/Constants.hpp"
+#include "Titanium/Filesystem/DirectoryEntry.hpp"
 #include "Titanium/ErrorResponse.hpp"
 #include <chrono>
 #include <vector>
@@ -158,6 +159,22 @@ namespace Titanium
 			  if this object doesn't identify a directory.
 			*/
 			virtual std::vector<std::string> getDirectoryListing() TITANIUM_NOEXCEPT;
+			/*!
+			  @method
+			  @abstract listDirectory
+			  @discussion Returns the entries of the directory identified by this file object
+			  together with their metadata, gathered in a single native pass.
+			*/
+			virtual std::vector<DirectoryEntry> listDirectory(const DirectoryListingOptions& options) TITANIUM_NOEXCEPT;
+			/*!
+			  @method
+			  @abstract enumerateDirectory
+			  @discussion Streams the entries of the directory identified by this file object
+			  to visitor, stopping as soon as visitor returns false. Returns false if the
+			  enumeration was stopped early. Platforms should override this to avoid
+			  creating a File object per entry.
+			*/
+			virtual bool enumerateDirectory(const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT;
 			/*!
 			  @method
 			  @abstract isDirectory
@@ -273,6 +290,7 @@ namespace Titanium
 			TITANIUM_FUNCTION_DEF(exists);
 			TITANIUM_FUNCTION_DEF(extension);
 			TITANIUM_FUNCTION_DEF(getDirectoryListing);
+			TITANIUM_FUNCTION_DEF(listDirectory);
 			TITANIUM_FUNCTION_DEF(isDirectory);
 			TITANIUM_FUNCTION_DEF(isFile);
 			TITANIUM_FUNCTION_DEF(modificationTimestamp);
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_FILESYSTEM_POSIX_FILE_HPP_
+#define _TITANIUM_FILESYSTEM_POSIX_FILE_HPP_
+
+#include "Titanium/Filesystem/File.hpp"
+
+struct stat;
+
+namespace Titanium
+{
+	namespace Filesystem
+	{
+		namespace POSIX
+		{
+			using namespace HAL;
+
+			/*!
+			  @class File
+			  @ingroup Titanium.Filesystem.File
+
+			  @discussion This is the Titanium.Filesystem.File implementation for POSIX
+			  platforms. Synchronous calls go straight to open/pread/fstat, large reads
+			  are served from a read-only mmap, and the asynchronous variants run on
+			  the shared I/O thread pool instead of blocking on a continuation.
+
+			  Callbacks passed to the *Async methods are invoked on a worker thread.
+			*/
+			class TITANIUMKIT_EXPORT File final : public Titanium::Filesystem::File, public JSExport<File>
+			{
+			public:
+				TITANIUM_PROPERTY_UNIMPLEMENTED(remoteBackup);
+
+				virtual bool get_executable() const TITANIUM_NOEXCEPT override;
+				virtual bool get_hidden() const TITANIUM_NOEXCEPT override;
+				virtual std::string get_name() const TITANIUM_NOEXCEPT override;
+				virtual std::string get_nativePath() const TITANIUM_NOEXCEPT override;
+				virtual std::shared_ptr<Titanium::Filesystem::File> get_parent() const TITANIUM_NOEXCEPT override;
+				virtual bool get_readonly() const TITANIUM_NOEXCEPT override;
+				virtual bool get_remoteBackup() const TITANIUM_NOEXCEPT override;
+				virtual std::uint64_t get_size() const TITANIUM_NOEXCEPT override;
+				virtual bool get_symbolicLink() const TITANIUM_NOEXCEPT override;
+				virtual bool get_writable() const TITANIUM_NOEXCEPT override;
+
+				virtual bool copy(const std::string& dest) TITANIUM_NOEXCEPT override;
+				virtual bool createDirectory() TITANIUM_NOEXCEPT override;
+				virtual bool createFile() TITANIUM_NOEXCEPT override;
+				virtual std::chrono::milliseconds createTimestamp() TITANIUM_NOEXCEPT override;
+				virtual bool deleteDirectory(const bool& recursive) TITANIUM_NOEXCEPT override;
+				virtual bool deleteFile() TITANIUM_NOEXCEPT override;
+				virtual bool exists() TITANIUM_NOEXCEPT override;
+				virtual std::string extension() TITANIUM_NOEXCEPT override;
+				virtual std::vector<std::string> getDirectoryListing() TITANIUM_NOEXCEPT override;
+				virtual bool enumerateDirectory(const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT override;
+				virtual bool isDirectory() TITANIUM_NOEXCEPT override;
+				virtual bool isFile() TITANIUM_NOEXCEPT override;
+				virtual std::chrono::milliseconds modificationTimestamp() TITANIUM_NOEXCEPT override;
+				virtual bool move(const std::string& newpath) TITANIUM_NOEXCEPT override;
+				virtual std::shared_ptr<Titanium::Blob> read() TITANIUM_NOEXCEPT override;
+				virtual bool rename(const std::string& newname) TITANIUM_NOEXCEPT override;
+				virtual std::string resolve() TITANIUM_NOEXCEPT override;
+				virtual std::uint64_t spaceAvailable() TITANIUM_NOEXCEPT override;
+				virtual bool write(const std::string& data, const bool& append) TITANIUM_NOEXCEPT override;
+				virtual bool write(const std::shared_ptr<Titanium::Blob>& data, const bool& append) TITANIUM_NOEXCEPT override;
+				virtual bool write(const std::shared_ptr<Titanium::Filesystem::File>& data, const bool& append) TITANIUM_NOEXCEPT override;
+				virtual bool write(const std::vector<std::uint8_t>& data, const std::uint32_t& offset, const std::uint32_t& length, const bool& append) override;
+				virtual void writeAsync(const std::vector<std::uint8_t>& data, const std::uint32_t& offset, const std::uint32_t& length, const bool& append, const std::function<void(const ErrorResponse&, const uint32_t&)>&) override;
+				virtual std::vector<std::uint8_t> readBytes(const std::uint32_t& offset, const std::uint32_t& length) const override;
+				virtual void readBytesAsync(const std::uint32_t& offset, const std::uint32_t& length, const std::function<void(const ErrorResponse&, const std::vector<std::uint8_t>&)>&) const override;
+				virtual void readAllBytesAsync(const std::function<void(const ErrorResponse&, const std::vector<std::uint8_t>&)>&) const override;
+
+				virtual std::vector<std::uint8_t> getContent() const TITANIUM_NOEXCEPT override;
+
+				File(const JSContext&) TITANIUM_NOEXCEPT;
+
+				virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
+
+				virtual ~File() = default;
+				File(const File&) = default;
+				File& operator=(const File&) = default;
+#ifdef TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+				File(File&&) = default;
+				File& operator=(File&&) = default;
+#endif
+
+				static void JSExportInitialize();
+
+				/*!
+				  @property
+				  @abstract MmapThreshold
+				  @discussion Reads of at least this many bytes are served from mmap
+				  rather than pread.
+				*/
+				static const std::size_t MmapThreshold;
+
+			private:
+				// Reads up to length bytes starting at offset, clamped to the file size.
+				// Returns false and fills error on failure.
+				static bool readRange(const std::string& path, const std::uint64_t& offset, const std::uint64_t& length, std::vector<std::uint8_t>& buffer, ErrorResponse& error);
+
+				// Writes length bytes from data. Returns the number of bytes written,
+				// or -1 and fills error on failure.
+				static std::int64_t writeRange(const std::string& path, const std::uint8_t* data, const std::size_t& length, const bool& append, ErrorResponse& error);
+
+				static bool removeRecursive(const std::string& path);
+
+				// Walks the directory open at fd (which it takes ownership of) with readdir
+				// and fstatat, so no per-entry path strings or File objects are created.
+				static bool enumerateDirectory(const int& fd, const std::string& prefix, const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor);
+
+				bool getStat(struct stat& st) const TITANIUM_NOEXCEPT;
+				std::string parentPath() const TITANIUM_NOEXCEPT;
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+				std::string path__;
+#pragma warning(pop)
+			};
+		} // namespace POSIX
+	} // namespace Filesystem
+}  // namespace Titanium
+
+#endif  // _TITANIUM_FILESYSTEM_POSIX_FILE_HPP_
@@ -10,9 +10,12 @@
 #define _TITANIUM_GLOBALOBJECT_HPP_
 
 #include "Titanium/detail/TiBase.hpp"
+#include "Titanium/detail/TiTimerWheel.hpp"
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <atomic>
 
 namespace Titanium
@@ -158,6 +161,24 @@ namespace Titanium
 		*/
 		virtual void clearInterval(const unsigned& timerId) TITANIUM_NOEXCEPT final;
 
+		/*!
+		  @method
+
+		  @abstract setNativeTimeout( callback, delay ) : Number
+
+		  @discussion Native counterpart of setTimeout, for modules that
+		  need to come back to something later. It shares the timers of
+		  setTimeout and is cancelled with clearTimeout.
+
+		  @param callback Function to call once delay has passed.
+
+		  @param delay Time in milliseconds to wait before callback is
+		  called.
+
+		  @result Unique timer identifier.
+		*/
+		virtual unsigned setNativeTimeout(const std::function<void()>& callback, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT final;
+
 		GlobalObject(const JSContext&) TITANIUM_NOEXCEPT;
 		virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
 
@@ -240,12 +261,25 @@ namespace Titanium
 			  @method
 
 			  @abstract Return the interval that the Timer was constructed
-			  with.
+			  with or last given to set_interval.
 
-			  @result The interval that the Timer was constructed with.
+			  @result The interval the Timer calls the callback at.
 			*/
 			virtual std::chrono::milliseconds get_interval() const TITANIUM_NOEXCEPT final;
 
+			/*!
+			  @method
+
+			  @abstract Change the interval the callback is called at.
+			  Platforms override this to update their native timer and
+			  call the base version. Takes effect from the next Start.
+
+			  @param interval The new interval.
+
+			  @result void
+			*/
+			virtual void set_interval(const std::chrono::milliseconds& interval) TITANIUM_NOEXCEPT;
+
 		private:
 // Silence 4251 on Windows since private member variables do not
 // need to be exported from a DLL.
@@ -261,6 +295,7 @@ namespace Titanium
 #pragma warning(push)
 #pragma warning(disable : 4251)
 		static const std::string COMMONJS_SEPARATOR__;
+		static const std::string REQUIRE_MANIFEST__;
 		static std::uint32_t require_nested_count__;
 #pragma warning(pop)
 
@@ -304,13 +339,51 @@ namespace Titanium
 		*/
 		virtual std::shared_ptr<Timer> CreateTimer(Callback_t callback, const std::chrono::milliseconds& interval) const TITANIUM_NOEXCEPT;
 
+		/*!
+		  @method
+
+		  @abstract Granularity of setTimeout and setInterval. All of them
+		  share one Timer, armed for whenever the next of them is due and
+		  stopped while none are pending. Zero-delay timeouts skip the
+		  wheel and run on the next turn of the Timer.
+
+		  @result The tick interval, 1ms unless overridden.
+		*/
+		virtual std::chrono::milliseconds timerResolution() const TITANIUM_NOEXCEPT;
+
+		/*!
+		  @method
+
+		  @abstract The clock setTimeout and setInterval are measured
+		  against. Tests override it with a virtual clock.
+
+		  @result Milliseconds since an arbitrary, fixed epoch.
+		*/
+		virtual std::chrono::milliseconds timerNow() const TITANIUM_NOEXCEPT;
+
+		/*!
+		  @method
+
+		  @abstract Runs every setTimeout and setInterval callback that
+		  came due since the last call, as one batch, then arms the shared
+		  Timer for the next one. Called by the shared Timer.
+
+		  @result void
+		*/
+		void OnTimerTick() TITANIUM_NOEXCEPT;
+
 	private:
 
-		void RegisterCallback(JSObject&& function, const unsigned& timerId) TITANIUM_NOEXCEPT;
-		void UnregisterCallback(const unsigned& timerId) TITANIUM_NOEXCEPT;
-		void InvokeCallback(const unsigned& timerId) TITANIUM_NOEXCEPT;
-		void StartTimer(Callback_t&& callback, const unsigned& timerId, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT;
+		JSObject getRequireRunner(const JSContext& js_context);
+		std::string resolveModule(const JSObject& parent, const std::string& moduleId, const std::string& dirname) const TITANIUM_NOEXCEPT;
+		void loadRequireManifest(const JSObject& parent) TITANIUM_NOEXCEPT;
+		bool moduleExists(const std::string& path) const TITANIUM_NOEXCEPT;
+
+		unsigned StartTimer(JSObject&& function, const std::chrono::milliseconds& delay, const bool& repeating) TITANIUM_NOEXCEPT;
+		void ScheduleTimer(const unsigned& timerId, const std::chrono::milliseconds& delay, const bool& repeating) TITANIUM_NOEXCEPT;
+		void RunTimer(const unsigned& timerId, const bool& repeating, const JSObject& global_object) TITANIUM_NOEXCEPT;
 		void StopTimer(const unsigned& timerId) TITANIUM_NOEXCEPT;
+		void UpdateTimerTick() TITANIUM_NOEXCEPT;
 
 // Silence 4251 on Windows since private member variables do not
 // need to be exported from a DLL.
@@ -318,9 +391,26 @@ namespace Titanium
 #pragma warning(disable : 4251)
 		std::unordered_map<std::string, std::string> module_path_cache__;
 		std::unordered_map<std::string, JSValue> module_cache__;
+		std::shared_ptr<JSObject> require_runner__;
+		// Loaded from REQUIRE_MANIFEST__ on the first require(). While
+		// require_manifest_only__ is set, resolution looks only here.
+		std::unordered_set<std::string> require_manifest_files__;
+		std::unordered_map<std::string, std::string> require_manifest_packages__;
+		bool require_manifest_loaded__ { false };
+		bool require_manifest_only__ { false };
 		std::string currentDir__;
-		std::unordered_map<unsigned, std::shared_ptr<Timer>> timer_map__;
 		std::unordered_map<unsigned, JSObject> timer_callback_map__;
+		std::unordered_map<unsigned, std::function<void()>> native_timer_callback_map__;
+		// Created on the first setTimeout or setInterval
+		std::shared_ptr<detail::TiTimerWheel> timer_wheel__;
+		// Zero-delay timeouts, in the order they were set
+		std::vector<unsigned> timer_immediate__;
+		std::shared_ptr<Timer> timer_tick__;
+		bool timer_tick_running__ { false };
+		// When the running timer_tick__ fires next
+		std::chrono::milliseconds timer_tick_due__;
+		// Set while OnTimerTick runs callbacks, it rearms once they are done
+		bool timer_tick_firing__ { false };
 
 		static std::atomic<unsigned> timer_id_generator__;
 #pragma warning(pop)
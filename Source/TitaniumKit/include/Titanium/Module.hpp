@@ -10,6 +10,8 @@
 #define _TITANIUM_MODULE_HPP_
 
 #include "Titanium/detail/TiBase.hpp"
+#include <chrono>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -34,6 +36,48 @@ namespace Titanium
 	{
 	public:
 
+		/*!
+		  @typedef EventId
+		  @abstract Process-wide id of an event name, see InternEvent.
+		*/
+		using EventId = std::uint32_t;
+
+		/*!
+		  @enum EventCoalescingMode
+		  @abstract How fireEvent delivers an event that fires faster than
+		  JavaScript can handle it.
+		  @constant None Every event is dispatched right away.
+		  @constant LatestOnly Events are held until the next timer tick and
+		  a newer event replaces one that is still waiting.
+		  @constant Throttle At most one event per interval, the latest.
+		  @constant Batch Events are collected and delivered batch_size at a
+		  time, or whatever was collected once interval has passed.
+		*/
+		enum class EventCoalescingMode {
+			None,
+			LatestOnly,
+			Throttle,
+			Batch
+		};
+
+		struct EventCoalescingPolicy
+		{
+			EventCoalescingMode mode;
+			std::chrono::milliseconds interval;
+			std::size_t batch_size;
+		};
+
+		/*!
+		  @method
+
+		  @abstract ParseEventCoalescing( value, policy ) : bool
+
+		  @discussion Parses the coalesce option of addEventListener:
+		  "none", "latest-only", "throttle(ms)", "batch(n)" or
+		  "batch(n, ms)". Returns false if value is none of those.
+		*/
+		static bool ParseEventCoalescing(const std::string& value, EventCoalescingPolicy& policy) TITANIUM_NOEXCEPT;
+
 		/*!
 		  @property
 		  @abstract bubbleParent
@@ -103,6 +147,18 @@ namespace Titanium
 		*/
 		static void applyProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT;
 
+		/*!
+		  @method
+
+		  @abstract setProperties
+
+		  @discussion Sets the enumerable properties of props on this_object,
+		  the JavaScript object of this module, one at a time. applyProperties
+		  calls it; modules that can take several properties faster at once
+		  override it.
+		*/
+		virtual void setProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT;
+
 		/*!
 		@method
 
@@ -132,6 +188,51 @@ namespace Titanium
 		*/
 		virtual void fireEvent(const std::string& name) TITANIUM_NOEXCEPT final;
 		virtual void fireEvent(const std::string& name, const JSObject& event) TITANIUM_NOEXCEPT final;
+		virtual void fireEvent(const EventId& id, const JSObject& event) TITANIUM_NOEXCEPT final;
+
+		/*!
+		  @method
+
+		  @abstract InternEvent( name ) : EventId
+
+		  @discussion Returns the id of the named event, which stays the
+		  same for the life of the process. High-frequency events should
+		  keep it in a static and check for listeners before building the
+		  event object:
+
+		  static const auto touchmove = Module::InternEvent("touchmove");
+		  if (hasEventListener(touchmove)) {
+			  ...
+			  fireEvent(touchmove, event);
+		  }
+		*/
+		static EventId InternEvent(const std::string& name) TITANIUM_NOEXCEPT;
+
+		/*!
+		  @method
+
+		  @abstract setEventCoalescing( name, callback, policy ) : void
+
+		  @discussion Sets how the named event is delivered to one of its
+		  listeners; JavaScript sets it with
+		  addEventListener(name, callback, { coalesce: 'latest-only' }).
+		  Other listeners of the event keep getting every event as it is
+		  fired. A coalesced event carries two extra properties: dropped,
+		  the number of events replaced before being delivered, and merged,
+		  the number of events it stands for. Batches also carry the events
+		  themselves in events. The policy goes away with the listener.
+		*/
+		virtual void setEventCoalescing(const std::string& name, const JSObject& callback, const EventCoalescingPolicy& policy) TITANIUM_NOEXCEPT final;
+
+		/*!
+		  @method
+
+		  @abstract flushEvents() : void
+
+		  @discussion Delivers every coalesced event that is still waiting
+		  without waiting for the timer.
+		*/
+		virtual void flushEvents() TITANIUM_NOEXCEPT final;
 
 		Module(const JSContext&, const std::string& apiName = "Titanium.Proxy") TITANIUM_NOEXCEPT;
 		virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
@@ -165,6 +266,7 @@ namespace Titanium
 		TITANIUM_FUNCTION_DEF(fireEvent);
 
 		virtual bool hasEventListener(const std::string& event_name) TITANIUM_NOEXCEPT;
+		bool hasEventListener(const EventId& id) const TITANIUM_NOEXCEPT;
 
 		/*
 		* Stop firing all events, especially used when module is closed/hidden.
@@ -228,11 +330,52 @@ namespace Titanium
 		std::shared_ptr<Titanium::UI::Window> lifecycleContainerWindow__;
 		std::shared_ptr<Titanium::UI::TabGroup> lifecycleContainerTabGroup__;
 
-		std::unordered_map<std::string, std::vector<JSObject>> event_listener_map__;
+		struct EventCoalescing;
+
+		struct EventListener
+		{
+			JSObject callback;
+			JSObject this_object;
+			// Removed while its event was being dispatched, erased afterwards
+			bool removed;
+			// Set while this listener has its events coalesced
+			std::shared_ptr<EventCoalescing> coalescing;
+		};
+
+		struct EventListeners
+		{
+			EventId id;
+			std::string name;
+			// The event's "type" property, created once
+			JSValue type;
+			std::vector<EventListener> listeners;
+			// Listeners not marked removed
+			std::size_t count;
+			// Nesting depth of fireEvent for this event
+			std::uint32_t dispatching;
+			// Listeners not marked removed that have a coalescing policy
+			std::size_t coalesced;
+		};
+
+		// One entry per event name ever listened to, entries are never erased
+		std::vector<EventListeners> event_listeners__;
+		// Bit (id % 64) is set while some event with that bit has listeners
+		std::uint64_t event_listener_mask__ { 0 };
+		// Reused by fireEvent so dispatching does not allocate
+		std::vector<JSValue> event_arguments__;
+		std::uint32_t event_dispatch_depth__ { 0 };
 		bool enableEvents__ { true };
 #pragma warning(pop)
 	private:
-		static unsigned eventListenerIndex(const std::vector<JSObject>& event_listener_list, const std::string& name, JSObject& callback) TITANIUM_NOEXCEPT;
+		std::size_t findEventListeners(const std::string& name) const TITANIUM_NOEXCEPT;
+		std::size_t findEventListeners(const EventId& id) const TITANIUM_NOEXCEPT;
+		std::size_t ensureEventListeners(const std::string& name) TITANIUM_NOEXCEPT;
+		std::vector<std::shared_ptr<EventCoalescing>> getEventCoalescing(const std::size_t& index) const TITANIUM_NOEXCEPT;
+		void coalesceEvent(const std::size_t& index, const std::shared_ptr<EventCoalescing>& coalescing, const JSObject& event, const std::uint32_t& dropped) TITANIUM_NOEXCEPT;
+		void flushCoalescedEvent(const std::size_t& index, const std::shared_ptr<EventCoalescing>& coalescing) TITANIUM_NOEXCEPT;
+		// Calls the listeners coalesced by coalescing, or every other one if nullptr
+		void dispatchEvent(const std::size_t& index, const JSObject& event, const EventCoalescing* coalescing) TITANIUM_NOEXCEPT;
+		void updateEventListenerMask() TITANIUM_NOEXCEPT;
 	};
 }  // namespace Titanium
 
@@ -0,0 +1,432 @@
+/**
+ * TitaniumKit ConnectionPool
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_NETWORK_CONNECTIONPOOL_HPP_
+#define _TITANIUM_NETWORK_CONNECTIONPOOL_HPP_
+
+#include "Titanium/detail/TiBase.hpp"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace Network
+	{
+		using namespace HAL;
+
+		/*!
+		  @struct
+		  @discussion Identifies the server a pooled connection talks to.
+		*/
+		struct ConnectionKey
+		{
+			std::string scheme;
+			std::string host;
+			std::uint16_t port { 0 };
+		};
+
+		TITANIUMKIT_EXPORT bool operator<(const ConnectionKey& lhs, const ConnectionKey& rhs);
+
+		/*!
+		  @function
+		  @discussion Builds the key for an absolute URL. Scheme and host are lower-cased
+		  and a missing port is filled in from the scheme (80 for http, 443 for https).
+		*/
+		TITANIUMKIT_EXPORT ConnectionKey ConnectionKey_from_url(const std::string& url);
+
+		/*!
+		  @struct
+		  @discussion Counters exposed by a connection pool.
+
+		  open - connections currently owned by the pool, leased or idle.
+		  idle - connections waiting to be reused.
+		  created - connections opened since the pool was created.
+		  reused - leases that were served by an idle connection.
+		  evicted - idle connections closed because they were idle for too long.
+		  coalesced - requests that shared the response of an identical request in flight.
+		*/
+		struct ConnectionPoolStats
+		{
+			std::size_t open { 0 };
+			std::size_t idle { 0 };
+			std::size_t created { 0 };
+			std::size_t reused { 0 };
+			std::size_t evicted { 0 };
+			std::size_t coalesced { 0 };
+		};
+
+		TITANIUMKIT_EXPORT JSObject ConnectionPoolStats_to_js(const JSContext& js_context, const ConnectionPoolStats& stats);
+
+		/*!
+		  @typedef
+		  @discussion Identifies a caller queued in a ConnectionPool or a
+		  RequestCoalescer so that it can withdraw before its callback runs.
+		  0 never identifies a queued caller.
+		*/
+		using WaitTicket = std::uint64_t;
+
+		/*!
+		  @class
+		  @abstract ConnectionPool
+
+		  @discussion A process-wide pool of connections keyed by scheme, host and
+		  port. At most maxPerHost connections are handed out per key; further
+		  requests wait until one is released. Released connections stay idle for
+		  idleTimeout before they are evicted.
+
+		  Connection is whatever the platform uses to talk to a server; the pool
+		  only holds shared pointers to it and closes it by dropping them.
+		*/
+		template<typename Connection>
+		class ConnectionPool final
+		{
+		public:
+			using ConnectionPtr = std::shared_ptr<Connection>;
+			using Factory = std::function<ConnectionPtr(const ConnectionKey&)>;
+			using Callback = std::function<void(const ConnectionPtr&)>;
+
+			ConnectionPool(const std::size_t& maxPerHost, const std::chrono::milliseconds& idleTimeout)
+				: maxPerHost__(maxPerHost)
+				, idleTimeout__(idleTimeout)
+			{
+			}
+
+			ConnectionPool(const ConnectionPool&) = delete;
+			ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+			/*!
+			  @method
+			  @abstract Acquire
+			  @discussion Returns an idle connection for key, or a new one from factory if
+			  the key is below maxPerHost. Otherwise returns nullptr, sets ticket and calls
+			  onAvailable, possibly on another thread, once a connection has been released
+			  for key. The factory may return nullptr when it fails to connect, in which
+			  case onAvailable gets nullptr too. Pass ticket to Cancel to stop waiting.
+			*/
+			ConnectionPtr Acquire(const ConnectionKey& key, const Factory& factory, const Callback& onAvailable, WaitTicket& ticket)
+			{
+				std::unique_lock<std::mutex> lock(mutex__);
+				evictIdle(std::chrono::steady_clock::now());
+				ticket = 0;
+
+				// leased counts every connection handed out for key, whether it was
+				// created or reused, until it comes back through Release
+				auto& host = hosts__[key];
+				if (!host.idle.empty()) {
+					auto connection = host.idle.back().connection;
+					host.idle.pop_back();
+					host.leased++;
+					stats__.idle--;
+					stats__.reused++;
+					return connection;
+				}
+				if (host.leased >= maxPerHost__) {
+					ticket = ++lastTicket__;
+					host.waiting.push_back({ ticket, factory, onAvailable });
+					return nullptr;
+				}
+
+				// Don't hold the lock while connecting
+				host.leased++;
+				lock.unlock();
+				auto connection = factory(key);
+				lock.lock();
+				if (connection) {
+					stats__.open++;
+					stats__.created++;
+				} else {
+					hosts__[key].leased--;
+				}
+				return connection;
+			}
+
+			/*!
+			  @method
+			  @abstract Release
+			  @discussion Returns a leased connection. Pass reusable = false when the
+			  connection is broken or the server asked to close it; it is then dropped.
+			*/
+			void Release(const ConnectionKey& key, const ConnectionPtr& connection, const bool& reusable)
+			{
+				std::unique_lock<std::mutex> lock(mutex__);
+				auto& host = hosts__[key];
+				if (!reusable || !connection) {
+					if (connection) {
+						stats__.open--;
+					}
+					if (host.waiting.empty()) {
+						host.leased--;
+						return;
+					}
+					// The slot goes to the next waiter, which needs a fresh connection
+					auto waiter = host.waiting.front();
+					host.waiting.pop_front();
+					lock.unlock();
+					auto replacement = waiter.factory(key);
+					lock.lock();
+					if (replacement) {
+						stats__.open++;
+						stats__.created++;
+					} else {
+						hosts__[key].leased--;
+					}
+					lock.unlock();
+					waiter.callback(replacement);
+					return;
+				}
+
+				if (!host.waiting.empty()) {
+					auto waiter = host.waiting.front();
+					host.waiting.pop_front();
+					stats__.reused++;
+					lock.unlock();
+					waiter.callback(connection);
+					return;
+				}
+
+				host.leased--;
+				host.idle.push_back({ connection, std::chrono::steady_clock::now() });
+				stats__.idle++;
+			}
+
+			/*!
+			  @method
+			  @abstract Cancel
+			  @discussion Withdraws the caller that Acquire queued under ticket. Returns
+			  false when it is no longer queued, because a connection has already been
+			  handed to its callback; the callback then still runs and must Release the
+			  connection it gets if the caller is gone.
+			*/
+			bool Cancel(const ConnectionKey& key, const WaitTicket& ticket)
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				const auto host = hosts__.find(key);
+				if (ticket == 0 || host == hosts__.end()) {
+					return false;
+				}
+				auto& waiting = host->second.waiting;
+				const auto waiter = std::find_if(waiting.begin(), waiting.end(), [&ticket](const Waiter& waiter) {
+					return waiter.ticket == ticket;
+				});
+				if (waiter == waiting.end()) {
+					return false;
+				}
+				waiting.erase(waiter);
+				return true;
+			}
+
+			/*!
+			  @method
+			  @abstract EvictIdle
+			  @discussion Closes every idle connection that has been idle for longer than
+			  idleTimeout. Returns the number of connections closed. This also happens
+			  on every Acquire.
+			*/
+			std::size_t EvictIdle()
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				return evictIdle(std::chrono::steady_clock::now());
+			}
+
+			/*!
+			  @method
+			  @abstract Clear
+			  @discussion Closes all idle connections.
+			*/
+			void Clear()
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				for (auto& entry : hosts__) {
+					stats__.open -= entry.second.idle.size();
+					stats__.idle -= entry.second.idle.size();
+					entry.second.idle.clear();
+				}
+			}
+
+			ConnectionPoolStats get_stats() const
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				return stats__;
+			}
+
+			std::size_t get_maxPerHost() const
+			{
+				return maxPerHost__;
+			}
+
+			std::chrono::milliseconds get_idleTimeout() const
+			{
+				return idleTimeout__;
+			}
+
+		private:
+			struct IdleConnection
+			{
+				ConnectionPtr connection;
+				std::chrono::steady_clock::time_point since;
+			};
+
+			struct Waiter
+			{
+				WaitTicket ticket;
+				Factory factory;
+				Callback callback;
+			};
+
+			struct Host
+			{
+				std::size_t leased { 0 };
+				std::vector<IdleConnection> idle;
+				std::deque<Waiter> waiting;
+			};
+
+			std::size_t evictIdle(const std::chrono::steady_clock::time_point& now)
+			{
+				std::size_t count = 0;
+				for (auto& entry : hosts__) {
+					auto& idle = entry.second.idle;
+					const auto expired = std::remove_if(idle.begin(), idle.end(), [this, &now](const IdleConnection& connection) {
+						return now - connection.since >= idleTimeout__;
+					});
+					count += std::distance(expired, idle.end());
+					idle.erase(expired, idle.end());
+				}
+				stats__.open -= count;
+				stats__.idle -= count;
+				stats__.evicted += count;
+				return count;
+			}
+
+			const std::size_t maxPerHost__;
+			const std::chrono::milliseconds idleTimeout__;
+			mutable std::mutex mutex__;
+			std::map<ConnectionKey, Host> hosts__;
+			ConnectionPoolStats stats__;
+			WaitTicket lastTicket__ { 0 };
+		};
+
+		/*!
+		  @class
+		  @abstract RequestCoalescer
+
+		  @discussion Lets identical requests that are in flight at the same time
+		  share one response. The first caller to Join a key performs the request
+		  and calls Complete; everybody who joined the key in the meantime gets
+		  the same response.
+		*/
+		template<typename Response>
+		class RequestCoalescer final
+		{
+		public:
+			using Callback = std::function<void(const Response&)>;
+
+			RequestCoalescer() = default;
+			RequestCoalescer(const RequestCoalescer&) = delete;
+			RequestCoalescer& operator=(const RequestCoalescer&) = delete;
+
+			/*!
+			  @method
+			  @abstract Join
+			  @discussion Returns true when the caller is the first one for key and must
+			  perform the request itself; callback is not used in that case. Otherwise
+			  the caller piggybacks on the request already in flight, returns false, sets
+			  ticket and gets the response through callback. Pass ticket to Leave to stop
+			  waiting for it.
+			*/
+			bool Join(const std::string& key, const Callback& callback, WaitTicket& ticket)
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				ticket = 0;
+				const auto it = inflight__.find(key);
+				if (it == inflight__.end()) {
+					inflight__.emplace(key, std::vector<Waiter>());
+					return true;
+				}
+				ticket = ++lastTicket__;
+				it->second.push_back({ ticket, callback });
+				coalesced__++;
+				return false;
+			}
+
+			/*!
+			  @method
+			  @abstract Leave
+			  @discussion Withdraws the caller that Join queued under ticket. Returns
+			  false when the response has already been handed to its callback.
+			*/
+			bool Leave(const std::string& key, const WaitTicket& ticket)
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				const auto it = inflight__.find(key);
+				if (ticket == 0 || it == inflight__.end()) {
+					return false;
+				}
+				auto& waiters = it->second;
+				const auto waiter = std::find_if(waiters.begin(), waiters.end(), [&ticket](const Waiter& waiter) {
+					return waiter.ticket == ticket;
+				});
+				if (waiter == waiters.end()) {
+					return false;
+				}
+				waiters.erase(waiter);
+				return true;
+			}
+
+			/*!
+			  @method
+			  @abstract Complete
+			  @discussion Called by the first caller once its request is done. Hands
+			  response to everybody else that joined key and forgets the key, so the
+			  next Join starts a new request.
+			*/
+			void Complete(const std::string& key, const Response& response)
+			{
+				std::vector<Waiter> waiters;
+				{
+					std::lock_guard<std::mutex> lock(mutex__);
+					const auto it = inflight__.find(key);
+					if (it == inflight__.end()) {
+						return;
+					}
+					waiters.swap(it->second);
+					inflight__.erase(it);
+				}
+				for (const auto& waiter : waiters) {
+					waiter.callback(response);
+				}
+			}
+
+			std::size_t get_coalesced() const
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				return coalesced__;
+			}
+
+		private:
+			struct Waiter
+			{
+				WaitTicket ticket;
+				Callback callback;
+			};
+
+			mutable std::mutex mutex__;
+			std::unordered_map<std::string, std::vector<Waiter>> inflight__;
+			std::size_t coalesced__ { 0 };
+			WaitTicket lastTicket__ { 0 };
+		};
+	} // namespace Network
+} // namespace Titanium
+
+#endif // _TITANIUM_NETWORK_CONNECTIONPOOL_HPP_
@@ -128,7 +128,9 @@ namespace Titanium
 			/*!
 			  @property
 			  @abstract responseData
-			  @discussion Response data as a `Blob` object.
+			  @discussion Response data as a `Blob` object. The first access hands the
+			  response buffer over to the Blob instead of copying it; later accesses
+			  return the same Blob.
 			*/
 			TITANIUM_PROPERTY_IMPL_READONLY_DEF(std::vector<std::uint8_t>, responseData);
 
@@ -160,6 +162,14 @@ namespace Titanium
 			*/
 			TITANIUM_PROPERTY_IMPL_DEF(std::chrono::milliseconds, timeout);
 
+			/*!
+			  @property
+			  @abstract progressInterval
+			  @discussion Minimum time in milliseconds between two ondatastream events while
+			  a response is being received. Set to 0 to get an event for every chunk read.
+			*/
+			TITANIUM_PROPERTY_IMPL_DEF(std::chrono::milliseconds, progressInterval);
+
 			/*!
 			  @property
 			  @abstract username
@@ -195,6 +205,15 @@ namespace Titanium
 			*/
 			TITANIUM_PROPERTY_IMPL_DEF(bool, cache);
 
+			/*!
+			  @property
+			  @abstract coalesce
+			  @discussion When true, a GET without a body that is identical to one already
+			  in flight (same URL and headers) shares its response instead of going
+			  to the network again.
+			*/
+			TITANIUM_PROPERTY_IMPL_DEF(bool, coalesce);
+
 			// ----------------------------------------- Methods
 
 			/*!
@@ -246,6 +265,21 @@ namespace Titanium
 			*/
 			virtual void send(const std::string& postDataStr) TITANIUM_NOEXCEPT;
 
+			/*!
+			  @method
+			  @abstract send
+			  @discussion Do an HTTP POST or PUT request with the contents of a Blob as the body.
+			*/
+			virtual void send(const std::shared_ptr<Titanium::Blob>& blob) TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract send
+			  @discussion Do an HTTP POST or PUT request with the contents of a File as the body.
+			  Implementations should stream the file instead of reading it into memory.
+			*/
+			virtual void send(const std::shared_ptr<Titanium::Filesystem::File>& file) TITANIUM_NOEXCEPT;
+
 			/*!
 			  @method
 			  @abstract setRequestHeader
@@ -253,6 +287,20 @@ namespace Titanium
 			*/
 			virtual void setRequestHeader(const std::string& key, const std::string& value) TITANIUM_NOEXCEPT;
 
+			/*!
+			  @property
+			  @abstract MinReadSize
+			  @discussion Size of the first read of a response body.
+			*/
+			static const std::size_t MinReadSize;
+
+			/*!
+			  @property
+			  @abstract MaxReadSize
+			  @discussion Upper bound for the read size, which doubles every time a read fills it.
+			*/
+			static const std::size_t MaxReadSize;
+
 			HTTPClient(const JSContext&) TITANIUM_NOEXCEPT;
 
 			virtual ~HTTPClient() = default;
@@ -268,6 +316,7 @@ namespace Titanium
 			TITANIUM_PROPERTY_DEF(autoEncodeUrl);
 			TITANIUM_PROPERTY_DEF(autoRedirect);
 			TITANIUM_PROPERTY_DEF(cache);
+			TITANIUM_PROPERTY_DEF(coalesce);
 			TITANIUM_PROPERTY_DEF(domain);
 			TITANIUM_PROPERTY_DEF(enableKeepAlive);
 			TITANIUM_PROPERTY_DEF(file);
@@ -277,6 +326,7 @@ namespace Titanium
 			TITANIUM_PROPERTY_DEF(onreadystatechange);
 			TITANIUM_PROPERTY_DEF(onsendstream);
 			TITANIUM_PROPERTY_DEF(password);
+			TITANIUM_PROPERTY_DEF(progressInterval);
 			TITANIUM_PROPERTY_DEF(securityManager);
 			TITANIUM_PROPERTY_DEF(timeout);
 			TITANIUM_PROPERTY_DEF(tlsVersion);
@@ -308,6 +358,7 @@ namespace Titanium
 			TITANIUM_FUNCTION_DEF(getAutoEncodeUrl);
 			TITANIUM_FUNCTION_DEF(getAutoRedirect);
 			TITANIUM_FUNCTION_DEF(getCache);
+			TITANIUM_FUNCTION_DEF(getCoalesce);
 			TITANIUM_FUNCTION_DEF(getConnected);
 			TITANIUM_FUNCTION_DEF(getConnectionType);
 			TITANIUM_FUNCTION_DEF(getDomain);
@@ -320,6 +371,7 @@ namespace Titanium
 			TITANIUM_FUNCTION_DEF(getOnreadystatechange);
 			TITANIUM_FUNCTION_DEF(getOnsendstream);
 			TITANIUM_FUNCTION_DEF(getPassword);
+			TITANIUM_FUNCTION_DEF(getProgressInterval);
 			TITANIUM_FUNCTION_DEF(getReadyState);
 			TITANIUM_FUNCTION_DEF(getResponseData);
 			TITANIUM_FUNCTION_DEF(getResponseHeader);
@@ -338,6 +390,7 @@ namespace Titanium
 			TITANIUM_FUNCTION_DEF(setAutoEncodeUrl);
 			TITANIUM_FUNCTION_DEF(setAutoRedirect);
 			TITANIUM_FUNCTION_DEF(setCache);
+			TITANIUM_FUNCTION_DEF(setCoalesce);
 			TITANIUM_FUNCTION_DEF(setDomain);
 			TITANIUM_FUNCTION_DEF(setEnableKeepAlive);
 			TITANIUM_FUNCTION_DEF(setFile);
@@ -347,6 +400,7 @@ namespace Titanium
 			TITANIUM_FUNCTION_DEF(setOnreadystatechange);
 			TITANIUM_FUNCTION_DEF(setOnsendstream);
 			TITANIUM_FUNCTION_DEF(setPassword);
+			TITANIUM_FUNCTION_DEF(setProgressInterval);
 			TITANIUM_FUNCTION_DEF(setRequestHeader);
 			TITANIUM_FUNCTION_DEF(setSecurityManager);
 			TITANIUM_FUNCTION_DEF(setTimeout);
@@ -381,6 +435,13 @@ namespace Titanium
 			JSValue onreadystatechange__;
 			JSValue onsendstream__;
 			std::chrono::milliseconds timeout__;
+			std::chrono::milliseconds progressInterval__;
+
+			// Receive state of the current response, see beginResponse
+			std::int64_t expectedLength__ { -1 };
+			std::uint64_t receivedLength__ { 0 };
+			std::size_t readSize__ { 0 };
+			std::chrono::steady_clock::time_point lastProgress__;
 
 			std::map<uint32_t, std::string> httpStatusPhrase__;
 
@@ -401,7 +462,10 @@ namespace Titanium
 			std::string location__;
 			std::string password__;
 			RequestState readyState__;
-			std::vector<std::uint8_t> responseData__;
+			// responseData__ - body of the current response while it is being received.
+			// Moved into responseBlob__ the first time responseData is read from JS.
+			mutable std::vector<std::uint8_t> responseData__;
+			mutable JSValue responseBlob__;
 			JSValue securityManager__;
 			std::uint32_t status__;
 			std::string statusText__;
@@ -410,9 +474,59 @@ namespace Titanium
 			bool withCredentials__;
 			TLS_VERSION tlsVersion__;
 			bool cache__;
+			bool coalesce__ { false };
 #pragma warning(pop)
 
 			void setHTTPStatusPhrase();
+
+			/*!
+			  @method
+			  @abstract getResponseBytes
+			  @discussion Returns the body of the current response without copying it,
+			  whether it is still held by the client or has been handed to the
+			  responseData Blob.
+			*/
+			const std::vector<std::uint8_t>& getResponseBytes() const TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract resetResponse
+			  @discussion Drops the body of the previous response. Implementations
+			  should call this before sending a new request.
+			*/
+			void resetResponse() TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract beginResponse
+			  @discussion Prepares for receiving a response body. A non-negative contentLength
+			  is used to reserve the response buffer up front; pass -1 when it is unknown
+			  (chunked encoding).
+			*/
+			void beginResponse(const std::int64_t& contentLength) TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract nextReadSize
+			  @discussion Number of bytes the next read of the response body should ask for.
+			*/
+			std::size_t nextReadSize() const TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract appendResponseData
+			  @discussion Appends a chunk of the response body to responseData and reports it
+			  through reportDataReceived.
+			*/
+			void appendResponseData(const std::uint8_t* data, const std::size_t& length) TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract reportDataReceived
+			  @discussion Accounts for a chunk of the response body, grows the read size when
+			  the chunk filled it and fires ondatastream at most once per progressInterval.
+			*/
+			void reportDataReceived(const std::size_t& length) TITANIUM_NOEXCEPT;
 		};
 	} // namespace Network
 } // namespace Titanium
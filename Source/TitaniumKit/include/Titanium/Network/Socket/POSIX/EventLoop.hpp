@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_NETWORK_SOCKET_POSIX_EVENTLOOP_HPP_
+#define _TITANIUM_NETWORK_SOCKET_POSIX_EVENTLOOP_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace Network
+	{
+		namespace Socket
+		{
+			namespace POSIX
+			{
+				/*!
+				  @class
+
+				  @abstract A single epoll I/O thread shared by all POSIX sockets.
+
+				  @discussion File descriptors are registered with a handler that runs
+				  on the I/O thread whenever epoll reports them ready. Anything that
+				  has to reach JavaScript is queued with Deliver; queued callbacks are
+				  handed to the dispatcher as one batch per loop iteration, so a burst
+				  of completions costs one hop to the JS thread instead of one each.
+
+				  Callbacks never run on the I/O thread. Without a dispatcher they stay
+				  queued until the JS thread calls RunPendingCallbacks itself.
+				*/
+				class TITANIUMKIT_EXPORT EventLoop final
+				{
+				public:
+					using Handler = std::function<void(const std::uint32_t& events)>;
+					using Dispatcher = std::function<void(const std::function<void()>& batch)>;
+
+					EventLoop();
+					~EventLoop();
+
+					EventLoop(const EventLoop&) = delete;
+					EventLoop& operator=(const EventLoop&) = delete;
+
+#ifdef TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+					EventLoop(EventLoop&&) = delete;
+					EventLoop& operator=(EventLoop&&) = delete;
+#endif
+
+					/*!
+					  @method
+					  @abstract Add
+					  @discussion Starts watching fd for events (EPOLLIN, EPOLLOUT, ...).
+					  Returns false if epoll refused the descriptor.
+					*/
+					bool Add(const int& fd, const std::uint32_t& events, Handler handler);
+
+					/*!
+					  @method
+					  @abstract Modify
+					  @discussion Changes the events fd is watched for.
+					*/
+					bool Modify(const int& fd, const std::uint32_t& events);
+
+					/*!
+					  @method
+					  @abstract Remove
+					  @discussion Stops watching fd. Call this before closing it.
+					*/
+					void Remove(const int& fd);
+
+					/*!
+					  @method
+					  @abstract Post
+					  @discussion Runs task on the I/O thread.
+					*/
+					void Post(std::function<void()> task);
+
+					/*!
+					  @method
+					  @abstract Deliver
+					  @discussion Queues callback for the JS thread. It goes out with the
+					  next batch.
+					*/
+					void Deliver(std::function<void()> callback);
+
+					/*!
+					  @method
+					  @abstract RunPendingCallbacks
+					  @discussion Runs every callback queued with Deliver and returns how
+					  many ran. Batches handed to the dispatcher call this; without a
+					  dispatcher the JS thread has to call it to pump the loop.
+					*/
+					std::size_t RunPendingCallbacks();
+
+					/*!
+					  @method
+					  @abstract set_dispatcher
+					  @discussion Sets how batches reach the JS thread, e.g. by posting
+					  them to the UI dispatcher of the application. Callbacks queued
+					  before the dispatcher was set go out with the next batch.
+					*/
+					void set_dispatcher(const Dispatcher& dispatcher);
+
+					bool IsLoopThread() const;
+
+					// Number of batches handed out and callbacks delivered so far
+					std::size_t get_batches() const;
+					std::size_t get_delivered() const;
+
+					/*!
+					  @method
+					  @abstract Default
+					  @discussion The loop shared by sockets that don't get one of their own.
+					  The host application sets its dispatcher or pumps it from the JS thread.
+					*/
+					static EventLoop& Default();
+
+				private:
+					void Run();
+					void Wake();
+					void Flush();
+
+					int epoll_fd__ { -1 };
+					int wake_fd__ { -1 };
+					std::thread thread__;
+					std::atomic<bool> stopping__ { false };
+
+					std::mutex mutex__;
+					std::unordered_map<int, std::shared_ptr<Handler>> handlers__;
+					std::vector<std::function<void()>> tasks__;
+
+					std::mutex callbacks_mutex__;
+					std::vector<std::function<void()>> callbacks__;
+					bool batch_scheduled__ { false };
+					Dispatcher dispatcher__;
+					std::atomic<std::size_t> batches__ { 0 };
+					std::atomic<std::size_t> delivered__ { 0 };
+				};
+			} // namespace POSIX
+		} // namespace Socket
+	} // namespace Network
+} // namespace Titanium
+
+#endif // _TITANIUM_NETWORK_SOCKET_POSIX_EVENTLOOP_HPP_
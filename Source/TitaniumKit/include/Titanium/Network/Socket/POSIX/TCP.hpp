@@ -0,0 +1,98 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_NETWORK_SOCKET_POSIX_TCP_HPP_
+#define _TITANIUM_NETWORK_SOCKET_POSIX_TCP_HPP_
+
+#include "Titanium/Network/Socket/TCP.hpp"
+#include "Titanium/Network/Socket/POSIX/EventLoop.hpp"
+
+namespace Titanium
+{
+	namespace Network
+	{
+		namespace Socket
+		{
+			namespace POSIX
+			{
+				using namespace HAL;
+
+				/*!
+				  @class TCP
+				  @ingroup Titanium.Network.Socket.TCP
+
+				  @discussion This is the Titanium.Network.Socket.TCP implementation for
+				  POSIX platforms. Sockets are non-blocking and driven by one shared
+				  epoll thread (EventLoop). readAsync/writeAsync queue their Ti.Buffer
+				  ranges and the loop moves data with a single readv/writev across all
+				  queued requests. The loop works on its own copy of each range, so
+				  buffers may be changed while a request on them is pending.
+
+				  connected, accepted, error and the *Async callbacks are delivered in
+				  batches through the loop's dispatcher.
+				*/
+				class TITANIUMKIT_EXPORT TCP final : public Titanium::Network::Socket::TCP, public JSExport<TCP>
+				{
+				public:
+					virtual void close() TITANIUM_NOEXCEPT override;
+					virtual void connect() TITANIUM_NOEXCEPT override;
+					virtual void listen() TITANIUM_NOEXCEPT override;
+					virtual void accept(const AcceptDict& options) TITANIUM_NOEXCEPT override;
+
+					virtual std::int32_t read(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length) override;
+					virtual void readAsync(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length, const std::function<void(const ErrorResponse&, const std::int32_t&)>& callback) override;
+					virtual std::uint32_t write(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length) override;
+					virtual void writeAsync(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length, const std::function<void(const ErrorResponse&, const std::int32_t&)>& callback) override;
+
+					/*!
+					  @method
+					  @abstract construct
+					  @discussion Wraps a socket that is already connected, e.g. one
+					  returned by accept. Takes ownership of fd.
+					*/
+					void construct(const int& fd);
+
+					/*!
+					  @method
+					  @abstract set_eventLoop
+					  @discussion Loop to drive this socket, EventLoop::Default() unless
+					  set before connect or listen.
+					*/
+					void set_eventLoop(EventLoop& loop) TITANIUM_NOEXCEPT;
+					EventLoop& get_eventLoop() const TITANIUM_NOEXCEPT;
+
+					TCP(const JSContext&) TITANIUM_NOEXCEPT;
+
+					virtual ~TCP();
+					TCP(const TCP&) = default;
+					TCP& operator=(const TCP&) = default;
+#ifdef TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+					TCP(TCP&&) = default;
+					TCP& operator=(TCP&&) = default;
+#endif
+
+					static void JSExportInitialize();
+
+					// Called on the JS thread when the loop delivers socket events
+					void fireError(const std::int32_t& code, const std::string& message);
+					void fireConnected();
+					void fireAccepted(const int& fd);
+
+					struct Channel;
+
+				private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+					EventLoop* loop__;
+					std::shared_ptr<Channel> channel__;
+#pragma warning(pop)
+				};
+			} // namespace POSIX
+		} // namespace Socket
+	} // namespace Network
+} // namespace Titanium
+
+#endif // _TITANIUM_NETWORK_SOCKET_POSIX_TCP_HPP_
@@ -61,6 +61,27 @@ namespace Titanium
 				*/
 				TITANIUM_PROPERTY_IMPL_DEF(std::chrono::milliseconds, timeout);
 
+				/*!
+				  @property
+				  @abstract noDelay
+				  @discussion Disables Nagle's algorithm (TCP_NODELAY) so small writes go out immediately. Applied on `connect`.
+				*/
+				TITANIUM_PROPERTY_IMPL_DEF(bool, noDelay);
+
+				/*!
+				  @property
+				  @abstract sendBufferSize
+				  @discussion Size of the socket send buffer in bytes, 0 for the system default. Applied on `connect` and `listen`.
+				*/
+				TITANIUM_PROPERTY_IMPL_DEF(std::uint32_t, sendBufferSize);
+
+				/*!
+				  @property
+				  @abstract receiveBufferSize
+				  @discussion Size of the socket receive buffer in bytes, 0 for the system default. Applied on `connect` and `listen`.
+				*/
+				TITANIUM_PROPERTY_IMPL_DEF(std::uint32_t, receiveBufferSize);
+
 				/*!
 				  @property
 				  @abstract state
@@ -112,6 +133,9 @@ namespace Titanium
 				TITANIUM_PROPERTY_DEF(port);
 				TITANIUM_PROPERTY_DEF(listenQueueSize);
 				TITANIUM_PROPERTY_DEF(timeout);
+				TITANIUM_PROPERTY_DEF(noDelay);
+				TITANIUM_PROPERTY_DEF(sendBufferSize);
+				TITANIUM_PROPERTY_DEF(receiveBufferSize);
 				TITANIUM_PROPERTY_DEF(connected);
 				TITANIUM_PROPERTY_DEF(error);
 				TITANIUM_PROPERTY_DEF(accepted);
@@ -129,6 +153,12 @@ namespace Titanium
 				TITANIUM_FUNCTION_DEF(setListenQueueSize);
 				TITANIUM_FUNCTION_DEF(getTimeout);
 				TITANIUM_FUNCTION_DEF(setTimeout);
+				TITANIUM_FUNCTION_DEF(getNoDelay);
+				TITANIUM_FUNCTION_DEF(setNoDelay);
+				TITANIUM_FUNCTION_DEF(getSendBufferSize);
+				TITANIUM_FUNCTION_DEF(setSendBufferSize);
+				TITANIUM_FUNCTION_DEF(getReceiveBufferSize);
+				TITANIUM_FUNCTION_DEF(setReceiveBufferSize);
 				TITANIUM_FUNCTION_DEF(getConnected);
 				TITANIUM_FUNCTION_DEF(setConnected);
 				TITANIUM_FUNCTION_DEF(getError);
@@ -144,6 +174,9 @@ namespace Titanium
 				std::uint32_t port__;
 				std::uint32_t listenQueueSize__;
 				std::chrono::milliseconds timeout__;
+				bool noDelay__ { false };
+				std::uint32_t sendBufferSize__ { 0 };
+				std::uint32_t receiveBufferSize__ { 0 };
 				JSValue connected__;
 				JSValue error__;
 				JSValue accepted__;
@@ -9,6 +9,7 @@
 
 #include "Titanium/Module.hpp"
 #include "Titanium/Network/Constants.hpp"
+#include "Titanium/Network/ConnectionPool.hpp"
 #include "Titanium/Network/Cookie.hpp"
 #include "Titanium/Network/HTTPClient.hpp"
 #include "Titanium/Network/Socket.hpp"
@@ -162,6 +163,14 @@ namespace Titanium
 		*/
 		virtual void unregisterForPushNotifications() TITANIUM_NOEXCEPT;
 
+		/*!
+		  @method
+		  @abstract getConnectionPoolStats
+		  @discussion Returns the counters of the process-wide HTTP connection pool.
+		  Platforms without a pool report zeroes.
+		*/
+		virtual Network::ConnectionPoolStats getConnectionPoolStats() TITANIUM_NOEXCEPT;
+
 		NetworkModule& HTTPClientClass(const JSClass&) TITANIUM_NOEXCEPT;
 		NetworkModule& CookieClass(const JSClass&) TITANIUM_NOEXCEPT;
 		
@@ -203,6 +212,7 @@ namespace Titanium
 		TITANIUM_FUNCTION_DEF(removeSystemCookie);
 		TITANIUM_FUNCTION_DEF(registerForPushNotifications);
 		TITANIUM_FUNCTION_DEF(unregisterForPushNotifications);
+		TITANIUM_FUNCTION_DEF(getConnectionPoolStats);
 		TITANIUM_FUNCTION_DEF(createCookie);
 		TITANIUM_FUNCTION_DEF(createHTTPClient);
 		TITANIUM_FUNCTION_DEF(getAllHTTPCookies);
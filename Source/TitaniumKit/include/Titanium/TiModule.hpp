@@ -8,6 +8,9 @@
 #define _TITANIUM_TIMODULE_HPP_
 
 #include "Titanium/Module.hpp"
+#include <chrono>
+#include <functional>
+#include <unordered_map>
 
 namespace Titanium
 {
@@ -27,6 +30,26 @@ namespace Titanium
 
 		virtual void setUserAgent(const std::string&) TITANIUM_NOEXCEPT final;
 
+		/*!
+		  @struct
+		  @discussion A namespace such as Ti.UI that was created on first access.
+		*/
+		struct NamespaceMaterialization
+		{
+			std::string name;
+			// From construction of Ti to the first access
+			std::chrono::microseconds since_start;
+			std::chrono::microseconds duration;
+		};
+
+		/*!
+		  @method
+		  @abstract get_materialized_namespaces
+		  @discussion Namespaces created so far, in the order they were first
+		  accessed. Ones the app never touches are never created.
+		*/
+		std::vector<NamespaceMaterialization> get_materialized_namespaces() const TITANIUM_NOEXCEPT;
+
 		TiModule(const JSContext&) TITANIUM_NOEXCEPT;
 		virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
 
@@ -160,9 +183,24 @@ namespace Titanium
 
 		void build() TITANIUM_NOEXCEPT;
 	protected:
+		/*!
+		  @method
+		  @abstract materialize
+		  @discussion Returns the namespace cached under name, creating it with
+		  create on first access. setup runs once the namespace is cached, so
+		  it may reach the namespace again through Ti without recursing.
+		*/
+		JSObject materialize(const std::string& name, const std::function<JSObject()>& create, const std::function<void(JSObject&)>& setup = nullptr) const TITANIUM_NOEXCEPT;
+
 #pragma warning(push)
 #pragma warning(disable : 4251)
-		std::string userAgent__;
+		// Computed on first read unless set after build()
+		mutable std::string userAgent__;
+		mutable bool userAgent_default__ { false };
+
+		mutable std::unordered_map<std::string, JSObject> namespaces__;
+		mutable std::vector<NamespaceMaterialization> materialized__;
+		std::chrono::steady_clock::time_point created_at__;
 
 		JSClass global_string__;
 		JSClass ti__;
@@ -0,0 +1,122 @@
+/**
+ * TitaniumKit ListItemTemplate
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_UI_LISTITEMTEMPLATE_HPP_
+#define _TITANIUM_UI_LISTITEMTEMPLATE_HPP_
+
+#include "Titanium/detail/TiBase.hpp"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace UI
+	{
+		using namespace HAL;
+
+		class View;
+		struct ListItemInstance;
+
+		/*!
+		  @class
+		  @discussion A ListView item template compiled into a flat plan.
+		  Views are listed parent first, each with its create function already
+		  resolved from its type, the index of its parent, its bindId and the
+		  properties it is created with. Creating an item runs the list from
+		  top to bottom and binding one looks bindIds up in a table, neither
+		  walks the template's childTemplates again.
+		  See http://docs.appcelerator.com/titanium/latest/#!/api/ItemTemplate
+		*/
+		class TITANIUMKIT_EXPORT ListItemTemplate final
+		{
+		public:
+			struct Node
+			{
+				// Template of the view, and the Ti.UI.createXXX function for its type
+				JSObject js_template;
+				JSObject createView;
+				// Index of the parent view, -1 for the root
+				std::int32_t parent;
+				std::string bindId;
+				// Properties the view is created with, as an object and as a map
+				JSObject options;
+				std::unordered_map<std::string, JSValue> defaults;
+				// Builtin template labels show the item title
+				bool label;
+			};
+
+			/*!
+			  @method
+			  @abstract Compile
+			  @discussion Compiles a template, looking its create functions up with
+			  processTemplates and its properties with templateOptions from listview.js.
+			  Returns nullptr when a type has no create function.
+			*/
+			static std::shared_ptr<ListItemTemplate> Compile(const JSObject& js_template, const JSObject& listview_exports) TITANIUM_NOEXCEPT;
+
+			const std::vector<Node>& get_nodes() const TITANIUM_NOEXCEPT
+			{
+				return nodes__;
+			}
+
+			// Views other than the root in the order they are added to their parent, children first
+			const std::vector<std::uint32_t>& get_addOrder() const TITANIUM_NOEXCEPT
+			{
+				return addOrder__;
+			}
+
+			/*!
+			  @method
+			  @abstract bindNode
+			  @discussion Binds values to view, the view of node index of instance,
+			  applying only what differs from what the view was last bound to. A
+			  property bound before that values leave out goes back to the template's
+			  value, or else to the value the view had before it was first bound.
+			*/
+			void bindNode(ListItemInstance& instance, const std::uint32_t& index, JSObject& view, std::unordered_map<std::string, JSValue>&& values) const TITANIUM_NOEXCEPT;
+
+		private:
+			bool compileNode(const JSObject& js_template, JSObject& templateOptions, const std::int32_t& parent) TITANIUM_NOEXCEPT;
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::vector<Node> nodes__;
+			std::vector<std::uint32_t> addOrder__;
+#pragma warning(pop)
+		};
+
+		/*!
+		  @struct
+		  @discussion Views of one list item created from a ListItemTemplate, by node,
+		  the properties each was last bound to, and the values those properties had
+		  before the view was first bound to them. Views are weak so the item does
+		  not outlive its root view.
+		*/
+		struct ListItemInstance
+		{
+			std::shared_ptr<ListItemTemplate> plan;
+			std::vector<std::weak_ptr<View>> views;
+			std::vector<std::unordered_map<std::string, JSValue>> bound;
+			std::vector<std::unordered_map<std::string, JSValue>> initial;
+		};
+
+		/*!
+		  @struct
+		  @discussion The properties the root view of one list item ends up with,
+		  template properties included, copied out of JavaScript so a worker thread
+		  can measure the item. Strings, numbers and booleans are kept as strings;
+		  other values are left out.
+		*/
+		struct ListItemSnapshot
+		{
+			std::unordered_map<std::string, std::string> values;
+		};
+	} // namespace UI
+} // namespace Titanium
+#endif // _TITANIUM_UI_LISTITEMTEMPLATE_HPP_
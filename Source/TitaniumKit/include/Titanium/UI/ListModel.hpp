@@ -138,6 +138,7 @@ namespace Titanium
 				sections__ = saved_sections__;
 				saved_sections__ = std::vector<std::shared_ptr<T>>();
 				saved_positions__.clear();
+				version__++;
 			}
 
 			/*!
@@ -160,6 +161,7 @@ namespace Titanium
 				sections__.clear();
 				saved_sections__.clear();
 				saved_positions__.clear();
+				version__++;
 			}
 
 			/*!
@@ -170,6 +172,7 @@ namespace Titanium
 			void set_sections(const std::vector<std::shared_ptr<T>>& sections) TITANIUM_NOEXCEPT
 			{
 				sections__ = sections;
+				version__++;
 			}
 
 			/*!
@@ -232,6 +235,7 @@ namespace Titanium
 				for (const auto section : sections) {
 					sections__.push_back(section);
 				}
+				version__++;
 			}
 
 			/*!
@@ -242,6 +246,7 @@ namespace Titanium
 			void appendSection(const std::shared_ptr<T>& section) TITANIUM_NOEXCEPT
 			{
 				sections__.push_back(section);
+				version__++;
 			}
 
 			/*!
@@ -252,6 +257,7 @@ namespace Titanium
 			void deleteSectionAt(const uint32_t& sectionIndex) TITANIUM_NOEXCEPT
 			{
 				sections__.erase(sections__.begin() + sectionIndex);
+				version__++;
 			}
 
 			/*!
@@ -262,6 +268,7 @@ namespace Titanium
 			void insertSectionAt(const uint32_t& sectionIndex, const std::vector<std::shared_ptr<T>>& section) TITANIUM_NOEXCEPT
 			{
 				sections__.insert(sections__.begin() + sectionIndex, section.begin(), section.end());
+				version__++;
 			}
 
 			/*!
@@ -282,6 +289,7 @@ namespace Titanium
 			void insertSectionAfter(const uint32_t& sectionIndex, const std::vector<std::shared_ptr<T>>& section) TITANIUM_NOEXCEPT
 			{
 				sections__.insert(sections__.begin() + sectionIndex + 1, section.begin(), section.end());
+				version__++;
 			}
 
 			/*!
@@ -292,6 +300,7 @@ namespace Titanium
 			void updateSection(const uint32_t& sectionIndex, const std::shared_ptr<T>& section) TITANIUM_NOEXCEPT
 			{
 				sections__.at(sectionIndex) = section;
+				version__++;
 			}
 
 			/*!
@@ -303,6 +312,7 @@ namespace Titanium
 			{
 				sections__.erase(sections__.begin() + sectionIndex, sections__.begin() + sectionIndex + sections.size());
 				sections__.insert(sections__.begin() + sectionIndex, sections.begin(), sections.end());
+				version__++;
 			}
 
 			/*!
@@ -354,8 +364,19 @@ namespace Titanium
 				offset__ = offset;
 			}
 
+			/*!
+			  @method
+			  @abstract get_version
+			  @discussion Changes whenever sections are set, added, removed or replaced
+			*/
+			std::uint64_t get_version() const TITANIUM_NOEXCEPT
+			{
+				return version__;
+			}
+
 		protected:
 			std::uint32_t offset__ { 0 };
+			std::uint64_t version__ { 0 };
 			std::vector<std::shared_ptr<T>> saved_sections__;
 			std::vector<std::shared_ptr<T>> sections__;
 
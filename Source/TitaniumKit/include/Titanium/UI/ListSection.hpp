@@ -12,6 +12,8 @@
 #include "Titanium/Module.hpp"
 #include "Titanium/UI/View.hpp"
 #include "Titanium/UI/ListViewAnimationProperties.hpp"
+#include "Titanium/detail/TiSearchIndex.hpp"
+#include "Titanium/detail/TiItemStore.hpp"
 
 namespace Titanium
 {
@@ -51,6 +53,30 @@ namespace Titanium
 		*/
 		TITANIUMKIT_EXPORT bool ListDataItem_contains(const ListDataItem& item, const std::string& query, const bool& caseInsensitive);
 
+		/*!
+		  Get the text ListDataItem is searched by: searchableText, or title when it has none
+		  @param item List data item
+		  @param text Receives the text
+		  @return false when the item has neither property
+		*/
+		TITANIUMKIT_EXPORT bool ListDataItem_searchableText(const ListDataItem& item, std::string& text);
+
+		/*!
+		  Get the itemId property of every ListDataItem
+		  @param items List data items
+		  @param itemIds Receives the item ids in order
+		  @return false when any item has no itemId
+		*/
+		TITANIUMKIT_EXPORT bool ListDataItem_itemIds(const std::vector<ListDataItem>& items, std::vector<std::string>& itemIds);
+
+		/*!
+		  Check whether two ListDataItems would bind the same content
+		  @param a List data item
+		  @param b List data item
+		  @return true when template, properties and bindings are all equal
+		*/
+		TITANIUMKIT_EXPORT bool ListDataItem_equals(const ListDataItem& a, const ListDataItem& b);
+
 		/*!
 		  @class
 		  @discussion This is the Titanium ListSection Module.
@@ -93,6 +119,8 @@ namespace Titanium
 			  @property
 			  @abstract items
 			  @discussion Items of this list section.
+			  When old and new items all carry a unique itemId, setting items only applies
+			  the inserts, deletes and updates between them.
 			*/
 			TITANIUM_PROPERTY_IMPL_DEF(std::vector<ListDataItem>, items);
 
@@ -138,6 +166,31 @@ namespace Titanium
 			*/
 			virtual ListDataItem getItemAt(const uint32_t& itemIndex) TITANIUM_NOEXCEPT;
 
+			/*!
+			  @method
+			  @abstract getItemObjectAt
+			  @discussion Returns the item at the specified index as a ListDataItem JavaScript object,
+			  built straight from the slots of its shape.
+			*/
+			JSObject getItemObjectAt(const uint32_t& itemIndex) const TITANIUM_NOEXCEPT;
+
+			// Template of the item at itemIndex, without loading the item
+			const std::string& getItemTemplateAt(const uint32_t& itemIndex) const TITANIUM_NOEXCEPT
+			{
+				return itemStore__->get_templateAt(itemIndex);
+			}
+
+			// Calls callback(name, value, isBinding) for every value of the item at itemIndex, without loading the item
+			template<typename Callback>
+			void forEachItemValueAt(const uint32_t& itemIndex, const Callback& callback) const TITANIUM_NOEXCEPT
+			{
+				TITANIUM_ASSERT(get_itemCount() > itemIndex);
+				itemStore__->ForEach(itemIndex, callback);
+			}
+
+			// itemId of the item at itemIndex, without loading the item. Returns false when it has none.
+			bool getItemIdAt(const uint32_t& itemIndex, std::string& itemId) TITANIUM_NOEXCEPT;
+
 			/*!
 			  @method
 			  @abstract updateItemAt
@@ -145,6 +198,14 @@ namespace Titanium
 			*/
 			virtual void updateItemAt(const uint32_t& index, const ListDataItem& dataItem, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT;
 
+			/*!
+			  @method
+			  @abstract searchItems
+			  @discussion Returns the indexes of the items whose title/searchableText contains query.
+			  The search index is built by the first search and kept up to date as items change.
+			*/
+			std::vector<std::uint32_t> searchItems(const std::string& query, const bool& caseInsensitive) TITANIUM_NOEXCEPT;
+
 			ListSection(const JSContext&) TITANIUM_NOEXCEPT;
 			virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
 
@@ -186,7 +247,7 @@ namespace Titanium
 
 			std::uint32_t get_itemCount() const TITANIUM_NOEXCEPT
 			{
-				return static_cast<std::uint32_t>(items__.size());
+				return static_cast<std::uint32_t>(itemStore__->size());
 			}
 
 			bool hasHeaderTitle() const TITANIUM_NOEXCEPT
@@ -210,13 +271,35 @@ namespace Titanium
 			}
 
 		protected:
+			/*!
+			  @method
+			  @abstract applyItemsDiff
+			  @discussion When every old and new item has a unique itemId, turns the current
+			  items into values through deleteItemsAt, insertItemsAt/appendItems and updateItemAt,
+			  so items left in place keep their views. Returns false when it cannot.
+			*/
+			virtual bool applyItemsDiff(const std::vector<ListDataItem>& values) TITANIUM_NOEXCEPT;
+
+			// Stores dataItems before index
+			void storeItems(const std::uint32_t& index, const std::vector<ListDataItem>& dataItems) TITANIUM_NOEXCEPT;
+			ListDataItem loadItem(const std::uint32_t& index) const TITANIUM_NOEXCEPT;
+
+			// Store counterparts of ListDataItem_searchableText, ListDataItem_itemIds and ListDataItem_equals
+			bool getItemSearchableText(const std::uint32_t& index, std::string& text) TITANIUM_NOEXCEPT;
+			bool getItemIds(std::vector<std::string>& itemIds) TITANIUM_NOEXCEPT;
+			bool itemEquals(const std::uint32_t& index, const ListDataItem& dataItem) TITANIUM_NOEXCEPT;
+
 #pragma warning(push)
 #pragma warning(disable : 4251)
 			std::string footerTitle__;
 			std::string headerTitle__;
 			std::shared_ptr<View> footerView__;
 			std::shared_ptr<View> headerView__;
-			std::vector<ListDataItem> items__;
+			// Items by shape, with the view of each item alongside
+			std::shared_ptr<detail::TiItemStore<JSValue>> itemStore__;
+			std::vector<std::shared_ptr<View>> itemViews__;
+			// Built by the first search, nullptr until then or when items moved
+			std::shared_ptr<detail::TiSearchIndex> searchIndex__;
 
 			JSObject listviewAnimationProperties_ctor__;
 #pragma warning(pop)
@@ -12,8 +12,13 @@
 #include "Titanium/UI/View.hpp"
 #include "Titanium/UI/ListSection.hpp"
 #include "Titanium/UI/ListViewMarkerProps.hpp"
+#include "Titanium/UI/ListItemTemplate.hpp"
 #include "Titanium/UI/ListModel.hpp"
 #include "Titanium/detail/TiImpl.hpp"
+#include "Titanium/detail/TiViewRecycler.hpp"
+#include "Titanium/detail/TiPrepareQueue.hpp"
+#include "Titanium/detail/TiRowHeights.hpp"
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include <tuple>
@@ -44,41 +49,70 @@ namespace Titanium
 			*/
 			TITANIUM_PROPERTY_IMPL_DEF(std::vector<std::shared_ptr<ListSection>>, sections);
 
-			/*
-			 * Create views for the section at given index
-			 */
-			template<typename T>
-			std::vector<std::shared_ptr<T>> createSectionViewAt(const uint32_t& index)
-			{
-				// lazy loading
-				loadJS();
-				
-				std::vector<std::shared_ptr<T>> items;
-				const std::vector<JSValue> args { get_object(), model__->getSectionAtIndex(index)->get_object() };
-				JSValue result = sectionViewCreateFunction__(args, ti_listview_exports__);
-				TITANIUM_ASSERT(result.IsObject());
-				auto js_items = static_cast<JSObject>(result);
-				TITANIUM_ASSERT(js_items.IsArray());
-				
-				const auto length = static_cast<uint32_t>(js_items.GetProperty("length"));
-				for (uint32_t i = 0; i < length; i++) {
-					items.push_back(static_cast<JSObject>(js_items.GetProperty(i)).GetPrivate<T>());
-				}
-				
-				return items;
-			}
-
 			template<typename T>
 			std::shared_ptr<T> createSectionItemViewAt(const std::uint32_t& sectionIndex, const uint32_t& itemIndex) {
 				loadJS();
 				const auto section = model__->getSectionAtIndex(sectionIndex);
-				const auto item = section->getItemAt(itemIndex);			
-				const std::vector<JSValue> args { get_object(), section->get_object(), ListDataItem_to_js(get_context(), item) };
+				const auto view = createItemViewFromTemplate(section, itemIndex);
+				if (view) {
+					return view->get_object().GetPrivate<T>();
+				}
+				// Template did not compile, let listview.js interpret it
+				const std::vector<JSValue> args { get_object(), section->get_object(), section->getItemObjectAt(itemIndex) };
 				JSValue js_view = sectionViewItemCreateFunction__(args, ti_listview_exports__);
 				TITANIUM_ASSERT(js_view.IsObject());
 				return static_cast<JSObject>(js_view).GetPrivate<T>();
 			}
 
+			/*!
+			  @method
+			  @abstract setVisibleItems
+			  @discussion Tells the list which items are on screen, counted
+			  across all sections. Only those items and a few on either side
+			  keep a view; views of items that scrolled away go back to a pool
+			  for their template and are rebound to the next item using it,
+			  applying only the properties that differ. Platforms that
+			  virtualize their list control call this as it scrolls.
+			*/
+			virtual void setVisibleItems(const std::uint32_t& firstItem, const std::uint32_t& itemCount);
+
+			/*!
+			  @method
+			  @abstract getRealizedItemViewAt
+			  @discussion View of the item while it is near the viewport
+			  given to setVisibleItems, nullptr otherwise.
+			*/
+			std::shared_ptr<View> getRealizedItemViewAt(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const;
+
+			std::size_t get_realizedItemViewCount() const TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract setVisibleRange
+			  @discussion Like setVisibleItems, with the viewport given in
+			  pixels from the top of the first item. Items are found from the
+			  heights they were laid out at and, for items not laid out yet,
+			  the average height of their template, so jumping far down the
+			  list lays out only the items that end up on screen.
+			*/
+			virtual void setVisibleRange(const double& offset, const double& height);
+
+			/*!
+			  @method
+			  @abstract setItemHeight
+			  @discussion Records the height an item was laid out at. Heights
+			  measured while preparing items are recorded as well. Items with an
+			  itemId keep their height when the sections are set again.
+			*/
+			void setItemHeight(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex, const double& height);
+
+			// Top of an item in pixels from the top of the first item, and the item at such an offset
+			double getItemOffset(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const;
+			std::tuple<std::uint32_t, std::uint32_t> getItemAtOffset(const double& offset) const;
+
+			// Height of all items, measured or estimated
+			double get_contentHeight() const;
+
 			/*!
 			  @property
 			  @abstract footerTitle
@@ -276,6 +310,59 @@ namespace Titanium
 			virtual std::vector<std::string> suggestionRequested(const std::string& query);
 
 		protected:
+			// Called when setVisibleItems realizes or binds again an item view, and when one leaves the viewport.
+			// Subclass may override these to attach and detach the native view.
+			virtual void itemViewRealized(const std::shared_ptr<View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex);
+			virtual void itemViewReleased(const std::shared_ptr<View>& view);
+
+			// Measures an item from its snapshot on a worker thread, returning the height of its root view,
+			// or NAN when that depends on content. Platforms that can measure without touching JavaScript
+			// or UI objects return such a function; the default nullptr leaves items unprepared.
+			virtual std::function<double(const ListItemSnapshot&)> createItemMeasure();
+
+			// Called with the height prepared for an item view once it is realized.
+			virtual void itemViewPrepared(const std::shared_ptr<View>& view, const double& height);
+
+			// Snapshot count items from position on and measure them on a worker. Each item is looked
+			// at once until the items change, and only items with a fixed root height are snapshot.
+			void prepareItems(const std::uint32_t& position, const std::uint32_t& count);
+			void attachPreparedItem(const std::shared_ptr<View>& view, const std::uint32_t& position);
+
+			// Items or their layout changed; drop what was prepared for them.
+			void cancelPreparedItems();
+
+			// Compiled template for items of templateId, or the default template when there is no such template.
+			// Templates compile on first use and again once ListView.templates is set.
+			std::shared_ptr<ListItemTemplate> getItemTemplate(const std::string& templateId);
+
+			// Create the views of an item by running its compiled template, nullptr when it has none.
+			std::shared_ptr<View> createItemViewFromTemplate(const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex);
+			void bindItemInstance(ListItemInstance& instance, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex);
+
+			// Properties each view of plan gets from the item at itemIndex of section, by node, read from the section's item store
+			std::vector<std::unordered_map<std::string, JSValue>> resolveItemValues(const ListItemTemplate& plan, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex) const;
+
+			// Copy the properties of the root view of the item at itemIndex of section,
+			// false when its height depends on content so there is nothing to measure ahead.
+			bool snapshotItem(const ListItemTemplate& plan, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex, ListItemSnapshot& snapshot) const;
+
+			// Bind a view created for the same template to another item, applying only what changed.
+			void bindSectionItemViewAt(const std::shared_ptr<View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex);
+
+			// Sections or items changed; bind the realized item views again.
+			void refreshItemViews(const bool& realize = true);
+
+			// Heights of the items by position, rebuilt after the sections change
+			detail::TiRowHeights& getRowHeights() const;
+			std::uint32_t getRowTemplateId(const std::string& templateId) const;
+			std::string getItemHeightKey(const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex) const;
+			void updateRowHeights(const std::string& name, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex, const std::uint32_t& itemCount, const std::uint32_t& affectedRows);
+
+			// Item positions counted across all sections
+			const std::vector<std::uint32_t>& getItemOffsets() const;
+			std::tuple<std::uint32_t, std::uint32_t> getSectionItemIndex(const std::uint32_t& position) const;
+			std::uint32_t getItemPosition(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const;
+
 #pragma warning(push)
 #pragma warning(disable : 4251)
 			std::shared_ptr<ListModel<ListSection>> model__;
@@ -294,7 +381,36 @@ namespace Titanium
 			JSObject ti_listview_exports__;
 			JSObject sectionViewCreateFunction__;
 			JSObject sectionViewItemCreateFunction__;
+			JSObject sectionItemBindFunction__;
+			JSObject hookItemClickFunction__;
 			JSObject listviewAnimationProperties_ctor__;
+
+			std::shared_ptr<detail::TiViewRecycler<View>> itemViewRecycler__;
+			// Position of the first item of each section, and one past the last item
+			mutable std::vector<std::uint32_t> itemOffsets__;
+			mutable bool itemOffsetsValid__ { false };
+
+			// Templates compiled from the templates object in compiledTemplates__, by name
+			JSValue compiledTemplates__;
+			std::unordered_map<std::string, std::shared_ptr<ListItemTemplate>> itemTemplates__;
+			// Items created from compiled templates by their root view. Entries of
+			// collected views are pruned whenever the map doubles.
+			std::unordered_map<const View*, ListItemInstance> itemInstances__;
+			std::size_t itemInstancesPruneSize__ { 64 };
+
+			// Item heights measured on workers by item position, and how far ahead items are prepared
+			std::shared_ptr<detail::TiPrepareQueue<double>> itemPrepareQueue__;
+			std::function<double(const ListItemSnapshot&)> itemMeasure__;
+			std::uint32_t itemPrepareAhead__ { 32 };
+			std::uint32_t itemPreparedEnd__ { 0 };
+
+			// Measured and estimated item heights by position, templates interned in rowTemplateIds__
+			mutable detail::TiRowHeights rowHeights__;
+			mutable bool rowHeightsValid__ { false };
+			mutable std::unordered_map<std::string, std::uint32_t> rowTemplateIds__;
+			// Measured heights of items with an itemId, by template and itemId
+			std::unordered_map<std::string, double> itemHeights__;
+			double visibleHeight__ { 0 };
 #pragma warning(pop)
 		};
 	} // namespace UI
@@ -12,6 +12,7 @@
 #include "Titanium/UI/View.hpp"
 #include "Titanium/detail/TiBase.hpp"
 #include "Titanium/UI/ListModel.hpp"
+#include "Titanium/detail/TiRowIndex.hpp"
 #include <vector>
 #include <unordered_map>
 #include <tuple>
@@ -55,6 +56,8 @@ namespace Titanium
 			  @property
 			  @abstract data
 			  @discussion Rows of the table view.
+			  When the rows and the new data all carry a unique itemId, setting data only
+			  applies the inserts, deletes and updates between them.
 			*/
   			TITANIUM_PROPERTY_IMPL_DEF(std::vector<JSObject>, data);
 
@@ -366,6 +369,25 @@ namespace Titanium
 
 			virtual void createEmptyTableViewSection();
 
+			// Replaces the sections with data, as setting data always did.
+			virtual void resetData(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT;
+
+			// Row of datum: datum itself when it is a TableViewRow, or a new row created from it.
+			std::shared_ptr<TableViewRow> createTableViewRow(const JSObject& datum);
+
+			// When the table and data are rows without header that all carry a unique itemId,
+			// turns the rows into data through remove/add/update of the section, so rows left
+			// in place keep their views. Returns false when it cannot.
+			virtual bool applyDataDiff(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT;
+
+			// Row index of the current sections, built on first use and after the sections are replaced.
+			// Row changes arrive through fireTableViewSectionEvent, section changes through sectionsChanged.
+			const detail::TiRowIndex& getRowIndex() TITANIUM_NOEXCEPT;
+
+			// The erased sections from index on were replaced with the inserted ones, which are attached to
+			// this table so their row changes arrive. version is that of the model before the change.
+			void sectionsChanged(const std::uint64_t& version, const std::uint32_t& index, const std::vector<std::shared_ptr<TableViewSection>>& erased, const std::vector<std::shared_ptr<TableViewSection>>& inserted);
+
 			bool hasHeaderTitle() const TITANIUM_NOEXCEPT
 			{
 				return !headerTitle__.empty();
@@ -406,6 +428,11 @@ namespace Titanium
 				std::shared_ptr<SearchBar> search__;
 				std::string separatorColor__;
 				JSObject tableviewAnimationProperties_ctor__;
+				detail::TiRowIndex rowIndex__;
+				// Section to its index in rowIndex__
+				std::unordered_map<const TableViewSection*, std::uint32_t> rowIndexSections__;
+				bool rowIndexValid__ { false };
+				std::uint64_t rowIndexVersion__ { 0 };
 #pragma warning(pop)
 		};
 
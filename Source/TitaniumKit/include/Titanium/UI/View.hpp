@@ -321,6 +321,16 @@ namespace Titanium
 
 			virtual void postInitialize(JSObject& this_object) override;
 			virtual void postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments) override;
+
+			/*!
+			  @method
+			  @abstract setProperties
+			  @discussion Sets layout properties such as top and width through
+			  their native setters first, then the others, and lays the view out
+			  at most once when all of them are set.
+			*/
+			virtual void setProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT override;
+
 			virtual void disableEvent(const std::string& event_name) TITANIUM_NOEXCEPT override;
 			virtual void enableEvent(const std::string& event_name) TITANIUM_NOEXCEPT override;
 
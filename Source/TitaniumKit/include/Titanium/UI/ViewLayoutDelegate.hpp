@@ -444,6 +444,25 @@ namespace Titanium
 			virtual void disableEvent(const std::string& event_name) TITANIUM_NOEXCEPT;
 			virtual void enableEvent(const std::string& event_name) TITANIUM_NOEXCEPT;
 
+			/*!
+			  @method
+			  @abstract beginLayoutUpdate
+			  @discussion Holds back the layout requests of this view until the
+			  matching endLayoutUpdate, which then lays the view out at most
+			  once. Used while several properties are set together. Calls nest.
+			*/
+			virtual void beginLayoutUpdate() TITANIUM_NOEXCEPT;
+			virtual void endLayoutUpdate() TITANIUM_NOEXCEPT;
+			bool isUpdatingLayout() const TITANIUM_NOEXCEPT;
+
+			/*!
+			  @method
+			  @abstract requestLayout
+			  @discussion Lays the view out, firing postlayout when fire_event
+			  is true. Platforms override this; the default does nothing.
+			*/
+			virtual void requestLayout(const bool& fire_event = false);
+
 			/*!
 			  @property
 			  @abstract anchorPoint
@@ -610,6 +629,10 @@ namespace Titanium
 			virtual ~ViewLayoutDelegate();
 
 		protected:
+			// Holds a layout request back while properties are set together, see beginLayoutUpdate.
+			// Returns whether it did; endLayoutUpdate then makes one request for all of them.
+			bool holdLayoutRequest(const bool& fire_event) TITANIUM_NOEXCEPT;
+
 #pragma warning(push)
 #pragma warning(disable : 4251)
 			std::vector<std::shared_ptr<Titanium::UI::View>> children__;
@@ -653,6 +676,9 @@ namespace Titanium
 			std::string viewShadowColor__;
 			Point viewShadowOffset__;
 			bool horizontalWrap__ { true };
+			std::uint32_t layoutUpdateDepth__ { 0 };
+			bool layoutRequested__ { false };
+			bool layoutEventRequested__ { false };
 
 			Point anchorPoint__;
 			Point animatedCenter__;
@@ -81,103 +81,174 @@ static const char listview_js[] = { 47,42,42,10,32,42,32,84,105,116,97,110,105,1
     ,47,32,67,114,101,97,116,101,32,105,116,101,109,32,118,105,101,119,115,32,102,114,111,109,32,115,101,99,116,105
     ,111,110,10,102,117,110,99,116,105,111,110,32,99,114,101,97,116,101,83,101,99,116,105,111,110,86,105,101,119,40
     ,108,105,115,116,118,105,101,119,44,32,115,101,99,116,105,111,110,41,32,123,10,9,115,101,99,116,105,111,110,46
-    ,108,105,115,116,118,105,101,119,32,61,32,108,105,115,116,118,105,101,119,59,10,9,108,105,115,116,118,105,101,119
-    ,46,116,101,109,112,108,97,116,101,115,32,61,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101
-    ,115,32,124,124,32,91,93,59,10,9,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101,109
-    ,84,101,109,112,108,97,116,101,32,61,32,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101
-    ,109,84,101,109,112,108,97,116,101,32,124,124,32,84,105,46,85,73,46,76,73,83,84,95,73,84,69,77,95,84
-    ,69,77,80,76,65,84,69,95,68,69,70,65,85,76,84,59,10,10,9,101,110,115,117,114,101,76,111,97,100,84
-    ,101,109,112,108,97,116,101,115,40,108,105,115,116,118,105,101,119,41,59,10,10,9,118,97,114,32,118,105,101,119
-    ,115,32,61,32,91,93,59,10,9,118,97,114,32,105,116,101,109,115,32,61,32,115,101,99,116,105,111,110,46,105
-    ,116,101,109,115,59,10,9,102,111,114,32,40,118,97,114,32,105,32,61,32,48,59,32,105,32,60,32,105,116,101
-    ,109,115,46,108,101,110,103,116,104,59,32,105,43,43,41,32,123,10,9,9,118,105,101,119,115,46,112,117,115,104
-    ,40,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,40,108,105,115,116,118,105,101,119,44
-    ,32,115,101,99,116,105,111,110,44,32,105,116,101,109,115,91,105,93,41,41,59,10,9,125,10,9,114,101,116,117
-    ,114,110,32,118,105,101,119,115,59,10,125,10,10,102,117,110,99,116,105,111,110,32,99,114,101,97,116,101,83,101
-    ,99,116,105,111,110,73,116,101,109,86,105,101,119,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109,44,32
-    ,116,101,109,112,108,97,116,101,44,32,112,97,114,101,110,116,41,32,123,10,9,118,97,114,32,111,112,116,105,111
-    ,110,115,32,61,32,116,101,109,112,108,97,116,101,46,112,114,111,112,101,114,116,105,101,115,59,10,9,105,102,32
-    ,40,111,112,116,105,111,110,115,32,61,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,111,112,116,105,111
-    ,110,115,32,61,32,123,116,111,112,58,48,44,32,108,101,102,116,58,48,44,32,119,105,100,116,104,58,84,105,46
-    ,85,73,46,83,73,90,69,44,32,104,101,105,103,104,116,58,84,105,46,85,73,46,83,73,90,69,125,59,10,9
-    ,125,10,10,9,105,102,32,40,116,101,109,112,108,97,116,101,46,99,114,101,97,116,101,86,105,101,119,32,61,61
-    ,61,32,118,111,105,100,32,48,41,32,123,10,9,9,112,114,111,99,101,115,115,84,101,109,112,108,97,116,101,115
-    ,40,116,101,109,112,108,97,116,101,41,59,10,9,125,10,10,9,118,97,114,32,118,105,101,119,32,61,32,116,101
-    ,109,112,108,97,116,101,46,99,114,101,97,116,101,86,105,101,119,40,111,112,116,105,111,110,115,41,59,10,10,9
-    ,105,102,32,40,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,32,33,61,61,32,118,111,105,100,32,48
-    ,41,32,123,10,9,9,118,105,101,119,46,98,105,110,100,73,100,32,61,32,116,101,109,112,108,97,116,101,46,98
-    ,105,110,100,73,100,59,10,9,125,10,10,9,47,47,32,104,111,111,107,32,99,108,105,99,107,32,97,110,100,32
-    ,102,105,114,101,32,108,105,115,116,118,105,101,119,32,101,118,101,110,116,32,119,105,116,104,32,98,105,110,100,73
-    ,100,10,9,118,105,101,119,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,39,99,108,105,99
-    ,107,39,44,32,102,117,110,99,116,105,111,110,40,41,32,123,10,9,9,47,47,32,99,104,101,99,107,32,105,102
-    ,32,111,116,104,101,114,32,118,105,101,119,32,97,108,114,101,97,100,121,32,112,114,111,99,101,115,115,101,115,32
-    ,116,104,101,32,101,118,101,110,116,10,9,9,105,102,32,40,108,105,115,116,118,105,101,119,46,95,105,116,101,109
-    ,99,108,105,99,107,95,115,101,99,116,105,111,110,95,41,32,123,10,9,9,9,47,47,32,115,101,116,32,98,105
-    ,110,100,73,100,32,97,110,100,32,102,111,114,119,97,114,100,32,116,104,101,32,101,118,101,110,116,32,97,103,97
-    ,105,110,10,9,9,9,108,105,115,116,118,105,101,119,46,102,105,114,101,69,118,101,110,116,40,39,105,116,101,109
-    ,99,108,105,99,107,39,44,32,123,10,9,9,9,9,98,105,110,100,73,100,58,32,32,32,32,32,32,32,108,105
-    ,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,98,105,110,100,73,100,95,32,63,32,108,105
-    ,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,98,105,110,100,73,100,95,32,58,32,118,105
-    ,101,119,46,98,105,110,100,73,100,44,10,9,9,9,9,105,116,101,109,73,100,58,32,32,32,32,32,32,32,108
-    ,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,105,116,101,109,73,100,95,44,10,9,9
-    ,9,9,115,101,99,116,105,111,110,58,32,32,32,32,32,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109
-    ,99,108,105,99,107,95,115,101,99,116,105,111,110,95,44,10,9,9,9,9,115,101,99,116,105,111,110,73,110,100
-    ,101,120,58,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105,111
-    ,110,73,110,100,101,120,95,44,10,9,9,9,9,105,116,101,109,73,110,100,101,120,58,32,32,32,32,108,105,115
-    ,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,105,116,101,109,73,110,100,101,120,95,10,9,9
-    ,9,125,41,59,10,9,9,9,47,47,32,109,97,107,101,32,115,117,114,101,32,116,111,32,100,101,108,101,116,101
-    ,32,101,118,101,110,116,32,112,114,111,112,101,114,116,105,101,115,32,115,111,32,119,101,32,99,97,110,32,100,101
-    ,116,101,99,116,32,105,116,39,115,32,112,114,111,99,101,115,115,101,100,10,9,9,9,100,101,108,101,116,101,32
-    ,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,98,105,110,100,73,100,95,59,10,9
-    ,9,9,100,101,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,105
-    ,116,101,109,73,100,95,59,10,9,9,9,100,101,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116
-    ,101,109,99,108,105,99,107,95,115,101,99,116,105,111,110,95,59,10,9,9,9,100,101,108,101,116,101,32,108,105
-    ,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105,111,110,73,110,100,101,120
-    ,95,59,10,9,9,9,100,101,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105
-    ,99,107,95,105,116,101,109,73,110,100,101,120,95,59,10,9,9,125,10,9,125,41,59,10,10,9,105,102,32,40
-    ,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,32,33,61,61,32,118,111,105,100,32,48,32,38,38,32
-    ,105,116,101,109,91,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,93,32,33,61,61,32,118,111,105,100
-    ,32,48,41,32,123,10,9,9,118,105,101,119,46,97,112,112,108,121,80,114,111,112,101,114,116,105,101,115,40,105
-    ,116,101,109,91,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,93,41,59,10,9,125,32,101,108,115,101
-    ,32,105,102,32,40,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,32,33,61,61,32,118,111,105,100,32
-    ,48,41,32,123,10,9,9,105,102,32,40,111,112,116,105,111,110,115,46,104,101,105,103,104,116,32,61,61,61,32
-    ,118,111,105,100,32,48,32,38,38,32,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,46,104,101,105,103
-    ,104,116,32,61,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,9,105,116,101,109,46,112,114,111,112,101
-    ,114,116,105,101,115,46,104,101,105,103,104,116,32,61,32,84,105,46,85,73,46,83,73,90,69,59,10,9,9,125
-    ,10,9,9,47,47,32,98,117,105,108,116,105,110,32,116,101,109,112,108,97,116,101,32,104,97,115,32,100,105,102
-    ,102,101,114,101,110,116,32,102,111,114,109,97,116,10,9,9,105,102,32,40,116,101,109,112,108,97,116,101,46,116
-    ,121,112,101,32,61,61,32,39,84,105,46,85,73,46,76,97,98,101,108,39,41,32,123,10,9,9,9,105,116,101
-    ,109,46,112,114,111,112,101,114,116,105,101,115,46,116,101,120,116,32,61,32,105,116,101,109,46,112,114,111,112,101
-    ,114,116,105,101,115,46,116,105,116,108,101,59,10,9,9,9,118,105,101,119,46,97,112,112,108,121,80,114,111,112
-    ,101,114,116,105,101,115,40,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,41,59,10,9,9,125,32,101
-    ,108,115,101,32,123,10,9,9,9,118,105,101,119,46,97,112,112,108,121,80,114,111,112,101,114,116,105,101,115,40
-    ,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,41,59,10,9,9,125,10,9,125,10,9,105,102,32,40
-    ,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101,109,112,108,97,116,101,115,32,33,61,61,32,118,111
-    ,105,100,32,48,32,38,38,32,65,114,114,97,121,46,105,115,65,114,114,97,121,40,116,101,109,112,108,97,116,101
-    ,46,99,104,105,108,100,84,101,109,112,108,97,116,101,115,41,41,32,123,10,9,9,102,111,114,32,40,118,97,114
-    ,32,105,32,61,32,48,59,32,105,32,60,32,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101,109,112
-    ,108,97,116,101,115,46,108,101,110,103,116,104,59,32,105,43,43,41,32,123,10,9,9,9,99,114,101,97,116,101
-    ,83,101,99,116,105,111,110,73,116,101,109,86,105,101,119,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109
-    ,44,32,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101,109,112,108,97,116,101,115,91,105,93,44,32
-    ,118,105,101,119,41,59,10,9,9,125,10,9,125,10,9,105,102,32,40,112,97,114,101,110,116,32,33,61,61,32
-    ,118,111,105,100,32,48,41,32,123,10,9,9,112,97,114,101,110,116,46,97,100,100,40,118,105,101,119,41,59,10
-    ,9,125,10,9,114,101,116,117,114,110,32,118,105,101,119,59,10,125,10,10,47,47,32,67,114,101,97,116,101,32
-    ,108,105,115,116,32,105,116,101,109,32,102,111,114,32,99,117,115,116,111,109,32,116,101,109,112,108,97,116,101,10
-    ,102,117,110,99,116,105,111,110,32,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,40,108
-    ,105,115,116,118,105,101,119,44,32,115,101,99,116,105,111,110,44,32,105,116,101,109,41,32,123,10,9,118,97,114
-    ,32,116,101,109,112,108,97,116,101,32,61,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115
-    ,91,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101,109,84,101,109,112,108,97,116,101,93
-    ,59,10,9,105,102,32,40,105,116,101,109,46,116,101,109,112,108,97,116,101,32,33,61,61,32,118,111,105,100,32
-    ,48,32,38,38,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115,91,105,116,101,109,46,116
-    ,101,109,112,108,97,116,101,93,32,33,61,61,32,118,111,105,100,32,48,32,41,32,123,10,9,9,116,101,109,112
-    ,108,97,116,101,32,61,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115,91,105,116,101,109
-    ,46,116,101,109,112,108,97,116,101,93,59,10,9,125,10,9,114,101,116,117,114,110,32,99,114,101,97,116,101,83
+    ,108,105,115,116,118,105,101,119,32,61,32,108,105,115,116,118,105,101,119,59,10,9,112,114,101,112,97,114,101,76
+    ,105,115,116,86,105,101,119,40,108,105,115,116,118,105,101,119,41,59,10,10,9,118,97,114,32,118,105,101,119,115
+    ,32,61,32,91,93,59,10,9,118,97,114,32,105,116,101,109,115,32,61,32,115,101,99,116,105,111,110,46,105,116
+    ,101,109,115,59,10,9,102,111,114,32,40,118,97,114,32,105,32,61,32,48,59,32,105,32,60,32,105,116,101,109
+    ,115,46,108,101,110,103,116,104,59,32,105,43,43,41,32,123,10,9,9,118,105,101,119,115,46,112,117,115,104,40
+    ,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,40,108,105,115,116,118,105,101,119,44,32
+    ,115,101,99,116,105,111,110,44,32,105,116,101,109,115,91,105,93,41,41,59,10,9,125,10,9,114,101,116,117,114
+    ,110,32,118,105,101,119,115,59,10,125,10,10,102,117,110,99,116,105,111,110,32,112,114,101,112,97,114,101,76,105
+    ,115,116,86,105,101,119,40,108,105,115,116,118,105,101,119,41,32,123,10,9,108,105,115,116,118,105,101,119,46,116
+    ,101,109,112,108,97,116,101,115,32,61,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115,32
+    ,124,124,32,91,93,59,10,9,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101,109,84,101
+    ,109,112,108,97,116,101,32,61,32,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101,109,84
+    ,101,109,112,108,97,116,101,32,124,124,32,84,105,46,85,73,46,76,73,83,84,95,73,84,69,77,95,84,69,77
+    ,80,76,65,84,69,95,68,69,70,65,85,76,84,59,10,10,9,101,110,115,117,114,101,76,111,97,100,84,101,109
+    ,112,108,97,116,101,115,40,108,105,115,116,118,105,101,119,41,59,10,125,10,10,102,117,110,99,116,105,111,110,32
+    ,108,111,111,107,117,112,84,101,109,112,108,97,116,101,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109,41
+    ,32,123,10,9,105,102,32,40,105,116,101,109,46,116,101,109,112,108,97,116,101,32,33,61,61,32,118,111,105,100
+    ,32,48,32,38,38,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115,91,105,116,101,109,46
+    ,116,101,109,112,108,97,116,101,93,32,33,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,114,101,116,117
+    ,114,110,32,108,105,115,116,118,105,101,119,46,116,101,109,112,108,97,116,101,115,91,105,116,101,109,46,116,101,109
+    ,112,108,97,116,101,93,59,10,9,125,10,9,114,101,116,117,114,110,32,108,105,115,116,118,105,101,119,46,116,101
+    ,109,112,108,97,116,101,115,91,108,105,115,116,118,105,101,119,46,100,101,102,97,117,108,116,73,116,101,109,84,101
+    ,109,112,108,97,116,101,93,59,10,125,10,10,47,47,32,80,114,111,112,101,114,116,105,101,115,32,111,102,32,105
+    ,116,101,109,32,116,104,97,116,32,103,111,32,116,111,32,116,104,101,32,118,105,101,119,32,99,114,101,97,116,101
+    ,100,32,102,114,111,109,32,116,101,109,112,108,97,116,101,10,102,117,110,99,116,105,111,110,32,105,116,101,109,80
+    ,114,111,112,101,114,116,105,101,115,40,105,116,101,109,44,32,116,101,109,112,108,97,116,101,44,32,111,112,116,105
+    ,111,110,115,41,32,123,10,9,105,102,32,40,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,32,33,61
+    ,61,32,118,111,105,100,32,48,32,38,38,32,105,116,101,109,91,116,101,109,112,108,97,116,101,46,98,105,110,100
+    ,73,100,93,32,33,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,114,101,116,117,114,110,32,105,116,101
+    ,109,91,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,93,59,10,9,125,32,101,108,115,101,32,105,102
+    ,32,40,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,32,33,61,61,32,118,111,105,100,32,48,41,32
+    ,123,10,9,9,105,102,32,40,111,112,116,105,111,110,115,46,104,101,105,103,104,116,32,61,61,61,32,118,111,105
+    ,100,32,48,32,38,38,32,105,116,101,109,46,112,114,111,112,101,114,116,105,101,115,46,104,101,105,103,104,116,32
+    ,61,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,9,105,116,101,109,46,112,114,111,112,101,114,116,105
+    ,101,115,46,104,101,105,103,104,116,32,61,32,84,105,46,85,73,46,83,73,90,69,59,10,9,9,125,10,9,9
+    ,47,47,32,98,117,105,108,116,105,110,32,116,101,109,112,108,97,116,101,32,104,97,115,32,100,105,102,102,101,114
+    ,101,110,116,32,102,111,114,109,97,116,10,9,9,105,102,32,40,116,101,109,112,108,97,116,101,46,116,121,112,101
+    ,32,61,61,32,39,84,105,46,85,73,46,76,97,98,101,108,39,41,32,123,10,9,9,9,105,116,101,109,46,112
+    ,114,111,112,101,114,116,105,101,115,46,116,101,120,116,32,61,32,105,116,101,109,46,112,114,111,112,101,114,116,105
+    ,101,115,46,116,105,116,108,101,59,10,9,9,125,10,9,9,114,101,116,117,114,110,32,105,116,101,109,46,112,114
+    ,111,112,101,114,116,105,101,115,59,10,9,125,10,9,114,101,116,117,114,110,32,123,125,59,10,125,10,10,47,47
+    ,32,65,112,112,108,121,32,111,110,108,121,32,116,104,101,32,112,114,111,112,101,114,116,105,101,115,32,116,104,97
+    ,116,32,100,105,102,102,101,114,32,102,114,111,109,32,119,104,97,116,32,116,104,101,32,118,105,101,119,32,119,97
+    ,115,32,108,97,115,116,32,98,111,117,110,100,32,116,111,46,10,47,47,32,80,114,111,112,101,114,116,105,101,115
+    ,32,116,104,101,32,105,116,101,109,32,110,111,32,108,111,110,103,101,114,32,115,101,116,115,32,103,111,32,98,97
+    ,99,107,32,116,111,32,116,104,101,32,116,101,109,112,108,97,116,101,39,115,32,118,97,108,117,101,44,32,111,114
+    ,32,116,111,10,47,47,32,116,104,101,32,118,97,108,117,101,32,116,104,101,32,118,105,101,119,32,104,97,100,32
+    ,98,101,102,111,114,101,32,97,110,32,105,116,101,109,32,102,105,114,115,116,32,115,101,116,32,116,104,101,109,46
+    ,10,102,117,110,99,116,105,111,110,32,98,105,110,100,86,105,101,119,40,118,105,101,119,44,32,112,114,111,112,101
+    ,114,116,105,101,115,44,32,111,112,116,105,111,110,115,41,32,123,10,9,118,97,114,32,98,111,117,110,100,32,61
+    ,32,118,105,101,119,46,95,98,111,117,110,100,95,32,124,124,32,123,125,44,10,9,9,105,110,105,116,105,97,108
+    ,32,61,32,118,105,101,119,46,95,105,110,105,116,105,97,108,95,32,124,124,32,123,125,44,10,9,9,99,104,97
+    ,110,103,101,100,32,61,32,123,125,44,10,9,9,100,105,114,116,121,32,61,32,102,97,108,115,101,44,10,9,9
+    ,107,101,121,59,10,9,102,111,114,32,40,107,101,121,32,105,110,32,112,114,111,112,101,114,116,105,101,115,41,32
+    ,123,10,9,9,105,102,32,40,33,40,107,101,121,32,105,110,32,111,112,116,105,111,110,115,41,32,38,38,32,33
+    ,40,107,101,121,32,105,110,32,105,110,105,116,105,97,108,41,41,32,123,10,9,9,9,105,110,105,116,105,97,108
+    ,91,107,101,121,93,32,61,32,118,105,101,119,91,107,101,121,93,59,10,9,9,125,10,9,9,105,102,32,40,98
+    ,111,117,110,100,91,107,101,121,93,32,33,61,61,32,112,114,111,112,101,114,116,105,101,115,91,107,101,121,93,41
+    ,32,123,10,9,9,9,99,104,97,110,103,101,100,91,107,101,121,93,32,61,32,112,114,111,112,101,114,116,105,101
+    ,115,91,107,101,121,93,59,10,9,9,9,100,105,114,116,121,32,61,32,116,114,117,101,59,10,9,9,125,10,9
+    ,125,10,9,102,111,114,32,40,107,101,121,32,105,110,32,98,111,117,110,100,41,32,123,10,9,9,105,102,32,40
+    ,33,40,107,101,121,32,105,110,32,112,114,111,112,101,114,116,105,101,115,41,41,32,123,10,9,9,9,99,104,97
+    ,110,103,101,100,91,107,101,121,93,32,61,32,107,101,121,32,105,110,32,111,112,116,105,111,110,115,32,63,32,111
+    ,112,116,105,111,110,115,91,107,101,121,93,32,58,32,105,110,105,116,105,97,108,91,107,101,121,93,59,10,9,9
+    ,9,100,105,114,116,121,32,61,32,116,114,117,101,59,10,9,9,125,10,9,125,10,9,105,102,32,40,100,105,114
+    ,116,121,41,32,123,10,9,9,118,105,101,119,46,97,112,112,108,121,80,114,111,112,101,114,116,105,101,115,40,99
+    ,104,97,110,103,101,100,41,59,10,9,125,10,9,118,105,101,119,46,95,105,110,105,116,105,97,108,95,32,61,32
+    ,105,110,105,116,105,97,108,59,10,9,118,105,101,119,46,95,98,111,117,110,100,95,32,61,32,123,125,59,10,9
+    ,102,111,114,32,40,107,101,121,32,105,110,32,112,114,111,112,101,114,116,105,101,115,41,32,123,10,9,9,118,105
+    ,101,119,46,95,98,111,117,110,100,95,91,107,101,121,93,32,61,32,112,114,111,112,101,114,116,105,101,115,91,107
+    ,101,121,93,59,10,9,125,10,125,10,10,102,117,110,99,116,105,111,110,32,116,101,109,112,108,97,116,101,79,112
+    ,116,105,111,110,115,40,116,101,109,112,108,97,116,101,41,32,123,10,9,114,101,116,117,114,110,32,116,101,109,112
+    ,108,97,116,101,46,112,114,111,112,101,114,116,105,101,115,32,33,61,61,32,118,111,105,100,32,48,32,63,32,116
+    ,101,109,112,108,97,116,101,46,112,114,111,112,101,114,116,105,101,115,32,58,32,123,116,111,112,58,48,44,32,108
+    ,101,102,116,58,48,44,32,119,105,100,116,104,58,84,105,46,85,73,46,83,73,90,69,44,32,104,101,105,103,104
+    ,116,58,84,105,46,85,73,46,83,73,90,69,125,59,10,125,10,10,47,47,32,104,111,111,107,32,99,108,105,99
+    ,107,32,97,110,100,32,102,105,114,101,32,108,105,115,116,118,105,101,119,32,101,118,101,110,116,32,119,105,116,104
+    ,32,98,105,110,100,73,100,10,102,117,110,99,116,105,111,110,32,104,111,111,107,73,116,101,109,67,108,105,99,107
+    ,40,108,105,115,116,118,105,101,119,44,32,118,105,101,119,41,32,123,10,9,118,105,101,119,46,97,100,100,69,118
+    ,101,110,116,76,105,115,116,101,110,101,114,40,39,99,108,105,99,107,39,44,32,102,117,110,99,116,105,111,110,40
+    ,41,32,123,10,9,9,47,47,32,99,104,101,99,107,32,105,102,32,111,116,104,101,114,32,118,105,101,119,32,97
+    ,108,114,101,97,100,121,32,112,114,111,99,101,115,115,101,115,32,116,104,101,32,101,118,101,110,116,10,9,9,105
+    ,102,32,40,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105,111,110
+    ,95,41,32,123,10,9,9,9,47,47,32,115,101,116,32,98,105,110,100,73,100,32,97,110,100,32,102,111,114,119
+    ,97,114,100,32,116,104,101,32,101,118,101,110,116,32,97,103,97,105,110,10,9,9,9,108,105,115,116,118,105,101
+    ,119,46,102,105,114,101,69,118,101,110,116,40,39,105,116,101,109,99,108,105,99,107,39,44,32,123,10,9,9,9
+    ,9,98,105,110,100,73,100,58,32,32,32,32,32,32,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99
+    ,108,105,99,107,95,98,105,110,100,73,100,95,32,63,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99
+    ,108,105,99,107,95,98,105,110,100,73,100,95,32,58,32,118,105,101,119,46,98,105,110,100,73,100,44,10,9,9
+    ,9,9,105,116,101,109,73,100,58,32,32,32,32,32,32,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109
+    ,99,108,105,99,107,95,105,116,101,109,73,100,95,44,10,9,9,9,9,115,101,99,116,105,111,110,58,32,32,32
+    ,32,32,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105,111,110
+    ,95,44,10,9,9,9,9,115,101,99,116,105,111,110,73,110,100,101,120,58,32,108,105,115,116,118,105,101,119,46
+    ,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105,111,110,73,110,100,101,120,95,44,10,9,9,9,9
+    ,105,116,101,109,73,110,100,101,120,58,32,32,32,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108
+    ,105,99,107,95,105,116,101,109,73,110,100,101,120,95,10,9,9,9,125,41,59,10,9,9,9,47,47,32,109,97
+    ,107,101,32,115,117,114,101,32,116,111,32,100,101,108,101,116,101,32,101,118,101,110,116,32,112,114,111,112,101,114
+    ,116,105,101,115,32,115,111,32,119,101,32,99,97,110,32,100,101,116,101,99,116,32,105,116,39,115,32,112,114,111
+    ,99,101,115,115,101,100,10,9,9,9,100,101,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116,101
+    ,109,99,108,105,99,107,95,98,105,110,100,73,100,95,59,10,9,9,9,100,101,108,101,116,101,32,108,105,115,116
+    ,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,105,116,101,109,73,100,95,59,10,9,9,9,100,101
+    ,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,115,101,99,116,105
+    ,111,110,95,59,10,9,9,9,100,101,108,101,116,101,32,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99
+    ,108,105,99,107,95,115,101,99,116,105,111,110,73,110,100,101,120,95,59,10,9,9,9,100,101,108,101,116,101,32
+    ,108,105,115,116,118,105,101,119,46,95,105,116,101,109,99,108,105,99,107,95,105,116,101,109,73,110,100,101,120,95
+    ,59,10,9,9,125,10,9,125,41,59,10,125,10,10,102,117,110,99,116,105,111,110,32,99,114,101,97,116,101,83
     ,101,99,116,105,111,110,73,116,101,109,86,105,101,119,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109,44
-    ,32,116,101,109,112,108,97,116,101,41,59,10,125,10,10,116,104,105,115,46,101,120,112,111,114,116,115,32,61,32
-    ,123,125,59,10,116,104,105,115,46,101,120,112,111,114,116,115,46,99,114,101,97,116,101,83,101,99,116,105,111,110
-    ,73,116,101,109,65,116,32,61,32,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,59,10
-    ,116,104,105,115,46,101,120,112,111,114,116,115,46,99,114,101,97,116,101,83,101,99,116,105,111,110,86,105,101,119
-    ,32,61,32,99,114,101,97,116,101,83,101,99,116,105,111,110,86,105,101,119,59,10,116,104,105,115,46,101,120,112
-    ,111,114,116,115,46,112,114,111,99,101,115,115,84,101,109,112,108,97,116,101,115,32,32,61,32,112,114,111,99,101
-    ,115,115,84,101,109,112,108,97,116,101,115,59,10,0 };
+    ,32,116,101,109,112,108,97,116,101,44,32,112,97,114,101,110,116,44,32,114,111,111,116,41,32,123,10,9,118,97
+    ,114,32,111,112,116,105,111,110,115,32,61,32,116,101,109,112,108,97,116,101,79,112,116,105,111,110,115,40,116,101
+    ,109,112,108,97,116,101,41,59,10,10,9,105,102,32,40,116,101,109,112,108,97,116,101,46,99,114,101,97,116,101
+    ,86,105,101,119,32,61,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9,112,114,111,99,101,115,115,84,101
+    ,109,112,108,97,116,101,115,40,116,101,109,112,108,97,116,101,41,59,10,9,125,10,10,9,118,97,114,32,118,105
+    ,101,119,32,61,32,116,101,109,112,108,97,116,101,46,99,114,101,97,116,101,86,105,101,119,40,111,112,116,105,111
+    ,110,115,41,59,10,10,9,105,102,32,40,116,101,109,112,108,97,116,101,46,98,105,110,100,73,100,32,33,61,61
+    ,32,118,111,105,100,32,48,41,32,123,10,9,9,118,105,101,119,46,98,105,110,100,73,100,32,61,32,116,101,109
+    ,112,108,97,116,101,46,98,105,110,100,73,100,59,10,9,125,10,10,9,47,47,32,114,101,109,101,109,98,101,114
+    ,32,101,118,101,114,121,32,118,105,101,119,32,111,102,32,116,104,101,32,105,116,101,109,32,115,111,32,105,116,32
+    ,99,97,110,32,98,101,32,98,111,117,110,100,32,97,103,97,105,110,32,119,104,101,110,32,114,101,99,121,99,108
+    ,101,100,10,9,114,111,111,116,32,61,32,114,111,111,116,32,124,124,32,118,105,101,119,59,10,9,114,111,111,116
+    ,46,95,118,105,101,119,115,95,32,61,32,114,111,111,116,46,95,118,105,101,119,115,95,32,124,124,32,91,93,59
+    ,10,9,114,111,111,116,46,95,118,105,101,119,115,95,46,112,117,115,104,40,123,118,105,101,119,58,32,118,105,101
+    ,119,44,32,116,101,109,112,108,97,116,101,58,32,116,101,109,112,108,97,116,101,125,41,59,10,10,9,104,111,111
+    ,107,73,116,101,109,67,108,105,99,107,40,108,105,115,116,118,105,101,119,44,32,118,105,101,119,41,59,10,10,9
+    ,98,105,110,100,86,105,101,119,40,118,105,101,119,44,32,105,116,101,109,80,114,111,112,101,114,116,105,101,115,40
+    ,105,116,101,109,44,32,116,101,109,112,108,97,116,101,44,32,111,112,116,105,111,110,115,41,44,32,111,112,116,105
+    ,111,110,115,41,59,10,10,9,105,102,32,40,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101,109,112
+    ,108,97,116,101,115,32,33,61,61,32,118,111,105,100,32,48,32,38,38,32,65,114,114,97,121,46,105,115,65,114
+    ,114,97,121,40,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101,109,112,108,97,116,101,115,41,41,32
+    ,123,10,9,9,102,111,114,32,40,118,97,114,32,105,32,61,32,48,59,32,105,32,60,32,116,101,109,112,108,97
+    ,116,101,46,99,104,105,108,100,84,101,109,112,108,97,116,101,115,46,108,101,110,103,116,104,59,32,105,43,43,41
+    ,32,123,10,9,9,9,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,86,105,101,119,40,108,105
+    ,115,116,118,105,101,119,44,32,105,116,101,109,44,32,116,101,109,112,108,97,116,101,46,99,104,105,108,100,84,101
+    ,109,112,108,97,116,101,115,91,105,93,44,32,118,105,101,119,44,32,114,111,111,116,41,59,10,9,9,125,10,9
+    ,125,10,9,105,102,32,40,112,97,114,101,110,116,32,33,61,61,32,118,111,105,100,32,48,41,32,123,10,9,9
+    ,112,97,114,101,110,116,46,97,100,100,40,118,105,101,119,41,59,10,9,125,10,9,114,101,116,117,114,110,32,118
+    ,105,101,119,59,10,125,10,10,47,47,32,67,114,101,97,116,101,32,108,105,115,116,32,105,116,101,109,32,102,111
+    ,114,32,99,117,115,116,111,109,32,116,101,109,112,108,97,116,101,10,102,117,110,99,116,105,111,110,32,99,114,101
+    ,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,40,108,105,115,116,118,105,101,119,44,32,115,101,99
+    ,116,105,111,110,44,32,105,116,101,109,41,32,123,10,9,112,114,101,112,97,114,101,76,105,115,116,86,105,101,119
+    ,40,108,105,115,116,118,105,101,119,41,59,10,9,114,101,116,117,114,110,32,99,114,101,97,116,101,83,101,99,116
+    ,105,111,110,73,116,101,109,86,105,101,119,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109,44,32,108,111
+    ,111,107,117,112,84,101,109,112,108,97,116,101,40,108,105,115,116,118,105,101,119,44,32,105,116,101,109,41,41,59
+    ,10,125,10,10,47,47,32,66,105,110,100,32,97,32,114,101,99,121,99,108,101,100,32,105,116,101,109,32,118,105
+    ,101,119,44,32,99,114,101,97,116,101,100,32,102,111,114,32,116,104,101,32,115,97,109,101,32,116,101,109,112,108
+    ,97,116,101,44,32,116,111,32,97,110,111,116,104,101,114,32,105,116,101,109,10,102,117,110,99,116,105,111,110,32
+    ,98,105,110,100,83,101,99,116,105,111,110,73,116,101,109,65,116,40,108,105,115,116,118,105,101,119,44,32,115,101
+    ,99,116,105,111,110,44,32,105,116,101,109,44,32,118,105,101,119,41,32,123,10,9,118,97,114,32,118,105,101,119
+    ,115,32,61,32,118,105,101,119,46,95,118,105,101,119,115,95,59,10,9,102,111,114,32,40,118,97,114,32,105,32
+    ,61,32,48,59,32,105,32,60,32,118,105,101,119,115,46,108,101,110,103,116,104,59,32,105,43,43,41,32,123,10
+    ,9,9,118,97,114,32,111,112,116,105,111,110,115,32,61,32,116,101,109,112,108,97,116,101,79,112,116,105,111,110
+    ,115,40,118,105,101,119,115,91,105,93,46,116,101,109,112,108,97,116,101,41,59,10,9,9,98,105,110,100,86,105
+    ,101,119,40,118,105,101,119,115,91,105,93,46,118,105,101,119,44,32,105,116,101,109,80,114,111,112,101,114,116,105
+    ,101,115,40,105,116,101,109,44,32,118,105,101,119,115,91,105,93,46,116,101,109,112,108,97,116,101,44,32,111,112
+    ,116,105,111,110,115,41,44,32,111,112,116,105,111,110,115,41,59,10,9,125,10,9,114,101,116,117,114,110,32,118
+    ,105,101,119,59,10,125,10,10,116,104,105,115,46,101,120,112,111,114,116,115,32,61,32,123,125,59,10,116,104,105
+    ,115,46,101,120,112,111,114,116,115,46,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,32
+    ,61,32,99,114,101,97,116,101,83,101,99,116,105,111,110,73,116,101,109,65,116,59,10,116,104,105,115,46,101,120
+    ,112,111,114,116,115,46,98,105,110,100,83,101,99,116,105,111,110,73,116,101,109,65,116,32,61,32,98,105,110,100
+    ,83,101,99,116,105,111,110,73,116,101,109,65,116,59,10,116,104,105,115,46,101,120,112,111,114,116,115,46,99,114
+    ,101,97,116,101,83,101,99,116,105,111,110,86,105,101,119,32,61,32,99,114,101,97,116,101,83,101,99,116,105,111
+    ,110,86,105,101,119,59,10,116,104,105,115,46,101,120,112,111,114,116,115,46,112,114,111,99,101,115,115,84,101,109
+    ,112,108,97,116,101,115,32,32,61,32,112,114,111,99,101,115,115,84,101,109,112,108,97,116,101,115,59,10,47,47
+    ,32,117,115,101,100,32,98,121,32,116,104,101,32,110,97,116,105,118,101,32,116,101,109,112,108,97,116,101,32,99
+    ,111,109,112,105,108,101,114,44,32,115,101,101,32,84,105,116,97,110,105,117,109,58,58,85,73,58,58,76,105,115
+    ,116,73,116,101,109,84,101,109,112,108,97,116,101,10,116,104,105,115,46,101,120,112,111,114,116,115,46,112,114,101
+    ,112,97,114,101,76,105,115,116,86,105,101,119,32,32,32,61,32,112,114,101,112,97,114,101,76,105,115,116,86,105
+    ,101,119,59,10,116,104,105,115,46,101,120,112,111,114,116,115,46,116,101,109,112,108,97,116,101,79,112,116,105,111
+    ,110,115,32,32,32,61,32,116,101,109,112,108,97,116,101,79,112,116,105,111,110,115,59,10,116,104,105,115,46,101
+    ,120,112,111,114,116,115,46,104,111,111,107,73,116,101,109,67,108,105,99,107,32,32,32,32,32,61,32,104,111,111
+    ,107,73,116,101,109,67,108,105,99,107,59,10,0 };
 
@@ -14,6 +14,7 @@
 
 #define TITANIUM_NOEXCEPT_ENABLE
 #define TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+#define TITANIUM_THREAD_LOCAL_ENABLE
 
 // See http://msdn.microsoft.com/en-us/library/b0084kay.aspx for the
 // list of Visual C++ "Predefined Macros". Visual Studio 2013 Update 3
@@ -40,12 +41,26 @@
 
 #endif  // #defined(_MSC_VER) && _MSC_VER <= 1900
 
+#if defined(_MSC_VER) && _MSC_VER < 1900
+// thread_local arrived with VS 2015. VS 2013 only has __declspec(thread),
+// which works for types without constructors and with constant
+// initializers.
+#undef TITANIUM_THREAD_LOCAL_ENABLE
+#endif
+
 #ifdef TITANIUM_NOEXCEPT_ENABLE
 #define TITANIUM_NOEXCEPT noexcept
 #else
 #define TITANIUM_NOEXCEPT
 #endif
 
+// Thread local storage for trivial types with constant initializers
+#ifdef TITANIUM_THREAD_LOCAL_ENABLE
+#define TITANIUM_THREAD_LOCAL thread_local
+#else
+#define TITANIUM_THREAD_LOCAL __declspec(thread)
+#endif
+
 #ifdef TITANIUM_THREAD_SAFE
 #include <mutex>
 #endif
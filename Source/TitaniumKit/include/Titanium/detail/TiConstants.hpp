@@ -0,0 +1,98 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TICONSTANTS_HPP_
+#define _TITANIUM_DETAIL_TICONSTANTS_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @struct
+
+		  @abstract One enumerator of a constant table and its name.
+
+		  @discussion A constant table is a static const array of these,
+		  declared once per enum:
+
+		    static const detail::TiConstant<UNIT> unitNames[] = {
+		      { UNIT::Cm, "UNIT_CM" },
+		      { UNIT::Dip, "UNIT_DIP" },
+		    };
+
+		  As a plain aggregate the table is initialized statically, so it
+		  costs nothing at startup and never allocates. FindConstant scans
+		  it, which for tables this small is cheaper than hashing the name.
+		*/
+		template<typename E>
+		struct TiConstant
+		{
+			E value;
+			const char* name;
+		};
+
+		// Whether every name and every value of table appears once
+		template<typename E, std::size_t N>
+		bool TiConstantsUnique(const TiConstant<E> (&table)[N])
+		{
+			for (std::size_t i = 0; i < N; i++) {
+				for (std::size_t j = i + 1; j < N; j++) {
+					if (table[i].value == table[j].value || std::strcmp(table[i].name, table[j].name) == 0) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		// Entry named name, or nullptr
+		template<typename E, std::size_t N>
+		const TiConstant<E>* FindConstant(const TiConstant<E> (&table)[N], const std::string& name)
+		{
+			const auto data = name.c_str();
+			for (const auto& entry : table) {
+				if (std::strcmp(entry.name, data) == 0) {
+					return &entry;
+				}
+			}
+			return nullptr;
+		}
+
+		// Entry of value, or nullptr
+		template<typename E, std::size_t N>
+		const TiConstant<E>* FindConstant(const TiConstant<E> (&table)[N], const E& value)
+		{
+			for (const auto& entry : table) {
+				if (entry.value == value) {
+					return &entry;
+				}
+			}
+			return nullptr;
+		}
+
+		// Entry whose value has the underlying value, or nullptr
+		template<typename E, std::size_t N>
+		const TiConstant<E>* FindConstant(const TiConstant<E> (&table)[N], const typename std::underlying_type<E>::type& value)
+		{
+			for (const auto& entry : table) {
+				if (static_cast<typename std::underlying_type<E>::type>(entry.value) == value) {
+					return &entry;
+				}
+			}
+			return nullptr;
+		}
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TICONSTANTS_HPP_
@@ -0,0 +1,309 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIITEMSTORE_HPP_
+#define _TITANIUM_DETAIL_TIITEMSTORE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Compact storage for the items of a list section.
+
+		  @discussion An item is a template name plus properties and
+		  bindings, each a set of named values. Names and templates are
+		  interned once per store. Items with the same template and the
+		  same property and binding names share a shape: the sorted key
+		  ids naming each value slot. An item itself is then only its
+		  shape and the offset of its values in one flat array, so a
+		  section of ten thousand rows holds a handful of shapes instead
+		  of twenty thousand hash maps.
+
+		  Values of erased or reshaped items stay in the array until they
+		  outnumber the live ones, then the array is compacted. V only
+		  needs to be copyable. Not thread safe.
+		*/
+		template<typename V>
+		class TiItemStore final
+		{
+		public:
+			/*!
+			  @struct
+			  @discussion Slot layout shared by items. keys holds the
+			  property key ids, sorted, then the binding key ids, sorted.
+			*/
+			struct Shape
+			{
+				std::uint32_t templateId;
+				std::uint32_t propertyCount;
+				std::vector<std::uint32_t> keys;
+			};
+
+			TiItemStore()
+				: stale__(0)
+			{
+			}
+
+			TiItemStore(const TiItemStore&) = delete;
+			TiItemStore& operator=(const TiItemStore&) = delete;
+
+			std::uint32_t InternKey(const std::string& key)
+			{
+				return Intern(key, keys__, keyIds__);
+			}
+
+			std::uint32_t InternTemplate(const std::string& templateId)
+			{
+				return Intern(templateId, templates__, templateIds__);
+			}
+
+			const std::string& get_key(const std::uint32_t& keyId) const
+			{
+				return keys__.at(keyId);
+			}
+
+			/*!
+			  @method
+			  @abstract Insert
+			  @discussion Stores an item before index. Properties and
+			  bindings are ranges of (name, value) pairs such as maps.
+			*/
+			template<typename Properties, typename Bindings>
+			void Insert(const std::size_t& index, const std::string& templateId, const Properties& properties, const Bindings& bindings)
+			{
+				const auto item = Store(templateId, properties, bindings);
+				items__.insert(items__.begin() + std::min(index, items__.size()), item);
+			}
+
+			/*!
+			  @method
+			  @abstract Update
+			  @discussion Replaces the item at index, reusing its slots
+			  when the shape is unchanged.
+			*/
+			template<typename Properties, typename Bindings>
+			void Update(const std::size_t& index, const std::string& templateId, const Properties& properties, const Bindings& bindings)
+			{
+				auto& item = items__.at(index);
+				const auto shapeId = ShapeOf(templateId, properties, bindings);
+				if (shapeId == item.shape) {
+					auto offset = item.offset;
+					for (const auto& slot : slots__) {
+						values__[offset++] = *slot.second;
+					}
+					return;
+				}
+				stale__ += shapes__[item.shape].keys.size();
+				item = Append(shapeId);
+				Compact();
+			}
+
+			void Erase(const std::size_t& index, const std::size_t& count)
+			{
+				const auto first = items__.begin() + index;
+				for (auto it = first; it != first + count; ++it) {
+					stale__ += shapes__[it->shape].keys.size();
+				}
+				items__.erase(first, first + count);
+				Compact();
+			}
+
+			void Clear()
+			{
+				items__.clear();
+				values__.clear();
+				stale__ = 0;
+			}
+
+			std::size_t size() const
+			{
+				return items__.size();
+			}
+
+			const std::string& get_templateAt(const std::size_t& index) const
+			{
+				return templates__[shapes__[items__.at(index).shape].templateId];
+			}
+
+			const Shape& get_shapeAt(const std::size_t& index) const
+			{
+				return shapes__[items__.at(index).shape];
+			}
+
+			// Property value of the item at index, nullptr when it has none
+			const V* FindProperty(const std::size_t& index, const std::uint32_t& keyId) const
+			{
+				const auto& item = items__.at(index);
+				const auto& keys = shapes__[item.shape].keys;
+				return Find(item, keys.begin(), keys.begin() + shapes__[item.shape].propertyCount, keyId);
+			}
+
+			const V* FindBinding(const std::size_t& index, const std::uint32_t& keyId) const
+			{
+				const auto& item = items__.at(index);
+				const auto& keys = shapes__[item.shape].keys;
+				return Find(item, keys.begin() + shapes__[item.shape].propertyCount, keys.end(), keyId);
+			}
+
+			/*!
+			  @method
+			  @abstract ForEach
+			  @discussion Calls callback(name, value, isBinding) for every
+			  value of the item at index, properties first.
+			*/
+			template<typename Callback>
+			void ForEach(const std::size_t& index, const Callback& callback) const
+			{
+				const auto& item = items__.at(index);
+				const auto& shape = shapes__[item.shape];
+				for (std::uint32_t i = 0; i < shape.keys.size(); i++) {
+					callback(keys__[shape.keys[i]], values__[item.offset + i], i >= shape.propertyCount);
+				}
+			}
+
+			std::size_t get_shapeCount() const
+			{
+				return shapes__.size();
+			}
+
+			// Values held, including stale ones not compacted yet
+			std::size_t get_valueCount() const
+			{
+				return values__.size();
+			}
+
+		private:
+			struct Item
+			{
+				std::uint32_t shape;
+				std::uint32_t offset;
+			};
+
+			static std::uint32_t Intern(const std::string& name, std::vector<std::string>& names, std::unordered_map<std::string, std::uint32_t>& ids)
+			{
+				const auto found = ids.find(name);
+				if (found != ids.end()) {
+					return found->second;
+				}
+				const auto id = static_cast<std::uint32_t>(names.size());
+				names.push_back(name);
+				ids.emplace(name, id);
+				return id;
+			}
+
+			// Fills slots__ with the values in slot order and returns their shape
+			template<typename Properties, typename Bindings>
+			std::uint32_t ShapeOf(const std::string& templateId, const Properties& properties, const Bindings& bindings)
+			{
+				const auto byKey = [](const std::pair<std::uint32_t, const V*>& a, const std::pair<std::uint32_t, const V*>& b) {
+					return a.first < b.first;
+				};
+				slots__.clear();
+				for (const auto& property : properties) {
+					slots__.emplace_back(InternKey(property.first), &property.second);
+				}
+				const auto propertyCount = static_cast<std::uint32_t>(slots__.size());
+				std::sort(slots__.begin(), slots__.end(), byKey);
+				for (const auto& binding : bindings) {
+					slots__.emplace_back(InternKey(binding.first), &binding.second);
+				}
+				std::sort(slots__.begin() + propertyCount, slots__.end(), byKey);
+
+				signature__.clear();
+				signature__.push_back(InternTemplate(templateId));
+				signature__.push_back(propertyCount);
+				for (const auto& slot : slots__) {
+					signature__.push_back(slot.first);
+				}
+				const auto found = shapeIds__.find(signature__);
+				if (found != shapeIds__.end()) {
+					return found->second;
+				}
+
+				Shape shape;
+				shape.templateId = signature__[0];
+				shape.propertyCount = propertyCount;
+				shape.keys.assign(signature__.begin() + 2, signature__.end());
+				const auto shapeId = static_cast<std::uint32_t>(shapes__.size());
+				shapes__.push_back(std::move(shape));
+				shapeIds__.emplace(signature__, shapeId);
+				return shapeId;
+			}
+
+			template<typename Properties, typename Bindings>
+			Item Store(const std::string& templateId, const Properties& properties, const Bindings& bindings)
+			{
+				return Append(ShapeOf(templateId, properties, bindings));
+			}
+
+			// Appends the values in slots__ for an item of the shape
+			Item Append(const std::uint32_t& shapeId)
+			{
+				Item item { shapeId, static_cast<std::uint32_t>(values__.size()) };
+				for (const auto& slot : slots__) {
+					values__.push_back(*slot.second);
+				}
+				return item;
+			}
+
+			const V* Find(const Item& item, const std::vector<std::uint32_t>::const_iterator& first, const std::vector<std::uint32_t>::const_iterator& last, const std::uint32_t& keyId) const
+			{
+				const auto found = std::lower_bound(first, last, keyId);
+				if (found == last || *found != keyId) {
+					return nullptr;
+				}
+				return &values__[item.offset + (found - shapes__[item.shape].keys.begin())];
+			}
+
+			void Compact()
+			{
+				if (stale__ * 2 <= values__.size()) {
+					return;
+				}
+				std::vector<V> values;
+				values.reserve(values__.size() - stale__);
+				for (auto& item : items__) {
+					const auto offset = item.offset;
+					item.offset = static_cast<std::uint32_t>(values.size());
+					const auto count = shapes__[item.shape].keys.size();
+					values.insert(values.end(), values__.begin() + offset, values__.begin() + offset + count);
+				}
+				values__.swap(values);
+				stale__ = 0;
+			}
+
+			std::vector<std::string> keys__;
+			std::unordered_map<std::string, std::uint32_t> keyIds__;
+			std::vector<std::string> templates__;
+			std::unordered_map<std::string, std::uint32_t> templateIds__;
+			std::vector<Shape> shapes__;
+			// Template id, property count, then the key ids of a shape
+			std::map<std::vector<std::uint32_t>, std::uint32_t> shapeIds__;
+			std::vector<Item> items__;
+			std::vector<V> values__;
+			std::size_t stale__;
+
+			// Scratch reused by every store so lookups do not allocate
+			std::vector<std::pair<std::uint32_t, const V*>> slots__;
+			std::vector<std::uint32_t> signature__;
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIITEMSTORE_HPP_
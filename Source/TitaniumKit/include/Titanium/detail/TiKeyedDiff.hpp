@@ -0,0 +1,65 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIKEYEDDIFF_HPP_
+#define _TITANIUM_DETAIL_TIKEYEDDIFF_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiDiffRange
+		{
+			std::uint32_t index;
+			std::uint32_t count;
+		};
+
+		/*!
+		  @struct
+
+		  @abstract Mutations turning an old keyed list into a new one.
+
+		  @discussion Applying the deletes in order, then the inserts in
+		  order, to the old list yields the new one. Deletes are old
+		  indexes from the back to the front, so each stays valid while
+		  applying them; inserts are new indexes from the front to the
+		  back. A moved item is deleted and inserted again. Kept pairs
+		  each new index with the old index of an item left in place.
+		*/
+		struct TiKeyedDiffResult
+		{
+			bool valid;
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::vector<TiDiffRange> deletes;
+			std::vector<TiDiffRange> inserts;
+			std::vector<std::pair<std::uint32_t, std::uint32_t>> kept;
+#pragma warning(pop)
+		};
+
+		/*!
+		  @method
+
+		  @abstract Diffs two lists of item keys.
+
+		  @discussion Keys are hashed to match old items to new ones, and
+		  the longest run of matched items already in order stays in
+		  place, so the fewest items move. O(n log n) in the longest
+		  list. The result is not valid when either list repeats a key.
+		*/
+		TITANIUMKIT_EXPORT TiKeyedDiffResult TiKeyedDiff(const std::vector<std::string>& oldKeys, const std::vector<std::string>& newKeys);
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIKEYEDDIFF_HPP_
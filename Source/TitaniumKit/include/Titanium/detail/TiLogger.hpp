@@ -9,13 +9,25 @@
 #ifndef _TITANIUM_DETAIL_TILOGGER_HPP_
 #define _TITANIUM_DETAIL_TILOGGER_HPP_
 
+#include "Titanium/detail/TiBase.hpp"
 #include "Titanium/detail/TiLoggerPolicyConsole.hpp"
 #include "Titanium/detail/TiLoggerPolicyAPI.hpp"
+#include "Titanium/detail/TiLoggerRing.hpp"
 #include <sstream>
 #include <iomanip>
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <memory>
+#include <thread>
+
+// Severities below this are compiled out (0 = TRACE ... 4 = ERROR).
+#ifndef TITANIUM_LOG_MIN_SEVERITY
+#define TITANIUM_LOG_MIN_SEVERITY 0
+#endif
 
 namespace Titanium
 {
@@ -43,6 +55,13 @@ namespace Titanium
 		  }
 		  TITANIUM_LOG_WARN("After loop.");
 		  TITANIUM_LOG_ERROR("All good things come to an end.");
+
+		  Messages below the minimum severity (TiLoggerLevel at runtime,
+		  TITANIUM_LOG_MIN_SEVERITY at compile time) are dropped before their
+		  arguments are evaluated. The rest are formatted on the calling
+		  thread, queued in a lock-free ring and written out in batches by a
+		  background thread. When the ring is full messages are dropped and
+		  the writer reports how many.
 		*/
 
 		enum class TITANIUMKIT_EXPORT TiLoggerSeverityType {
@@ -53,8 +72,90 @@ namespace Titanium
 			Ti_ERROR
 		};
 
+		/*!
+		  @class
+
+		  @abstract Runtime minimum severity shared by all loggers.
+
+		  @discussion Defaults to Ti_TRACE in debug builds and Ti_INFO when
+		  NDEBUG is defined.
+		*/
+		class TITANIUMKIT_EXPORT TiLoggerLevel final
+		{
+		public:
+			static void Set(const TiLoggerSeverityType& severity);
+			static TiLoggerSeverityType Get();
+
+			static bool IsEnabled(const TiLoggerSeverityType& severity)
+			{
+				return static_cast<int>(severity) >= min_severity__.load(std::memory_order_relaxed);
+			}
+
+		private:
+			static std::atomic<int> min_severity__;
+		};
+
+		/*!
+		  @class
+
+		  @abstract What TiLoggerFlushAll, TiLoggerShutdown and the crash
+		  handler need from a logger, whatever its policy.
+		*/
+		class TITANIUMKIT_EXPORT TiLoggerInterface
+		{
+		public:
+			virtual ~TiLoggerInterface() = default;
+
+			// Writes out everything queued so far on the calling thread
+			virtual void Flush() = 0;
+
+			// Same as Flush, but gives up instead of waiting for the writer
+			virtual void TryFlush() = 0;
+
+			// Stops the writer thread; later messages are written synchronously
+			virtual void Stop() = 0;
+		};
+
+		/*!
+		  @function
+		  @abstract TiLoggerRegister
+		  @discussion Registers a logger with TiLoggerFlushAll, TiLoggerShutdown
+		  and the crash handler. TiLogger instances register themselves.
+		*/
+		TITANIUMKIT_EXPORT void TiLoggerRegister(const std::weak_ptr<TiLoggerInterface>& logger);
+
+		/*!
+		  @function
+		  @abstract TiLoggerFlushAll
+		  @discussion Writes out every queued message of every logger on the
+		  calling thread.
+		*/
+		TITANIUMKIT_EXPORT void TiLoggerFlushAll();
+
+		/*!
+		  @function
+		  @abstract TiLoggerShutdown
+		  @discussion Writes out every queued message and stops the writer
+		  threads. The application calls this when it shuts down, so that the
+		  threads are not joined from a static destructor while the loader
+		  lock is held. Messages logged afterwards are written synchronously.
+		*/
+		TITANIUMKIT_EXPORT void TiLoggerShutdown();
+
+		/*!
+		  @function
+		  @abstract TiLoggerInstallCrashHandler
+		  @discussion Flushes all loggers from std::terminate, so the messages
+		  leading up to an unhandled exception are not lost in the ring. The
+		  application installs it at startup. Loggers whose writer is busy at
+		  the time are skipped rather than waited for. Fatal signals are not
+		  handled: flushing takes locks and allocates, which is not safe in a
+		  signal handler, so those crashes keep only what was already written.
+		*/
+		TITANIUMKIT_EXPORT void TiLoggerInstallCrashHandler();
+
 		template <typename TiLoggerPolicy>
-		class TiLogger final
+		class TiLogger final : public TiLoggerInterface
 		{
 		public:
 			template <typename...Args>
@@ -71,17 +172,45 @@ namespace Titanium
 			template <TiLoggerSeverityType severity, typename... Args>
 			void Print(Args... args);
 
+			/*!
+			  @method
+			  @abstract Flush
+			  @discussion Writes out everything queued so far on the calling thread.
+			*/
+			virtual void Flush() override;
+			virtual void TryFlush() override;
+			virtual void Stop() override;
+
+			// Messages dropped because the ring was full
+			std::size_t get_dropped() const
+			{
+				return dropped__;
+			}
+
+			static const std::size_t Capacity = 8192;
+
 		private:
+			struct Record
+			{
+				TiLoggerSeverityType severity;
+				std::string message;
+			};
+
 			template <typename...Args>
 			TiLogger(Args&&... args);
 
-			~TiLogger() = default;
+			virtual ~TiLogger();
 
 			// Core printing functionality.
-			void PrintImpl();
+			static void PrintImpl(std::ostringstream&);
 
 			template <typename First, typename... Rest>
-			void PrintImpl(First first_parameter, Rest... rest);
+			static void PrintImpl(std::ostringstream& stream, First first_parameter, Rest... rest);
+
+			void Run();
+
+			// Writes out what is queued. Called with consumer_mutex__ held.
+			std::size_t Drain();
 
 			// This struct only exists so that a custom deleter can be passed to
 			// std::shared_ptr<TiLogger<T>> while keeping the TiLogger<T> destructor
@@ -95,9 +224,17 @@ namespace Titanium
 			};
 
 			std::shared_ptr<TiLoggerPolicy> ti_log_policy__;
-			uint32_t log_line_number__{0};
-			std::ostringstream log_stream__;
-			std::mutex ti_logger_mutex__;
+			TiLoggerRing<Record> ring__ { Capacity };
+			std::atomic<std::size_t> dropped__ { 0 };
+			std::size_t reported_dropped__ { 0 };
+
+			// consumer_mutex__ - only one thread may pop from the ring at a time
+			std::mutex consumer_mutex__;
+			std::mutex wake_mutex__;
+			std::condition_variable wake__;
+			std::atomic<bool> writer_idle__ { false };
+			std::atomic<bool> stopping__ { false };
+			std::thread writer__;
 		};
 
 		template <typename TiLoggerPolicy>
@@ -105,6 +242,25 @@ namespace Titanium
 		TiLogger<TiLoggerPolicy>::TiLogger(Args&&...args)
 		    : ti_log_policy__(std::make_shared<TiLoggerPolicy>(std::forward<Args>(args)...))
 		{
+			writer__ = std::thread(&TiLogger<TiLoggerPolicy>::Run, this);
+		}
+
+		template <typename TiLoggerPolicy>
+		TiLogger<TiLoggerPolicy>::~TiLogger()
+		{
+			// Normally TiLoggerShutdown has stopped the writer already
+			Stop();
+		}
+
+		template <typename TiLoggerPolicy>
+		void TiLogger<TiLoggerPolicy>::Stop()
+		{
+			stopping__ = true;
+			wake__.notify_one();
+			if (writer__.joinable() && writer__.get_id() != std::this_thread::get_id()) {
+				writer__.join();
+			}
+			Flush();
 		}
 
 		template <typename TiLoggerPolicy>
@@ -114,7 +270,8 @@ namespace Titanium
 			static std::shared_ptr<TiLogger<TiLoggerPolicy>> instance;
 			static std::once_flag of;
 			std::call_once(of, [&args...] {
-      instance = std::shared_ptr<TiLogger<TiLoggerPolicy>>(new TiLogger<TiLoggerPolicy>(std::forward<Args>(args)...), deleter{});
+				instance = std::shared_ptr<TiLogger<TiLoggerPolicy>>(new TiLogger<TiLoggerPolicy>(std::forward<Args>(args)...), deleter{});
+				TiLoggerRegister(instance);
 			});
 
 			return instance;
@@ -124,48 +281,130 @@ namespace Titanium
 		template <TiLoggerSeverityType severity, typename... Args>
 		void TiLogger<TiLoggerPolicy>::Print(Args... args)
 		{
-			std::lock_guard<std::mutex> lock(ti_logger_mutex__);
+			if (static_cast<int>(severity) < TITANIUM_LOG_MIN_SEVERITY || !TiLoggerLevel::IsEnabled(severity)) {
+				return;
+			}
+
+#ifdef TITANIUM_THREAD_LOCAL_ENABLE
+			// Each thread formats into its own stream, so producers never contend.
+			static thread_local std::ostringstream log_stream;
+			log_stream.str("");
+#else
+			std::ostringstream log_stream;
+#endif
 
 			// The Debug and Error severity strings (i.e. "DEBUG" and "ERROR")
 			// are the longest of the three severity strings, and each is 5
 			// characters long. Since we want all of the severity types to have
 			// the same width on output, we set it to 5.
-			log_stream__ << std::setw(5) << std::left;
+			log_stream << std::setw(5) << std::left;
 
 			switch (severity) {
 				case TiLoggerSeverityType::Ti_TRACE:
-					log_stream__ << "[TRACE] ";
+					log_stream << "[TRACE] ";
 					break;
 				case TiLoggerSeverityType::Ti_DEBUG:
-					log_stream__ << "[DEBUG] ";
+					log_stream << "[DEBUG] ";
 					break;
 				case TiLoggerSeverityType::Ti_INFO:
-					log_stream__ << "[INFO] ";
+					log_stream << "[INFO] ";
 					break;
 				case TiLoggerSeverityType::Ti_WARN:
-					log_stream__ << "[WARN] ";
+					log_stream << "[WARN] ";
 					break;
 				case TiLoggerSeverityType::Ti_ERROR:
-					log_stream__ << "[ERROR] ";
+					log_stream << "[ERROR] ";
 					break;
 			};
 
-			PrintImpl(args...);
+			PrintImpl(log_stream, args...);
+
+			if (!ring__.TryPush({ severity, log_stream.str() })) {
+				dropped__++;
+				return;
+			}
+			if (stopping__) {
+				Flush();
+			} else if (writer_idle__.load(std::memory_order_acquire)) {
+				wake__.notify_one();
+			}
 		}
 
 		template <typename TiLoggerPolicy>
-		void TiLogger<TiLoggerPolicy>::PrintImpl()
+		void TiLogger<TiLoggerPolicy>::PrintImpl(std::ostringstream&)
 		{
-			ti_log_policy__->Write(log_stream__.str());
-			log_stream__.str("");
 		}
 
 		template <typename TiLoggerPolicy>
 		template <typename First, typename... Rest>
-		void TiLogger<TiLoggerPolicy>::PrintImpl(First first_parameter, Rest... rest)
+		void TiLogger<TiLoggerPolicy>::PrintImpl(std::ostringstream& stream, First first_parameter, Rest... rest)
+		{
+			stream << first_parameter;
+			PrintImpl(stream, rest...);
+		}
+
+		template <typename TiLoggerPolicy>
+		void TiLogger<TiLoggerPolicy>::Flush()
+		{
+			std::lock_guard<std::mutex> lock(consumer_mutex__);
+			Drain();
+		}
+
+		template <typename TiLoggerPolicy>
+		void TiLogger<TiLoggerPolicy>::TryFlush()
 		{
-			log_stream__ << first_parameter;
-			PrintImpl(rest...);
+			std::unique_lock<std::mutex> lock(consumer_mutex__, std::try_to_lock);
+			if (lock.owns_lock()) {
+				Drain();
+			}
+		}
+
+		template <typename TiLoggerPolicy>
+		std::size_t TiLogger<TiLoggerPolicy>::Drain()
+		{
+			std::size_t count = 0;
+			Record record;
+			while (ring__.TryPop(record)) {
+				ti_log_policy__->Write(record.message);
+				count++;
+			}
+
+			const auto dropped = dropped__.load();
+			if (dropped != reported_dropped__) {
+				std::ostringstream message;
+				message << "[WARN]  TiLogger: dropped " << (dropped - reported_dropped__) << " messages";
+				ti_log_policy__->Write(message.str());
+				reported_dropped__ = dropped;
+				count++;
+			}
+
+			// One flush per batch instead of one per line
+			if (count > 0) {
+				ti_log_policy__->Flush();
+			}
+			return count;
+		}
+
+		template <typename TiLoggerPolicy>
+		void TiLogger<TiLoggerPolicy>::Run()
+		{
+			while (!stopping__) {
+				std::size_t written = 0;
+				{
+					std::lock_guard<std::mutex> lock(consumer_mutex__);
+					written = Drain();
+				}
+				if (written > 0) {
+					continue;
+				}
+
+				// Producers only notify while the writer is idle; the timeout covers
+				// a notification that slips in between the check and the wait.
+				std::unique_lock<std::mutex> lock(wake_mutex__);
+				writer_idle__.store(true, std::memory_order_release);
+				wake__.wait_for(lock, std::chrono::milliseconds(50));
+				writer_idle__.store(false, std::memory_order_release);
+			}
 		}
 
 #ifdef TITANIUM_LOGGING_ENABLE
@@ -176,16 +415,25 @@ namespace Titanium
 		// Logging with Ti.API
 		using TiAPILogger_t = TiLogger<TiLoggerPolicyAPI>;
 
-#define TITANIUM_LOG_TRACE Titanium::detail::TiLogger_t::Instance()->Print<Titanium::detail::TiLoggerSeverityType::Ti_TRACE>
-#define TITANIUM_LOG_DEBUG Titanium::detail::TiLogger_t::Instance()->Print<Titanium::detail::TiLoggerSeverityType::Ti_DEBUG>
-#define TITANIUM_LOG_INFO Titanium::detail::TiLogger_t::Instance()->Print<Titanium::detail::TiLoggerSeverityType::Ti_INFO>
-#define TITANIUM_LOG_WARN Titanium::detail::TiLogger_t::Instance()->Print<Titanium::detail::TiLoggerSeverityType::Ti_WARN>
-#define TITANIUM_LOG_ERROR Titanium::detail::TiLogger_t::Instance()->Print<Titanium::detail::TiLoggerSeverityType::Ti_ERROR>
-#define TITANIUM_API_LOG_TRACE Titanium::detail::TiAPILogger_t::Instance(get_context())->Print<Titanium::detail::TiLoggerSeverityType::Ti_TRACE>
-#define TITANIUM_API_LOG_DEBUG Titanium::detail::TiAPILogger_t::Instance(get_context())->Print<Titanium::detail::TiLoggerSeverityType::Ti_DEBUG>
-#define TITANIUM_API_LOG_INFO Titanium::detail::TiAPILogger_t::Instance(get_context())->Print<Titanium::detail::TiLoggerSeverityType::Ti_INFO>
-#define TITANIUM_API_LOG_WARN Titanium::detail::TiAPILogger_t::Instance(get_context())->Print<Titanium::detail::TiLoggerSeverityType::Ti_WARN>
-#define TITANIUM_API_LOG_ERROR Titanium::detail::TiAPILogger_t::Instance(get_context())->Print<Titanium::detail::TiLoggerSeverityType::Ti_ERROR>
+// Checks the level before touching the logger, so filtered messages cost
+// one relaxed load and their arguments are never evaluated.
+#define TITANIUM_LOG_IF(LOGGER, SEVERITY, ...) \
+	do { \
+		if (static_cast<int>(SEVERITY) >= TITANIUM_LOG_MIN_SEVERITY && Titanium::detail::TiLoggerLevel::IsEnabled(SEVERITY)) { \
+			LOGGER->Print<SEVERITY>(__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define TITANIUM_LOG_TRACE(...) TITANIUM_LOG_IF(Titanium::detail::TiLogger_t::Instance(), Titanium::detail::TiLoggerSeverityType::Ti_TRACE, __VA_ARGS__)
+#define TITANIUM_LOG_DEBUG(...) TITANIUM_LOG_IF(Titanium::detail::TiLogger_t::Instance(), Titanium::detail::TiLoggerSeverityType::Ti_DEBUG, __VA_ARGS__)
+#define TITANIUM_LOG_INFO(...) TITANIUM_LOG_IF(Titanium::detail::TiLogger_t::Instance(), Titanium::detail::TiLoggerSeverityType::Ti_INFO, __VA_ARGS__)
+#define TITANIUM_LOG_WARN(...) TITANIUM_LOG_IF(Titanium::detail::TiLogger_t::Instance(), Titanium::detail::TiLoggerSeverityType::Ti_WARN, __VA_ARGS__)
+#define TITANIUM_LOG_ERROR(...) TITANIUM_LOG_IF(Titanium::detail::TiLogger_t::Instance(), Titanium::detail::TiLoggerSeverityType::Ti_ERROR, __VA_ARGS__)
+#define TITANIUM_API_LOG_TRACE(...) TITANIUM_LOG_IF(Titanium::detail::TiAPILogger_t::Instance(get_context()), Titanium::detail::TiLoggerSeverityType::Ti_TRACE, __VA_ARGS__)
+#define TITANIUM_API_LOG_DEBUG(...) TITANIUM_LOG_IF(Titanium::detail::TiAPILogger_t::Instance(get_context()), Titanium::detail::TiLoggerSeverityType::Ti_DEBUG, __VA_ARGS__)
+#define TITANIUM_API_LOG_INFO(...) TITANIUM_LOG_IF(Titanium::detail::TiAPILogger_t::Instance(get_context()), Titanium::detail::TiLoggerSeverityType::Ti_INFO, __VA_ARGS__)
+#define TITANIUM_API_LOG_WARN(...) TITANIUM_LOG_IF(Titanium::detail::TiAPILogger_t::Instance(get_context()), Titanium::detail::TiLoggerSeverityType::Ti_WARN, __VA_ARGS__)
+#define TITANIUM_API_LOG_ERROR(...) TITANIUM_LOG_IF(Titanium::detail::TiAPILogger_t::Instance(get_context()), Titanium::detail::TiLoggerSeverityType::Ti_ERROR, __VA_ARGS__)
 #else
 #define TITANIUM_LOG_TRACE(...)
 #define TITANIUM_LOG_DEBUG(...)
@@ -35,6 +35,7 @@ namespace Titanium
 #endif
 
 			virtual void Write(const std::string& message) override final;
+			virtual void Flush() override final;
 
 		private:
 #pragma warning(push)
@@ -34,7 +34,12 @@ namespace Titanium
 
 			virtual void Write(const std::string& log_message) override final
 			{
-				std::clog << log_message << std::endl;
+				std::clog << log_message << '\n';
+			}
+
+			virtual void Flush() override final
+			{
+				std::clog.flush();
 			}
 		};
 	} // namespace detail
@@ -43,7 +43,12 @@ namespace Titanium
 
 			virtual void Write(const std::string& log_message) override final
 			{
-				ofstream__ << log_message << std::endl;
+				ofstream__ << log_message << '\n';
+			}
+
+			virtual void Flush() override final
+			{
+				ofstream__.flush();
 			}
 
 		private:
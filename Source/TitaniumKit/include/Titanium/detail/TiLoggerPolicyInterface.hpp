@@ -30,6 +30,11 @@ namespace Titanium
 #endif
 
 			virtual void Write(const std::string& log_message) = 0;
+
+			// Called once after a batch of writes
+			virtual void Flush()
+			{
+			}
 		};
 	} // namespace detail
 }  // namespace Titanium
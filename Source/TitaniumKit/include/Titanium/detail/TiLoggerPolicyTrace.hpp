@@ -0,0 +1,96 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TILOGGERPOLICYTRACE_HPP_
+#define _TITANIUM_DETAIL_TILOGGERPOLICYTRACE_HPP_
+
+#include "Titanium/detail/TiLoggerPolicyInterface.hpp"
+#include "Titanium/detail/TiTrace.hpp"
+#include <stdexcept>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Sends TiLogger output to the binary trace.
+
+		  @discussion TITANIUM_LOG_* messages arrive here already formatted,
+		  so each one is stored as a single string argument of a per-severity
+		  site. Hot paths should use TITANIUM_TRACE_* instead, which skips
+		  formatting altogether.
+		*/
+		class TITANIUMKIT_EXPORT TiLoggerPolicyTrace final : public TiLoggerPolicyInterface
+		{
+		public:
+			TiLoggerPolicyTrace(const std::string& path, const std::size_t& segment_size = 4 * 1024 * 1024, const std::size_t& max_segments = 4)
+			{
+				if (!TiTrace::Open(path, segment_size, max_segments)) {
+					throw(std::runtime_error("TiLoggerPolicyTrace: Unable to open the trace file"));
+				}
+			}
+
+			~TiLoggerPolicyTrace()
+			{
+				TiTrace::Close();
+			}
+
+			TiLoggerPolicyTrace() = delete;
+			TiLoggerPolicyTrace(const TiLoggerPolicyTrace&) = default;
+			TiLoggerPolicyTrace& operator=(const TiLoggerPolicyTrace&) = default;
+
+#ifdef TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+			TiLoggerPolicyTrace(TiLoggerPolicyTrace&&) = default;
+			TiLoggerPolicyTrace& operator=(TiLoggerPolicyTrace&&) = default;
+#endif
+
+			virtual void Write(const std::string& log_message) override final
+			{
+				static const std::uint32_t sites[] = {
+					TiTrace::Intern(TiLoggerSeverityType::Ti_TRACE, __FILE__, __LINE__, "{}"),
+					TiTrace::Intern(TiLoggerSeverityType::Ti_DEBUG, __FILE__, __LINE__, "{}"),
+					TiTrace::Intern(TiLoggerSeverityType::Ti_INFO, __FILE__, __LINE__, "{}"),
+					TiTrace::Intern(TiLoggerSeverityType::Ti_WARN, __FILE__, __LINE__, "{}"),
+					TiTrace::Intern(TiLoggerSeverityType::Ti_ERROR, __FILE__, __LINE__, "{}")
+				};
+
+				// Recover the severity from the "[INFO] " prefix TiLogger adds
+				auto severity = TiLoggerSeverityType::Ti_INFO;
+				std::size_t prefix = 0;
+				if (log_message.size() > 2 && log_message[0] == '[') {
+					switch (log_message[1]) {
+						case 'T':
+							severity = TiLoggerSeverityType::Ti_TRACE;
+							break;
+						case 'D':
+							severity = TiLoggerSeverityType::Ti_DEBUG;
+							break;
+						case 'W':
+							severity = TiLoggerSeverityType::Ti_WARN;
+							break;
+						case 'E':
+							severity = TiLoggerSeverityType::Ti_ERROR;
+							break;
+					}
+					prefix = log_message.find_first_not_of(' ', log_message.find(']') + 1);
+				}
+				const auto message = prefix == std::string::npos ? std::string() : log_message.substr(prefix);
+				TiTrace::Write(sites[static_cast<int>(severity)], severity, "{}", message);
+			}
+
+			virtual void Flush() override final
+			{
+				TiTrace::Flush();
+			}
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TILOGGERPOLICYTRACE_HPP_
@@ -0,0 +1,108 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TILOGGERRING_HPP_
+#define _TITANIUM_DETAIL_TILOGGERRING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Bounded lock-free multi-producer, single-consumer queue.
+
+		  @discussion Any number of threads may TryPush concurrently; only one
+		  thread at a time may TryPop. Every slot carries a sequence number
+		  that tells producers and the consumer whose turn it is, so neither
+		  side takes a lock (Vyukov's bounded queue). TryPush fails instead of
+		  blocking when the queue is full. Capacity is rounded up to a power
+		  of two.
+		*/
+		template <typename T>
+		class TiLoggerRing final
+		{
+		public:
+			explicit TiLoggerRing(std::size_t capacity)
+			{
+				std::size_t size = 2;
+				while (size < capacity) {
+					size <<= 1;
+				}
+				mask__ = size - 1;
+				slots__.reset(new Slot[size]);
+				for (std::size_t i = 0; i < size; i++) {
+					slots__[i].sequence.store(i, std::memory_order_relaxed);
+				}
+			}
+
+			TiLoggerRing(const TiLoggerRing&) = delete;
+			TiLoggerRing& operator=(const TiLoggerRing&) = delete;
+
+			bool TryPush(T&& value)
+			{
+				auto position = head__.load(std::memory_order_relaxed);
+				while (true) {
+					auto& slot = slots__[position & mask__];
+					const auto sequence = slot.sequence.load(std::memory_order_acquire);
+					const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+					if (difference == 0) {
+						if (head__.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							slot.value = std::move(value);
+							slot.sequence.store(position + 1, std::memory_order_release);
+							return true;
+						}
+					} else if (difference < 0) {
+						// The consumer has not freed this slot yet
+						return false;
+					} else {
+						position = head__.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			bool TryPop(T& value)
+			{
+				auto& slot = slots__[tail__ & mask__];
+				if (slot.sequence.load(std::memory_order_acquire) != tail__ + 1) {
+					return false;
+				}
+				value = std::move(slot.value);
+				slot.sequence.store(tail__ + mask__ + 1, std::memory_order_release);
+				tail__++;
+				return true;
+			}
+
+			std::size_t get_capacity() const
+			{
+				return mask__ + 1;
+			}
+
+		private:
+			struct Slot
+			{
+				std::atomic<std::size_t> sequence;
+				T value;
+			};
+
+			std::unique_ptr<Slot[]> slots__;
+			std::size_t mask__ { 0 };
+			// head__ is shared by producers; keep it off the consumer's cache line
+			alignas(64) std::atomic<std::size_t> head__ { 0 };
+			alignas(64) std::size_t tail__ { 0 };
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TILOGGERRING_HPP_
@@ -0,0 +1,186 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIPREPAREQUEUE_HPP_
+#define _TITANIUM_DETAIL_TIPREPAREQUEUE_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Prepares results by key on another thread ahead of use.
+
+		  @discussion The owner schedules work for a key, such as a list
+		  position, before it needs the result, and takes the result once
+		  it does. Work runs through an executor, normally a thread pool;
+		  tests may run it inline or hold it back. Cancel drops everything
+		  scheduled or ready so far: work that has not started is skipped,
+		  and results of work already running are discarded when it ends.
+		  Retain does the same for keys outside a range only.
+
+		  Work must only use what it captured, never JavaScript or UI
+		  objects. Results are only read back on the owner's thread.
+		  Schedule, Take, Retain and Cancel must all be called from that thread.
+		*/
+		template<typename T>
+		class TiPrepareQueue final
+		{
+		public:
+			using Executor = std::function<void(std::function<void()>)>;
+
+			explicit TiPrepareQueue(Executor executor)
+				: executor__(std::move(executor))
+				, state__(std::make_shared<State>())
+			{
+			}
+
+			~TiPrepareQueue()
+			{
+				// Work still queued keeps the state alive but finds it cancelled
+				Cancel();
+			}
+
+			TiPrepareQueue(const TiPrepareQueue&) = delete;
+			TiPrepareQueue& operator=(const TiPrepareQueue&) = delete;
+
+			/*!
+			  @method
+			  @abstract Schedule
+			  @discussion Hands work for key to the executor. Returns false
+			  without scheduling when key is already pending or ready.
+			*/
+			bool Schedule(const std::uint32_t& key, std::function<T()> work)
+			{
+				std::uint64_t generation;
+				{
+					std::lock_guard<std::mutex> lock(state__->mutex);
+					if (state__->ready.find(key) != state__->ready.end() || !state__->pending.insert(key).second) {
+						return false;
+					}
+					generation = state__->generation;
+				}
+				const auto state = state__;
+				executor__([state, generation, key, work]() {
+					{
+						std::lock_guard<std::mutex> lock(state->mutex);
+						if (state->generation != generation || state->pending.find(key) == state->pending.end()) {
+							return;
+						}
+					}
+					auto result = work();
+					std::lock_guard<std::mutex> lock(state->mutex);
+					if (state->generation == generation && state->pending.erase(key) > 0) {
+						state->ready.emplace(key, std::move(result));
+					}
+				});
+				return true;
+			}
+
+			/*!
+			  @method
+			  @abstract Take
+			  @discussion Moves the result for key into result. Returns false
+			  when the work for key is still pending, was never scheduled or
+			  was cancelled.
+			*/
+			bool Take(const std::uint32_t& key, T& result)
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				const auto found = state__->ready.find(key);
+				if (found == state__->ready.end()) {
+					return false;
+				}
+				result = std::move(found->second);
+				state__->ready.erase(found);
+				return true;
+			}
+
+			// Whether work for key is pending or its result ready
+			bool Contains(const std::uint32_t& key) const
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				return state__->pending.find(key) != state__->pending.end() || state__->ready.find(key) != state__->ready.end();
+			}
+
+			/*!
+			  @method
+			  @abstract Retain
+			  @discussion Drops pending work and ready results for keys
+			  outside [first, last), such as list positions that scrolled
+			  away before their result was taken.
+			*/
+			void Retain(const std::uint32_t& first, const std::uint32_t& last)
+			{
+				const auto outside = [&first, &last](const std::uint32_t& key) {
+					return key < first || key >= last;
+				};
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				for (auto it = state__->pending.begin(); it != state__->pending.end();) {
+					it = outside(*it) ? state__->pending.erase(it) : std::next(it);
+				}
+				for (auto it = state__->ready.begin(); it != state__->ready.end();) {
+					it = outside(it->first) ? state__->ready.erase(it) : std::next(it);
+				}
+			}
+
+			// Drops all pending work and ready results
+			void Cancel()
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				state__->generation++;
+				state__->pending.clear();
+				state__->ready.clear();
+			}
+
+			std::uint64_t get_generation() const
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				return state__->generation;
+			}
+
+			std::size_t get_pendingCount() const
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				return state__->pending.size();
+			}
+
+			std::size_t get_readyCount() const
+			{
+				std::lock_guard<std::mutex> lock(state__->mutex);
+				return state__->ready.size();
+			}
+
+		private:
+			// Shared with queued work, which may outlive the queue
+			struct State
+			{
+				std::mutex mutex;
+				std::uint64_t generation { 0 };
+				std::unordered_set<std::uint32_t> pending;
+				std::unordered_map<std::uint32_t, T> ready;
+			};
+
+			Executor executor__;
+			std::shared_ptr<State> state__;
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIPREPAREQUEUE_HPP_
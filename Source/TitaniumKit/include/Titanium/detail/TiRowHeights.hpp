@@ -0,0 +1,127 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIROWHEIGHTS_HPP_
+#define _TITANIUM_DETAIL_TIROWHEIGHTS_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <cstdint>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Heights and offsets of list rows, measured or estimated.
+
+		  @discussion Each row has a template, a small id given by the
+		  caller. Rows that have been laid out keep their measured height.
+		  The others are estimated at the running average of the measured
+		  rows of their template, or of all measured rows when none of
+		  their template has been measured, or at the default height.
+
+		  Measured heights are summed in one Fenwick tree and unmeasured
+		  rows are counted per template in others, so an average moving
+		  does not touch the trees. Offset of a row, the row at an offset
+		  and measuring a row are O(templates * log rows). Inserting and
+		  erasing rows is O(rows) and the trees are rebuilt on the next
+		  query. Not thread safe.
+		*/
+		class TITANIUMKIT_EXPORT TiRowHeights final
+		{
+		public:
+			explicit TiRowHeights(const double& defaultHeight = 44);
+
+			// Starts over with unmeasured rows of the given templates
+			void Reset(const std::vector<std::uint32_t>& templates);
+
+			// Inserts unmeasured rows of the given templates before row
+			void Insert(const std::uint32_t& row, const std::vector<std::uint32_t>& templates);
+			void Erase(const std::uint32_t& row, const std::uint32_t& count);
+
+			/*!
+			  @method
+			  @abstract Measure
+			  @discussion Records the laid out height of row. Forget makes
+			  the row estimated again, as when its content changed.
+			*/
+			void Measure(const std::uint32_t& row, const double& height);
+			void Forget(const std::uint32_t& row);
+
+			bool IsMeasured(const std::uint32_t& row) const;
+			std::uint32_t get_templateAt(const std::uint32_t& row) const;
+
+			// Measured height of row, or its estimate
+			double get_heightAt(const std::uint32_t& row) const;
+
+			// Height expected of an unmeasured row of the template
+			double Estimate(const std::uint32_t& templateId) const;
+
+			/*!
+			  @method
+			  @abstract Offset
+			  @discussion Distance from the top of the first row to the top
+			  of row. Offset of the row count is the total height.
+			*/
+			double Offset(const std::uint32_t& row) const;
+
+			/*!
+			  @method
+			  @abstract RowAt
+			  @discussion Row covering offset, counted from the top of the
+			  first row. The row count when offset is past the last row.
+			*/
+			std::uint32_t RowAt(const double& offset) const;
+
+			double get_totalHeight() const;
+			std::uint32_t get_measuredCount() const;
+			std::uint32_t size() const;
+
+			double get_defaultHeight() const;
+			void set_defaultHeight(const double& defaultHeight);
+
+		private:
+			struct Row
+			{
+				std::uint32_t templateId;
+				bool measured;
+				double height;
+			};
+
+			void Change(const std::uint32_t& row, const bool& measured, const double& height);
+			void Account(const Row& row, const std::int32_t& sign);
+			void Update(const std::uint32_t& row, const double& measured, const std::uint32_t& templateId, const std::uint32_t& unmeasured) const;
+			void Rebuild() const;
+			std::vector<double> Estimates() const;
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::vector<Row> rows__;
+			// Measured height and row count per template, for the averages
+			std::vector<double> templateHeights__;
+			std::vector<std::uint32_t> templateMeasured__;
+			// 1-based Fenwick trees: measured heights, and unmeasured rows
+			// of each template with the templates of a node side by side
+			mutable std::vector<double> measured__;
+			mutable std::vector<std::uint32_t> unmeasured__;
+#pragma warning(pop)
+			double defaultHeight__;
+			double measuredHeight__;
+			std::uint32_t measuredCount__;
+			std::uint32_t templateCount__;
+			mutable bool dirty__;
+			// Highest power of two not above the row count
+			mutable std::uint32_t step__;
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIROWHEIGHTS_HPP_
@@ -0,0 +1,113 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIROWINDEX_HPP_
+#define _TITANIUM_DETAIL_TIROWINDEX_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiRowLocation
+		{
+			bool found;
+			std::uint32_t section;
+			std::uint32_t row;
+		};
+
+		/*!
+		  @class
+
+		  @abstract Translates flat row indexes of a sectioned table.
+
+		  @discussion Section sizes are kept in a Fenwick tree, so turning
+		  a flat index into a section and a row within it, and growing or
+		  shrinking a section, are O(log sections). Adding or removing
+		  sections is O(sections). Rows are also hashed to the section
+		  holding them, so finding a row's section is O(1), and rows stay
+		  hashed while sections come and go around theirs. Rows are
+		  opaque pointers; the index never dereferences them. Not thread
+		  safe.
+		*/
+		class TITANIUMKIT_EXPORT TiRowIndex final
+		{
+		public:
+			TiRowIndex();
+
+			/*!
+			  @method
+			  @abstract Reset
+			  @discussion Starts over with sections of the given sizes and no
+			  rows hashed.
+			*/
+			void Reset(const std::vector<std::uint32_t>& sizes);
+
+			/*!
+			  @method
+			  @abstract Resize
+			  @discussion Grows section by delta rows, or shrinks it if
+			  delta is negative.
+			*/
+			void Resize(const std::uint32_t& section, const std::int32_t& delta);
+
+			/*!
+			  @method
+			  @abstract SpliceSections
+			  @discussion Replaces erased sections from section on with
+			  sections of the given sizes. Rows hashed to the erased sections
+			  are not found any more; erase them to free their entries.
+			*/
+			void SpliceSections(const std::uint32_t& section, const std::uint32_t& erased, const std::vector<std::uint32_t>& sizes);
+
+			/*!
+			  @method
+			  @abstract Locate
+			  @discussion Section and row within it of the index-th row. When
+			  index is past the last row, found is false and section is the
+			  section count.
+			*/
+			TiRowLocation Locate(const std::uint32_t& index) const;
+
+			// Rows before the section
+			std::uint32_t Offset(const std::uint32_t& section) const;
+
+			void InsertRow(const void* row, const std::uint32_t& section);
+			void EraseRow(const void* row);
+			bool FindRow(const void* row, std::uint32_t& section) const;
+
+			std::uint32_t get_rowCount() const;
+			std::uint32_t get_sectionCount() const;
+
+		private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			// Rebuilds the tree and the section positions from sizes__ and ids__
+			void Build();
+
+			// 1-based; tree__[i] sums the sizes of the lowbit(i) sections ending at i
+			std::vector<std::uint32_t> tree__;
+			std::vector<std::uint32_t> sizes__;
+			// Sections by position are named by ids that do not move, rows are hashed to those
+			std::vector<std::uint32_t> ids__;
+			std::unordered_map<std::uint32_t, std::uint32_t> positions__;
+			std::unordered_map<const void*, std::uint32_t> rows__;
+#pragma warning(pop)
+			std::uint32_t count__;
+			// Highest power of two not above the section count
+			std::uint32_t step__;
+			std::uint32_t nextId__;
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIROWINDEX_HPP_
@@ -0,0 +1,98 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TISEARCHINDEX_HPP_
+#define _TITANIUM_DETAIL_TISEARCHINDEX_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Substring search over the searchable text of list items.
+
+		  @discussion Every document is kept as written and case-folded,
+		  and each distinct trigram of the folded text has a posting list
+		  of the documents containing it. A query of three or more
+		  characters only verifies the documents in the shortest posting
+		  list among its trigrams; shorter queries scan.
+
+		  The index remembers its last result. A query that contains the
+		  last one, as when the user keeps typing, only filters that
+		  result. Any Insert, Erase or Clear forgets it.
+
+		  Erased documents stay in their posting lists until the stale
+		  entries outnumber the live ones, then the lists are rebuilt.
+		  Not thread safe.
+		*/
+		class TITANIUMKIT_EXPORT TiSearchIndex final
+		{
+		public:
+			TiSearchIndex();
+
+			TiSearchIndex(const TiSearchIndex&) = delete;
+			TiSearchIndex& operator=(const TiSearchIndex&) = delete;
+
+			/*!
+			  @method
+			  @abstract Insert
+			  @discussion Indexes text as document id, replacing its old text.
+			*/
+			void Insert(const std::uint32_t& id, const std::string& text);
+
+			void Erase(const std::uint32_t& id);
+			void Clear();
+
+			/*!
+			  @method
+			  @abstract Search
+			  @discussion Ids of the documents containing query, in
+			  ascending order. An empty query matches every document.
+			*/
+			std::vector<std::uint32_t> Search(const std::string& query, const bool& caseInsensitive);
+
+			std::size_t size() const;
+
+			// Lower-cases ASCII letters, as the search compares them
+			static std::string Fold(const std::string& text);
+
+		private:
+			struct Document
+			{
+				std::string text;
+				std::string folded;
+			};
+
+			static std::vector<std::uint32_t> Trigrams(const std::string& folded);
+			void Compact();
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::unordered_map<std::uint32_t, Document> documents__;
+			std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> postings__;
+			std::size_t posted__;
+			std::size_t stale__;
+
+			bool last_valid__;
+			bool last_case_insensitive__;
+			std::string last_query__;
+			std::vector<std::uint32_t> last_result__;
+#pragma warning(pop)
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TISEARCHINDEX_HPP_
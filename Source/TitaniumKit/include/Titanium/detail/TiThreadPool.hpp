@@ -0,0 +1,88 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TITHREADPOOL_HPP_
+#define _TITANIUM_DETAIL_TITHREADPOOL_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract A small fixed-size pool of worker threads.
+
+		  @discussion Tasks are executed in FIFO order by whichever worker
+		  becomes free first. Callbacks posted to the pool run on a worker
+		  thread, so anything touching JavaScript must be marshalled back
+		  to the JS thread by the caller.
+		*/
+		class TITANIUMKIT_EXPORT TiThreadPool final
+		{
+		public:
+			explicit TiThreadPool(const std::size_t& thread_count);
+			~TiThreadPool();
+
+			TiThreadPool(const TiThreadPool&) = delete;
+			TiThreadPool& operator=(const TiThreadPool&) = delete;
+
+#ifdef TITANIUM_MOVE_CTOR_AND_ASSIGN_DEFAULT_ENABLE
+			TiThreadPool(TiThreadPool&&) = delete;
+			TiThreadPool& operator=(TiThreadPool&&) = delete;
+#endif
+
+			/*!
+			  @method
+			  @abstract Post
+			  @discussion Queues a task for execution on one of the workers.
+			*/
+			void Post(std::function<void()> task);
+
+			std::size_t get_thread_count() const;
+
+			/*!
+			  @method
+			  @abstract IOPool
+			  @discussion Shared pool for blocking file and network I/O.
+			*/
+			static TiThreadPool& IOPool();
+
+			/*!
+			  @method
+			  @abstract ComputePool
+			  @discussion Shared pool for short CPU-bound work, such as
+			  preparing list items ahead of the viewport.
+			*/
+			static TiThreadPool& ComputePool();
+
+		private:
+			void Run();
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::mutex mutex__;
+			std::condition_variable condition__;
+			std::deque<std::function<void()>> tasks__;
+			std::vector<std::thread> threads__;
+#pragma warning(pop)
+			bool stopping__ { false };
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TITHREADPOOL_HPP_
@@ -0,0 +1,126 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TITIMERWHEEL_HPP_
+#define _TITANIUM_DETAIL_TITIMERWHEEL_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiTimerWheelExpired
+		{
+			std::uint32_t id;
+			// Still scheduled for its next interval
+			bool repeating;
+		};
+
+		/*!
+		  @class
+
+		  @abstract Hierarchical timer wheel behind setTimeout and setInterval.
+
+		  @discussion Time is counted in ticks of a fixed resolution. The
+		  first level has a slot per tick for the next 256 ticks, each
+		  further level covers 64 times the span of the one below it, and
+		  timers move down a level as their slot comes around. Scheduling
+		  and cancelling are O(1); Advance skips straight to the next tick
+		  with a timer due or timers to move down, so an idle stretch costs
+		  nothing to catch up on.
+
+		  The wheel has no clock of its own. Whoever drives it passes the
+		  current time to Schedule and Advance, which is how tests run it on
+		  a virtual clock. Not thread safe.
+		*/
+		class TITANIUMKIT_EXPORT TiTimerWheel final
+		{
+		public:
+			TiTimerWheel(const std::chrono::milliseconds& resolution, const std::chrono::milliseconds& now);
+
+			TiTimerWheel(const TiTimerWheel&) = delete;
+			TiTimerWheel& operator=(const TiTimerWheel&) = delete;
+
+			/*!
+			  @method
+			  @abstract Schedule
+			  @discussion Fires id no earlier than delay after now, and every
+			  delay after that if repeating. Replaces an earlier schedule of
+			  the same id.
+			*/
+			void Schedule(const std::uint32_t& id, const std::chrono::milliseconds& delay, const bool& repeating, const std::chrono::milliseconds& now);
+
+			/*!
+			  @method
+			  @abstract Cancel
+			  @discussion Returns false if id was not scheduled.
+			*/
+			bool Cancel(const std::uint32_t& id);
+
+			/*!
+			  @method
+			  @abstract Advance
+			  @discussion Moves the wheel up to now and returns every timer
+			  that came due on the way, earliest first, as one batch.
+			  Repeating timers are already scheduled again when it returns.
+			*/
+			std::vector<TiTimerWheelExpired> Advance(const std::chrono::milliseconds& now);
+
+			/*!
+			  @method
+			  @abstract NextExpiry
+			  @discussion The time at which Advance next has work to do,
+			  either a timer coming due or timers moving down a level. It
+			  is never later than the earliest timer, so whoever drives the
+			  wheel can sleep until then. Only meaningful while not empty.
+			*/
+			std::chrono::milliseconds NextExpiry() const;
+
+			bool Contains(const std::uint32_t& id) const;
+			bool empty() const;
+			std::size_t size() const;
+			std::chrono::milliseconds get_resolution() const;
+
+		private:
+			static const std::size_t Levels = 4;
+			static const std::uint32_t RootBits = 8;
+			static const std::uint32_t LevelBits = 6;
+
+			struct Entry
+			{
+				std::uint64_t expires;
+				std::uint64_t interval;
+				std::size_t level;
+				std::size_t slot;
+				std::list<std::uint32_t>::iterator position;
+			};
+
+			std::uint64_t ToTick(const std::chrono::milliseconds& time, const bool& round_up) const;
+			void Insert(const std::uint32_t& id, Entry& entry);
+			bool Cascade(const std::size_t& level);
+			std::uint64_t NextTick() const;
+
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::chrono::milliseconds resolution__;
+			std::uint64_t current__;
+			std::array<std::vector<std::list<std::uint32_t>>, Levels> slots__;
+			std::unordered_map<std::uint32_t, Entry> entries__;
+#pragma warning(pop)
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TITIMERWHEEL_HPP_
@@ -0,0 +1,319 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TITRACE_HPP_
+#define _TITANIUM_DETAIL_TITRACE_HPP_
+
+#include "Titanium/detail/TiLogger.hpp"
+#include "Titanium/detail/TiTraceFormat.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		/*!
+		  @class
+
+		  @abstract Binary trace log written to rotating memory-mapped files.
+
+		  @discussion Here is an example of how to use the Titanium trace
+		  facility:
+
+		  TiTrace::Open("app.trace");
+		  TITANIUM_TRACE_INFO("Loaded {} in {} ms", path, elapsed);
+
+		  Each call site is interned once, so an event only stores the site
+		  id, a timestamp, the thread and the raw arguments; nothing is
+		  formatted on the device. Writers reserve space in the mapping with
+		  one atomic add and never take a lock, and the mapping survives a
+		  crash of the process.
+
+		  Segments are named path.0 ... path.(max_segments - 1) and reused
+		  round-robin once the last one is full. Use ti-trace-decode to turn
+		  them back into text or JSON. Supported arguments are numbers,
+		  bools, enums, C strings and std::string.
+		*/
+		class TITANIUMKIT_EXPORT TiTrace final
+		{
+		public:
+			/*!
+			  @method
+			  @abstract Open
+			  @discussion Starts tracing to path.N, closing any previous trace.
+			  Returns false if the first segment cannot be created.
+			*/
+			static bool Open(const std::string& path, const std::size_t& segment_size = 4 * 1024 * 1024, const std::size_t& max_segments = 4);
+
+			/*!
+			  @method
+			  @abstract Close
+			  @discussion Stops tracing and trims the current segment to the
+			  data written.
+			*/
+			static void Close();
+
+			/*!
+			  @method
+			  @abstract Flush
+			  @discussion Asks the OS to write the current segment to storage.
+			  Not needed to survive a crash of the process, only of the device.
+			*/
+			static void Flush();
+
+			static bool IsEnabled(const TiLoggerSeverityType& severity)
+			{
+				return enabled__.load(std::memory_order_relaxed) && TiLoggerLevel::IsEnabled(severity);
+			}
+
+			/*!
+			  @method
+			  @abstract Intern
+			  @discussion Registers a call site and returns its id. The macros
+			  call this once per site.
+			*/
+			static std::uint32_t Intern(const TiLoggerSeverityType& severity, const char* file, const std::uint32_t& line, const char* format);
+
+			template <typename... Args>
+			static void Write(const std::uint32_t& site, const TiLoggerSeverityType& severity, const char* format, const Args&... args);
+
+			// Events that did not fit into a segment
+			static std::uint64_t get_dropped();
+
+			// Number of segments opened since Open
+			static std::uint64_t get_segments();
+
+			static std::uint32_t ThreadId();
+
+			// Reserves size bytes in the current segment, nullptr when closed
+			static char* Reserve(const std::uint32_t& size, void*& segment);
+
+			// Publishes a reserved record; header.size is written last
+			static void Commit(void* segment, char* record, const TiTraceRecordHeader& header);
+
+			static std::int64_t Now()
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+
+		private:
+			static std::atomic<bool> enabled__;
+		};
+
+		template <typename T, typename Enable = void>
+		struct TiTraceArg;
+
+		template <typename T>
+		struct TiTraceArg<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type>
+		{
+			static std::size_t Size(const T&)
+			{
+				return 9;
+			}
+
+			static char* Encode(char* cursor, const T& value)
+			{
+				const std::int64_t encoded = value;
+				*cursor = static_cast<char>(TiTraceArgType::Int);
+				std::memcpy(cursor + 1, &encoded, 8);
+				return cursor + 9;
+			}
+		};
+
+		template <typename T>
+		struct TiTraceArg<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type>
+		{
+			static std::size_t Size(const T&)
+			{
+				return 9;
+			}
+
+			static char* Encode(char* cursor, const T& value)
+			{
+				const std::uint64_t encoded = value;
+				*cursor = static_cast<char>(TiTraceArgType::UInt);
+				std::memcpy(cursor + 1, &encoded, 8);
+				return cursor + 9;
+			}
+		};
+
+		template <typename T>
+		struct TiTraceArg<T, typename std::enable_if<std::is_enum<T>::value>::type>
+		{
+			static std::size_t Size(const T&)
+			{
+				return 9;
+			}
+
+			static char* Encode(char* cursor, const T& value)
+			{
+				const auto encoded = static_cast<std::int64_t>(value);
+				*cursor = static_cast<char>(TiTraceArgType::Int);
+				std::memcpy(cursor + 1, &encoded, 8);
+				return cursor + 9;
+			}
+		};
+
+		template <typename T>
+		struct TiTraceArg<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+		{
+			static std::size_t Size(const T&)
+			{
+				return 9;
+			}
+
+			static char* Encode(char* cursor, const T& value)
+			{
+				const double encoded = value;
+				*cursor = static_cast<char>(TiTraceArgType::Double);
+				std::memcpy(cursor + 1, &encoded, 8);
+				return cursor + 9;
+			}
+		};
+
+		template <>
+		struct TiTraceArg<bool>
+		{
+			static std::size_t Size(const bool&)
+			{
+				return 2;
+			}
+
+			static char* Encode(char* cursor, const bool& value)
+			{
+				cursor[0] = static_cast<char>(TiTraceArgType::Bool);
+				cursor[1] = value ? 1 : 0;
+				return cursor + 2;
+			}
+		};
+
+		inline char* TiTraceEncodeString(char* cursor, const char* value, const std::size_t& length)
+		{
+			const auto encoded = static_cast<std::uint16_t>(std::min<std::size_t>(length, 0xFFFF));
+			*cursor = static_cast<char>(TiTraceArgType::String);
+			std::memcpy(cursor + 1, &encoded, 2);
+			std::memcpy(cursor + 3, value, encoded);
+			return cursor + 3 + encoded;
+		}
+
+		template <>
+		struct TiTraceArg<const char*>
+		{
+			static std::size_t Size(const char* value)
+			{
+				return 3 + std::min<std::size_t>(std::strlen(value), 0xFFFF);
+			}
+
+			static char* Encode(char* cursor, const char* value)
+			{
+				return TiTraceEncodeString(cursor, value, std::strlen(value));
+			}
+		};
+
+		template <>
+		struct TiTraceArg<char*> : TiTraceArg<const char*>
+		{
+		};
+
+		template <>
+		struct TiTraceArg<std::string>
+		{
+			static std::size_t Size(const std::string& value)
+			{
+				return 3 + std::min<std::size_t>(value.size(), 0xFFFF);
+			}
+
+			static char* Encode(char* cursor, const std::string& value)
+			{
+				return TiTraceEncodeString(cursor, value.data(), value.size());
+			}
+		};
+
+		inline std::size_t TiTraceArgsSize()
+		{
+			return 0;
+		}
+
+		template <typename First, typename... Rest>
+		std::size_t TiTraceArgsSize(const First& first, const Rest&... rest)
+		{
+			return TiTraceArg<typename std::decay<First>::type>::Size(first) + TiTraceArgsSize(rest...);
+		}
+
+		inline char* TiTraceEncodeArgs(char* cursor)
+		{
+			return cursor;
+		}
+
+		template <typename First, typename... Rest>
+		char* TiTraceEncodeArgs(char* cursor, const First& first, const Rest&... rest)
+		{
+			return TiTraceEncodeArgs(TiTraceArg<typename std::decay<First>::type>::Encode(cursor, first), rest...);
+		}
+
+		// The macros pass the format twice, once to Intern and once here
+		template <typename... Args>
+		const char* TiTraceFormatOf(const char* format, const Args&...)
+		{
+			return format;
+		}
+
+		template <typename... Args>
+		void TiTrace::Write(const std::uint32_t& site, const TiLoggerSeverityType& severity, const char* format, const Args&... args)
+		{
+			const auto size = TiTraceAlign(sizeof(TiTraceRecordHeader) + sizeof(TiTraceEvent) + TiTraceArgsSize(args...));
+			void* segment = nullptr;
+			const auto record = Reserve(size, segment);
+			if (record == nullptr) {
+				return;
+			}
+
+			const TiTraceEvent event { Now(), ThreadId(), site };
+			std::memcpy(record + sizeof(TiTraceRecordHeader), &event, sizeof(event));
+			TiTraceEncodeArgs(record + sizeof(TiTraceRecordHeader) + sizeof(TiTraceEvent), args...);
+
+			TiTraceRecordHeader header;
+			header.size = size;
+			header.type = static_cast<std::uint8_t>(TiTraceRecordType::Event);
+			header.severity = static_cast<std::uint8_t>(severity);
+			header.argc = static_cast<std::uint16_t>(sizeof...(Args));
+			Commit(segment, record, header);
+		}
+
+#ifdef TITANIUM_LOGGING_ENABLE
+
+// The first argument is the format, "{}" stands for the next argument.
+#define TITANIUM_TRACE(SEVERITY, ...) \
+	do { \
+		if (static_cast<int>(SEVERITY) >= TITANIUM_LOG_MIN_SEVERITY && Titanium::detail::TiTrace::IsEnabled(SEVERITY)) { \
+			static const std::uint32_t titanium_trace_site = Titanium::detail::TiTrace::Intern(SEVERITY, __FILE__, __LINE__, Titanium::detail::TiTraceFormatOf(__VA_ARGS__)); \
+			Titanium::detail::TiTrace::Write(titanium_trace_site, SEVERITY, __VA_ARGS__); \
+		} \
+	} while (0)
+
+#define TITANIUM_TRACE_TRACE(...) TITANIUM_TRACE(Titanium::detail::TiLoggerSeverityType::Ti_TRACE, __VA_ARGS__)
+#define TITANIUM_TRACE_DEBUG(...) TITANIUM_TRACE(Titanium::detail::TiLoggerSeverityType::Ti_DEBUG, __VA_ARGS__)
+#define TITANIUM_TRACE_INFO(...) TITANIUM_TRACE(Titanium::detail::TiLoggerSeverityType::Ti_INFO, __VA_ARGS__)
+#define TITANIUM_TRACE_WARN(...) TITANIUM_TRACE(Titanium::detail::TiLoggerSeverityType::Ti_WARN, __VA_ARGS__)
+#define TITANIUM_TRACE_ERROR(...) TITANIUM_TRACE(Titanium::detail::TiLoggerSeverityType::Ti_ERROR, __VA_ARGS__)
+#else
+#define TITANIUM_TRACE(...)
+#define TITANIUM_TRACE_TRACE(...)
+#define TITANIUM_TRACE_DEBUG(...)
+#define TITANIUM_TRACE_INFO(...)
+#define TITANIUM_TRACE_WARN(...)
+#define TITANIUM_TRACE_ERROR(...)
+#endif
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TITRACE_HPP_
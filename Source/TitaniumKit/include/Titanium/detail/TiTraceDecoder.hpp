@@ -0,0 +1,85 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TITRACEDECODER_HPP_
+#define _TITANIUM_DETAIL_TITRACEDECODER_HPP_
+
+#include "TitaniumKit_EXPORT.h"
+#include "Titanium/detail/TiTraceFormat.hpp"
+#include <string>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiTraceDecodedArg
+		{
+			TiTraceArgType type;
+			std::int64_t int_value;
+			std::uint64_t uint_value;
+			double double_value;
+			bool bool_value;
+			std::string string_value;
+		};
+
+		struct TiTraceDecodedEvent
+		{
+			std::uint64_t sequence;
+			std::int64_t system_clock_ns;
+			std::uint32_t thread;
+			std::uint8_t severity;
+			std::uint32_t site;
+			std::string file;
+			std::uint32_t line;
+			std::string format;
+			std::vector<TiTraceDecodedArg> args;
+		};
+
+		/*!
+		  @class
+
+		  @abstract Reads the segments written by TiTrace.
+
+		  @discussion Has no dependency on HAL so that ti-trace-decode can
+		  build it for the host. Load the segments in any order; get_events
+		  returns them oldest first.
+		*/
+		class TITANIUMKIT_EXPORT TiTraceDecoder final
+		{
+		public:
+			/*!
+			  @method
+			  @abstract Load
+			  @discussion Reads one segment. Throws std::runtime_error if path
+			  cannot be read or is not a TiTrace segment. A record that was
+			  never finished ends the segment.
+			*/
+			void Load(const std::string& path);
+
+			std::vector<TiTraceDecodedEvent> get_events() const;
+
+			// The format with every "{}" replaced by the next argument
+			static std::string Format(const TiTraceDecodedEvent& event);
+
+			// One line per event: time, severity, thread, site and message
+			static std::string ToText(const TiTraceDecodedEvent& event);
+
+			// One JSON object per event, arguments keep their types
+			static std::string ToJSON(const TiTraceDecodedEvent& event);
+
+		private:
+#pragma warning(push)
+#pragma warning(disable : 4251)
+			std::vector<TiTraceDecodedEvent> events__;
+#pragma warning(pop)
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TITRACEDECODER_HPP_
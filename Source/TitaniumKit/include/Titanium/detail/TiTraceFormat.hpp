@@ -0,0 +1,104 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TITRACEFORMAT_HPP_
+#define _TITANIUM_DETAIL_TITRACEFORMAT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		// On-disk layout of a TiTrace segment, shared by the writer (TiTrace)
+		// and the decoder (TiTraceDecoder, ti-trace-decode). Everything is in
+		// the byte order of the device that wrote it.
+		//
+		// A segment is a TiTraceFileHeader followed by records. Every record
+		// starts with a TiTraceRecordHeader and is padded to a multiple of 8
+		// bytes. Unused space is zero, so a record whose size is 0 marks the
+		// end of the data (or a record that was never finished).
+		//
+		// Site record:  TiTraceRecordHeader, TiTraceSite, file bytes, format bytes
+		// Event record: TiTraceRecordHeader, TiTraceEvent, argc arguments
+		//
+		// Each argument is one TiTraceArgType byte followed by its value:
+		// 8 bytes for Int, UInt and Double, 1 byte for Bool and a uint16
+		// length plus bytes for String. Values are not aligned.
+
+		static const char TiTraceMagic[8] = { 'T', 'I', 'T', 'R', 'A', 'C', 'E', '\0' };
+		static const std::uint32_t TiTraceVersion = 1;
+
+		struct TiTraceFileHeader
+		{
+			char magic[8];
+			std::uint32_t version;
+			std::uint32_t header_size;
+			// Size of the whole segment file in bytes
+			std::uint64_t capacity;
+			// Increases by one with every rotation
+			std::uint64_t sequence;
+			// The same instant on both clocks, to turn event timestamps
+			// (steady clock) into wall clock time
+			std::int64_t system_clock_ns;
+			std::int64_t steady_clock_ns;
+			std::uint8_t reserved[16];
+		};
+
+		enum class TiTraceRecordType : std::uint8_t {
+			Site = 1,
+			Event = 2
+		};
+
+		enum class TiTraceArgType : std::uint8_t {
+			Int = 1,
+			UInt = 2,
+			Double = 3,
+			Bool = 4,
+			String = 5
+		};
+
+		struct TiTraceRecordHeader
+		{
+			// Written last, once the rest of the record is in place
+			std::uint32_t size;
+			std::uint8_t type;
+			std::uint8_t severity;
+			std::uint16_t argc;
+		};
+
+		struct TiTraceSite
+		{
+			std::uint32_t site;
+			std::uint32_t line;
+			std::uint16_t file_length;
+			std::uint16_t format_length;
+			std::uint32_t reserved;
+		};
+
+		struct TiTraceEvent
+		{
+			std::int64_t steady_clock_ns;
+			std::uint32_t thread;
+			std::uint32_t site;
+		};
+
+		static_assert(sizeof(TiTraceFileHeader) == 64, "TiTraceFileHeader must stay 64 bytes");
+		static_assert(sizeof(TiTraceRecordHeader) == 8, "TiTraceRecordHeader must stay 8 bytes");
+		static_assert(sizeof(TiTraceSite) == 16, "TiTraceSite must stay 16 bytes");
+		static_assert(sizeof(TiTraceEvent) == 16, "TiTraceEvent must stay 16 bytes");
+
+		inline std::uint32_t TiTraceAlign(const std::size_t& size)
+		{
+			return static_cast<std::uint32_t>((size + 7) & ~static_cast<std::size_t>(7));
+		}
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TITRACEFORMAT_HPP_
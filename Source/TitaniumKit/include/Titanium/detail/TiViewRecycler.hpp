@@ -0,0 +1,235 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#ifndef _TITANIUM_DETAIL_TIVIEWRECYCLER_HPP_
+#define _TITANIUM_DETAIL_TIVIEWRECYCLER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiViewRecyclerStats
+		{
+			std::uint64_t created;
+			std::uint64_t rebound;
+			std::uint64_t released;
+			// Released while the pool for their template was full
+			std::uint64_t dropped;
+		};
+
+		/*!
+		  @class
+
+		  @abstract Keeps views only for the rows near the viewport.
+
+		  @discussion Rows are counted by position from 0 to the item
+		  count. set_viewport realizes the visible rows plus overscan rows
+		  on either side and releases every other realized view into a
+		  pool keyed by the row's template, so scrolling a long list
+		  rebinds a handful of views instead of creating one per row. A
+		  view is only ever handed back to rows of the template it was
+		  created for. A pool holds as many views as fit in the realized
+		  range, or pool_limit if that is more.
+
+		  The recycler knows nothing about views beyond the callbacks:
+		  key_at names the template of a row, create builds a view already
+		  bound to it, rebind binds a pooled view to another row and
+		  release tells the owner a view left the viewport. Not thread
+		  safe.
+		*/
+		template<typename V>
+		class TiViewRecycler final
+		{
+		public:
+			using KeyAt = std::function<std::string(const std::uint32_t& position)>;
+			using Create = std::function<std::shared_ptr<V>(const std::uint32_t& position)>;
+			using Rebind = std::function<void(const std::shared_ptr<V>& view, const std::uint32_t& position)>;
+			using Release = std::function<void(const std::shared_ptr<V>& view, const std::uint32_t& position)>;
+
+			TiViewRecycler(const std::uint32_t& overscan = 4, const std::size_t& pool_limit = 8)
+				: overscan__(overscan)
+				, pool_limit__(pool_limit)
+				, first__(0)
+				, count__(0)
+				, active__(false)
+				, stats__({ 0, 0, 0, 0 })
+			{
+			}
+
+			TiViewRecycler(const TiViewRecycler&) = delete;
+			TiViewRecycler& operator=(const TiViewRecycler&) = delete;
+
+			void set_callbacks(const KeyAt& key_at, const Create& create, const Rebind& rebind, const Release& release)
+			{
+				key_at__ = key_at;
+				create__ = create;
+				rebind__ = rebind;
+				release__ = release;
+			}
+
+			/*!
+			  @method
+			  @abstract set_viewport
+			  @discussion Makes count rows from first visible out of
+			  item_count. Releases views that fell out of range before
+			  realizing new rows, so they can be reused straight away.
+			*/
+			void set_viewport(const std::uint32_t& first, const std::uint32_t& count, const std::uint32_t& item_count)
+			{
+				first__ = first;
+				count__ = count;
+				active__ = true;
+
+				const auto lo = first > overscan__ ? first - overscan__ : 0;
+				const auto hi = static_cast<std::uint32_t>(std::min<std::uint64_t>(item_count, static_cast<std::uint64_t>(first) + count + overscan__));
+
+				for (auto it = realized__.begin(); it != realized__.end();) {
+					if (it->first < lo || it->first >= hi) {
+						Pool(it->first, it->second);
+						it = realized__.erase(it);
+					} else {
+						++it;
+					}
+				}
+				for (auto position = lo; position < hi; position++) {
+					if (realized__.find(position) == realized__.end()) {
+						Realize(position);
+					}
+				}
+			}
+
+			/*!
+			  @method
+			  @abstract Refresh
+			  @discussion The rows changed under the realized views. Releases
+			  all of them and, if the viewport was set, realizes it again
+			  over item_count rows; the views come straight back out of the
+			  pools.
+			*/
+			void Refresh(const std::uint32_t& item_count)
+			{
+				Recycle();
+				if (active__) {
+					set_viewport(std::min(first__, item_count), count__, item_count);
+				}
+			}
+
+			/*!
+			  @method
+			  @abstract Recycle
+			  @discussion Releases every realized view into the pools.
+			*/
+			void Recycle()
+			{
+				for (auto& realized : realized__) {
+					Pool(realized.first, realized.second);
+				}
+				realized__.clear();
+			}
+
+			/*!
+			  @method
+			  @abstract Clear
+			  @discussion Releases every realized view and empties the pools,
+			  e.g. when the templates change.
+			*/
+			void Clear()
+			{
+				Recycle();
+				pools__.clear();
+			}
+
+			std::shared_ptr<V> get_view(const std::uint32_t& position) const
+			{
+				const auto found = realized__.find(position);
+				return found == realized__.end() ? nullptr : found->second.view;
+			}
+
+			std::size_t get_live_count() const
+			{
+				return realized__.size();
+			}
+
+			std::size_t get_pooled_count() const
+			{
+				std::size_t count = 0;
+				for (const auto& pool : pools__) {
+					count += pool.second.size();
+				}
+				return count;
+			}
+
+			TiViewRecyclerStats get_stats() const
+			{
+				return stats__;
+			}
+
+		private:
+			struct Realized
+			{
+				std::string key;
+				std::shared_ptr<V> view;
+			};
+
+			void Realize(const std::uint32_t& position)
+			{
+				Realized realized;
+				realized.key = key_at__(position);
+				auto& pool = pools__[realized.key];
+				if (pool.empty()) {
+					realized.view = create__(position);
+					stats__.created++;
+				} else {
+					realized.view = pool.back();
+					pool.pop_back();
+					rebind__(realized.view, position);
+					stats__.rebound++;
+				}
+				if (realized.view) {
+					realized__.emplace(position, std::move(realized));
+				}
+			}
+
+			void Pool(const std::uint32_t& position, Realized& realized)
+			{
+				release__(realized.view, position);
+				stats__.released++;
+				auto& pool = pools__[realized.key];
+				if (pool.size() < std::max<std::size_t>(pool_limit__, static_cast<std::size_t>(count__) + 2 * overscan__)) {
+					pool.push_back(std::move(realized.view));
+				} else {
+					stats__.dropped++;
+				}
+			}
+
+			std::uint32_t overscan__;
+			std::size_t pool_limit__;
+			std::uint32_t first__;
+			std::uint32_t count__;
+			bool active__;
+			TiViewRecyclerStats stats__;
+			KeyAt key_at__;
+			Create create__;
+			Rebind rebind__;
+			Release release__;
+			std::map<std::uint32_t, Realized> realized__;
+			std::unordered_map<std::string, std::vector<std::shared_ptr<V>>> pools__;
+		};
+	} // namespace detail
+}  // namespace Titanium
+
+#endif  // _TITANIUM_DETAIL_TIVIEWRECYCLER_HPP_
@@ -8,6 +8,8 @@
 #include "Titanium/Blob.hpp"
 #include "Titanium/Filesystem/File.hpp"
 #include "Titanium/UI/Dimension.hpp"
+#include <algorithm>
+#include <iterator>
 #include <type_traits>
 
 namespace Titanium
@@ -28,11 +30,27 @@ namespace Titanium
 		this->type_ = Titanium::BlobModule::TYPE::DATA;
 	}
 
+	void Blob::construct(std::vector<std::uint8_t>&& data) TITANIUM_NOEXCEPT
+	{
+		height_ = 0;
+		width_ = 0;
+		path_ = "";
+		data_ = std::move(data);
+		mimetype_ = "application/octet-stream";
+
+		this->type_ = Titanium::BlobModule::TYPE::DATA;
+	}
+
 	std::vector<std::uint8_t> Blob::getData() TITANIUM_NOEXCEPT
 	{
 		return data_;
 	}
 
+	const std::vector<std::uint8_t>& Blob::getDataRef() const TITANIUM_NOEXCEPT
+	{
+		return data_;
+	}
+
 	void Blob::JSExportInitialize()
 	{
 		JSExport<Blob>::SetClassVersion(1);
@@ -130,8 +148,13 @@ namespace Titanium
 
 	void Blob::append(const std::shared_ptr<Blob>& other) TITANIUM_NOEXCEPT
 	{
-		auto blob = std::dynamic_pointer_cast<Blob>(other).get();
-		const auto b = blob->getData();
+		if (other.get() == this) {
+			const auto size = data_.size();
+			data_.reserve(size * 2);
+			std::copy_n(data_.begin(), size, std::back_inserter(data_));
+			return;
+		}
+		const auto& b = other->getDataRef();
 		data_.reserve(data_.size() + b.size());
 		data_.insert(data_.end(), b.begin(), b.end());
 	}
@@ -30,7 +30,7 @@ namespace Titanium
 		const auto buffer_ctor = get_context().JSEvaluateScript("Ti.Buffer"); \
 		const auto buffer_object = static_cast<JSObject>(buffer_ctor).CallAsConstructor();
 		auto source_buffer = buffer_object.GetPrivate<Buffer>();
-		source_buffer->construct(blob__->getData());
+		source_buffer->construct(blob__->getDataRef());
 
 		const auto bytesToRead = getAvailableBytesToRead(source_buffer, write_buffer, totalBytesProcessed__, offset, length);
 		if (bytesToRead == 0) {
@@ -45,7 +45,7 @@ namespace Titanium
 	void BlobStream::readAllAsync(const std::shared_ptr<Buffer>& buffer, const std::function<void(const ErrorResponse&, const std::shared_ptr<IOStream>& source)>& callback)
 	{
 		ErrorResponse error;
-		buffer->construct(blob__->getData());
+		buffer->construct(blob__->getDataRef());
 		totalBytesProcessed__ = buffer->get_length();
 		callback(error, get_object().GetPrivate<IOStream>());
 	}
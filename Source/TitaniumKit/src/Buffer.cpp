@@ -105,6 +105,11 @@ namespace Titanium
 		return std::vector<std::uint8_t>(data__.begin() + offset, data__.begin() + std::min(offset + size, static_cast<std::uint32_t>(data__.size())));
 	}
 
+	std::vector<std::uint8_t>& Buffer::getDataRef() TITANIUM_NOEXCEPT
+	{
+		return data__;
+	}
+
 	std::uint32_t Buffer::append(const std::shared_ptr<Buffer>& sourceBuffer, const std::uint32_t& sourceOffset, const std::uint32_t& sourceLength) TITANIUM_NOEXCEPT
 	{
 		const auto source = sourceBuffer->get_data();
@@ -8,71 +8,69 @@
 
 #include "Titanium/Codec/Constants.hpp"
 #include "Titanium/Buffer.hpp"
+#include "Titanium/detail/TiConstants.hpp"
 
 namespace Titanium
 {
 	namespace Codec
 	{
+		static const detail::TiConstant<ByteOrder> byteOrderNames[] = {
+			{ ByteOrder::BigEndian,    "bigendian" },
+			{ ByteOrder::LittleEndian, "littleendian" },
+		};
+
 		std::string Constants::to_string(const ByteOrder& fieldType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "unknown";
-			static std::unordered_map<ByteOrder, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[ByteOrder::BigEndian] = "bigendian";
-				map[ByteOrder::LittleEndian] = "littleendian";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(fieldType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(byteOrderNames, fieldType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
 		}
 
+		static const detail::TiConstant<CharSet> charSetNames[] = {
+			{ CharSet::ASCII,       "ascii" },
+			{ CharSet::ISO_LATIN_1, "iso-latin-1" },
+			{ CharSet::UTF16,       "utf16" },
+			{ CharSet::UTF16BE,     "utf16be" },
+			{ CharSet::UTF16LE,     "utf16le" },
+			{ CharSet::UTF8,        "utf8" },
+		};
+
 		std::string Constants::to_string(const CharSet& fieldType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "unknown";
-			static std::unordered_map<CharSet, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[CharSet::ASCII]   = "ascii";
-				map[CharSet::ISO_LATIN_1] = "iso-latin-1";
-				map[CharSet::UTF16]   = "utf16";
-				map[CharSet::UTF16BE] = "utf16be";
-				map[CharSet::UTF16LE] = "utf16le";
-				map[CharSet::UTF8]    = "utf8";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(fieldType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(charSetNames, fieldType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
 		}
 
+		static const detail::TiConstant<Type> typeNames[] = {
+			{ Type::Byte,   "byte" },
+			{ Type::Double, "double" },
+			{ Type::Float,  "float" },
+			{ Type::Int,    "int" },
+			{ Type::Long,   "long" },
+			{ Type::Short,  "short" },
+		};
+
 		std::string Constants::to_string(const Type& fieldType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "unknown";
-			static std::unordered_map<Type, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[Type::Byte]   = "byte";
-				map[Type::Double] = "double";
-				map[Type::Float]  = "float";
-				map[Type::Int]    = "int";
-				map[Type::Long]   = "long";
-				map[Type::Short]  = "short";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(fieldType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(typeNames, fieldType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -80,17 +78,10 @@ namespace Titanium
 
 		ByteOrder Constants::to_ByteOrder(const std::string& fieldTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ByteOrder> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["bigendian"]    = ByteOrder::BigEndian;
-				map["littleendian"] = ByteOrder::LittleEndian;
-			});
-
 			ByteOrder fieldType = ByteOrder::Unknown;
-			const auto position = map.find(fieldTypeName);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(byteOrderNames, fieldTypeName);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ByteOrder: Titanium::Codec::ByteOrder with name '", fieldTypeName, "' does not exist");
 			}
@@ -100,21 +91,10 @@ namespace Titanium
 
 		CharSet Constants::to_CharSet(const std::string& fieldTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, CharSet> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["ascii"]    = CharSet::ASCII;
-				map["iso-latin-1"] = CharSet::ISO_LATIN_1;
-				map["utf8"]     = CharSet::UTF8;
-				map["utf16"]    = CharSet::UTF16;
-				map["utf16be"]  = CharSet::UTF16BE;
-				map["utf16le"]  = CharSet::UTF16LE;
-			});
-
 			CharSet fieldType = CharSet::UTF8;
-			const auto position = map.find(fieldTypeName);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(charSetNames, fieldTypeName);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_CharSet: Titanium::Codec::CharSet with name '", fieldTypeName, "' does not exist");
 			}
@@ -124,21 +104,10 @@ namespace Titanium
 
 		Type Constants::to_Type(const std::string& fieldTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, Type> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["byte"]   = Type::Byte;
-				map["double"] = Type::Double;
-				map["float"]  = Type::Float;
-				map["int"]    = Type::Int;
-				map["long"]   = Type::Long;
-				map["short"]  = Type::Short;
-			});
-
 			Type fieldType = Type::Unknown;
-			const auto position = map.find(fieldTypeName);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(typeNames, fieldTypeName);
+			if (position != nullptr) {
+				fieldType = position->value;
 			}
 
 			return fieldType;
@@ -146,17 +115,10 @@ namespace Titanium
 
 		ByteOrder Constants::to_ByteOrder(std::underlying_type<ByteOrder>::type ByteOrder_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ByteOrder>::type, ByteOrder> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<ByteOrder>::type>(ByteOrder::BigEndian)]    = ByteOrder::BigEndian;
-				map[static_cast<std::underlying_type<ByteOrder>::type>(ByteOrder::LittleEndian)] = ByteOrder::LittleEndian;
-			});
-
 			ByteOrder fieldType = ByteOrder::Unknown;
-			const auto position = map.find(ByteOrder_underlying_type);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(byteOrderNames, ByteOrder_underlying_type);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ByteOrder: Titanium::Codec::ByteOrder with value '", ByteOrder_underlying_type, "' does not exist");
 			}
@@ -166,21 +128,10 @@ namespace Titanium
 
 		CharSet Constants::to_CharSet(std::underlying_type<CharSet>::type CharSet_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<CharSet>::type, CharSet> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::ISO_LATIN_1)] = CharSet::ISO_LATIN_1;
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::UTF8)]  = CharSet::UTF8;
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::UTF16)] = CharSet::UTF16;
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::ASCII)] = CharSet::ASCII;
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::UTF16BE)] = CharSet::UTF16BE;
-				map[static_cast<std::underlying_type<CharSet>::type>(CharSet::UTF16LE)] = CharSet::UTF16LE;
-			});
-
 			CharSet fieldType = CharSet::UTF8;
-			const auto position = map.find(CharSet_underlying_type);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(charSetNames, CharSet_underlying_type);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_CharSet: Titanium::Codec::CharSet with value '", CharSet_underlying_type, "' does not exist");
 			}
@@ -190,21 +141,10 @@ namespace Titanium
 
 		Type Constants::to_Type(std::underlying_type<Type>::type Type_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<Type>::type, Type> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<Type>::type>(Type::Byte)]   = Type::Byte;
-				map[static_cast<std::underlying_type<Type>::type>(Type::Short)]  = Type::Short;
-				map[static_cast<std::underlying_type<Type>::type>(Type::Int)]    = Type::Int;
-				map[static_cast<std::underlying_type<Type>::type>(Type::Float)]  = Type::Float;
-				map[static_cast<std::underlying_type<Type>::type>(Type::Long)]   = Type::Long;
-				map[static_cast<std::underlying_type<Type>::type>(Type::Double)] = Type::Double;
-			});
-
 			Type fieldType = Type::Int;
-			const auto position = map.find(Type_underlying_type);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(typeNames, Type_underlying_type);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ByteOrder: Titanium::Codec::ByteOrder with value '", Type_underlying_type, "' does not exist");
 			}
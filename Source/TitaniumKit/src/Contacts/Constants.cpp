@@ -8,8 +8,7 @@
 
 #include "Titanium/Contacts/Constants.hpp"
 #include "Titanium/detail/TiLogger.hpp"
-#include <unordered_map>
-#include <mutex>
+#include "Titanium/detail/TiConstants.hpp"
 
 // TODO Move the constants into the proxies they're used solely? i.e. AUTHORIZATION into ContactsModule, KIND into Contacts.Person, SORT into Contacts.Group?
 
@@ -17,22 +16,21 @@ namespace Titanium
 {
 	namespace Contacts
 	{
+		static const detail::TiConstant<AUTHORIZATION> authorizationNames[] = {
+			{ AUTHORIZATION::AUTHORIZED, "AUTHORIZATION_AUTHORIZED" },
+			{ AUTHORIZATION::DENIED,     "AUTHORIZATION_DENIED" },
+			{ AUTHORIZATION::RESTRICTED, "AUTHORIZATION_RESTRICTED" },
+			{ AUTHORIZATION::UNKNOWN,    "AUTHORIZATION_UNKNOWN" },
+		};
+
 		std::string Constants::to_string(const AUTHORIZATION& authorization) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "AUTHORIZATION::UNKNOWN";
-			static std::unordered_map<AUTHORIZATION, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[AUTHORIZATION::AUTHORIZED]  = "AUTHORIZATION_AUTHORIZED";
-				map[AUTHORIZATION::DENIED] 		= "AUTHORIZATION_DENIED";
-				map[AUTHORIZATION::RESTRICTED]  = "AUTHORIZATION_RESTRICTED";
-				map[AUTHORIZATION::UNKNOWN]     = "AUTHORIZATION_UNKNOWN";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(authorization);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(authorizationNames, authorization);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -40,19 +38,10 @@ namespace Titanium
 
 		AUTHORIZATION Constants::to_AUTHORIZATION(const std::string& authorizationName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, AUTHORIZATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["AUTHORIZATION_AUTHORIZED"]     = AUTHORIZATION::AUTHORIZED;
-				map["AUTHORIZATION_DENIED"] 		= AUTHORIZATION::DENIED;
-				map["AUTHORIZATION_RESTRICTED"]    	= AUTHORIZATION::RESTRICTED;
-				map["AUTHORIZATION_UNKNOWN"]      	= AUTHORIZATION::UNKNOWN;
-			});
-
 			AUTHORIZATION authorization = AUTHORIZATION::UNKNOWN;
-			const auto position = map.find(authorizationName);
-			if (position != map.end()) {
-				authorization = position->second;
+			const auto position = detail::FindConstant(authorizationNames, authorizationName);
+			if (position != nullptr) {
+				authorization = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_AUTHORIZATION: Titanium::Contacts::AUTHORIZATION with name '", authorizationName, "' does not exist");
 			}
@@ -62,19 +51,10 @@ namespace Titanium
 
 		AUTHORIZATION Constants::to_AUTHORIZATION(std::underlying_type<AUTHORIZATION>::type authorization_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<AUTHORIZATION>::type, AUTHORIZATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<AUTHORIZATION>::type>(AUTHORIZATION::AUTHORIZED)]  = AUTHORIZATION::AUTHORIZED;
-				map[static_cast<std::underlying_type<AUTHORIZATION>::type>(AUTHORIZATION::DENIED)] 		= AUTHORIZATION::DENIED;
-				map[static_cast<std::underlying_type<AUTHORIZATION>::type>(AUTHORIZATION::RESTRICTED)]  = AUTHORIZATION::RESTRICTED;
-				map[static_cast<std::underlying_type<AUTHORIZATION>::type>(AUTHORIZATION::UNKNOWN)]     = AUTHORIZATION::UNKNOWN;
-			});
-
 			AUTHORIZATION authorization = AUTHORIZATION::UNKNOWN;
-			const auto position = map.find(authorization_underlying_type);
-			if (position != map.end()) {
-				authorization = position->second;
+			const auto position = detail::FindConstant(authorizationNames, authorization_underlying_type);
+			if (position != nullptr) {
+				authorization = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_AUTHORIZATION: Titanium::Contacts::AUTHORIZATION with value '", authorization_underlying_type, "' does not exist");
 			}
@@ -87,20 +67,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<AUTHORIZATION>::type>(authorization);
 		}
 
+		static const detail::TiConstant<KIND> kindNames[] = {
+			{ KIND::ORGANIZATION, "CONTACTS_KIND_ORGANIZATION" },
+			{ KIND::PERSON,       "CONTACTS_KIND_PERSON" },
+		};
+
 		std::string Constants::to_string(const KIND& kind) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "KIND::UNKNOWN";
-			static std::unordered_map<KIND, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[KIND::PERSON]		= "CONTACTS_KIND_PERSON";
-				map[KIND::ORGANIZATION] = "CONTACTS_KIND_ORGANIZATION";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(kind);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(kindNames, kind);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -108,17 +87,10 @@ namespace Titanium
 
 		KIND Constants::to_KIND(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, KIND> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["CONTACTS_KIND_PERSON"]			= KIND::PERSON;
-				map["CONTACTS_KIND_ORGANIZATION"]	= KIND::ORGANIZATION;
-			});
-
 			KIND kind = KIND::PERSON;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				kind = position->second;
+			const auto position = detail::FindConstant(kindNames, name);
+			if (position != nullptr) {
+				kind = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KIND: Titanium::Contacts::KIND with name '", name, "' does not exist");
 			}
@@ -128,17 +100,10 @@ namespace Titanium
 
 		KIND Constants::to_KIND(std::underlying_type<KIND>::type underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<KIND>::type, KIND> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<KIND>::type>(KIND::PERSON)]		= KIND::PERSON;
-				map[static_cast<std::underlying_type<KIND>::type>(KIND::ORGANIZATION)]	= KIND::ORGANIZATION;
-			});
-
 			KIND kind = KIND::PERSON;
-			const auto position = map.find(underlying_type);
-			if (position != map.end()) {
-				kind = position->second;
+			const auto position = detail::FindConstant(kindNames, underlying_type);
+			if (position != nullptr) {
+				kind = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KIND: Titanium::Contacts::KIND with value '", underlying_type, "' does not exist");
 			}
@@ -151,20 +116,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<KIND>::type>(kind);
 		}
 
+		static const detail::TiConstant<SORT> sortNames[] = {
+			{ SORT::FIRST_NAME, "CONTACTS_SORT_FIRST_NAME" },
+			{ SORT::LAST_NAME,  "CONTACTS_SORT_LAST_NAME" },
+		};
+
 		std::string Constants::to_string(const SORT& kind) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "SORT::UNKNOWN";
-			static std::unordered_map<SORT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[SORT::FIRST_NAME]	= "CONTACTS_SORT_FIRST_NAME";
-				map[SORT::LAST_NAME]	= "CONTACTS_SORT_LAST_NAME";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(kind);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(sortNames, kind);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -172,17 +136,10 @@ namespace Titanium
 
 		SORT Constants::to_SORT(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, SORT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["CONTACTS_SORT_FIRST_NAME"] = SORT::FIRST_NAME;
-				map["CONTACTS_SORT_LAST_NAMEN"] = SORT::LAST_NAME;
-			});
-
 			SORT kind = SORT::FIRST_NAME;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				kind = position->second;
+			const auto position = detail::FindConstant(sortNames, name);
+			if (position != nullptr) {
+				kind = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_SORT: Titanium::Contacts::SORT with name '", name, "' does not exist");
 			}
@@ -192,17 +149,10 @@ namespace Titanium
 
 		SORT Constants::to_SORT(std::underlying_type<SORT>::type underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<SORT>::type, SORT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<SORT>::type>(SORT::FIRST_NAME)]	= SORT::FIRST_NAME;
-				map[static_cast<std::underlying_type<SORT>::type>(SORT::LAST_NAME)]		= SORT::LAST_NAME;
-			});
-
 			SORT sort = SORT::FIRST_NAME;
-			const auto position = map.find(underlying_type);
-			if (position != map.end()) {
-				sort = position->second;
+			const auto position = detail::FindConstant(sortNames, underlying_type);
+			if (position != nullptr) {
+				sort = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_SORT: Titanium::Contacts::SORT with value '", underlying_type, "' does not exist");
 			}
@@ -8,29 +8,27 @@
 
 #include "Titanium/Database/Constants.hpp"
 #include "Titanium/detail/TiLogger.hpp"
-#include <unordered_map>
-#include <mutex>
+#include "Titanium/detail/TiConstants.hpp"
 
 namespace Titanium
 {
 	namespace Database
 	{
+		static const detail::TiConstant<FIELD_TYPE> fieldTypeNames[] = {
+			{ FIELD_TYPE::DOUBLE, "FIELD_TYPE_DOUBLE" },
+			{ FIELD_TYPE::FLOAT,  "FIELD_TYPE_FLOAT" },
+			{ FIELD_TYPE::INT,    "FIELD_TYPE_INT" },
+			{ FIELD_TYPE::STRING, "FIELD_TYPE_STRING" },
+		};
+
 		std::string Constants::to_string(const FIELD_TYPE& fieldType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "FIELD_TYPE::Unknown";
-			static std::unordered_map<FIELD_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[FIELD_TYPE::DOUBLE] = "FIELD_TYPE_DOUBLE";
-				map[FIELD_TYPE::FLOAT] = "FIELD_TYPE_FLOAT";
-				map[FIELD_TYPE::INT] = "FIELD_TYPE_INT";
-				map[FIELD_TYPE::STRING] = "FIELD_TYPE_STRING";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(fieldType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(fieldTypeNames, fieldType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -38,19 +36,10 @@ namespace Titanium
 
 		FIELD_TYPE Constants::to_FIELD_TYPE(const std::string& fieldTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, FIELD_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["FIELD_TYPE_DOUBLE"] = FIELD_TYPE::DOUBLE;
-				map["FIELD_TYPE_FLOAT"] = FIELD_TYPE::FLOAT;
-				map["FIELD_TYPE_INT"] = FIELD_TYPE::INT;
-				map["FIELD_TYPE_STRING"] = FIELD_TYPE::STRING;
-			});
-
 			FIELD_TYPE fieldType = FIELD_TYPE::DOUBLE;
-			const auto position = map.find(fieldTypeName);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(fieldTypeNames, fieldTypeName);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FIELD_TYPE: Titanium::Database::FIELD_TYPE with name '", fieldTypeName, "' does not exist");
 			}
@@ -60,19 +49,10 @@ namespace Titanium
 
 		FIELD_TYPE Constants::to_FIELD_TYPE(std::underlying_type<FIELD_TYPE>::type field_type_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<FIELD_TYPE>::type, FIELD_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<FIELD_TYPE>::type>(FIELD_TYPE::DOUBLE)] = FIELD_TYPE::DOUBLE;
-				map[static_cast<std::underlying_type<FIELD_TYPE>::type>(FIELD_TYPE::FLOAT)] = FIELD_TYPE::FLOAT;
-				map[static_cast<std::underlying_type<FIELD_TYPE>::type>(FIELD_TYPE::INT)] = FIELD_TYPE::INT;
-				map[static_cast<std::underlying_type<FIELD_TYPE>::type>(FIELD_TYPE::STRING)] = FIELD_TYPE::STRING;
-			});
-
 			FIELD_TYPE fieldType = FIELD_TYPE::DOUBLE;
-			const auto position = map.find(field_type_underlying_type);
-			if (position != map.end()) {
-				fieldType = position->second;
+			const auto position = detail::FindConstant(fieldTypeNames, field_type_underlying_type);
+			if (position != nullptr) {
+				fieldType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FIELD_TYPE: Titanium::Database::FIELD_TYPE with value '", field_type_underlying_type, "' does not exist");
 			}
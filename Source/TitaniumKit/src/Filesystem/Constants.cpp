@@ -6,28 +6,26 @@
 
 #include "Titanium/Filesystem/Constants.hpp"
 #include "Titanium/detail/TiLogger.hpp"
-#include <unordered_map>
-#include <mutex>
+#include "Titanium/detail/TiConstants.hpp"
 
 namespace Titanium
 {
 	namespace Filesystem
 	{
+		static const detail::TiConstant<MODE> modeNames[] = {
+			{ MODE::APPEND, "MODE_APPEND" },
+			{ MODE::READ,   "MODE_READ" },
+			{ MODE::WRITE,  "MODE_WRITE" },
+		};
+
 		std::string Constants::to_string(const MODE& modeName) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "MODE::Unknown";
-			static std::unordered_map<MODE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[MODE::READ]   = "MODE_READ";
-      map[MODE::WRITE]  = "MODE_WRITE";
-      map[MODE::APPEND] = "MODE_EMAIL_APPEND";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(modeName);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(modeNames, modeName);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -35,18 +33,10 @@ namespace Titanium
 
 		MODE Constants::to_MODE(const std::string& modeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, MODE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["MODE_READ"]   = MODE::READ;
-      map["MODE_WRITE"]  = MODE::WRITE;
-      map["MODE_APPEND"] = MODE::APPEND;
-			});
-
 			MODE mode = MODE::READ;
-			const auto position = map.find(modeName);
-			if (position != map.end()) {
-				mode = position->second;
+			const auto position = detail::FindConstant(modeNames, modeName);
+			if (position != nullptr) {
+				mode = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_MODE: Titanium::Filesystem::MODE with name '", modeName, "' does not exist");
 			}
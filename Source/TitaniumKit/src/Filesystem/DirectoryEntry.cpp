@@ -0,0 +1,85 @@
+/**
+ * TitaniumKit DirectoryEntry
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/Filesystem/DirectoryEntry.hpp"
+#include <algorithm>
+
+namespace Titanium
+{
+	namespace Filesystem
+	{
+		using namespace HAL;
+
+		bool DirectoryListingOptions_matches(const DirectoryListingOptions& options, const std::string& name) TITANIUM_NOEXCEPT
+		{
+			const auto& pattern = options.filter;
+			if (pattern.empty()) {
+				return true;
+			}
+
+			// Iterative wildcard match with single-star backtracking, linear in practice.
+			std::size_t p = 0, n = 0;
+			std::size_t star = std::string::npos, mark = 0;
+			while (n < name.size()) {
+				if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) {
+					p++;
+					n++;
+				} else if (p < pattern.size() && pattern[p] == '*') {
+					star = p++;
+					mark = n;
+				} else if (star != std::string::npos) {
+					p = star + 1;
+					n = ++mark;
+				} else {
+					return false;
+				}
+			}
+			while (p < pattern.size() && pattern[p] == '*') {
+				p++;
+			}
+			return p == pattern.size();
+		}
+
+		DirectoryListingOptions js_to_DirectoryListingOptions(const JSObject& object)
+		{
+			DirectoryListingOptions options;
+			if (object.HasProperty("recursive")) {
+				options.recursive = static_cast<bool>(object.GetProperty("recursive"));
+			}
+			if (object.HasProperty("withStats")) {
+				options.withStats = static_cast<bool>(object.GetProperty("withStats"));
+			}
+			if (object.HasProperty("filter")) {
+				const auto filter = object.GetProperty("filter");
+				if (filter.IsString()) {
+					options.filter = static_cast<std::string>(filter);
+				}
+			}
+			if (object.HasProperty("batchSize")) {
+				// Batches are reserved up front, so a huge size would fail to allocate
+				const auto batchSize = static_cast<double>(object.GetProperty("batchSize"));
+				if (batchSize >= 1) {
+					options.batchSize = static_cast<std::uint32_t>((std::min)(batchSize, 4096.0));
+				}
+			}
+			return options;
+		}
+
+		JSObject DirectoryEntry_to_js(const JSContext& js_context, const DirectoryEntry& entry)
+		{
+			auto object = js_context.CreateObject();
+			object.SetProperty("name", js_context.CreateString(entry.name));
+			object.SetProperty("isDirectory", js_context.CreateBoolean(entry.isDirectory));
+			if (entry.hasStats) {
+				object.SetProperty("size", js_context.CreateNumber(static_cast<double>(entry.size)));
+				object.SetProperty("modificationTimestamp", js_context.CreateNumber(static_cast<double>(entry.modificationTimestamp.count())));
+			}
+			return object;
+		}
+	} // namespace Filesystem
+} // namespace Titanium
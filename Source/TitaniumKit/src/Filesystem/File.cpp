@@ -56,6 +56,7 @@ namespace Titanium
 			TITANIUM_ADD_FUNCTION(File, exists);
 			TITANIUM_ADD_FUNCTION(File, extension);
 			TITANIUM_ADD_FUNCTION(File, getDirectoryListing);
+			TITANIUM_ADD_FUNCTION(File, listDirectory);
 			TITANIUM_ADD_FUNCTION(File, isDirectory);
 			TITANIUM_ADD_FUNCTION(File, isFile);
 			TITANIUM_ADD_FUNCTION(File, modificationTimestamp);
@@ -225,6 +226,54 @@ namespace Titanium
 			return list;
 		}
 
+		std::vector<DirectoryEntry> File::listDirectory(const DirectoryListingOptions& options) TITANIUM_NOEXCEPT
+		{
+			std::vector<DirectoryEntry> entries;
+			enumerateDirectory(options, [&entries](const DirectoryEntry& entry) {
+				entries.push_back(entry);
+				return true;
+			});
+			return entries;
+		}
+
+		bool File::enumerateDirectory(const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT
+		{
+			if (!isDirectory()) {
+				return true;
+			}
+
+			// Generic fallback: one File object per entry, same as deleteDirectory.
+			const auto js_filesystem = get_context().JSEvaluateScript("Ti.Filesystem");
+			TITANIUM_ASSERT(js_filesystem.IsObject());
+			const auto filesystem_obj = static_cast<JSObject>(js_filesystem).CallAsConstructor();
+			const auto Filesystem = filesystem_obj.GetPrivate<Titanium::FilesystemModule>();
+
+			std::function<bool(const std::shared_ptr<File>&, const std::string&)> walk;
+			walk = [&](const std::shared_ptr<File>& directory, const std::string& prefix) {
+				const auto path = directory->resolve();
+				for (const auto& name : directory->getDirectoryListing()) {
+					const auto file = Filesystem->getFile(get_context(), path + Filesystem->separator() + name);
+
+					DirectoryEntry entry;
+					entry.name = prefix + name;
+					entry.isDirectory = file->isDirectory();
+					if (options.withStats) {
+						entry.hasStats = true;
+						entry.size = entry.isDirectory ? 0 : file->get_size();
+						entry.modificationTimestamp = file->modificationTimestamp();
+					}
+					if (DirectoryListingOptions_matches(options, name) && !visitor(entry)) {
+						return false;
+					}
+					if (options.recursive && entry.isDirectory && !walk(file, entry.name + "/")) {
+						return false;
+					}
+				}
+				return true;
+			};
+			return walk(get_object().GetPrivate<File>(), "");
+		}
+
 		bool File::isDirectory() TITANIUM_NOEXCEPT
 		{
 			TITANIUM_LOG_WARN("File::isDirectory: Unimplemented");
@@ -492,6 +541,42 @@ namespace Titanium
 			return context.CreateArray(result);
 		}
 
+		TITANIUM_FUNCTION(File, listDirectory)
+		{
+			ENSURE_OPTIONAL_OBJECT_AT_INDEX(options_object, 0);
+			const auto options = js_to_DirectoryListingOptions(options_object);
+			const auto context = get_context();
+
+			// Iterator form: listDirectory(options, function (entries) { ... }) delivers
+			// entries in batches of options.batchSize and stops when the callback returns false.
+			if (arguments.size() > 1 && arguments.at(1).IsObject() && static_cast<JSObject>(arguments.at(1)).IsFunction()) {
+				auto callback = static_cast<JSObject>(arguments.at(1));
+				std::vector<JSValue> batch;
+				batch.reserve(options.batchSize);
+				const auto flush = [&]() {
+					const auto result = callback({ context.CreateArray(batch) }, this_object);
+					batch.clear();
+					return !(result.IsBoolean() && !static_cast<bool>(result));
+				};
+				const auto completed = enumerateDirectory(options, [&](const DirectoryEntry& entry) {
+					batch.push_back(DirectoryEntry_to_js(context, entry));
+					return batch.size() < options.batchSize || flush();
+				});
+				if (completed && !batch.empty()) {
+					flush();
+				}
+				return context.CreateUndefined();
+			}
+
+			const auto entries = listDirectory(options);
+			std::vector<JSValue> result;
+			result.reserve(entries.size());
+			for (const auto& entry : entries) {
+				result.push_back(DirectoryEntry_to_js(context, entry));
+			}
+			return context.CreateArray(result);
+		}
+
 		TITANIUM_FUNCTION(File, isDirectory)
 		{
 			return get_context().CreateBoolean(isDirectory());
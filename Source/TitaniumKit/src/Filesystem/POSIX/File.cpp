@@ -0,0 +1,685 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/Filesystem/POSIX/File.hpp"
+#include "Titanium/detail/TiImpl.hpp"
+#include "Titanium/detail/TiThreadPool.hpp"
+#include "Titanium/Blob.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <climits>
+#include <cstdlib>
+#include <limits>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace Titanium
+{
+	namespace Filesystem
+	{
+		namespace POSIX
+		{
+			const std::size_t File::MmapThreshold = 256 * 1024;
+
+			namespace
+			{
+				// Closes the descriptor when it goes out of scope.
+				class FileDescriptor final
+				{
+				public:
+					explicit FileDescriptor(const int& fd) : fd__(fd)
+					{
+					}
+
+					~FileDescriptor()
+					{
+						if (fd__ >= 0) {
+							::close(fd__);
+						}
+					}
+
+					FileDescriptor(const FileDescriptor&) = delete;
+					FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+					int get() const
+					{
+						return fd__;
+					}
+
+					bool valid() const
+					{
+						return fd__ >= 0;
+					}
+
+				private:
+					int fd__;
+				};
+
+				ErrorResponse errno_to_ErrorResponse(const std::string& operation, const std::string& path)
+				{
+					ErrorResponse error;
+					error.code = errno;
+					error.success = false;
+					error.error = operation + " " + path + ": " + std::strerror(errno);
+					return error;
+				}
+
+				std::chrono::milliseconds timespec_to_milliseconds(const struct timespec& ts)
+				{
+					return std::chrono::milliseconds(static_cast<std::int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000);
+				}
+
+				std::string join_path(const std::string& parent, const std::string& name)
+				{
+					if (parent.empty() || parent.back() == '/') {
+						return parent + name;
+					}
+					return parent + "/" + name;
+				}
+
+				bool copy_fd(const int& from, const int& to)
+				{
+					std::vector<std::uint8_t> buffer(64 * 1024);
+					while (true) {
+						const auto count = ::read(from, &buffer[0], buffer.size());
+						if (count == 0) {
+							return true;
+						} else if (count < 0) {
+							if (errno == EINTR) {
+								continue;
+							}
+							return false;
+						}
+						ssize_t written = 0;
+						while (written < count) {
+							const auto result = ::write(to, &buffer[written], count - written);
+							if (result < 0) {
+								if (errno == EINTR) {
+									continue;
+								}
+								return false;
+							}
+							written += result;
+						}
+					}
+				}
+			}
+
+			File::File(const JSContext& js_context) TITANIUM_NOEXCEPT
+			    : Titanium::Filesystem::File(js_context)
+			{
+			}
+
+			void File::postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments)
+			{
+				// if argument is empty, we assume it's called from initializer.
+				if (arguments.empty()) {
+					return;
+				}
+
+				TITANIUM_ASSERT(arguments.at(0).IsString());
+				path__ = static_cast<std::string>(arguments.at(0));
+
+				// strip trailing separators so that get_name and get_parent behave
+				while (path__.size() > 1 && path__.back() == '/') {
+					path__.pop_back();
+				}
+			}
+
+			void File::JSExportInitialize()
+			{
+				JSExport<File>::SetClassVersion(1);
+				JSExport<File>::SetParent(JSExport<Titanium::Filesystem::File>::Class());
+			}
+
+			bool File::getStat(struct stat& st) const TITANIUM_NOEXCEPT
+			{
+				return ::stat(path__.c_str(), &st) == 0;
+			}
+
+			std::string File::parentPath() const TITANIUM_NOEXCEPT
+			{
+				const auto separator = path__.find_last_of('/');
+				if (separator == std::string::npos) {
+					return ".";
+				} else if (separator == 0) {
+					return "/";
+				}
+				return path__.substr(0, separator);
+			}
+
+			bool File::get_executable() const TITANIUM_NOEXCEPT
+			{
+				return ::access(path__.c_str(), X_OK) == 0;
+			}
+
+			bool File::get_hidden() const TITANIUM_NOEXCEPT
+			{
+				const auto name = get_name();
+				return !name.empty() && name.front() == '.';
+			}
+
+			std::string File::get_name() const TITANIUM_NOEXCEPT
+			{
+				const auto separator = path__.find_last_of('/');
+				if (separator == std::string::npos) {
+					return path__;
+				}
+				return path__.substr(separator + 1);
+			}
+
+			std::string File::get_nativePath() const TITANIUM_NOEXCEPT
+			{
+				return "file://" + path__;
+			}
+
+			std::shared_ptr<Titanium::Filesystem::File> File::get_parent() const TITANIUM_NOEXCEPT
+			{
+				if (path__.empty() || path__ == "/") {
+					return nullptr;
+				}
+				const auto ctx = get_context();
+				auto file_ctor = ctx.CreateObject(JSExport<POSIX::File>::Class());
+				auto parent = file_ctor.CallAsConstructor(ctx.CreateString(parentPath()));
+				return parent.GetPrivate<Titanium::Filesystem::File>();
+			}
+
+			bool File::get_readonly() const TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				return getStat(st) && ::access(path__.c_str(), W_OK) != 0;
+			}
+
+			bool File::get_remoteBackup() const TITANIUM_NOEXCEPT
+			{
+				return false;
+			}
+
+			std::uint64_t File::get_size() const TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				if (!getStat(st) || S_ISDIR(st.st_mode)) {
+					return 0;
+				}
+				return static_cast<std::uint64_t>(st.st_size);
+			}
+
+			bool File::get_symbolicLink() const TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				return ::lstat(path__.c_str(), &st) == 0 && S_ISLNK(st.st_mode);
+			}
+
+			bool File::get_writable() const TITANIUM_NOEXCEPT
+			{
+				return ::access(path__.c_str(), W_OK) == 0;
+			}
+
+			bool File::copy(const std::string& dest) TITANIUM_NOEXCEPT
+			{
+				FileDescriptor from(::open(path__.c_str(), O_RDONLY));
+				if (!from.valid()) {
+					TITANIUM_LOG_WARN(errno_to_ErrorResponse("File::copy: open", path__).error);
+					return false;
+				}
+				struct stat st;
+				if (::fstat(from.get(), &st) != 0 || !S_ISREG(st.st_mode)) {
+					return false;
+				}
+				FileDescriptor to(::open(dest.c_str(), O_WRONLY | O_CREAT | O_TRUNC, st.st_mode & 0777));
+				if (!to.valid()) {
+					TITANIUM_LOG_WARN(errno_to_ErrorResponse("File::copy: open", dest).error);
+					return false;
+				}
+				return copy_fd(from.get(), to.get());
+			}
+
+			bool File::createDirectory() TITANIUM_NOEXCEPT
+			{
+				return ::mkdir(path__.c_str(), 0755) == 0;
+			}
+
+			bool File::createFile() TITANIUM_NOEXCEPT
+			{
+				FileDescriptor fd(::open(path__.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644));
+				return fd.valid();
+			}
+
+			std::chrono::milliseconds File::createTimestamp() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				if (!getStat(st)) {
+					return std::chrono::milliseconds(0);
+				}
+#if defined(__APPLE__)
+				return timespec_to_milliseconds(st.st_birthtimespec);
+#else
+				// Linux does not expose a birth time through stat(2), ctime is the closest we get.
+				return timespec_to_milliseconds(st.st_ctim);
+#endif
+			}
+
+			bool File::removeRecursive(const std::string& path)
+			{
+				struct stat st;
+				if (::lstat(path.c_str(), &st) != 0) {
+					return false;
+				}
+				if (!S_ISDIR(st.st_mode)) {
+					return ::unlink(path.c_str()) == 0;
+				}
+
+				const auto dir = ::opendir(path.c_str());
+				if (dir == nullptr) {
+					return false;
+				}
+				bool result = true;
+				while (const auto entry = ::readdir(dir)) {
+					if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) {
+						continue;
+					}
+					if (!removeRecursive(join_path(path, entry->d_name))) {
+						result = false;
+						break;
+					}
+				}
+				::closedir(dir);
+				return result && ::rmdir(path.c_str()) == 0;
+			}
+
+			bool File::deleteDirectory(const bool& recursive) TITANIUM_NOEXCEPT
+			{
+				if (!isDirectory()) {
+					return false;
+				}
+				if (!recursive) {
+					return ::rmdir(path__.c_str()) == 0;
+				}
+				return removeRecursive(path__);
+			}
+
+			bool File::deleteFile() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				if (!getStat(st)) {
+					return false;
+				}
+				if (S_ISDIR(st.st_mode)) {
+					return ::rmdir(path__.c_str()) == 0;
+				}
+				return ::unlink(path__.c_str()) == 0;
+			}
+
+			bool File::exists() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				return getStat(st);
+			}
+
+			std::string File::extension() TITANIUM_NOEXCEPT
+			{
+				const auto name = get_name();
+				const auto dot = name.find_last_of('.');
+				if (dot == std::string::npos || dot == 0) {
+					return "";
+				}
+				return name.substr(dot + 1);
+			}
+
+			std::vector<std::string> File::getDirectoryListing() TITANIUM_NOEXCEPT
+			{
+				std::vector<std::string> list;
+				const auto dir = ::opendir(path__.c_str());
+				if (dir == nullptr) {
+					return list;
+				}
+				while (const auto entry = ::readdir(dir)) {
+					if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) {
+						continue;
+					}
+					list.push_back(entry->d_name);
+				}
+				::closedir(dir);
+				return list;
+			}
+
+			bool File::enumerateDirectory(const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor) TITANIUM_NOEXCEPT
+			{
+				const auto fd = ::open(path__.c_str(), O_RDONLY | O_DIRECTORY);
+				if (fd < 0) {
+					return true;
+				}
+				return enumerateDirectory(fd, "", options, visitor);
+			}
+
+			bool File::enumerateDirectory(const int& fd, const std::string& prefix, const DirectoryListingOptions& options, const std::function<bool(const DirectoryEntry&)>& visitor)
+			{
+				const auto dir = ::fdopendir(fd);
+				if (dir == nullptr) {
+					::close(fd);
+					return true;
+				}
+
+				bool completed = true;
+				while (const auto dirent = ::readdir(dir)) {
+					if (std::strcmp(dirent->d_name, ".") == 0 || std::strcmp(dirent->d_name, "..") == 0) {
+						continue;
+					}
+
+					DirectoryEntry entry;
+					entry.isDirectory = dirent->d_type == DT_DIR;
+					bool is_link = dirent->d_type == DT_LNK;
+
+					// d_type is enough unless stats were asked for, or the file system
+					// (or a symbolic link) leaves us guessing.
+					if (options.withStats || dirent->d_type == DT_UNKNOWN || is_link) {
+						struct stat st;
+						if (::fstatat(::dirfd(dir), dirent->d_name, &st, 0) == 0) {
+							entry.isDirectory = S_ISDIR(st.st_mode);
+							if (options.withStats) {
+								entry.hasStats = true;
+								entry.size = entry.isDirectory ? 0 : static_cast<std::uint64_t>(st.st_size);
+#if defined(__APPLE__)
+								entry.modificationTimestamp = timespec_to_milliseconds(st.st_mtimespec);
+#else
+								entry.modificationTimestamp = timespec_to_milliseconds(st.st_mtim);
+#endif
+							}
+						}
+						if (dirent->d_type == DT_UNKNOWN && ::fstatat(::dirfd(dir), dirent->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0) {
+							is_link = S_ISLNK(st.st_mode);
+						}
+					}
+
+					if (DirectoryListingOptions_matches(options, dirent->d_name)) {
+						entry.name = prefix + dirent->d_name;
+						if (!visitor(entry)) {
+							completed = false;
+							break;
+						}
+					}
+
+					// Do not follow symbolic links while recursing to avoid cycles.
+					if (options.recursive && entry.isDirectory && !is_link) {
+						const auto child = ::openat(::dirfd(dir), dirent->d_name, O_RDONLY | O_DIRECTORY);
+						if (child >= 0 && !enumerateDirectory(child, prefix + dirent->d_name + "/", options, visitor)) {
+							completed = false;
+							break;
+						}
+					}
+				}
+				::closedir(dir);
+				return completed;
+			}
+
+			bool File::isDirectory() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				return getStat(st) && S_ISDIR(st.st_mode);
+			}
+
+			bool File::isFile() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				return getStat(st) && S_ISREG(st.st_mode);
+			}
+
+			std::chrono::milliseconds File::modificationTimestamp() TITANIUM_NOEXCEPT
+			{
+				struct stat st;
+				if (!getStat(st)) {
+					return std::chrono::milliseconds(0);
+				}
+#if defined(__APPLE__)
+				return timespec_to_milliseconds(st.st_mtimespec);
+#else
+				return timespec_to_milliseconds(st.st_mtim);
+#endif
+			}
+
+			bool File::move(const std::string& newpath) TITANIUM_NOEXCEPT
+			{
+				if (::rename(path__.c_str(), newpath.c_str()) == 0) {
+					path__ = newpath;
+					return true;
+				}
+				// rename(2) cannot cross file systems, fall back to copy and unlink
+				if (errno == EXDEV && copy(newpath) && ::unlink(path__.c_str()) == 0) {
+					path__ = newpath;
+					return true;
+				}
+				TITANIUM_LOG_WARN(errno_to_ErrorResponse("File::move", path__).error);
+				return false;
+			}
+
+			std::shared_ptr<Titanium::Blob> File::read() TITANIUM_NOEXCEPT
+			{
+				if (!isFile()) {
+					return nullptr;
+				}
+				auto blob = get_context().CreateObject(JSExport<Titanium::Blob>::Class()).CallAsConstructor();
+				auto blob_ptr = blob.GetPrivate<Titanium::Blob>();
+				blob_ptr->construct(getContent());
+				return blob_ptr;
+			}
+
+			bool File::rename(const std::string& newname) TITANIUM_NOEXCEPT
+			{
+				const auto newpath = join_path(parentPath(), newname);
+				if (::rename(path__.c_str(), newpath.c_str()) != 0) {
+					return false;
+				}
+				path__ = newpath;
+				return true;
+			}
+
+			std::string File::resolve() TITANIUM_NOEXCEPT
+			{
+				char resolved[PATH_MAX];
+				if (::realpath(path__.c_str(), resolved) == nullptr) {
+					return path__;
+				}
+				return resolved;
+			}
+
+			std::uint64_t File::spaceAvailable() TITANIUM_NOEXCEPT
+			{
+				struct statvfs vfs;
+				const auto target = isDirectory() ? path__ : parentPath();
+				if (::statvfs(target.c_str(), &vfs) != 0) {
+					return 0;
+				}
+				return static_cast<std::uint64_t>(vfs.f_bavail) * vfs.f_frsize;
+			}
+
+			std::int64_t File::writeRange(const std::string& path, const std::uint8_t* data, const std::size_t& length, const bool& append, ErrorResponse& error)
+			{
+				FileDescriptor fd(::open(path.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC), 0644));
+				if (!fd.valid()) {
+					error = errno_to_ErrorResponse("open", path);
+					return -1;
+				}
+				std::size_t written = 0;
+				while (written < length) {
+					const auto result = ::write(fd.get(), data + written, length - written);
+					if (result < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						error = errno_to_ErrorResponse("write", path);
+						return -1;
+					}
+					written += static_cast<std::size_t>(result);
+				}
+				return static_cast<std::int64_t>(written);
+			}
+
+			bool File::readRange(const std::string& path, const std::uint64_t& offset, const std::uint64_t& length, std::vector<std::uint8_t>& buffer, ErrorResponse& error)
+			{
+				FileDescriptor fd(::open(path.c_str(), O_RDONLY));
+				if (!fd.valid()) {
+					error = errno_to_ErrorResponse("open", path);
+					return false;
+				}
+				struct stat st;
+				if (::fstat(fd.get(), &st) != 0) {
+					error = errno_to_ErrorResponse("fstat", path);
+					return false;
+				}
+
+				const auto size = static_cast<std::uint64_t>(st.st_size);
+				if (offset >= size) {
+					buffer.clear();
+					return true;
+				}
+				const auto count = static_cast<std::size_t>(std::min(length, size - offset));
+				buffer.resize(count);
+				if (count == 0) {
+					return true;
+				}
+
+				if (count >= MmapThreshold) {
+					// mmap needs a page aligned offset
+					const auto page_size = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+					const auto aligned_offset = offset - (offset % page_size);
+					const auto delta = static_cast<std::size_t>(offset - aligned_offset);
+					const auto mapped = ::mmap(nullptr, count + delta, PROT_READ, MAP_PRIVATE, fd.get(), static_cast<off_t>(aligned_offset));
+					if (mapped != MAP_FAILED) {
+						::madvise(mapped, count + delta, MADV_SEQUENTIAL);
+						std::memcpy(&buffer[0], static_cast<const std::uint8_t*>(mapped) + delta, count);
+						::munmap(mapped, count + delta);
+						return true;
+					}
+					// fall through to pread, e.g. for files on file systems without mmap support
+				}
+
+				std::size_t total = 0;
+				while (total < count) {
+					const auto result = ::pread(fd.get(), &buffer[total], count - total, static_cast<off_t>(offset + total));
+					if (result < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						error = errno_to_ErrorResponse("pread", path);
+						return false;
+					} else if (result == 0) {
+						// file was truncated while reading
+						buffer.resize(total);
+						break;
+					}
+					total += static_cast<std::size_t>(result);
+				}
+				return true;
+			}
+
+			bool File::write(const std::string& data, const bool& append) TITANIUM_NOEXCEPT
+			{
+				ErrorResponse error;
+				const auto result = writeRange(path__, reinterpret_cast<const std::uint8_t*>(data.data()), data.size(), append, error);
+				if (result < 0) {
+					TITANIUM_LOG_WARN("File::write: ", error.error);
+				}
+				return result >= 0;
+			}
+
+			bool File::write(const std::shared_ptr<Titanium::Blob>& data, const bool& append) TITANIUM_NOEXCEPT
+			{
+				if (data == nullptr) {
+					return false;
+				}
+				const auto content = data->getData();
+				return write(content, 0, static_cast<std::uint32_t>(content.size()), append);
+			}
+
+			bool File::write(const std::shared_ptr<Titanium::Filesystem::File>& data, const bool& append) TITANIUM_NOEXCEPT
+			{
+				if (data == nullptr) {
+					return false;
+				}
+				const auto content = data->getContent();
+				return write(content, 0, static_cast<std::uint32_t>(content.size()), append);
+			}
+
+			bool File::write(const std::vector<std::uint8_t>& data, const std::uint32_t& offset, const std::uint32_t& length, const bool& append)
+			{
+				if (offset > data.size()) {
+					return false;
+				}
+				const auto count = std::min<std::size_t>(length, data.size() - offset);
+				ErrorResponse error;
+				const auto result = writeRange(path__, data.data() + offset, count, append, error);
+				if (result < 0) {
+					TITANIUM_LOG_WARN("File::write: ", error.error);
+				}
+				return result >= 0;
+			}
+
+			void File::writeAsync(const std::vector<std::uint8_t>& data, const std::uint32_t& offset, const std::uint32_t& length, const bool& append, const std::function<void(const ErrorResponse&, const uint32_t&)>& callback)
+			{
+				// Only the requested slice is captured, the caller's buffer may not outlive this call.
+				const auto begin = std::min<std::size_t>(offset, data.size());
+				const auto end = begin + std::min<std::size_t>(length, data.size() - begin);
+				const auto slice = std::make_shared<std::vector<std::uint8_t>>(data.begin() + begin, data.begin() + end);
+				const auto path = path__;
+
+				Titanium::detail::TiThreadPool::IOPool().Post([path, slice, append, callback]() {
+					ErrorResponse error;
+					const auto result = writeRange(path, slice->data(), slice->size(), append, error);
+					callback(error, result < 0 ? 0 : static_cast<std::uint32_t>(result));
+				});
+			}
+
+			std::vector<std::uint8_t> File::readBytes(const std::uint32_t& offset, const std::uint32_t& length) const
+			{
+				std::vector<std::uint8_t> buffer;
+				ErrorResponse error;
+				if (!readRange(path__, offset, length, buffer, error)) {
+					TITANIUM_LOG_WARN("File::readBytes: ", error.error);
+				}
+				return buffer;
+			}
+
+			void File::readBytesAsync(const std::uint32_t& offset, const std::uint32_t& length, const std::function<void(const ErrorResponse&, const std::vector<std::uint8_t>&)>& callback) const
+			{
+				const auto path = path__;
+				Titanium::detail::TiThreadPool::IOPool().Post([path, offset, length, callback]() {
+					std::vector<std::uint8_t> buffer;
+					ErrorResponse error;
+					readRange(path, offset, length, buffer, error);
+					callback(error, buffer);
+				});
+			}
+
+			void File::readAllBytesAsync(const std::function<void(const ErrorResponse&, const std::vector<std::uint8_t>&)>& callback) const
+			{
+				const auto path = path__;
+				Titanium::detail::TiThreadPool::IOPool().Post([path, callback]() {
+					std::vector<std::uint8_t> buffer;
+					ErrorResponse error;
+					readRange(path, 0, std::numeric_limits<std::uint64_t>::max(), buffer, error);
+					callback(error, buffer);
+				});
+			}
+
+			std::vector<std::uint8_t> File::getContent() const TITANIUM_NOEXCEPT
+			{
+				std::vector<std::uint8_t> buffer;
+				ErrorResponse error;
+				if (!readRange(path__, 0, std::numeric_limits<std::uint64_t>::max(), buffer, error)) {
+					TITANIUM_LOG_WARN("File::getContent: ", error.error);
+				}
+				return buffer;
+			}
+		} // namespace POSIX
+	} // namespace Filesystem
+}  // namespace Titanium
@@ -10,6 +10,7 @@
 #include "Titanium/detail/TiUtil.hpp"
 #include "Titanium/detail/TiImpl.hpp"
 #include "Titanium/Module.hpp"
+#include <algorithm>
 #include <sstream>
 #include <functional>
 #include <boost/algorithm/string/predicate.hpp>
@@ -21,6 +22,7 @@ namespace Titanium
 	using namespace Titanium::detail;
 
 	const std::string GlobalObject::COMMONJS_SEPARATOR__{"/"};
+	const std::string GlobalObject::REQUIRE_MANIFEST__{"_require_manifest_.json"};
 	std::atomic<std::uint32_t> GlobalObject::timer_id_generator__;
 	std::uint32_t GlobalObject::require_nested_count__ = 0;
 
@@ -38,6 +40,9 @@ namespace Titanium
 	GlobalObject::~GlobalObject() TITANIUM_NOEXCEPT
 	{
 		TITANIUM_LOG_DEBUG("GlobalObject:: dtor ", this);
+		if (timer_tick_running__) {
+			timer_tick__->Stop();
+		}
 	}
 
 	static std::vector<std::string> slice(const std::vector<std::string>& list, const size_t& begin, const size_t& end=std::string::npos)
@@ -122,7 +127,7 @@ namespace Titanium
 
 		for (std::vector<std::string>::iterator i = checks.begin(); i!=checks.end(); i++) {
 			auto check = *i;
-			if (requiredModuleExists(check)) {
+			if (moduleExists(check)) {
 				return check;
 			}
 		}
@@ -132,7 +137,14 @@ namespace Titanium
 	std::string GlobalObject::resolvePathAsDirectory(const JSObject& parent, const std::string& path) const TITANIUM_NOEXCEPT
 	{
 		const auto packageJSONFile = path + "/package.json";
-		if (requiredModuleExists(packageJSONFile)) {
+		if (require_manifest_only__) {
+			// The build already resolved "main"
+			const auto leading_separator = path.find(COMMONJS_SEPARATOR__) == 0;
+			const auto package = require_manifest_packages__.find(leading_separator ? path.substr(1) : path);
+			if (package != require_manifest_packages__.end()) {
+				return (leading_separator ? COMMONJS_SEPARATOR__ : "") + package->second;
+			}
+		} else if (requiredModuleExists(packageJSONFile)) {
 			TITANIUM_LOG_DEBUG("package.json exists");
 			const auto content = readRequiredModule(parent, packageJSONFile);
 			TITANIUM_LOG_DEBUG("Content: " + content);
@@ -149,11 +161,11 @@ namespace Titanium
 			}
 		}
 		const auto indexFile = path + "/index.js";
-		if (requiredModuleExists(indexFile)) {
+		if (moduleExists(indexFile)) {
 			return indexFile;
 		}
 		const auto indexJSON = path + "/index.json";
-		if (requiredModuleExists(indexJSON)) {
+		if (moduleExists(indexJSON)) {
 			return indexJSON;
 		}
 		return std::string();
@@ -197,6 +209,26 @@ namespace Titanium
 			return cached->second;
 		}
 
+		// Try the manifest first; anything it does not know about, such as
+		// files added after the build, goes through the filesystem.
+		loadRequireManifest(parent);
+		std::string modulePath;
+		if (!require_manifest_files__.empty()) {
+			require_manifest_only__ = true;
+			modulePath = resolveModule(parent, moduleId, dirname);
+			require_manifest_only__ = false;
+		}
+		if (modulePath.empty()) {
+			modulePath = resolveModule(parent, moduleId, dirname);
+		}
+
+		module_path_cache__.emplace(modulePathCacheKey, modulePath);
+
+		return modulePath;
+	}
+
+	std::string GlobalObject::resolveModule(const JSObject& parent, const std::string& moduleId, const std::string& dirname) const TITANIUM_NOEXCEPT
+	{
 		auto isNodeModule = false;
 		std::string rawPath;
 
@@ -222,11 +254,60 @@ namespace Titanium
 			}
 		}
 
-		module_path_cache__.emplace(modulePathCacheKey, modulePath);
-
 		return modulePath;
 	}
 
+	void GlobalObject::loadRequireManifest(const JSObject& parent) TITANIUM_NOEXCEPT
+	{
+		if (require_manifest_loaded__) {
+			return;
+		}
+		require_manifest_loaded__ = true;
+
+		// {"files": ["app.js", ...], "packages": {"node_modules/foo": "node_modules/foo/lib/foo.js", ...}}
+		TITANIUM_EXCEPTION_CATCH_START {
+			if (!requiredModuleExists(REQUIRE_MANIFEST__)) {
+				return;
+			}
+			const auto manifest = parent.get_context().CreateValueFromJSON(readRequiredModule(parent, REQUIRE_MANIFEST__));
+			if (!manifest.IsObject()) {
+				TITANIUM_LOG_WARN("GlobalObject::require: ", REQUIRE_MANIFEST__, " is not a JSON object, ignoring it");
+				return;
+			}
+			const auto manifest_object = static_cast<JSObject>(manifest);
+
+			const auto files = manifest_object.GetProperty("files");
+			if (files.IsObject()) {
+				const auto files_object = static_cast<JSObject>(files);
+				if (files_object.IsArray()) {
+					const auto file_list = static_cast<std::vector<JSValue>>(static_cast<JSArray>(files_object));
+					require_manifest_files__.reserve(file_list.size());
+					for (const auto& file : file_list) {
+						require_manifest_files__.emplace(static_cast<std::string>(file));
+					}
+				}
+			}
+
+			const auto packages = manifest_object.GetProperty("packages");
+			if (packages.IsObject()) {
+				const auto package_object = static_cast<JSObject>(packages);
+				for (const auto& name : static_cast<std::vector<JSString>>(package_object.GetPropertyNames())) {
+					require_manifest_packages__.emplace(name, static_cast<std::string>(package_object.GetProperty(name)));
+				}
+			}
+			TITANIUM_LOG_DEBUG("GlobalObject::require: loaded ", require_manifest_files__.size(), " modules from ", REQUIRE_MANIFEST__);
+		} TITANIUM_EXCEPTION_CATCH_END
+	}
+
+	bool GlobalObject::moduleExists(const std::string& path) const TITANIUM_NOEXCEPT
+	{
+		if (require_manifest_only__) {
+			const auto leading_separator = path.find(COMMONJS_SEPARATOR__) == 0;
+			return require_manifest_files__.find(leading_separator ? path.substr(1) : path) != require_manifest_files__.end();
+		}
+		return requiredModuleExists(path);
+	}
+
 	bool GlobalObject::requiredNativeModuleExists(const JSContext& js_context, const std::string& moduleId) const TITANIUM_NOEXCEPT
 	{
 		return false;
@@ -321,34 +402,34 @@ namespace Titanium
 			JSValue result = js_context.CreateUndefined();
 			if (boost::ends_with(module_path, ".json")){
 				result = js_context.CreateValueFromJSON(module_js);
-			} else if (js_context.JSCheckScriptSyntax(module_js, moduleId)) {
+			} else if (moduleId == "/app") {
 				//
 				// app entry point should not be treated as "CommonJS module". It should expose every variables to children.
 				//
-				if (moduleId == "/app") {
-					const std::string app_module_js = "try {" + module_js + "} catch (E) { E.fileName='app.js'; Titanium_RedScreenOfDeath(E);}";
-					result = js_context.JSEvaluateScript(app_module_js, js_context.get_global_object());
-				} else {
-					const std::string require_module_js = "(function(global) { var exports={},__OXP=exports,module={'exports':exports},__dirname='" + currentDir__ + "',__filename='/"
-						+ module_path + "';try {" + module_js + R"JS(
-						if(module.exports !== __OXP){
-							return module.exports;
-						} else {
-							return exports;
-						}
-					  } catch (E) {
-						if (!E.fileName) {
-						    E.fileName = __filename;
-						}
-						Titanium_RedScreenOfDeath(E);
-					  }
-					})(this);
-					)JS";
-					result = js_context.JSEvaluateScript(require_module_js, js_context.get_global_object(), module_path);
-				}
+				const std::string app_module_js = "try {" + module_js + "} catch (E) { E.fileName='app.js'; Titanium_RedScreenOfDeath(E);}";
+				result = js_context.JSEvaluateScript(app_module_js, js_context.get_global_object());
 			} else {
-				currentDir__ = dirname; // Should ensure this gets reset on _EVERY_ code branch possible here. Would be nice if C++/CX had finally blocks
-				detail::ThrowRuntimeError("require", "Could not load module "+moduleId);
+				// Compile the source as the body of a function taking the CommonJS
+				// variables as parameters. This is the only parse the module gets,
+				// so a syntax error surfaces here as an exception.
+				static const std::vector<JSString> parameter_names { "exports", "module", "__filename", "__dirname", "global" };
+				const auto filename = "/" + module_path;
+				auto module_function = js_context.CreateFunction(module_js, parameter_names, "", filename);
+
+				auto exports = js_context.CreateObject();
+				auto module = js_context.CreateObject();
+				module.SetProperty("exports", exports);
+
+				const std::vector<JSValue> arguments {
+					module_function,
+					exports,
+					module,
+					js_context.CreateString(filename),
+					js_context.CreateString(currentDir__),
+					js_context.get_global_object()
+				};
+				auto runner = getRequireRunner(js_context);
+				result = runner(arguments, js_context.get_global_object());
 			}
 			currentDir__ = dirname; // Should ensure this gets reset on _EVERY_ code branch possible here. Would be nice if C++/CX had finally blocks
 			if (!result.IsObject()) {
@@ -367,20 +448,31 @@ namespace Titanium
 		return js_context.CreateUndefined();
 	}
 
+	JSObject GlobalObject::getRequireRunner(const JSContext& js_context)
+	{
+		// Calls a compiled module and sends uncaught errors to the red screen
+		// of death, the way the old source wrapper did. Modules share it.
+		if (!require_runner__) {
+			static const std::vector<JSString> parameter_names { "fn", "exports", "module", "__filename", "__dirname", "global" };
+			const std::string runner_js = R"JS(
+				try {
+					fn.call(global, exports, module, __filename, __dirname, global);
+					return module.exports;
+				} catch (E) {
+					if (!E.fileName) {
+						E.fileName = __filename;
+					}
+					Titanium_RedScreenOfDeath(E);
+				}
+			)JS";
+			require_runner__ = std::make_shared<JSObject>(js_context.CreateFunction(runner_js, parameter_names));
+		}
+		return *require_runner__;
+	}
+
 	unsigned GlobalObject::setTimeout(JSObject&& function, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT
 	{
-		const auto timerId = timer_id_generator__++;
-
-		RegisterCallback(std::move(function), timerId);
-
-		Callback_t callback = [this, timerId]() mutable {
-			InvokeCallback(timerId);
-			clearTimeout(timerId);
-		};
-
-		StartTimer(std::move(callback), timerId, delay);
-
-		return timerId;
+		return StartTimer(std::move(function), delay, false);
 	}
 
 	void GlobalObject::clearTimeout(const unsigned& timerId) TITANIUM_NOEXCEPT
@@ -390,17 +482,7 @@ namespace Titanium
 
 	unsigned GlobalObject::setInterval(JSObject&& function, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT
 	{
-		const auto timerId = timer_id_generator__++;
-
-		RegisterCallback(std::move(function), timerId);
-
-		Callback_t callback = [this, timerId]() mutable {
-			InvokeCallback(timerId);
-		};
-
-		StartTimer(std::move(callback), timerId, delay);
-
-		return timerId;
+		return StartTimer(std::move(function), delay, true);
 	}
 
 	void GlobalObject::clearInterval(const unsigned& timerId) TITANIUM_NOEXCEPT
@@ -408,56 +490,158 @@ namespace Titanium
 		StopTimer(timerId);
 	}
 
-	void GlobalObject::RegisterCallback(JSObject&& function, const unsigned& timerId) TITANIUM_NOEXCEPT
+	unsigned GlobalObject::setNativeTimeout(const std::function<void()>& callback, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT
+	{
+		const auto timerId = timer_id_generator__++;
+		native_timer_callback_map__.emplace(timerId, callback);
+		ScheduleTimer(timerId, delay, false);
+		return timerId;
+	}
+
+	unsigned GlobalObject::StartTimer(JSObject&& function, const std::chrono::milliseconds& delay, const bool& repeating) TITANIUM_NOEXCEPT
 	{
 		TITANIUM_ASSERT(function.IsFunction());
+		const auto timerId = timer_id_generator__++;
 		TITANIUM_ASSERT(timer_callback_map__.find(timerId) == timer_callback_map__.end());
 		timer_callback_map__.emplace(timerId, function);
+		ScheduleTimer(timerId, delay, repeating);
+		return timerId;
+	}
+
+	void GlobalObject::ScheduleTimer(const unsigned& timerId, const std::chrono::milliseconds& delay, const bool& repeating) TITANIUM_NOEXCEPT
+	{
+		// Not worth rounding up to a wheel tick
+		if (delay.count() <= 0 && !repeating) {
+			timer_immediate__.push_back(timerId);
+			TITANIUM_LOG_DEBUG("GlobalObject::ScheduleTimer: timerId ", timerId, " on the next turn");
+			UpdateTimerTick();
+			return;
+		}
+
+		const auto now = timerNow();
+		if (timer_wheel__ == nullptr) {
+			timer_wheel__ = std::make_shared<detail::TiTimerWheel>(timerResolution(), now);
+		}
+		timer_wheel__->Schedule(timerId, delay, repeating, now);
+		TITANIUM_LOG_DEBUG("GlobalObject::ScheduleTimer: timerId ", timerId, " in ", delay.count(), "ms");
+
+		UpdateTimerTick();
+	}
+
+	void GlobalObject::StopTimer(const unsigned& timerId) TITANIUM_NOEXCEPT
+	{
+		if (timer_wheel__ != nullptr) {
+			timer_wheel__->Cancel(timerId);
+		}
+		const auto immediate = std::find(timer_immediate__.begin(), timer_immediate__.end(), timerId);
+		if (immediate != timer_immediate__.end()) {
+			timer_immediate__.erase(immediate);
+		}
+
+		// A timeout that is already due in the running batch has left the wheel
+		// but still has its callback, which RunTimer then skips.
+		const auto registered = timer_callback_map__.erase(timerId) + native_timer_callback_map__.erase(timerId);
+		if (registered > 0) {
+			TITANIUM_LOG_DEBUG("GlobalObject::StopTimer: timerId ", timerId, " cleared");
+			UpdateTimerTick();
+		} else {
+			TITANIUM_LOG_WARN("GlobalObject::StopTimer: timerId ", timerId, " is not registered");
+		}
 	}
 
-	void GlobalObject::UnregisterCallback(const unsigned& timerId) TITANIUM_NOEXCEPT
+	void GlobalObject::OnTimerTick() TITANIUM_NOEXCEPT
 	{
-		TITANIUM_ASSERT(timer_callback_map__.find(timerId) != timer_callback_map__.end());
-		timer_callback_map__.erase(timerId);
+		const auto now = timerNow();
+		if (timer_tick_running__) {
+			// The Timer repeats at its interval until it is rearmed
+			timer_tick_due__ = now + timer_tick__->get_interval();
+		}
+		timer_tick_firing__ = true;
+
+		const auto global_object = get_context().get_global_object();
+		// Zero-delay timeouts set by these callbacks wait for the next turn
+		std::vector<unsigned> immediate;
+		immediate.swap(timer_immediate__);
+		for (const auto timerId : immediate) {
+			RunTimer(timerId, false, global_object);
+		}
+		if (timer_wheel__ != nullptr) {
+			for (const auto& expired : timer_wheel__->Advance(now)) {
+				RunTimer(expired.id, expired.repeating, global_object);
+			}
+		}
+
+		timer_tick_firing__ = false;
+		UpdateTimerTick();
 	}
 
-	void GlobalObject::InvokeCallback(const unsigned& timerId) TITANIUM_NOEXCEPT
+	void GlobalObject::RunTimer(const unsigned& timerId, const bool& repeating, const JSObject& global_object) TITANIUM_NOEXCEPT
 	{
+		// An earlier callback in this batch may have cleared it
+		const auto found = timer_callback_map__.find(timerId);
+		if (found == timer_callback_map__.end()) {
+			const auto native = native_timer_callback_map__.find(timerId);
+			if (native != native_timer_callback_map__.end()) {
+				const auto callback = native->second;
+				native_timer_callback_map__.erase(native);
+				callback();
+			}
+			return;
+		}
+		auto callback = found->second;
+		if (!repeating) {
+			timer_callback_map__.erase(found);
+		}
 		TITANIUM_EXCEPTION_CATCH_START{
-			const auto found = timer_callback_map__.find(timerId);
-			TITANIUM_ASSERT(found != timer_callback_map__.end());
-			auto callback = found->second;
-			TITANIUM_ASSERT(callback.IsFunction());
-			callback(get_context().get_global_object());
+			callback(global_object);
 		} TITANIUM_EXCEPTION_CATCH_END
 	}
 
-	void GlobalObject::StartTimer(Callback_t&& callback, const unsigned& timerId, const std::chrono::milliseconds& delay) TITANIUM_NOEXCEPT
+	void GlobalObject::UpdateTimerTick() TITANIUM_NOEXCEPT
+	{
+		if (timer_tick_firing__) {
+			return;
+		}
+
+		const auto pending = !timer_immediate__.empty() || (timer_wheel__ != nullptr && !timer_wheel__->empty());
+		if (!pending) {
+			if (timer_tick_running__) {
+				timer_tick_running__ = false;
+				timer_tick__->Stop();
+			}
+			return;
+		}
+
+		// Sleep until the next timer is due rather than waking every tick
+		const auto now = timerNow();
+		const auto next = timer_immediate__.empty() ? std::max(timer_wheel__->NextExpiry(), now) : now;
+		if (timer_tick_running__ && timer_tick_due__ == next) {
+			return;
+		}
+		if (timer_tick_running__) {
+			timer_tick__->Stop();
+		}
+		const auto delay = next - now;
+		if (timer_tick__ == nullptr) {
+			timer_tick__ = CreateTimer([this]() {
+				OnTimerTick();
+			}, delay);
+		} else if (timer_tick__->get_interval() != delay) {
+			timer_tick__->set_interval(delay);
+		}
+		timer_tick__->Start();
+		timer_tick_running__ = true;
+		timer_tick_due__ = next;
+	}
+
+	std::chrono::milliseconds GlobalObject::timerResolution() const TITANIUM_NOEXCEPT
 	{
-		auto timer = CreateTimer(callback, delay);
-		const auto timer_insert_result = timer_map__.emplace(timerId, timer);
-		const bool timer_inserted = timer_insert_result.second;
-		TITANIUM_ASSERT(timer_inserted);
-		TITANIUM_LOG_DEBUG("GlobalObject::setInterval: starting timer for timerId ", timerId);
-		timer->Start();
+		return std::chrono::milliseconds(1);
 	}
 
-	void GlobalObject::StopTimer(const unsigned& timerId) TITANIUM_NOEXCEPT
+	std::chrono::milliseconds GlobalObject::timerNow() const TITANIUM_NOEXCEPT
 	{
-		const auto timer_position = timer_map__.find(timerId);
-		const bool timer_found = timer_position != timer_map__.end();
-		if (timer_found) {
-			TITANIUM_LOG_DEBUG("GlobalObject::clearInterval: timerId ", timerId, " cleared");
-			auto timer_ptr = timer_position->second;
-			timer_ptr->Stop();
-			const auto number_of_elements_removed = timer_map__.erase(timerId);
-			TITANIUM_ASSERT(number_of_elements_removed == 1);
-
-			TITANIUM_ASSERT(timer_callback_map__.find(timerId) != timer_callback_map__.end());
-			timer_callback_map__.erase(timerId);
-		} else {
-			TITANIUM_LOG_WARN("GlobalObject::clearTimeout: timerId ", timerId, " is not registered");
-		}
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch());
 	}
 
 	bool GlobalObject::requiredModuleExists(const std::string& path) const TITANIUM_NOEXCEPT
@@ -483,6 +667,11 @@ namespace Titanium
 		return interval__;
 	}
 
+	void GlobalObject::Timer::set_interval(const std::chrono::milliseconds& interval) TITANIUM_NOEXCEPT
+	{
+		interval__ = interval;
+	}
+
 	class UnimplementedTimer final : public GlobalObject::Timer
 	{
 	public:
@@ -8,29 +8,27 @@
 
 #include "Titanium/Map/Constants.hpp"
 #include "Titanium/detail/TiLogger.hpp"
-#include <unordered_map>
-#include <mutex>
+#include "Titanium/detail/TiConstants.hpp"
 
 namespace Titanium
 {
 	namespace Map
 	{
+		static const detail::TiConstant<MAP_TYPE> mapTypeNames[] = {
+			{ MAP_TYPE::HYBRID,    "HYBRID_TYPE" },
+			{ MAP_TYPE::NORMAL,    "NORMAL_TYPE" },
+			{ MAP_TYPE::SATELLITE, "SATELLITE_TYPE" },
+			{ MAP_TYPE::TERRAIN,   "TERRAIN_TYPE" },
+		};
+
 		std::string Constants::to_string(const MAP_TYPE& type) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "MAP_TYPE::Unknown";
-			static std::unordered_map<MAP_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[MAP_TYPE::HYBRID] = "HYBRID_TYPE";
-				map[MAP_TYPE::SATELLITE] = "SATELLITE_TYPE";
-				map[MAP_TYPE::NORMAL] = "NORMAL_TYPE";
-				map[MAP_TYPE::TERRAIN] = "TERRAIN_TYPE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(type);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(mapTypeNames, type);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -38,19 +36,10 @@ namespace Titanium
 
 		MAP_TYPE Constants::to_MAP_TYPE(const std::string& typeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, MAP_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["HYBRID_TYPE"] = MAP_TYPE::HYBRID;
-				map["SATELLITE_TYPE"] = MAP_TYPE::SATELLITE;
-				map["NORMAL_TYPE"] = MAP_TYPE::NORMAL;
-				map["TERRAIN_TYPE"] = MAP_TYPE::TERRAIN;
-			});
-
 			MAP_TYPE type = MAP_TYPE::NORMAL;
-			const auto position = map.find(typeName);
-			if (position != map.end()) {
-				type = position->second;
+			const auto position = detail::FindConstant(mapTypeNames, typeName);
+			if (position != nullptr) {
+				type = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_MAP_TYPE: Titanium::Map::MAP_TYPE with name '", typeName, "' does not exist");
 			}
@@ -60,19 +49,10 @@ namespace Titanium
 
 		MAP_TYPE Constants::to_MAP_TYPE(std::underlying_type<MAP_TYPE>::type type_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<MAP_TYPE>::type, MAP_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<MAP_TYPE>::type>(MAP_TYPE::HYBRID)] = MAP_TYPE::HYBRID;
-				map[static_cast<std::underlying_type<MAP_TYPE>::type>(MAP_TYPE::SATELLITE)] = MAP_TYPE::SATELLITE;
-				map[static_cast<std::underlying_type<MAP_TYPE>::type>(MAP_TYPE::NORMAL)] = MAP_TYPE::NORMAL;
-				map[static_cast<std::underlying_type<MAP_TYPE>::type>(MAP_TYPE::TERRAIN)] = MAP_TYPE::TERRAIN;
-			});
-
 			MAP_TYPE type = MAP_TYPE::NORMAL;
-			const auto position = map.find(type_underlying_type);
-			if (position != map.end()) {
-				type = position->second;
+			const auto position = detail::FindConstant(mapTypeNames, type_underlying_type);
+			if (position != nullptr) {
+				type = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_MAP_TYPE: Titanium::Map::MAP_TYPE with value '", type_underlying_type, "' does not exist");
 			}
@@ -85,20 +65,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<MAP_TYPE>::type>(mapType);
 		}
 
+		static const detail::TiConstant<OVERLAY_LEVEL> overlayLevelNames[] = {
+			{ OVERLAY_LEVEL::ABOVE_LABELS, "OVERLAY_LEVEL_ABOVE_LABELS" },
+			{ OVERLAY_LEVEL::ABOVE_ROADS,  "OVERLAY_LEVEL_ABOVE_ROADS" },
+		};
+
 		std::string Constants::to_string(const OVERLAY_LEVEL& overlayLevel) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "OVERLAY_LEVEL::Unknown";
-			static std::unordered_map<OVERLAY_LEVEL, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[OVERLAY_LEVEL::ABOVE_LABELS]    = "OVERLAY_LEVEL_ABOVE_LABELS";
-				map[OVERLAY_LEVEL::ABOVE_ROADS] 	= "OVERLAY_LEVEL_ABOVE_ROADS";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(overlayLevel);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(overlayLevelNames, overlayLevel);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -106,17 +85,10 @@ namespace Titanium
 
 		OVERLAY_LEVEL Constants::to_OVERLAY_LEVEL(const std::string& overlayLevelName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, OVERLAY_LEVEL> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["OVERLAY_LEVEL_ABOVE_LABELS"] = OVERLAY_LEVEL::ABOVE_LABELS;
-				map["OVERLAY_LEVEL_ABOVE_ROADS"]  = OVERLAY_LEVEL::ABOVE_ROADS;
-			});
-
 			OVERLAY_LEVEL level = OVERLAY_LEVEL::ABOVE_LABELS;
-			const auto position = map.find(overlayLevelName);
-			if (position != map.end()) {
-				level = position->second;
+			const auto position = detail::FindConstant(overlayLevelNames, overlayLevelName);
+			if (position != nullptr) {
+				level = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_OVERLAY_LEVEL: Titanium::Map::OVERLAY_LEVEL with name '", overlayLevelName, "' does not exist");
 			}
@@ -126,17 +98,10 @@ namespace Titanium
 
 		OVERLAY_LEVEL Constants::to_OVERLAY_LEVEL(std::underlying_type<OVERLAY_LEVEL>::type level_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<OVERLAY_LEVEL>::type, OVERLAY_LEVEL> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<OVERLAY_LEVEL>::type>(OVERLAY_LEVEL::ABOVE_LABELS)] = OVERLAY_LEVEL::ABOVE_LABELS;
-				map[static_cast<std::underlying_type<OVERLAY_LEVEL>::type>(OVERLAY_LEVEL::ABOVE_ROADS)]  = OVERLAY_LEVEL::ABOVE_ROADS;
-			});
-
 			OVERLAY_LEVEL level = OVERLAY_LEVEL::ABOVE_LABELS;
-			const auto position = map.find(level_underlying_type);
-			if (position != map.end()) {
-				level = position->second;
+			const auto position = detail::FindConstant(overlayLevelNames, level_underlying_type);
+			if (position != nullptr) {
+				level = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_OVERLAY_LEVEL: Titanium::Map::OVERLAY_LEVEL with value '", level_underlying_type, "' does not exist");
 			}
@@ -149,20 +114,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<OVERLAY_LEVEL>::type>(level);
 		}
 
+		static const detail::TiConstant<ANNOTATION_DRAG_STATE> annotationDragStateNames[] = {
+			{ ANNOTATION_DRAG_STATE::END,   "ANNOTATION_DRAG_STATE_END" },
+			{ ANNOTATION_DRAG_STATE::START, "ANNOTATION_DRAG_STATE_START" },
+		};
+
 		std::string Constants::to_string(const ANNOTATION_DRAG_STATE& state) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ANNOTATION_DRAG_STATE::Unknown";
-			static std::unordered_map<ANNOTATION_DRAG_STATE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[ANNOTATION_DRAG_STATE::END]   = "ANNOTATION_DRAG_STATE_END";
-				map[ANNOTATION_DRAG_STATE::START] = "ANNOTATION_DRAG_STATE_START";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(state);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(annotationDragStateNames, state);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -170,17 +134,10 @@ namespace Titanium
 
 		ANNOTATION_DRAG_STATE Constants::to_ANNOTATION_DRAG_STATE(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ANNOTATION_DRAG_STATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["ANNOTATION_DRAG_STATE_END"]   = ANNOTATION_DRAG_STATE::END;
-				map["ANNOTATION_DRAG_STATE_START"] = ANNOTATION_DRAG_STATE::START;
-			});
-
 			ANNOTATION_DRAG_STATE state = ANNOTATION_DRAG_STATE::END;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				state = position->second;
+			const auto position = detail::FindConstant(annotationDragStateNames, name);
+			if (position != nullptr) {
+				state = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANNOTATION_DRAG_STATE: Titanium::Map::ANNOTATION_DRAG_STATE with name '", name, "' does not exist");
 			}
@@ -190,17 +147,10 @@ namespace Titanium
 
 		ANNOTATION_DRAG_STATE Constants::to_ANNOTATION_DRAG_STATE(std::underlying_type<ANNOTATION_DRAG_STATE>::type level_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ANNOTATION_DRAG_STATE>::type, ANNOTATION_DRAG_STATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<ANNOTATION_DRAG_STATE>::type>(ANNOTATION_DRAG_STATE::END)]   = ANNOTATION_DRAG_STATE::END;
-				map[static_cast<std::underlying_type<ANNOTATION_DRAG_STATE>::type>(ANNOTATION_DRAG_STATE::START)] = ANNOTATION_DRAG_STATE::START;
-			});
-
 			ANNOTATION_DRAG_STATE state = ANNOTATION_DRAG_STATE::END;
-			const auto position = map.find(level_underlying_type);
-			if (position != map.end()) {
-				state = position->second;
+			const auto position = detail::FindConstant(annotationDragStateNames, level_underlying_type);
+			if (position != nullptr) {
+				state = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANNOTATION_DRAG_STATE: Titanium::Map::ANNOTATION_DRAG_STATE with value '", level_underlying_type, "' does not exist");
 			}
@@ -213,29 +163,28 @@ namespace Titanium
 			return static_cast<std::underlying_type<ANNOTATION_DRAG_STATE>::type>(state);
 		}
 
+		static const detail::TiConstant<ANNOTATION_COLOR> annotationColorNames[] = {
+			{ ANNOTATION_COLOR::AZURE,   "ANNOTATION_AZURE" },
+			{ ANNOTATION_COLOR::BLUE,    "ANNOTATION_BLUE" },
+			{ ANNOTATION_COLOR::CYAN,    "ANNOTATION_CYAN" },
+			{ ANNOTATION_COLOR::GREEN,   "ANNOTATION_GREEN" },
+			{ ANNOTATION_COLOR::MAGENTA, "ANNOTATION_MAGENTA" },
+			{ ANNOTATION_COLOR::ORANGE,  "ANNOTATION_ORANGE" },
+			{ ANNOTATION_COLOR::PURPLE,  "ANNOTATION_PURPLE" },
+			{ ANNOTATION_COLOR::RED,     "ANNOTATION_RED" },
+			{ ANNOTATION_COLOR::ROSE,    "ANNOTATION_ROSE" },
+			{ ANNOTATION_COLOR::VIOLET,  "ANNOTATION_VIOLET" },
+			{ ANNOTATION_COLOR::YELLOW,  "ANNOTATION_YELLOW" },
+		};
+
 		std::string Constants::to_string(const ANNOTATION_COLOR& color) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ANNOTATION_COLOR::Unknown";
-			static std::unordered_map<ANNOTATION_COLOR, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[ANNOTATION_COLOR::AZURE]   = "ANNOTATION_AZURE";
-				map[ANNOTATION_COLOR::BLUE]    = "ANNOTATION_BLUE";
-				map[ANNOTATION_COLOR::CYAN]    = "ANNOTATION_CYAN";
-				map[ANNOTATION_COLOR::GREEN]   = "ANNOTATION_GREEN";
-				map[ANNOTATION_COLOR::MAGENTA] = "ANNOTATION_MAGENTA";
-				map[ANNOTATION_COLOR::ORANGE]  = "ANNOTATION_ORANGE";
-				map[ANNOTATION_COLOR::PURPLE]  = "ANNOTATION_PURPLE";
-				map[ANNOTATION_COLOR::RED]     = "ANNOTATION_RED";
-				map[ANNOTATION_COLOR::ROSE]    = "ANNOTATION_ROSE";
-				map[ANNOTATION_COLOR::VIOLET]  = "ANNOTATION_VIOLET";
-				map[ANNOTATION_COLOR::YELLOW]  = "ANNOTATION_YELLOW";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(color);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(annotationColorNames, color);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -243,26 +192,10 @@ namespace Titanium
 
 		ANNOTATION_COLOR Constants::to_ANNOTATION_COLOR(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ANNOTATION_COLOR> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["ANNOTATION_AZURE"]   = ANNOTATION_COLOR::AZURE;
-				map["ANNOTATION_BLUE"]    = ANNOTATION_COLOR::BLUE;
-				map["ANNOTATION_CYAN"]    = ANNOTATION_COLOR::CYAN;
-				map["ANNOTATION_GREEN"]   = ANNOTATION_COLOR::GREEN;
-				map["ANNOTATION_MAGENTA"] = ANNOTATION_COLOR::MAGENTA;
-				map["ANNOTATION_ORANGE"]  = ANNOTATION_COLOR::ORANGE;
-				map["ANNOTATION_PURPLE"]  = ANNOTATION_COLOR::PURPLE;
-				map["ANNOTATION_RED"]     = ANNOTATION_COLOR::RED;
-				map["ANNOTATION_ROSE"]    = ANNOTATION_COLOR::ROSE;
-				map["ANNOTATION_VIOLET"]  = ANNOTATION_COLOR::VIOLET;
-				map["ANNOTATION_YELLOW"]  = ANNOTATION_COLOR::YELLOW;
-			});
-
 			ANNOTATION_COLOR color = ANNOTATION_COLOR::AZURE;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				color = position->second;
+			const auto position = detail::FindConstant(annotationColorNames, name);
+			if (position != nullptr) {
+				color = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANNOTATION_COLOR: Titanium::Map::ANNOTATION_COLOR with name '", name, "' does not exist");
 			}
@@ -272,26 +205,10 @@ namespace Titanium
 
 		ANNOTATION_COLOR Constants::to_ANNOTATION_COLOR(std::underlying_type<ANNOTATION_COLOR>::type color_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ANNOTATION_COLOR>::type, ANNOTATION_COLOR> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::AZURE)]   = ANNOTATION_COLOR::AZURE;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::BLUE)]    = ANNOTATION_COLOR::BLUE;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::CYAN)]    = ANNOTATION_COLOR::CYAN;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::GREEN)]   = ANNOTATION_COLOR::GREEN;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::MAGENTA)] = ANNOTATION_COLOR::MAGENTA;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::ORANGE)]  = ANNOTATION_COLOR::ORANGE;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::PURPLE)]  = ANNOTATION_COLOR::PURPLE;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::RED)]     = ANNOTATION_COLOR::RED;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::ROSE)]    = ANNOTATION_COLOR::ROSE;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::VIOLET)]  = ANNOTATION_COLOR::VIOLET;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(ANNOTATION_COLOR::YELLOW)]  = ANNOTATION_COLOR::YELLOW;
-			});
-
 			ANNOTATION_COLOR color = ANNOTATION_COLOR::AZURE;
-			const auto position = map.find(color_underlying_type);
-			if (position != map.end()) {
-				color = position->second;
+			const auto position = detail::FindConstant(annotationColorNames, color_underlying_type);
+			if (position != nullptr) {
+				color = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANNOTATION_COLOR: Titanium::Map::ANNOTATION_COLOR with value '", color_underlying_type, "' does not exist");
 			}
@@ -304,23 +221,22 @@ namespace Titanium
 			return static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(color);
 		}
 
+		static const detail::TiConstant<GOOGLE_PLAY_SERVICE_STATE> googlePlayServiceStateNames[] = {
+			{ GOOGLE_PLAY_SERVICE_STATE::DISABLED,                "SERVICE_DISABLED" },
+			{ GOOGLE_PLAY_SERVICE_STATE::INVALID,                 "SERVICE_INVALID" },
+			{ GOOGLE_PLAY_SERVICE_STATE::MISSING,                 "SERVICE_MISSING" },
+			{ GOOGLE_PLAY_SERVICE_STATE::VERSION_UPDATE_REQUIRED, "SERVICE_VERSION_UPDATE_REQUIRED" },
+			{ GOOGLE_PLAY_SERVICE_STATE::SUCCESS,                 "SUCCESS" },
+		};
+
 		std::string Constants::to_string(const GOOGLE_PLAY_SERVICE_STATE& state) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "GOOGLE_PLAY_SERVICE_STATE::Unknown";
-			static std::unordered_map<GOOGLE_PLAY_SERVICE_STATE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[GOOGLE_PLAY_SERVICE_STATE::DISABLED] 				= "SERVICE_DISABLED";
-				map[GOOGLE_PLAY_SERVICE_STATE::INVALID] 				= "SERVICE_INVALID";
-				map[GOOGLE_PLAY_SERVICE_STATE::MISSING] 				= "SERVICE_MISSING";
-				map[GOOGLE_PLAY_SERVICE_STATE::VERSION_UPDATE_REQUIRED] = "SERVICE_VERSION_UPDATE_REQUIRED";
-				map[GOOGLE_PLAY_SERVICE_STATE::SUCCESS] 				= "SUCCESS";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(state);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(googlePlayServiceStateNames, state);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -328,20 +244,10 @@ namespace Titanium
 
 		GOOGLE_PLAY_SERVICE_STATE Constants::to_GOOGLE_PLAY_SERVICE_STATE(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, GOOGLE_PLAY_SERVICE_STATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["SERVICE_DISABLED"] 				= GOOGLE_PLAY_SERVICE_STATE::DISABLED;
-				map["SERVICE_INVALID"] 					= GOOGLE_PLAY_SERVICE_STATE::INVALID;
-				map["SERVICE_MISSING"] 					= GOOGLE_PLAY_SERVICE_STATE::MISSING;
-				map["SERVICE_VERSION_UPDATE_REQUIRED"] 	= GOOGLE_PLAY_SERVICE_STATE::VERSION_UPDATE_REQUIRED;
-				map["SUCCESS"] 							= GOOGLE_PLAY_SERVICE_STATE::SUCCESS;
-			});
-
 			GOOGLE_PLAY_SERVICE_STATE state = GOOGLE_PLAY_SERVICE_STATE::MISSING;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				state = position->second;
+			const auto position = detail::FindConstant(googlePlayServiceStateNames, name);
+			if (position != nullptr) {
+				state = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_GOOGLE_PLAY_SERVICE_STATE: Titanium::Map::GOOGLE_PLAY_SERVICE_STATE with name '", name, "' does not exist");
 			}
@@ -351,20 +257,10 @@ namespace Titanium
 
 		GOOGLE_PLAY_SERVICE_STATE Constants::to_GOOGLE_PLAY_SERVICE_STATE(std::underlying_type<GOOGLE_PLAY_SERVICE_STATE>::type state_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<GOOGLE_PLAY_SERVICE_STATE>::type, GOOGLE_PLAY_SERVICE_STATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(GOOGLE_PLAY_SERVICE_STATE::DISABLED)] 				= GOOGLE_PLAY_SERVICE_STATE::DISABLED;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(GOOGLE_PLAY_SERVICE_STATE::INVALID)] 					= GOOGLE_PLAY_SERVICE_STATE::INVALID;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(GOOGLE_PLAY_SERVICE_STATE::MISSING)] 					= GOOGLE_PLAY_SERVICE_STATE::MISSING;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(GOOGLE_PLAY_SERVICE_STATE::VERSION_UPDATE_REQUIRED)]  = GOOGLE_PLAY_SERVICE_STATE::VERSION_UPDATE_REQUIRED;
-				map[static_cast<std::underlying_type<ANNOTATION_COLOR>::type>(GOOGLE_PLAY_SERVICE_STATE::SUCCESS)] 					= GOOGLE_PLAY_SERVICE_STATE::SUCCESS;
-			});
-
 			GOOGLE_PLAY_SERVICE_STATE state = GOOGLE_PLAY_SERVICE_STATE::MISSING;
-			const auto position = map.find(state_underlying_type);
-			if (position != map.end()) {
-				state = position->second;
+			const auto position = detail::FindConstant(googlePlayServiceStateNames, state_underlying_type);
+			if (position != nullptr) {
+				state = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_GOOGLE_PLAY_SERVICE_STATE: Titanium::Map::GOOGLE_PLAY_SERVICE_STATE with value '", state_underlying_type, "' does not exist");
 			}
@@ -7,8 +7,12 @@
  */
 
 #include "Titanium/Module.hpp"
+#include "Titanium/GlobalObject.hpp"
 #include "Titanium/detail/TiImpl.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <mutex>
+#include <sstream>
 #include "Titanium/UI/Window.hpp"
 #include "Titanium/UI/TabGroup.hpp"
 
@@ -37,6 +41,44 @@ namespace Titanium
 	TITANIUM_PROPERTY_READWRITE(Module, bool, bubbleParent)
 	TITANIUM_PROPERTY_READWRITE(Module, std::string, apiName)
 
+	struct Module::EventCoalescing
+	{
+		EventCoalescingPolicy policy;
+		// At most one event unless batching
+		std::vector<JSObject> pending;
+		std::uint32_t dropped { 0 };
+		std::chrono::steady_clock::time_point last_delivery;
+		// Cleared once the listener is removed
+		bool attached { true };
+		std::weak_ptr<GlobalObject> global_object;
+		unsigned timer_id { 0 };
+		bool timer_running { false };
+
+		void StopTimer()
+		{
+			if (!timer_running) {
+				return;
+			}
+			timer_running = false;
+			const auto global = global_object.lock();
+			if (global) {
+				global->clearTimeout(timer_id);
+			}
+		}
+
+		void Detach()
+		{
+			attached = false;
+			pending.clear();
+			StopTimer();
+		}
+
+		~EventCoalescing()
+		{
+			StopTimer();
+		}
+	};
+
 	void Module::addEventListener(const std::string& name, JSObject& callback, JSObject& this_object) TITANIUM_NOEXCEPT
 	{
 		if (!callback.IsFunction()) {
@@ -44,30 +86,27 @@ namespace Titanium
 			return;
 		}
 
-		std::vector<JSObject> event_listener_list;
-		if (event_listener_map__.find(name) != event_listener_map__.end()) {
-			event_listener_list = event_listener_map__.at(name);
-		}
-
-		JSObject callback_payload = get_context().CreateObject();
-		callback_payload.SetProperty("callback", callback);
-		callback_payload.SetProperty("this_object", this_object);
+		const auto index = ensureEventListeners(name);
+		auto& entry = event_listeners__.at(index);
 
 		// Precondition
-		const auto event_listener_index = eventListenerIndex(event_listener_list, name, callback_payload);
-		if (event_listener_index > 0) {
-			TITANIUM_LOG_WARN(apiName__, " addEventListener: event listener already added at index ", event_listener_index, " for event '", name, "'");
-		} else {
-			const auto callback_list_index = event_listener_list.size();
-			if (callback_list_index == 0) {
-				// This is the first event listener for this event name, so signal
-				// module subclasses that callbacks have been registered for this event.
-				enableEvent(name);
+		for (std::size_t i = 0; i < entry.listeners.size(); ++i) {
+			if (!entry.listeners[i].removed && callback == static_cast<JSValue>(entry.listeners[i].callback)) {
+				TITANIUM_LOG_WARN(apiName__, " addEventListener: event listener already added at index ", i, " for event '", name, "'");
+				return;
 			}
-			TITANIUM_LOG_DEBUG(apiName__, " addEventListener: add listener at index ", callback_list_index, " for event '", name, "' for ", this);
-			event_listener_list.push_back(callback_payload);
 		}
-		event_listener_map__[name] = event_listener_list;
+
+		TITANIUM_LOG_DEBUG(apiName__, " addEventListener: add listener at index ", entry.listeners.size(), " for event '", name, "' for ", this);
+		entry.listeners.push_back({ callback, this_object, false, nullptr });
+		entry.count++;
+
+		if (entry.count == 1) {
+			event_listener_mask__ |= std::uint64_t(1) << (entry.id % 64);
+			// This is the first event listener for this event name, so signal
+			// module subclasses that callbacks have been registered for this event.
+			enableEvent(name);
+		}
 	}
 
 	void Module::removeEventListener(const std::string& name, JSObject& callback, JSObject& this_object) TITANIUM_NOEXCEPT
@@ -77,44 +116,52 @@ namespace Titanium
 			return;
 		}
 
-		if (event_listener_map__.find(name) == event_listener_map__.end()) {
+		const auto index = findEventListeners(name);
+		if (index == event_listeners__.size() || event_listeners__.at(index).count == 0) {
 			TITANIUM_LOG_WARN(apiName__, " removeEventListener: No event listener's for event '", name, "'");
 			return;
 		}
+		auto& entry = event_listeners__.at(index);
 
-		std::vector<JSObject> event_listener_list = event_listener_map__.at(name);
-
-		JSObject callback_payload = get_context().CreateObject();
-		callback_payload.SetProperty("callback", callback);
-		callback_payload.SetProperty("this_object", this_object);
-
-		const auto event_listener_count = event_listener_list.size();
-		if (event_listener_count > 0) {
-			const auto event_listener_index = eventListenerIndex(event_listener_list, name, callback_payload);
-
-			if (event_listener_count == 1) {
-				// This is the last event listener for this event name, and it is about
-				// to be removed, so signal module subclasses that there are no more
-				// callbacks registered for this event.
-				disableEvent(name);
+		auto listener = entry.listeners.begin();
+		for (; listener != entry.listeners.end(); ++listener) {
+			if (!listener->removed && callback == static_cast<JSValue>(listener->callback)) {
+				break;
 			}
+		}
+		if (listener == entry.listeners.end()) {
+			TITANIUM_LOG_WARN(apiName__, " removeEventListener: listener does not exist for event '", name, "'");
+			return;
+		}
 
-			TITANIUM_LOG_DEBUG(apiName__, " removeEventListener: remove listener at index ", event_listener_index, " for event '", name, "' for ", this);
+		TITANIUM_LOG_DEBUG(apiName__, " removeEventListener: remove listener at index ", listener - entry.listeners.begin(), " for event '", name, "' for ", this);
+
+		// Whatever is still waiting for it has nobody to go to
+		if (listener->coalescing) {
+			listener->coalescing->Detach();
+			listener->coalescing = nullptr;
+			entry.coalesced--;
+		}
 
-			// postcondition
-			event_listener_list.erase(event_listener_list.begin() +  event_listener_index);
-			//if (!deleted) {
-				// This is a TitaniumKit logic error.
-				//TITANIUM_LOG_ERROR(apiName__, " removeEventListener: event listener at index ", event_listener_index, " for event '", name, "' was not removed");
-				//TITANIUM_ASSERT(deleted);
-			//}
+		// fireEvent walks the list by index, so only mark the listener while
+		// it runs and let it compact the list when done.
+		if (entry.dispatching > 0) {
+			listener->removed = true;
 		} else {
-			TITANIUM_LOG_WARN(apiName__, " removeEventListener: listener does not exist for event '", name, "'");
+			entry.listeners.erase(listener);
+		}
+		entry.count--;
+
+		if (entry.count == 0) {
+			updateEventListenerMask();
+			// This was the last event listener for this event name, so signal
+			// module subclasses that there are no more callbacks registered for
+			// this event.
+			disableEvent(name);
 		}
-		event_listener_map__[name] = event_listener_list;
 	}
 
-	void Module::applyProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT
+	static void setEachProperty(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT
 	{
 		const auto propertyNames = props.GetPropertyNames();
 		const auto length = propertyNames.GetCount();
@@ -122,12 +169,24 @@ namespace Titanium
 			const auto property_name = propertyNames.GetNameAtIndex(i);
 			this_object.SetProperty(property_name, props.GetProperty(property_name));
 		}
+	}
 
+	void Module::applyProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT
+	{
 		const auto module = this_object.GetPrivate<Titanium::Module>();
-		if (module) {
-			module->propertiesSet__ = true;
-			module->afterPropertiesSet();
+		if (!module) {
+			setEachProperty(props, this_object);
+			return;
 		}
+
+		module->setProperties(props, this_object);
+		module->propertiesSet__ = true;
+		module->afterPropertiesSet();
+	}
+
+	void Module::setProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT
+	{
+		setEachProperty(props, this_object);
 	}
 
 	void Module::afterPropertiesSet() TITANIUM_NOEXCEPT
@@ -148,32 +207,126 @@ namespace Titanium
 		}
 	}
 
+	Module::EventId Module::InternEvent(const std::string& name) TITANIUM_NOEXCEPT
+	{
+		static std::mutex mutex;
+		static std::unordered_map<std::string, EventId> ids;
+		std::lock_guard<std::mutex> lock(mutex);
+		const auto id = ids.find(name);
+		if (id != ids.end()) {
+			return id->second;
+		}
+		const auto next = static_cast<EventId>(ids.size());
+		ids.emplace(name, next);
+		return next;
+	}
+
+	std::size_t Module::findEventListeners(const std::string& name) const TITANIUM_NOEXCEPT
+	{
+		// Modules listen to a handful of events, a scan beats hashing the name
+		for (std::size_t i = 0; i < event_listeners__.size(); ++i) {
+			if (event_listeners__[i].name == name) {
+				return i;
+			}
+		}
+		return event_listeners__.size();
+	}
+
+	std::size_t Module::ensureEventListeners(const std::string& name) TITANIUM_NOEXCEPT
+	{
+		const auto index = findEventListeners(name);
+		if (index == event_listeners__.size()) {
+			event_listeners__.push_back({ InternEvent(name), name, get_context().CreateString(name), {}, 0, 0, 0 });
+		}
+		return index;
+	}
+
+	std::size_t Module::findEventListeners(const EventId& id) const TITANIUM_NOEXCEPT
+	{
+		for (std::size_t i = 0; i < event_listeners__.size(); ++i) {
+			if (event_listeners__[i].id == id) {
+				return i;
+			}
+		}
+		return event_listeners__.size();
+	}
+
+	void Module::updateEventListenerMask() TITANIUM_NOEXCEPT
+	{
+		event_listener_mask__ = 0;
+		for (const auto& entry : event_listeners__) {
+			if (entry.count > 0) {
+				event_listener_mask__ |= std::uint64_t(1) << (entry.id % 64);
+			}
+		}
+	}
+
 	bool Module::hasEventListener(const std::string& event_name) TITANIUM_NOEXCEPT
 	{
-		return event_listener_map__.find(event_name) != event_listener_map__.end() && event_listener_map__.at(event_name).size() > 0;
+		const auto index = findEventListeners(event_name);
+		return index < event_listeners__.size() && event_listeners__[index].count > 0;
+	}
+
+	bool Module::hasEventListener(const EventId& id) const TITANIUM_NOEXCEPT
+	{
+		if ((event_listener_mask__ & (std::uint64_t(1) << (id % 64))) == 0) {
+			return false;
+		}
+		const auto index = findEventListeners(id);
+		return index < event_listeners__.size() && event_listeners__[index].count > 0;
 	}
 
 	void Module::fireEvent(const std::string& name) TITANIUM_NOEXCEPT
 	{
-		fireEvent(name, get_context().CreateObject());
+		const auto index = findEventListeners(name);
+		if (index < event_listeners__.size() && event_listeners__[index].count > 0) {
+			fireEvent(event_listeners__[index].id, get_context().CreateObject());
+		}
 	}
 
 	void Module::fireEvent(const std::string& name, const JSObject& event) TITANIUM_NOEXCEPT
 	{
-		if (!enableEvents__) {
-			TITANIUM_LOG_WARN(apiName__, " fireEvent: Stopped firing '", name, "'");
+		const auto index = findEventListeners(name);
+		if (index < event_listeners__.size()) {
+			fireEvent(event_listeners__[index].id, event);
+		}
+	}
+
+	void Module::fireEvent(const EventId& id, const JSObject& event) TITANIUM_NOEXCEPT
+	{
+		if ((event_listener_mask__ & (std::uint64_t(1) << (id % 64))) == 0) {
 			return;
 		}
-		if (event_listener_map__.find(name) == event_listener_map__.end()) {
-			TITANIUM_LOG_WARN(apiName__, " fireEvent: No event named '", name, "' has been added");
+		const auto index = findEventListeners(id);
+		if (index >= event_listeners__.size()) {
+			return;
+		}
+		if (event_listeners__[index].coalesced == 0) {
+			dispatchEvent(index, event, nullptr);
 			return;
 		}
 
-		std::vector<JSObject> event_listener_list = event_listener_map__.at(name);
-		const auto event_listener_count = event_listener_list.size();
+		// The listeners that coalesce share the event object and set its
+		// dropped property when they deliver it, so read it only once.
+		const auto own_dropped = event.GetProperty("dropped");
+		const auto dropped = own_dropped.IsNumber() ? static_cast<std::uint32_t>(own_dropped) : 0;
+		const auto coalesced = getEventCoalescing(index);
+		if (event_listeners__[index].count > coalesced.size()) {
+			dispatchEvent(index, event, nullptr);
+		}
+		for (const auto& coalescing : coalesced) {
+			coalesceEvent(index, coalescing, event, dropped);
+		}
+	}
 
-		if (event_listener_count == 0) {
-			TITANIUM_LOG_WARN(apiName__, " fireEvent: No listeners for event '", name, "'");
+	void Module::dispatchEvent(const std::size_t& index, const JSObject& event, const EventCoalescing* coalescing) TITANIUM_NOEXCEPT
+	{
+		// Nobody listening is the common case for most events, not worth a log line
+		if (event_listeners__[index].count == 0) {
+			return;
+		}
+		if (!enableEvents__) {
+			TITANIUM_LOG_WARN(apiName__, " fireEvent: Stopped firing '", event_listeners__[index].name, "'");
 			return;
 		}
 
@@ -181,72 +334,271 @@ namespace Titanium
 		if (!event_copy.HasProperty("source")) {
 			event_copy.SetProperty("source", get_object());
 		}
-		event_copy.SetProperty("type", event.get_context().CreateString(name));
+		event_copy.SetProperty("type", event_listeners__[index].type);
 
-		TITANIUM_EXCEPTION_CATCH_START {
-			for (size_t i = 0; i < event_listener_count; ++i) {
-				JSObject callback_payload = event_listener_list.at(i);
+		// Listeners may add or remove listeners, or listen to new events, while
+		// we call them. Entries are never erased and removed listeners are only
+		// marked, so walk by index and take copies before each call. Listeners
+		// added during this dispatch are not called until the next one.
+		const auto event_listener_count = event_listeners__[index].listeners.size();
+		event_listeners__[index].dispatching++;
 
-				JSValue callback_property = callback_payload.GetProperty("callback");
+		// Nested dispatches get their own arguments
+		std::vector<JSValue> nested_arguments;
+		auto& arguments = event_dispatch_depth__ == 0 ? event_arguments__ : nested_arguments;
+		event_dispatch_depth__++;
 
-				// Precondition
-				TITANIUM_ASSERT(callback_property.IsObject());
-				JSObject callback = static_cast<JSObject>(callback_property);
-
-				// Precondition
-				TITANIUM_ASSERT(callback.IsFunction());
-
-				JSValue this_object_property = callback_payload.GetProperty("this_object");
-
-				// Precondition
-				TITANIUM_ASSERT(this_object_property.IsObject());
-				JSObject this_object = static_cast<JSObject>(this_object_property);
+		TITANIUM_EXCEPTION_CATCH_START {
+			for (std::size_t i = 0; i < event_listener_count; ++i) {
+				const auto& listener = event_listeners__[index].listeners[i];
+				if (listener.removed || listener.coalescing.get() != coalescing) {
+					continue;
+				}
+				auto callback = listener.callback;
+				auto this_object = listener.this_object;
 
-				TITANIUM_LOG_DEBUG(apiName__, " fireEvent: name = '", name, "' for listener at index ", i, " for ", this);
+				TITANIUM_LOG_TRACE(apiName__, " fireEvent: name = '", event_listeners__[index].name, "' for listener at index ", i, " for ", this);
 
 				//
 				// Note: Currently there's no way to access "arguments.callee" inside HAL JSExport callback.
 				// We cheat here, by adding callback as an argument
 				//
-				callback({ static_cast<JSValue>(event_copy), callback }, this_object);
+				arguments.clear();
+				arguments.push_back(event_copy);
+				arguments.push_back(callback);
+				callback(arguments, this_object);
 			}
 		} TITANIUM_EXCEPTION_CATCH_END
+
+		// Don't keep the event alive until the next dispatch
+		arguments.clear();
+		event_dispatch_depth__--;
+
+		auto& entry = event_listeners__[index];
+		if (--entry.dispatching == 0 && entry.listeners.size() != entry.count) {
+			entry.listeners.erase(std::remove_if(entry.listeners.begin(), entry.listeners.end(), [](const EventListener& listener) {
+				return listener.removed;
+			}), entry.listeners.end());
+		}
 	}
 
-	void Module::enableEvent(const std::string& event_name) TITANIUM_NOEXCEPT
+	bool Module::ParseEventCoalescing(const std::string& value, EventCoalescingPolicy& policy) TITANIUM_NOEXCEPT
 	{
-		TITANIUM_LOG_WARN(apiName__, " enableEvent: Unimplemented (event name '", event_name, "' for ", this);
+		policy = { EventCoalescingMode::None, std::chrono::milliseconds(0), 0 };
+		if (value == "none") {
+			return true;
+		}
+		if (value == "latest-only" || value == "latest") {
+			policy.mode = EventCoalescingMode::LatestOnly;
+			return true;
+		}
+
+		// throttle(ms), batch(n) and batch(n, ms)
+		const auto open = value.find('(');
+		if (open == std::string::npos || value.back() != ')') {
+			return false;
+		}
+		const auto mode = value.substr(0, open);
+		std::istringstream arguments(value.substr(open + 1, value.size() - open - 2));
+		long first = 0;
+		if (!(arguments >> first) || first <= 0) {
+			return false;
+		}
+		if (mode == "throttle") {
+			policy.mode = EventCoalescingMode::Throttle;
+			policy.interval = std::chrono::milliseconds(first);
+		} else if (mode == "batch") {
+			policy.mode = EventCoalescingMode::Batch;
+			policy.batch_size = static_cast<std::size_t>(first);
+			// A partial batch waits at most this long
+			policy.interval = std::chrono::milliseconds(100);
+			char comma = 0;
+			long interval = 0;
+			if (arguments >> comma) {
+				if (comma != ',' || !(arguments >> interval) || interval <= 0) {
+					return false;
+				}
+				policy.interval = std::chrono::milliseconds(interval);
+			}
+		} else {
+			return false;
+		}
+		return arguments.eof() || (arguments >> std::ws).eof();
 	}
 
-	void Module::disableEvent(const std::string& event_name) TITANIUM_NOEXCEPT
+	void Module::setEventCoalescing(const std::string& name, const JSObject& callback, const EventCoalescingPolicy& policy) TITANIUM_NOEXCEPT
 	{
-		TITANIUM_LOG_WARN(apiName__, " disableEvent: Unimplemented (event name '", event_name, "' for ", this);
+		const auto index = findEventListeners(name);
+		if (index == event_listeners__.size()) {
+			TITANIUM_LOG_WARN(apiName__, " setEventCoalescing: No event listener's for event '", name, "'");
+			return;
+		}
+
+		const auto find_listener = [this, index, &callback]() {
+			auto& listeners = event_listeners__.at(index).listeners;
+			return std::find_if(listeners.begin(), listeners.end(), [&callback](const EventListener& listener) {
+				return !listener.removed && callback == static_cast<JSValue>(listener.callback);
+			});
+		};
+		auto listener = find_listener();
+		if (listener == event_listeners__.at(index).listeners.end()) {
+			TITANIUM_LOG_WARN(apiName__, " setEventCoalescing: listener does not exist for event '", name, "'");
+			return;
+		}
+
+		if (policy.mode == EventCoalescingMode::None) {
+			const auto coalescing = listener->coalescing;
+			if (!coalescing) {
+				return;
+			}
+			// Deliver what is waiting, the listener may change while it runs
+			flushCoalescedEvent(index, coalescing);
+			listener = find_listener();
+			if (listener != event_listeners__.at(index).listeners.end() && listener->coalescing == coalescing) {
+				coalescing->Detach();
+				listener->coalescing = nullptr;
+				event_listeners__.at(index).coalesced--;
+			}
+			return;
+		}
+
+		if (!listener->coalescing) {
+			listener->coalescing = std::make_shared<EventCoalescing>();
+			event_listeners__.at(index).coalesced++;
+		}
+		listener->coalescing->policy = policy;
+		TITANIUM_LOG_DEBUG(apiName__, " setEventCoalescing: event '", name, "' mode ", static_cast<int>(policy.mode), " for ", this);
 	}
 
-	unsigned Module::eventListenerIndex(const std::vector<JSObject>& event_listener_list, const std::string& name, JSObject& callback) TITANIUM_NOEXCEPT
+	std::vector<std::shared_ptr<Module::EventCoalescing>> Module::getEventCoalescing(const std::size_t& index) const TITANIUM_NOEXCEPT
 	{
-		unsigned index = 0;
-		bool found = false;
-		const auto event_listener_count = event_listener_list.size();
-		for (unsigned i = 0; i < event_listener_count; ++i) {
-			JSObject callback_payload = event_listener_list.at(i);
+		// Copied because listeners may come and go while each is delivered to
+		std::vector<std::shared_ptr<EventCoalescing>> coalesced;
+		coalesced.reserve(event_listeners__[index].coalesced);
+		for (const auto& listener : event_listeners__[index].listeners) {
+			if (!listener.removed && listener.coalescing) {
+				coalesced.push_back(listener.coalescing);
+			}
+		}
+		return coalesced;
+	}
 
-			JSValue callback_property = callback_payload.GetProperty("callback");
-			if (callback == callback_property) {
-				// precondition
-				if (found) {
-					// This is a TitaniumKit logic error.
-					TITANIUM_LOG_ERROR("Module::eventListenerIndex: multiple identical listeners found for event = '", name, "'");
+	void Module::coalesceEvent(const std::size_t& index, const std::shared_ptr<EventCoalescing>& coalescing, const JSObject& event, const std::uint32_t& dropped) TITANIUM_NOEXCEPT
+	{
+		if (!coalescing->attached) {
+			return;
+		}
+		const auto& policy = coalescing->policy;
+		auto delay = policy.interval;
+
+		if (policy.mode == EventCoalescingMode::Batch) {
+			coalescing->pending.push_back(event);
+			coalescing->dropped += dropped;
+			if (coalescing->pending.size() >= policy.batch_size) {
+				flushCoalescedEvent(index, coalescing);
+				return;
+			}
+		} else {
+			if (policy.mode == EventCoalescingMode::Throttle) {
+				const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - coalescing->last_delivery);
+				// A throttled event that is due goes out right away, one
+				// that is not waits out the rest of the interval.
+				if (coalescing->pending.empty() && elapsed >= policy.interval) {
+					coalescing->pending.push_back(event);
+					coalescing->dropped += dropped;
+					flushCoalescedEvent(index, coalescing);
+					return;
 				}
+				delay = elapsed < policy.interval ? policy.interval - elapsed : std::chrono::milliseconds(0);
+			} else {
+				// Latest-only waits for the next tick
+				delay = std::chrono::milliseconds(0);
+			}
 
-				index = i;
-				found = true;
-				break;
+			// Overwrite what is waiting instead of queueing behind it
+			if (!coalescing->pending.empty()) {
+				coalescing->dropped++;
+				coalescing->pending.clear();
 			}
+			coalescing->pending.push_back(event);
+			coalescing->dropped += dropped;
 		}
 
-		TITANIUM_LOG_DEBUG("Module::eventListenerIndex: index = ", index, " for event '", name, "'");
-		return index;
+		if (coalescing->timer_running) {
+			return;
+		}
+		const auto global_object = get_context().get_global_object().GetPrivate<GlobalObject>();
+		if (!global_object) {
+			// No way to come back later, deliver what we have
+			flushCoalescedEvent(index, coalescing);
+			return;
+		}
+
+		// The listener owns coalescing, which outlives neither it nor this
+		// Module, and cancels the timer when it goes.
+		const auto id = event_listeners__[index].id;
+		const std::weak_ptr<EventCoalescing> weak = coalescing;
+		coalescing->global_object = global_object;
+		coalescing->timer_running = true;
+		coalescing->timer_id = global_object->setNativeTimeout([this, id, weak]() {
+			const auto coalescing = weak.lock();
+			if (!coalescing) {
+				return;
+			}
+			coalescing->timer_running = false;
+			const auto index = findEventListeners(id);
+			if (index < event_listeners__.size()) {
+				flushCoalescedEvent(index, coalescing);
+			}
+		}, delay);
+	}
+
+	void Module::flushCoalescedEvent(const std::size_t& index, const std::shared_ptr<EventCoalescing>& coalescing) TITANIUM_NOEXCEPT
+	{
+		coalescing->StopTimer();
+		if (coalescing->pending.empty() || !coalescing->attached) {
+			return;
+		}
+
+		// Keep them alive, a listener may remove itself
+		const auto keep = coalescing;
+		auto pending = std::move(coalescing->pending);
+		coalescing->pending.clear();
+		auto event = pending.back();
+
+		const auto dropped = coalescing->dropped;
+		coalescing->dropped = 0;
+		coalescing->last_delivery = std::chrono::steady_clock::now();
+
+		const auto ctx = get_context();
+		event.SetProperty("dropped", ctx.CreateNumber(dropped));
+		event.SetProperty("merged", ctx.CreateNumber(static_cast<double>(pending.size())));
+		if (coalescing->policy.mode == EventCoalescingMode::Batch) {
+			event.SetProperty("events", ctx.CreateArray(std::vector<JSValue>(pending.begin(), pending.end())));
+		}
+
+		dispatchEvent(index, event, keep.get());
+	}
+
+	void Module::flushEvents() TITANIUM_NOEXCEPT
+	{
+		for (std::size_t i = 0; i < event_listeners__.size(); ++i) {
+			if (event_listeners__[i].coalesced > 0) {
+				for (const auto& coalescing : getEventCoalescing(i)) {
+					flushCoalescedEvent(i, coalescing);
+				}
+			}
+		}
+	}
+
+	void Module::enableEvent(const std::string& event_name) TITANIUM_NOEXCEPT
+	{
+		TITANIUM_LOG_WARN(apiName__, " enableEvent: Unimplemented (event name '", event_name, "' for ", this);
+	}
+
+	void Module::disableEvent(const std::string& event_name) TITANIUM_NOEXCEPT
+	{
+		TITANIUM_LOG_WARN(apiName__, " disableEvent: Unimplemented (event name '", event_name, "' for ", this);
 	}
 
 	void Module::JSExportInitialize()
@@ -303,6 +655,20 @@ namespace Titanium
 
 		TITANIUM_ASSERT(callback.IsFunction());
 		addEventListener(name, callback, this_object);
+
+		// addEventListener(name, callback, { coalesce: 'throttle(100)' })
+		if (arguments.size() > 2 && arguments.at(2).IsObject()) {
+			const auto options = static_cast<JSObject>(arguments.at(2));
+			const auto coalesce = options.GetProperty("coalesce");
+			if (coalesce.IsString()) {
+				EventCoalescingPolicy policy;
+				if (ParseEventCoalescing(static_cast<std::string>(coalesce), policy)) {
+					setEventCoalescing(name, callback, policy);
+				} else {
+					TITANIUM_LOG_WARN(apiName__, " addEventListener: unknown coalesce option '", static_cast<std::string>(coalesce), "' for event '", name, "'");
+				}
+			}
+		}
 		return get_context().CreateUndefined();
 	}
 
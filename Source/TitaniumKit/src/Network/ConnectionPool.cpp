@@ -0,0 +1,84 @@
+/**
+ * TitaniumKit ConnectionPool
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/Network/ConnectionPool.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <tuple>
+
+namespace Titanium
+{
+	namespace Network
+	{
+		using namespace HAL;
+
+		bool operator<(const ConnectionKey& lhs, const ConnectionKey& rhs)
+		{
+			return std::tie(lhs.scheme, lhs.host, lhs.port) < std::tie(rhs.scheme, rhs.host, rhs.port);
+		}
+
+		static std::string to_lower(std::string value)
+		{
+			for (auto& c : value) {
+				c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+			}
+			return value;
+		}
+
+		ConnectionKey ConnectionKey_from_url(const std::string& url)
+		{
+			ConnectionKey key;
+
+			auto start = url.find("://");
+			if (start == std::string::npos) {
+				key.scheme = "http";
+				start = 0;
+			} else {
+				key.scheme = to_lower(url.substr(0, start));
+				start += 3;
+			}
+
+			const auto end = url.find_first_of("/?#", start);
+			auto authority = url.substr(start, end == std::string::npos ? std::string::npos : end - start);
+
+			// drop any user:password@ prefix
+			const auto at = authority.rfind('@');
+			if (at != std::string::npos) {
+				authority = authority.substr(at + 1);
+			}
+
+			// the port separator is the last colon outside of an IPv6 literal
+			const auto bracket = authority.rfind(']');
+			const auto colon = authority.rfind(':');
+			if (colon != std::string::npos && (bracket == std::string::npos || colon > bracket)) {
+				key.host = to_lower(authority.substr(0, colon));
+				key.port = static_cast<std::uint16_t>(std::atoi(authority.c_str() + colon + 1));
+			} else {
+				key.host = to_lower(authority);
+			}
+
+			if (key.port == 0) {
+				key.port = key.scheme == "https" ? 443 : 80;
+			}
+
+			return key;
+		}
+
+		JSObject ConnectionPoolStats_to_js(const JSContext& js_context, const ConnectionPoolStats& stats)
+		{
+			auto object = js_context.CreateObject();
+			object.SetProperty("open", js_context.CreateNumber(static_cast<double>(stats.open)));
+			object.SetProperty("idle", js_context.CreateNumber(static_cast<double>(stats.idle)));
+			object.SetProperty("created", js_context.CreateNumber(static_cast<double>(stats.created)));
+			object.SetProperty("reused", js_context.CreateNumber(static_cast<double>(stats.reused)));
+			object.SetProperty("evicted", js_context.CreateNumber(static_cast<double>(stats.evicted)));
+			object.SetProperty("coalesced", js_context.CreateNumber(static_cast<double>(stats.coalesced)));
+			return object;
+		}
+	} // namespace Network
+} // namespace Titanium
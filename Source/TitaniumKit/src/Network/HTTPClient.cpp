@@ -6,12 +6,18 @@
 
 #include "Titanium/Network/HTTPClient.hpp"
 #include "Titanium/Blob.hpp"
+#include "Titanium/FilesystemModule.hpp"
+#include "Titanium/Filesystem/File.hpp"
 #include "Titanium/detail/TiImpl.hpp"
+#include <algorithm>
 
 namespace Titanium
 {
 	namespace Network
 	{
+		const std::size_t HTTPClient::MinReadSize = 64 * 1024;
+		const std::size_t HTTPClient::MaxReadSize = 1024 * 1024;
+
 		HTTPClient::HTTPClient(const JSContext& js_context) TITANIUM_NOEXCEPT
 			: Module(js_context, "Ti.Network.HTTPClient")
 			, onload__(js_context.CreateNull())
@@ -25,19 +31,24 @@ namespace Titanium
 			, opened__(js_context.CreateNumber(static_cast<uint32_t>(RequestState::Opened)))
 			, unsent__(js_context.CreateNumber(static_cast<uint32_t>(RequestState::Unsent)))
 			, securityManager__(js_context.CreateNull())
+			, responseBlob__(js_context.CreateNull())
 			, status__(200)
 			, readyState__(RequestState::Unsent)
+			, progressInterval__(std::chrono::milliseconds(100))
+			, readSize__(MinReadSize)
 		{
 			setHTTPStatusPhrase();
 		}
 
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::chrono::milliseconds, timeout)
+		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::chrono::milliseconds, progressInterval)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::string, file)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::string, username)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::string, password)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, std::string, domain)
 		TITANIUM_PROPERTY_READ(HTTPClient, std::string, location)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, cache)
+		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, coalesce)
 
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, autoEncodeUrl)
 		TITANIUM_PROPERTY_READ(HTTPClient, RequestState, readyState)
@@ -50,14 +61,85 @@ namespace Titanium
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, enableKeepAlive)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, validatesSecureCertificate)
 		TITANIUM_PROPERTY_READWRITE(HTTPClient, bool, withCredentials)
-		TITANIUM_PROPERTY_READ(HTTPClient, std::vector<std::uint8_t>, responseData);
+
+		std::vector<std::uint8_t> HTTPClient::get_responseData() const TITANIUM_NOEXCEPT
+		{
+			return getResponseBytes();
+		}
 
 		std::string HTTPClient::get_responseText() const TITANIUM_NOEXCEPT
 		{
-			auto data = get_responseData();
+			const auto& data = getResponseBytes();
 			return std::string(data.begin(), data.end());
 		}
 
+		const std::vector<std::uint8_t>& HTTPClient::getResponseBytes() const TITANIUM_NOEXCEPT
+		{
+			if (responseBlob__.IsObject()) {
+				const auto blob_ptr = static_cast<JSObject>(responseBlob__).GetPrivate<Titanium::Blob>();
+				if (blob_ptr) {
+					return blob_ptr->getDataRef();
+				}
+			}
+			return responseData__;
+		}
+
+		void HTTPClient::resetResponse() TITANIUM_NOEXCEPT
+		{
+			std::vector<std::uint8_t>().swap(responseData__);
+			responseBlob__ = get_context().CreateNull();
+		}
+
+		void HTTPClient::beginResponse(const std::int64_t& contentLength) TITANIUM_NOEXCEPT
+		{
+			expectedLength__ = contentLength;
+			receivedLength__ = 0;
+			readSize__ = MinReadSize;
+			lastProgress__ = std::chrono::steady_clock::time_point();
+
+			// Don't trust a huge Content-Length blindly, past this point the buffer grows geometrically
+			if (contentLength > 0 && file__.empty()) {
+				responseData__.reserve(static_cast<std::size_t>(std::min<std::int64_t>(contentLength, 16 * MaxReadSize)));
+			}
+		}
+
+		std::size_t HTTPClient::nextReadSize() const TITANIUM_NOEXCEPT
+		{
+			return readSize__;
+		}
+
+		void HTTPClient::appendResponseData(const std::uint8_t* data, const std::size_t& length) TITANIUM_NOEXCEPT
+		{
+			const auto size = responseData__.size();
+			if (responseData__.capacity() < size + length) {
+				responseData__.reserve(std::max(responseData__.capacity() * 2, size + length));
+			}
+			responseData__.insert(responseData__.end(), data, data + length);
+			reportDataReceived(length);
+		}
+
+		void HTTPClient::reportDataReceived(const std::size_t& length) TITANIUM_NOEXCEPT
+		{
+			receivedLength__ += length;
+
+			// A read that filled the buffer means more is waiting, so ask for more next time
+			if (length >= readSize__) {
+				readSize__ = std::min(readSize__ * 2, MaxReadSize);
+			}
+
+			const auto now = std::chrono::steady_clock::now();
+			if (now - lastProgress__ < progressInterval__) {
+				return;
+			}
+			lastProgress__ = now;
+
+			if (expectedLength__ > 0) {
+				ondatastream(static_cast<double>(receivedLength__) / static_cast<double>(expectedLength__));
+			} else {
+				ondatastream(-1.0); // chunked encoding was used
+			}
+		}
+
 		std::string HTTPClient::get_statusText() const TITANIUM_NOEXCEPT
 		{
 			auto it = httpStatusPhrase__.find(get_status());
@@ -104,6 +186,16 @@ namespace Titanium
 			TITANIUM_LOG_WARN("HTTPClient::send<data string>: unimplemented");
 		}
 
+		void HTTPClient::send(const std::shared_ptr<Titanium::Blob>& blob) TITANIUM_NOEXCEPT
+		{
+			TITANIUM_LOG_WARN("HTTPClient::send<Blob>: unimplemented");
+		}
+
+		void HTTPClient::send(const std::shared_ptr<Titanium::Filesystem::File>& file) TITANIUM_NOEXCEPT
+		{
+			TITANIUM_LOG_WARN("HTTPClient::send<File>: unimplemented");
+		}
+
 		void HTTPClient::setRequestHeader(const std::string& name, const std::string& value) TITANIUM_NOEXCEPT
 		{
 			TITANIUM_LOG_WARN("HTTPClient::setRequestHeader: unimplemented");
@@ -117,6 +209,7 @@ namespace Titanium
 			TITANIUM_ADD_PROPERTY(HTTPClient, autoEncodeUrl);
 			TITANIUM_ADD_PROPERTY(HTTPClient, autoRedirect);
 			TITANIUM_ADD_PROPERTY(HTTPClient, cache);
+			TITANIUM_ADD_PROPERTY(HTTPClient, coalesce);
 			TITANIUM_ADD_PROPERTY(HTTPClient, domain);
 			TITANIUM_ADD_PROPERTY(HTTPClient, enableKeepAlive);
 			TITANIUM_ADD_PROPERTY(HTTPClient, file);
@@ -126,6 +219,7 @@ namespace Titanium
 			TITANIUM_ADD_PROPERTY(HTTPClient, onreadystatechange);
 			TITANIUM_ADD_PROPERTY(HTTPClient, onsendstream);
 			TITANIUM_ADD_PROPERTY(HTTPClient, password);
+			TITANIUM_ADD_PROPERTY(HTTPClient, progressInterval);
 			TITANIUM_ADD_PROPERTY(HTTPClient, securityManager);
 			TITANIUM_ADD_PROPERTY(HTTPClient, timeout);
 			TITANIUM_ADD_PROPERTY(HTTPClient, tlsVersion);
@@ -157,6 +251,7 @@ namespace Titanium
 			TITANIUM_ADD_FUNCTION(HTTPClient, getAutoEncodeUrl);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getAutoRedirect);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getCache);
+			TITANIUM_ADD_FUNCTION(HTTPClient, getCoalesce);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getConnected);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getConnectionType);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getDomain);
@@ -169,6 +264,7 @@ namespace Titanium
 			TITANIUM_ADD_FUNCTION(HTTPClient, getOnreadystatechange);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getOnsendstream);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getPassword);
+			TITANIUM_ADD_FUNCTION(HTTPClient, getProgressInterval);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getReadyState);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getResponseData);
 			TITANIUM_ADD_FUNCTION(HTTPClient, getResponseHeader);
@@ -187,6 +283,7 @@ namespace Titanium
 			TITANIUM_ADD_FUNCTION(HTTPClient, setAutoEncodeUrl);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setAutoRedirect);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setCache);
+			TITANIUM_ADD_FUNCTION(HTTPClient, setCoalesce);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setDomain);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setEnableKeepAlive);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setFile);
@@ -196,6 +293,7 @@ namespace Titanium
 			TITANIUM_ADD_FUNCTION(HTTPClient, setOnreadystatechange);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setOnsendstream);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setPassword);
+			TITANIUM_ADD_FUNCTION(HTTPClient, setProgressInterval);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setRequestHeader);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setSecurityManager);
 			TITANIUM_ADD_FUNCTION(HTTPClient, setTimeout);
@@ -291,6 +389,10 @@ namespace Titanium
 				if (arguments.at(0).IsString()) {
 					std::string postDataString = static_cast<std::string>(arguments.at(0));
 					send(postDataString);
+				} else if (static_cast<JSObject>(arguments.at(0)).GetPrivate<Titanium::Blob>()) {
+					send(static_cast<JSObject>(arguments.at(0)).GetPrivate<Titanium::Blob>());
+				} else if (static_cast<JSObject>(arguments.at(0)).GetPrivate<Titanium::Filesystem::File>()) {
+					send(static_cast<JSObject>(arguments.at(0)).GetPrivate<Titanium::Filesystem::File>());
 				} else {
 					bool useMultipartForm = false;
 					std::map<std::string, JSValue> map;
@@ -334,11 +436,33 @@ namespace Titanium
 
 		TITANIUM_PROPERTY_GETTER(HTTPClient, responseData)
 		{
+			if (responseBlob__.IsObject()) {
+				return responseBlob__;
+			}
+
+			// When the response was streamed into the target file it never lands in memory
+			if (!file__.empty() && responseData__.empty()) {
+				const auto js_filesystem = get_context().JSEvaluateScript("Ti.Filesystem");
+				TITANIUM_ASSERT(js_filesystem.IsObject());
+				const auto filesystem_obj = static_cast<JSObject>(js_filesystem).CallAsConstructor();
+				const auto Filesystem = filesystem_obj.GetPrivate<Titanium::FilesystemModule>();
+				const auto file = Filesystem->getFile(get_context(), file__);
+				const auto blob = file ? file->read() : nullptr;
+				if (blob == nullptr) {
+					return get_context().CreateNull();
+				}
+				responseBlob__ = blob->get_object();
+				return responseBlob__;
+			}
+
 			auto Blob = get_context().CreateObject(JSExport<Titanium::Blob>::Class());
 			auto blob = Blob.CallAsConstructor();
 			auto blob_ptr = blob.GetPrivate<Titanium::Blob>();
 
-			blob_ptr->construct(get_responseData());
+			// Hand the buffer over rather than copying it, responseText reads it back from the Blob
+			blob_ptr->construct(std::move(responseData__));
+			responseData__ = std::vector<std::uint8_t>();
+			responseBlob__ = blob;
 
 			return blob;
 		}
@@ -449,6 +573,11 @@ namespace Titanium
 		TITANIUM_FUNCTION_AS_GETTER(HTTPClient, getCache, cache)
 		TITANIUM_FUNCTION_AS_SETTER(HTTPClient, setCache, cache)
 
+		TITANIUM_PROPERTY_GETTER_BOOL(HTTPClient, coalesce)
+		TITANIUM_PROPERTY_SETTER_BOOL(HTTPClient, coalesce)
+		TITANIUM_FUNCTION_AS_GETTER(HTTPClient, getCoalesce, coalesce)
+		TITANIUM_FUNCTION_AS_SETTER(HTTPClient, setCoalesce, coalesce)
+
 		TITANIUM_PROPERTY_GETTER_STRING(HTTPClient, domain)
 		TITANIUM_PROPERTY_SETTER_STRING(HTTPClient, domain)
 		TITANIUM_FUNCTION_AS_GETTER(HTTPClient, getDomain, domain)
@@ -588,6 +717,18 @@ namespace Titanium
 			return this_object.get_context().CreateUndefined();
 		}
 
+		TITANIUM_PROPERTY_GETTER_TIME(HTTPClient, progressInterval)
+		TITANIUM_PROPERTY_SETTER(HTTPClient, progressInterval)
+		{
+			TITANIUM_ASSERT(argument.IsNumber());
+			const auto interval = static_cast<std::int64_t>(static_cast<double>(argument));
+			set_progressInterval(std::chrono::milliseconds(std::max<std::int64_t>(0, interval)));
+			return true;
+		}
+
+		TITANIUM_FUNCTION_AS_GETTER(HTTPClient, getProgressInterval, progressInterval)
+		TITANIUM_FUNCTION_AS_SETTER(HTTPClient, setProgressInterval, progressInterval)
+
 		////// slots
 		void HTTPClient::onload(const std::uint32_t code, const std::string error, const bool success) TITANIUM_NOEXCEPT
 		{
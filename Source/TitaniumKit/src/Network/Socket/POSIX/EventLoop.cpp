@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/Network/Socket/POSIX/EventLoop.hpp"
+#include "Titanium/detail/TiLogger.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+
+namespace Titanium
+{
+	namespace Network
+	{
+		namespace Socket
+		{
+			namespace POSIX
+			{
+				EventLoop::EventLoop()
+					: epoll_fd__(epoll_create1(EPOLL_CLOEXEC))
+					, wake_fd__(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+				{
+					epoll_event event {};
+					event.events = EPOLLIN;
+					event.data.fd = wake_fd__;
+					epoll_ctl(epoll_fd__, EPOLL_CTL_ADD, wake_fd__, &event);
+					thread__ = std::thread(&EventLoop::Run, this);
+				}
+
+				EventLoop::~EventLoop()
+				{
+					stopping__ = true;
+					Wake();
+					if (thread__.joinable()) {
+						thread__.join();
+					}
+					::close(wake_fd__);
+					::close(epoll_fd__);
+				}
+
+				bool EventLoop::Add(const int& fd, const std::uint32_t& events, Handler handler)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex__);
+						handlers__[fd] = std::make_shared<Handler>(std::move(handler));
+					}
+					epoll_event event {};
+					event.events = events;
+					event.data.fd = fd;
+					if (epoll_ctl(epoll_fd__, EPOLL_CTL_ADD, fd, &event) != 0) {
+						TITANIUM_LOG_WARN("EventLoop::Add: ", std::strerror(errno));
+						std::lock_guard<std::mutex> lock(mutex__);
+						handlers__.erase(fd);
+						return false;
+					}
+					return true;
+				}
+
+				bool EventLoop::Modify(const int& fd, const std::uint32_t& events)
+				{
+					epoll_event event {};
+					event.events = events;
+					event.data.fd = fd;
+					return epoll_ctl(epoll_fd__, EPOLL_CTL_MOD, fd, &event) == 0;
+				}
+
+				void EventLoop::Remove(const int& fd)
+				{
+					epoll_ctl(epoll_fd__, EPOLL_CTL_DEL, fd, nullptr);
+					std::lock_guard<std::mutex> lock(mutex__);
+					handlers__.erase(fd);
+				}
+
+				void EventLoop::Post(std::function<void()> task)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex__);
+						tasks__.push_back(std::move(task));
+					}
+					Wake();
+				}
+
+				void EventLoop::Deliver(std::function<void()> callback)
+				{
+					{
+						std::lock_guard<std::mutex> lock(callbacks_mutex__);
+						callbacks__.push_back(std::move(callback));
+					}
+					// The loop hands out a batch at the end of every iteration, so
+					// only callers from other threads need to wake it.
+					if (!IsLoopThread()) {
+						Wake();
+					}
+				}
+
+				std::size_t EventLoop::RunPendingCallbacks()
+				{
+					std::vector<std::function<void()>> callbacks;
+					{
+						std::lock_guard<std::mutex> lock(callbacks_mutex__);
+						callbacks.swap(callbacks__);
+						batch_scheduled__ = false;
+					}
+					for (const auto& callback : callbacks) {
+						try {
+							callback();
+						} catch (const std::exception& e) {
+							TITANIUM_LOG_ERROR("EventLoop: callback threw ", e.what());
+						}
+					}
+					delivered__ += callbacks.size();
+					return callbacks.size();
+				}
+
+				void EventLoop::set_dispatcher(const Dispatcher& dispatcher)
+				{
+					{
+						std::lock_guard<std::mutex> lock(callbacks_mutex__);
+						dispatcher__ = dispatcher;
+					}
+					// Hand out whatever was queued while there was no dispatcher
+					Wake();
+				}
+
+				bool EventLoop::IsLoopThread() const
+				{
+					return std::this_thread::get_id() == thread__.get_id();
+				}
+
+				std::size_t EventLoop::get_batches() const
+				{
+					return batches__;
+				}
+
+				std::size_t EventLoop::get_delivered() const
+				{
+					return delivered__;
+				}
+
+				EventLoop& EventLoop::Default()
+				{
+					static EventLoop loop;
+					return loop;
+				}
+
+				void EventLoop::Wake()
+				{
+					const std::uint64_t one = 1;
+					const auto result = ::write(wake_fd__, &one, sizeof(one));
+					(void)result;
+				}
+
+				void EventLoop::Flush()
+				{
+					Dispatcher dispatcher;
+					{
+						std::lock_guard<std::mutex> lock(callbacks_mutex__);
+						// A batch that is still waiting for the JS thread picks up
+						// whatever was queued since. Without a dispatcher callbacks
+						// wait for the JS thread to call RunPendingCallbacks.
+						if (callbacks__.empty() || batch_scheduled__ || !dispatcher__) {
+							return;
+						}
+						batch_scheduled__ = true;
+						dispatcher = dispatcher__;
+					}
+					batches__++;
+					dispatcher([this]() { RunPendingCallbacks(); });
+				}
+
+				void EventLoop::Run()
+				{
+					epoll_event events[64];
+					while (!stopping__) {
+						const auto count = epoll_wait(epoll_fd__, events, 64, -1);
+						if (count < 0 && errno != EINTR) {
+							TITANIUM_LOG_ERROR("EventLoop: epoll_wait failed: ", std::strerror(errno));
+							break;
+						}
+
+						for (int i = 0; i < count; i++) {
+							const auto fd = events[i].data.fd;
+							if (fd == wake_fd__) {
+								std::uint64_t value;
+								const auto result = ::read(wake_fd__, &value, sizeof(value));
+								(void)result;
+								continue;
+							}
+							std::shared_ptr<Handler> handler;
+							{
+								std::lock_guard<std::mutex> lock(mutex__);
+								const auto it = handlers__.find(fd);
+								if (it != handlers__.end()) {
+									handler = it->second;
+								}
+							}
+							if (handler) {
+								(*handler)(events[i].events);
+							}
+						}
+
+						std::vector<std::function<void()>> tasks;
+						{
+							std::lock_guard<std::mutex> lock(mutex__);
+							tasks.swap(tasks__);
+						}
+						for (const auto& task : tasks) {
+							task();
+						}
+
+						Flush();
+					}
+				}
+			} // namespace POSIX
+		} // namespace Socket
+	} // namespace Network
+} // namespace Titanium
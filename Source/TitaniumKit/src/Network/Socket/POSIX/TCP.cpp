@@ -0,0 +1,772 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/Network/Socket/POSIX/TCP.hpp"
+#include "Titanium/Network/Socket/AcceptDict.hpp"
+#include "Titanium/Buffer.hpp"
+#include "Titanium/detail/TiThreadPool.hpp"
+#include "Titanium/detail/TiImpl.hpp"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+
+namespace Titanium
+{
+	namespace Network
+	{
+		namespace Socket
+		{
+			namespace POSIX
+			{
+				using Callback = std::function<void(const ErrorResponse&, const std::int32_t&)>;
+
+				// Most iovecs handed to a single readv/sendmsg
+				static const std::size_t MaxBatch = 64;
+
+				// The loop never touches Ti.Buffer storage, which the JS thread may resize
+				// at any time. Writes send a copy taken when they are queued; reads land
+				// in data and are copied into the buffer on the JS thread.
+				struct IORequest
+				{
+					std::shared_ptr<Titanium::Buffer> buffer;
+					std::uint32_t offset;
+					std::uint32_t length;
+					std::uint32_t done;
+					std::vector<std::uint8_t> data;
+					Callback callback;
+				};
+
+				struct SocketOptions
+				{
+					bool noDelay;
+					std::uint32_t sendBufferSize;
+					std::uint32_t receiveBufferSize;
+				};
+
+				struct TCP::Channel
+				{
+					explicit Channel(EventLoop& loop)
+						: loop(loop)
+					{
+					}
+
+					EventLoop& loop;
+					std::mutex mutex;
+					int fd { -1 };
+					// owner - cleared when the TCP object goes away
+					TCP* owner { nullptr };
+					bool closed { false };
+					bool connecting { false };
+					bool listening { false };
+					// scheduled - a flush of the queued requests is already posted to the loop
+					bool scheduled { false };
+					std::uint32_t events { 0 };
+					std::deque<IORequest> reads;
+					std::deque<IORequest> writes;
+					// connections accepted by the kernel that accept() has not asked for yet
+					std::deque<int> pending;
+					// accept() calls still waiting for a connection
+					std::uint32_t accepts { 0 };
+				};
+
+				static ErrorResponse ErrorFromErrno(const int& code)
+				{
+					ErrorResponse error;
+					error.code = code;
+					error.error = std::strerror(code);
+					error.success = false;
+					return error;
+				}
+
+				static void ApplyOptions(const int& fd, const SocketOptions& options)
+				{
+					if (options.noDelay) {
+						const int on = 1;
+						setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+					}
+					if (options.sendBufferSize > 0) {
+						const int size = static_cast<int>(options.sendBufferSize);
+						setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+					}
+					if (options.receiveBufferSize > 0) {
+						const int size = static_cast<int>(options.receiveBufferSize);
+						setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+					}
+				}
+
+				static void Complete(EventLoop& loop, const Callback& callback, const ErrorResponse& error, const std::int32_t& count)
+				{
+					if (callback) {
+						loop.Deliver([callback, error, count]() {
+							callback(error, count);
+						});
+					}
+				}
+
+				static void CompleteRead(EventLoop& loop, IORequest& request, const std::size_t& received)
+				{
+					const auto buffer = request.buffer;
+					const auto offset = request.offset;
+					const auto callback = request.callback;
+					const auto data = std::make_shared<std::vector<std::uint8_t>>();
+					data->swap(request.data);
+					loop.Deliver([buffer, offset, callback, data, received]() {
+						// The buffer may have shrunk while the read was in flight
+						auto& target = buffer->getDataRef();
+						const auto count = offset < target.size() ? std::min(received, target.size() - offset) : 0;
+						std::copy_n(data->begin(), count, target.begin() + offset);
+						if (callback) {
+							callback(ErrorResponse(), static_cast<std::int32_t>(count));
+						}
+					});
+				}
+
+				static void Fail(EventLoop& loop, std::deque<IORequest>& requests, const ErrorResponse& error, const std::int32_t& count)
+				{
+					for (const auto& request : requests) {
+						Complete(loop, request.callback, error, count);
+					}
+					requests.clear();
+				}
+
+				// The functions below run on the loop thread with channel->mutex held.
+
+				static void UpdateInterest(TCP::Channel& channel)
+				{
+					if (channel.fd < 0) {
+						return;
+					}
+					std::uint32_t events = 0;
+					if (channel.listening || !channel.reads.empty()) {
+						events |= EPOLLIN | EPOLLRDHUP;
+					}
+					if (channel.connecting || !channel.writes.empty()) {
+						events |= EPOLLOUT;
+					}
+					if (events != channel.events) {
+						channel.loop.Modify(channel.fd, events);
+						channel.events = events;
+					}
+				}
+
+				static void DoReads(TCP::Channel& channel)
+				{
+					while (!channel.reads.empty()) {
+						iovec iov[MaxBatch];
+						std::size_t count = 0;
+						for (auto& request : channel.reads) {
+							if (count == MaxBatch) {
+								break;
+							}
+							iov[count].iov_base = request.data.data();
+							iov[count].iov_len = request.length;
+							count++;
+						}
+
+						const auto result = ::readv(channel.fd, iov, static_cast<int>(count));
+						if (result < 0) {
+							if (errno == EINTR) {
+								continue;
+							}
+							if (errno != EAGAIN && errno != EWOULDBLOCK) {
+								Fail(channel.loop, channel.reads, ErrorFromErrno(errno), -1);
+							}
+							return;
+						}
+						if (result == 0) {
+							// End of stream
+							Fail(channel.loop, channel.reads, ErrorResponse(), -1);
+							return;
+						}
+
+						// readv fills the requests in order; each one that got data completes
+						auto remaining = static_cast<std::size_t>(result);
+						while (remaining > 0) {
+							auto& request = channel.reads.front();
+							const auto received = std::min<std::size_t>(request.length, remaining);
+							remaining -= received;
+							CompleteRead(channel.loop, request, received);
+							channel.reads.pop_front();
+						}
+					}
+				}
+
+				static void DoWrites(TCP::Channel& channel)
+				{
+					while (!channel.writes.empty()) {
+						iovec iov[MaxBatch];
+						std::size_t count = 0;
+						for (auto& request : channel.writes) {
+							if (count == MaxBatch) {
+								break;
+							}
+							iov[count].iov_base = request.data.data() + request.done;
+							iov[count].iov_len = request.length - request.done;
+							count++;
+						}
+
+						// sendmsg is writev with flags; MSG_NOSIGNAL keeps a closed peer from raising SIGPIPE
+						msghdr message {};
+						message.msg_iov = iov;
+						message.msg_iovlen = count;
+						const auto result = ::sendmsg(channel.fd, &message, MSG_NOSIGNAL);
+						if (result < 0) {
+							if (errno == EINTR) {
+								continue;
+							}
+							if (errno != EAGAIN && errno != EWOULDBLOCK) {
+								Fail(channel.loop, channel.writes, ErrorFromErrno(errno), 0);
+							}
+							return;
+						}
+
+						auto remaining = static_cast<std::size_t>(result);
+						while (remaining > 0) {
+							auto& request = channel.writes.front();
+							const auto sent = std::min<std::size_t>(request.length - request.done, remaining);
+							request.done += static_cast<std::uint32_t>(sent);
+							remaining -= sent;
+							if (request.done == request.length) {
+								Complete(channel.loop, request.callback, ErrorResponse(), static_cast<std::int32_t>(request.length));
+								channel.writes.pop_front();
+							}
+						}
+					}
+				}
+
+				static void ServeAccepts(const std::shared_ptr<TCP::Channel>& channel)
+				{
+					while (channel->accepts > 0 && !channel->pending.empty()) {
+						const auto fd = channel->pending.front();
+						channel->pending.pop_front();
+						channel->accepts--;
+						channel->loop.Deliver([channel, fd]() {
+							TCP* owner = nullptr;
+							{
+								std::lock_guard<std::mutex> lock(channel->mutex);
+								owner = channel->owner;
+							}
+							if (owner) {
+								owner->fireAccepted(fd);
+							} else {
+								::close(fd);
+							}
+						});
+					}
+				}
+
+				static void OnEvents(const std::shared_ptr<TCP::Channel>& channel, const std::uint32_t& events)
+				{
+					std::lock_guard<std::mutex> lock(channel->mutex);
+					if (channel->fd < 0) {
+						return;
+					}
+
+					if (channel->connecting && (events & (EPOLLOUT | EPOLLERR | EPOLLHUP))) {
+						channel->connecting = false;
+						int error = 0;
+						socklen_t length = sizeof(error);
+						getsockopt(channel->fd, SOL_SOCKET, SO_ERROR, &error, &length);
+						channel->loop.Deliver([channel, error]() {
+							TCP* owner = nullptr;
+							{
+								std::lock_guard<std::mutex> lock(channel->mutex);
+								owner = channel->owner;
+							}
+							if (owner && error != 0) {
+								owner->fireError(error, std::strerror(error));
+							} else if (owner) {
+								owner->fireConnected();
+							}
+						});
+					}
+
+					if (channel->listening && (events & EPOLLIN)) {
+						while (true) {
+							const auto fd = ::accept4(channel->fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+							if (fd < 0) {
+								break;
+							}
+							channel->pending.push_back(fd);
+						}
+						ServeAccepts(channel);
+					}
+
+					if (!channel->reads.empty() && (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))) {
+						DoReads(*channel);
+					}
+					if (!channel->writes.empty() && (events & (EPOLLOUT | EPOLLHUP | EPOLLERR))) {
+						DoWrites(*channel);
+					}
+					UpdateInterest(*channel);
+				}
+
+				static bool Register(const std::shared_ptr<TCP::Channel>& channel, const int& fd, const std::uint32_t& events)
+				{
+					channel->fd = fd;
+					channel->events = events;
+					return channel->loop.Add(fd, events, [channel](const std::uint32_t& ready) {
+						OnEvents(channel, ready);
+					});
+				}
+
+				// Queues one flush of the pending requests on the loop, however many
+				// requests were added since the last one.
+				static void Schedule(const std::shared_ptr<TCP::Channel>& channel)
+				{
+					if (channel->scheduled) {
+						return;
+					}
+					channel->scheduled = true;
+					channel->loop.Post([channel]() {
+						std::lock_guard<std::mutex> lock(channel->mutex);
+						channel->scheduled = false;
+						if (channel->fd < 0 || channel->connecting) {
+							return;
+						}
+						DoWrites(*channel);
+						DoReads(*channel);
+						UpdateInterest(*channel);
+					});
+				}
+
+				TCP::TCP(const JSContext& js_context) TITANIUM_NOEXCEPT
+					: Titanium::Network::Socket::TCP(js_context)
+					, loop__(&EventLoop::Default())
+					, channel__(std::make_shared<Channel>(EventLoop::Default()))
+				{
+					channel__->owner = this;
+				}
+
+				TCP::~TCP()
+				{
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						channel__->owner = nullptr;
+					}
+					close();
+				}
+
+				void TCP::JSExportInitialize()
+				{
+					JSExport<TCP>::SetClassVersion(1);
+					JSExport<TCP>::SetParent(JSExport<Titanium::Network::Socket::TCP>::Class());
+				}
+
+				void TCP::set_eventLoop(EventLoop& loop) TITANIUM_NOEXCEPT
+				{
+					const auto previous = channel__;
+					std::lock_guard<std::mutex> lock(previous->mutex);
+					if (previous->fd >= 0) {
+						TITANIUM_LOG_WARN("TCP::set_eventLoop: socket is already open");
+						return;
+					}
+					loop__ = &loop;
+					previous->owner = nullptr;
+					channel__ = std::make_shared<Channel>(loop);
+					channel__->owner = this;
+				}
+
+				EventLoop& TCP::get_eventLoop() const TITANIUM_NOEXCEPT
+				{
+					return *loop__;
+				}
+
+				void TCP::construct(const int& fd)
+				{
+					ApplyOptions(fd, { noDelay__, sendBufferSize__, receiveBufferSize__ });
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						Register(channel__, fd, 0);
+					}
+					state__ = State::Connected;
+					modes__.emplace(Titanium::Filesystem::MODE::READ);
+					modes__.emplace(Titanium::Filesystem::MODE::WRITE);
+				}
+
+				void TCP::connect() TITANIUM_NOEXCEPT
+				{
+					if (state__ == State::Connected || state__ == State::Listening || channel__->fd >= 0) {
+						fireError(EISCONN, "Socket is already connected or listening");
+						return;
+					}
+
+					const auto channel = channel__;
+					const auto host = host__;
+					const auto port = std::to_string(port__);
+					const SocketOptions options { noDelay__, sendBufferSize__, receiveBufferSize__ };
+					{
+						std::lock_guard<std::mutex> lock(channel->mutex);
+						channel->closed = false;
+					}
+
+					// Name resolution blocks, so it runs on the I/O pool rather than the loop
+					Titanium::detail::TiThreadPool::IOPool().Post([channel, host, port, options]() {
+						addrinfo hints {};
+						hints.ai_family = AF_UNSPEC;
+						hints.ai_socktype = SOCK_STREAM;
+						addrinfo* addresses = nullptr;
+						const auto status = getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses);
+
+						int fd = -1;
+						int error = 0;
+						std::string message;
+						if (status != 0) {
+							error = EHOSTUNREACH;
+							message = gai_strerror(status);
+						} else {
+							for (auto address = addresses; address != nullptr; address = address->ai_next) {
+								fd = ::socket(address->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+								if (fd < 0) {
+									error = errno;
+									continue;
+								}
+								ApplyOptions(fd, options);
+								if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0 || errno == EINPROGRESS) {
+									break;
+								}
+								error = errno;
+								::close(fd);
+								fd = -1;
+							}
+							freeaddrinfo(addresses);
+							if (fd < 0) {
+								message = std::strerror(error);
+							}
+						}
+
+						std::lock_guard<std::mutex> lock(channel->mutex);
+						if (channel->closed) {
+							if (fd >= 0) {
+								::close(fd);
+							}
+							return;
+						}
+						if (fd < 0) {
+							channel->loop.Deliver([channel, error, message]() {
+								TCP* owner = nullptr;
+								{
+									std::lock_guard<std::mutex> lock(channel->mutex);
+									owner = channel->owner;
+								}
+								if (owner) {
+									owner->fireError(error, message);
+								}
+							});
+							return;
+						}
+						// A non-blocking connect reports completion as writability
+						channel->connecting = true;
+						Register(channel, fd, EPOLLOUT);
+					});
+				}
+
+				void TCP::listen() TITANIUM_NOEXCEPT
+				{
+					if (state__ == State::Connected || state__ == State::Listening || channel__->fd >= 0) {
+						fireError(EISCONN, "Socket is already listening or connected");
+						return;
+					}
+
+					addrinfo hints {};
+					hints.ai_family = AF_UNSPEC;
+					hints.ai_socktype = SOCK_STREAM;
+					hints.ai_flags = AI_PASSIVE;
+					addrinfo* addresses = nullptr;
+					const auto port = std::to_string(port__);
+					const auto status = getaddrinfo(host__.empty() ? nullptr : host__.c_str(), port.c_str(), &hints, &addresses);
+					if (status != 0) {
+						fireError(EADDRNOTAVAIL, gai_strerror(status));
+						return;
+					}
+
+					int fd = -1;
+					int error = 0;
+					for (auto address = addresses; address != nullptr; address = address->ai_next) {
+						fd = ::socket(address->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+						if (fd < 0) {
+							error = errno;
+							continue;
+						}
+						const int on = 1;
+						setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+						// Buffer sizes set on the listener are inherited by accepted sockets
+						ApplyOptions(fd, { false, sendBufferSize__, receiveBufferSize__ });
+						if (::bind(fd, address->ai_addr, address->ai_addrlen) == 0 && ::listen(fd, listenQueueSize__ > 0 ? static_cast<int>(listenQueueSize__) : SOMAXCONN) == 0) {
+							break;
+						}
+						error = errno;
+						::close(fd);
+						fd = -1;
+					}
+					freeaddrinfo(addresses);
+					if (fd < 0) {
+						fireError(error, std::strerror(error));
+						return;
+					}
+
+					// Report the port the system picked when asked for port 0
+					sockaddr_storage address {};
+					socklen_t length = sizeof(address);
+					if (port__ == 0 && getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length) == 0) {
+						if (address.ss_family == AF_INET6) {
+							port__ = ntohs(reinterpret_cast<sockaddr_in6*>(&address)->sin6_port);
+						} else {
+							port__ = ntohs(reinterpret_cast<sockaddr_in*>(&address)->sin_port);
+						}
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						channel__->closed = false;
+						channel__->listening = true;
+						Register(channel__, fd, EPOLLIN);
+					}
+					state__ = State::Listening;
+				}
+
+				void TCP::accept(const AcceptDict& options) TITANIUM_NOEXCEPT
+				{
+					if (state__ != State::Listening) {
+						fireError(EINVAL, "Socket is not in listening state");
+						return;
+					}
+					const auto channel = channel__;
+					loop__->Post([channel]() {
+						std::lock_guard<std::mutex> lock(channel->mutex);
+						channel->accepts++;
+						ServeAccepts(channel);
+					});
+				}
+
+				void TCP::close() TITANIUM_NOEXCEPT
+				{
+					std::deque<IORequest> reads;
+					std::deque<IORequest> writes;
+					std::deque<int> pending;
+					int fd = -1;
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						channel__->closed = true;
+						fd = channel__->fd;
+						channel__->fd = -1;
+						channel__->connecting = false;
+						channel__->listening = false;
+						channel__->accepts = 0;
+						reads.swap(channel__->reads);
+						writes.swap(channel__->writes);
+						pending.swap(channel__->pending);
+					}
+
+					if (fd >= 0) {
+						loop__->Remove(fd);
+						::close(fd);
+					}
+					for (const auto inbound : pending) {
+						::close(inbound);
+					}
+
+					ErrorResponse error;
+					error.code = ECANCELED;
+					error.error = "Socket closed";
+					error.success = false;
+					Fail(*loop__, reads, error, -1);
+					Fail(*loop__, writes, error, 0);
+
+					if (state__ != State::Error) {
+						state__ = State::Closed;
+					}
+					modes__.clear();
+				}
+
+				std::int32_t TCP::read(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length)
+				{
+					int fd = -1;
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						fd = channel__->fd;
+					}
+					if (buffer == nullptr || fd < 0) {
+						return -1;
+					}
+					auto& data = buffer->getDataRef();
+					if (offset >= data.size()) {
+						return 0;
+					}
+					const auto count = std::min<std::size_t>(length, data.size() - offset);
+					if (count == 0) {
+						// read() returning 0 would look like the end of the stream
+						return 0;
+					}
+
+					while (true) {
+						const auto result = ::read(fd, data.data() + offset, count);
+						if (result > 0) {
+							totalBytesProcessed__ += static_cast<std::uint32_t>(result);
+							return static_cast<std::int32_t>(result);
+						}
+						if (result == 0) {
+							return -1;
+						}
+						if (errno == EAGAIN || errno == EWOULDBLOCK) {
+							pollfd ready { fd, POLLIN, 0 };
+							::poll(&ready, 1, -1);
+						} else if (errno != EINTR) {
+							TITANIUM_LOG_WARN("TCP::read: ", std::strerror(errno));
+							return -1;
+						}
+					}
+				}
+
+				void TCP::readAsync(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length, const Callback& callback)
+				{
+					if (buffer == nullptr || offset > buffer->getDataRef().size()) {
+						Complete(*loop__, callback, ErrorFromErrno(EINVAL), -1);
+						return;
+					}
+					const auto count = static_cast<std::uint32_t>(std::min<std::size_t>(length, buffer->getDataRef().size() - offset));
+					if (count == 0) {
+						Complete(*loop__, callback, ErrorResponse(), 0);
+						return;
+					}
+
+					std::lock_guard<std::mutex> lock(channel__->mutex);
+					if (channel__->fd < 0) {
+						Complete(*loop__, callback, ErrorFromErrno(ENOTCONN), -1);
+						return;
+					}
+					channel__->reads.push_back({ buffer, offset, count, 0, std::vector<std::uint8_t>(count), callback });
+					Schedule(channel__);
+				}
+
+				std::uint32_t TCP::write(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length)
+				{
+					int fd = -1;
+					{
+						std::lock_guard<std::mutex> lock(channel__->mutex);
+						fd = channel__->fd;
+					}
+					if (buffer == nullptr || fd < 0) {
+						return 0;
+					}
+					const auto& data = buffer->getDataRef();
+					if (offset + length > data.size()) {
+						return 0;
+					}
+
+					const auto timeout = timeout__.count() > 0 ? static_cast<int>(timeout__.count()) : -1;
+					std::uint32_t written = 0;
+					while (written < length) {
+						const auto result = ::send(fd, data.data() + offset + written, length - written, MSG_NOSIGNAL);
+						if (result >= 0) {
+							written += static_cast<std::uint32_t>(result);
+						} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+							pollfd ready { fd, POLLOUT, 0 };
+							if (::poll(&ready, 1, timeout) == 0) {
+								TITANIUM_LOG_WARN("TCP::write: timed out");
+								break;
+							}
+						} else if (errno != EINTR) {
+							TITANIUM_LOG_WARN("TCP::write: ", std::strerror(errno));
+							break;
+						}
+					}
+					totalBytesProcessed__ += written;
+					return written;
+				}
+
+				void TCP::writeAsync(const std::shared_ptr<Titanium::Buffer>& buffer, const std::uint32_t& offset, const std::uint32_t& length, const Callback& callback)
+				{
+					if (buffer == nullptr || offset + length > buffer->getDataRef().size()) {
+						Complete(*loop__, callback, ErrorFromErrno(EINVAL), 0);
+						return;
+					}
+					if (length == 0) {
+						Complete(*loop__, callback, ErrorResponse(), 0);
+						return;
+					}
+
+					std::lock_guard<std::mutex> lock(channel__->mutex);
+					if (channel__->fd < 0) {
+						Complete(*loop__, callback, ErrorFromErrno(ENOTCONN), 0);
+						return;
+					}
+					const auto first = buffer->getDataRef().begin() + offset;
+					channel__->writes.push_back({ buffer, offset, length, 0, std::vector<std::uint8_t>(first, first + length), callback });
+					Schedule(channel__);
+				}
+
+				void TCP::fireConnected()
+				{
+					state__ = State::Connected;
+					modes__.emplace(Titanium::Filesystem::MODE::READ);
+					modes__.emplace(Titanium::Filesystem::MODE::WRITE);
+
+					if (connected__.IsObject()) {
+						auto connected = static_cast<JSObject>(connected__);
+						if (connected.IsFunction()) {
+							auto args = get_context().CreateObject();
+							args.SetProperty("socket", get_object());
+							connected({ args }, get_object());
+						}
+					}
+				}
+
+				void TCP::fireError(const std::int32_t& code, const std::string& message)
+				{
+					TITANIUM_LOG_WARN("TCP: ", message);
+					state__ = State::Error;
+
+					if (error__.IsObject()) {
+						auto error = static_cast<JSObject>(error__);
+						if (error.IsFunction()) {
+							const auto ctx = get_context();
+							auto args = ctx.CreateObject();
+							args.SetProperty("code", ctx.CreateNumber(code));
+							args.SetProperty("error", ctx.CreateString(message));
+							args.SetProperty("socket", get_object());
+							args.SetProperty("success", ctx.CreateBoolean(false));
+							error({ args }, get_object());
+						}
+					}
+				}
+
+				void TCP::fireAccepted(const int& fd)
+				{
+					auto TCP_class = get_context().CreateObject(JSExport<TCP>::Class());
+					auto inbound = TCP_class.CallAsConstructor();
+					const auto tcp = inbound.GetPrivate<TCP>();
+					tcp->set_eventLoop(*loop__);
+					tcp->noDelay__ = noDelay__;
+					tcp->construct(fd);
+
+					if (accepted__.IsObject()) {
+						auto accepted = static_cast<JSObject>(accepted__);
+						if (accepted.IsFunction()) {
+							auto args = get_context().CreateObject();
+							args.SetProperty("inbound", inbound);
+							args.SetProperty("socket", get_object());
+							accepted({ args }, get_object());
+						}
+					}
+				}
+			} // namespace POSIX
+		} // namespace Socket
+	} // namespace Network
+} // namespace Titanium
@@ -34,6 +34,9 @@ namespace Titanium
 			TITANIUM_PROPERTY_READWRITE(TCP, std::uint32_t, port)
 			TITANIUM_PROPERTY_READWRITE(TCP, std::uint32_t, listenQueueSize)
 			TITANIUM_PROPERTY_READWRITE(TCP, std::chrono::milliseconds, timeout)
+			TITANIUM_PROPERTY_READWRITE(TCP, bool, noDelay)
+			TITANIUM_PROPERTY_READWRITE(TCP, std::uint32_t, sendBufferSize)
+			TITANIUM_PROPERTY_READWRITE(TCP, std::uint32_t, receiveBufferSize)
 
 			TITANIUM_PROPERTY_READ(TCP, State, state);
 
@@ -66,6 +69,9 @@ namespace Titanium
 				TITANIUM_ADD_PROPERTY(TCP, port);
 				TITANIUM_ADD_PROPERTY(TCP, listenQueueSize);
 				TITANIUM_ADD_PROPERTY(TCP, timeout);
+				TITANIUM_ADD_PROPERTY(TCP, noDelay);
+				TITANIUM_ADD_PROPERTY(TCP, sendBufferSize);
+				TITANIUM_ADD_PROPERTY(TCP, receiveBufferSize);
 				TITANIUM_ADD_PROPERTY(TCP, connected);
 				TITANIUM_ADD_PROPERTY(TCP, error);
 				TITANIUM_ADD_PROPERTY(TCP, accepted);
@@ -83,6 +89,12 @@ namespace Titanium
 				TITANIUM_ADD_FUNCTION(TCP, setListenQueueSize);
 				TITANIUM_ADD_FUNCTION(TCP, getTimeout);
 				TITANIUM_ADD_FUNCTION(TCP, setTimeout);
+				TITANIUM_ADD_FUNCTION(TCP, getNoDelay);
+				TITANIUM_ADD_FUNCTION(TCP, setNoDelay);
+				TITANIUM_ADD_FUNCTION(TCP, getSendBufferSize);
+				TITANIUM_ADD_FUNCTION(TCP, setSendBufferSize);
+				TITANIUM_ADD_FUNCTION(TCP, getReceiveBufferSize);
+				TITANIUM_ADD_FUNCTION(TCP, setReceiveBufferSize);
 				TITANIUM_ADD_FUNCTION(TCP, getConnected);
 				TITANIUM_ADD_FUNCTION(TCP, setConnected);
 				TITANIUM_ADD_FUNCTION(TCP, getError);
@@ -104,6 +116,15 @@ namespace Titanium
 			TITANIUM_PROPERTY_GETTER_TIME(TCP, timeout)
 			TITANIUM_PROPERTY_SETTER_TIME(TCP, timeout)
 
+			TITANIUM_PROPERTY_GETTER_BOOL(TCP, noDelay)
+			TITANIUM_PROPERTY_SETTER_BOOL(TCP, noDelay)
+
+			TITANIUM_PROPERTY_GETTER_UINT(TCP, sendBufferSize)
+			TITANIUM_PROPERTY_SETTER_UINT(TCP, sendBufferSize)
+
+			TITANIUM_PROPERTY_GETTER_UINT(TCP, receiveBufferSize)
+			TITANIUM_PROPERTY_SETTER_UINT(TCP, receiveBufferSize)
+
 			TITANIUM_PROPERTY_GETTER_ENUM(TCP, state)
 
 			TITANIUM_PROPERTY_GETTER(TCP, connected)
@@ -170,6 +191,12 @@ namespace Titanium
 			TITANIUM_FUNCTION_AS_SETTER(TCP, setListenQueueSize, listenQueueSize)
 			TITANIUM_FUNCTION_AS_GETTER(TCP, getTimeout, timeout)
 			TITANIUM_FUNCTION_AS_SETTER(TCP, setTimeout, timeout)
+			TITANIUM_FUNCTION_AS_GETTER(TCP, getNoDelay, noDelay)
+			TITANIUM_FUNCTION_AS_SETTER(TCP, setNoDelay, noDelay)
+			TITANIUM_FUNCTION_AS_GETTER(TCP, getSendBufferSize, sendBufferSize)
+			TITANIUM_FUNCTION_AS_SETTER(TCP, setSendBufferSize, sendBufferSize)
+			TITANIUM_FUNCTION_AS_GETTER(TCP, getReceiveBufferSize, receiveBufferSize)
+			TITANIUM_FUNCTION_AS_SETTER(TCP, setReceiveBufferSize, receiveBufferSize)
 			TITANIUM_FUNCTION_AS_GETTER(TCP, getConnected, connected)
 			TITANIUM_FUNCTION_AS_SETTER(TCP, setConnected, connected)
 			TITANIUM_FUNCTION_AS_GETTER(TCP, getError, error)
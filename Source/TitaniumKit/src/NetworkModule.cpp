@@ -109,6 +109,11 @@ namespace Titanium
 		TITANIUM_LOG_WARN("NetworkModule::unregisterForPushNotifications: unimplemented");
 	}
 
+	Network::ConnectionPoolStats NetworkModule::getConnectionPoolStats() TITANIUM_NOEXCEPT
+	{
+		return Network::ConnectionPoolStats();
+	}
+
 	TITANIUM_PROPERTY_GETTER(NetworkModule, HTTPClient)
 	{
 		return get_context().CreateObject(httpclient__);
@@ -227,6 +232,7 @@ namespace Titanium
 		TITANIUM_ADD_FUNCTION(NetworkModule, removeSystemCookie);
 		TITANIUM_ADD_FUNCTION(NetworkModule, registerForPushNotifications);
 		TITANIUM_ADD_FUNCTION(NetworkModule, unregisterForPushNotifications);
+		TITANIUM_ADD_FUNCTION(NetworkModule, getConnectionPoolStats);
 		TITANIUM_ADD_FUNCTION(NetworkModule, createCookie);
 		TITANIUM_ADD_FUNCTION(NetworkModule, createHTTPClient);
 		TITANIUM_ADD_FUNCTION(NetworkModule, getAllHTTPCookies);
@@ -398,6 +404,11 @@ namespace Titanium
 		return get_context().CreateUndefined();
 	}
 
+	TITANIUM_FUNCTION(NetworkModule, getConnectionPoolStats)
+	{
+		return Network::ConnectionPoolStats_to_js(get_context(), getConnectionPoolStats());
+	}
+
 	TITANIUM_FUNCTION(NetworkModule, getHTTPCookies)
 	{
 		ENSURE_ARGUMENT_INDEX(2);
@@ -170,7 +170,8 @@ namespace Titanium
 		  scrollableView__(JSExport<Titanium::UI::ScrollableView>::Class()),
 		  searchBar__(JSExport<Titanium::UI::SearchBar>::Class()),
 		  attributedString__(JSExport<Titanium::UI::AttributedString>::Class()),
-	      userAgent__(js_context.CreateString())
+	      userAgent__(js_context.CreateString()),
+	      created_at__(std::chrono::steady_clock::now())
 	{
 		TITANIUM_LOG_DEBUG("TiModule:: ctor ", this);
 	}
@@ -235,199 +236,286 @@ namespace Titanium
 		return "";
 	}
 
+	JSObject TiModule::materialize(const std::string& name, const std::function<JSObject()>& create, const std::function<void(JSObject&)>& setup) const TITANIUM_NOEXCEPT
+	{
+		const auto cached = namespaces__.find(name);
+		if (cached != namespaces__.end()) {
+			return cached->second;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		auto object = create();
+		namespaces__.emplace(name, object);
+		if (setup) {
+			setup(object);
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		const NamespaceMaterialization materialized = {
+			name,
+			std::chrono::duration_cast<std::chrono::microseconds>(start - created_at__),
+			std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+		};
+		materialized__.push_back(materialized);
+		TITANIUM_LOG_DEBUG("TiModule: materialized Ti.", name, " at ", materialized.since_start.count(), "us in ", materialized.duration.count(), "us");
+
+		return object;
+	}
+
+	std::vector<TiModule::NamespaceMaterialization> TiModule::get_materialized_namespaces() const TITANIUM_NOEXCEPT
+	{
+		return materialized__;
+	}
+
 	TITANIUM_PROPERTY_GETTER(TiModule, Accelerometer)
 	{
-		return get_context().CreateObject(accelerometer__);
+		return materialize("Accelerometer", [this] {
+			return get_context().CreateObject(accelerometer__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Analytics)
 	{
-		return get_context().CreateObject(analytics__);
+		return materialize("Analytics", [this] {
+			return get_context().CreateObject(analytics__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, API)
 	{
-		return get_context().CreateObject(api__);
+		return materialize("API", [this] {
+			return get_context().CreateObject(api__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, App)
 	{
-		auto app = get_context().CreateObject(app__);
-		auto app_ptr = app.GetPrivate<Titanium::AppModule>();
-		app_ptr->PropertiesClass(properties__);
-		return app;
+		return materialize("App", [this] {
+			auto app = get_context().CreateObject(app__);
+			auto app_ptr = app.GetPrivate<Titanium::AppModule>();
+			app_ptr->PropertiesClass(properties__);
+			return app;
+		}, [](JSObject& app) {
+			// _app_info_.json and _app_props_.json are only read once Ti.App is used
+			app.GetPrivate<Titanium::AppModule>()->loadAppInfo();
+			static_cast<JSObject>(app.GetProperty("Properties")).GetPrivate<Titanium::App::Properties>()->loadAppProperties();
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Blob)
 	{
-		return get_context().CreateObject(blob__);
+		return materialize("Blob", [this] {
+			return get_context().CreateObject(blob__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, BlobStream)
 	{
-		return get_context().CreateObject(blobstream__);
+		return materialize("BlobStream", [this] {
+			return get_context().CreateObject(blobstream__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Buffer)
 	{
-		return get_context().CreateObject(buffer__);
+		return materialize("Buffer", [this] {
+			return get_context().CreateObject(buffer__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, BufferStream)
 	{
-		return get_context().CreateObject(bufferstream__);
+		return materialize("BufferStream", [this] {
+			return get_context().CreateObject(bufferstream__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Codec)
 	{
-		return get_context().CreateObject(codec__);
+		return materialize("Codec", [this] {
+			return get_context().CreateObject(codec__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Contacts)
 	{
-		auto contacts = get_context().CreateObject(contacts__);
-		auto contacts_ptr = contacts.GetPrivate<Titanium::ContactsModule>();
-		contacts_ptr->GroupClass(group__).PersonClass(person__);
-		return contacts;
+		return materialize("Contacts", [this] {
+			auto contacts = get_context().CreateObject(contacts__);
+			auto contacts_ptr = contacts.GetPrivate<Titanium::ContactsModule>();
+			contacts_ptr->GroupClass(group__).PersonClass(person__);
+			return contacts;
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Database)
 	{
-		return get_context().CreateObject(database__);
+		return materialize("Database", [this] {
+			return get_context().CreateObject(database__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Filesystem)
 	{
-		auto fs = get_context().CreateObject(filesystem__);
-		auto fs_ptr = fs.GetPrivate<Titanium::FilesystemModule>();
+		return materialize("Filesystem", [this] {
+			auto fs = get_context().CreateObject(filesystem__);
+			auto fs_ptr = fs.GetPrivate<Titanium::FilesystemModule>();
 
-		fs_ptr->FileClass(file__).FileStreamClass(filestream__);
+			fs_ptr->FileClass(file__).FileStreamClass(filestream__);
 
-		return fs;
+			return fs;
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Geolocation)
 	{
-		return get_context().CreateObject(geolocation__);
+		return materialize("Geolocation", [this] {
+			return get_context().CreateObject(geolocation__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Gesture)
 	{
-		return get_context().CreateObject(gesture__);
+		return materialize("Gesture", [this] {
+			return get_context().CreateObject(gesture__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, IOStream)
 	{
-		return get_context().CreateObject(iostream__);
+		return materialize("IOStream", [this] {
+			return get_context().CreateObject(iostream__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Locale)
 	{
-		return get_context().CreateObject(locale__);
+		return materialize("Locale", [this] {
+			return get_context().CreateObject(locale__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Map)
 	{
-		auto map = get_context().CreateObject(map__);
-		auto map_ptr = map.GetPrivate<Titanium::MapModule>();
-		map_ptr->AnnotationClass(mapAnnotation__).
-			CameraClass(mapCamera__).
-			RouteClass(mapRoute__).
-			ViewClass(mapView__);
-		return  map;
+		return materialize("Map", [this] {
+			auto map = get_context().CreateObject(map__);
+			auto map_ptr = map.GetPrivate<Titanium::MapModule>();
+			map_ptr->AnnotationClass(mapAnnotation__).
+				CameraClass(mapCamera__).
+				RouteClass(mapRoute__).
+				ViewClass(mapView__);
+			return  map;
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Media)
 	{
-		auto media = get_context().CreateObject(media__);
-		auto media_ptr = media.GetPrivate<Titanium::MediaModule>();
-		media_ptr->AudioPlayerClass(audioplayer__).
-			AudioRecorderClass(audiorecorder__).
-			ItemClass(audioitem__).
-			MusicPlayerClass(musicplayer__).
-			SoundClass(sound__).
-			VideoPlayerClass(videoplayer__);
-		return media;
+		return materialize("Media", [this] {
+			auto media = get_context().CreateObject(media__);
+			auto media_ptr = media.GetPrivate<Titanium::MediaModule>();
+			media_ptr->AudioPlayerClass(audioplayer__).
+				AudioRecorderClass(audiorecorder__).
+				ItemClass(audioitem__).
+				MusicPlayerClass(musicplayer__).
+				SoundClass(sound__).
+				VideoPlayerClass(videoplayer__);
+			return media;
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Network)
 	{
-		const auto ctx = get_context();
-		auto network = ctx.CreateObject(network__);
-		auto network_ptr = network.GetPrivate<Titanium::NetworkModule>();
+		return materialize("Network", [this] {
+			const auto ctx = get_context();
+			auto network = ctx.CreateObject(network__);
+			auto network_ptr = network.GetPrivate<Titanium::NetworkModule>();
 
-		network_ptr->HTTPClientClass(httpclient__).CookieClass(cookie__);
+			network_ptr->HTTPClientClass(httpclient__).CookieClass(cookie__);
 
-		// Create socket instance here, just like ApplicationBuilder does
-		auto socket = ctx.CreateObject(JSExport<Titanium::Network::SocketModule>::Class());
-		auto socket_ptr = socket.GetPrivate<Titanium::Network::SocketModule>();
-		socket_ptr->TCPClass(tcp__).UDPClass(udp__);
-		network.SetProperty("Socket", socket);
+			// Create socket instance here, just like ApplicationBuilder does
+			auto socket = ctx.CreateObject(JSExport<Titanium::Network::SocketModule>::Class());
+			auto socket_ptr = socket.GetPrivate<Titanium::Network::SocketModule>();
+			socket_ptr->TCPClass(tcp__).UDPClass(udp__);
+			network.SetProperty("Socket", socket);
 
-		return network;
+			return network;
+		}, [this](JSObject& network) {
+			auto global_object = get_context().get_global_object();
+			network.SetProperty("encodeURIComponent", global_object.GetProperty("encodeURIComponent"));
+			network.SetProperty("decodeURIComponent", global_object.GetProperty("decodeURIComponent"));
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Platform)
 	{
-		return get_context().CreateObject(platform__);
+		return materialize("Platform", [this] {
+			return get_context().CreateObject(platform__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Stream)
 	{
-		return get_context().CreateObject(stream__);
+		return materialize("Stream", [this] {
+			return get_context().CreateObject(stream__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, UI)
 	{
-		auto ui = get_context().CreateObject(ui__);
-		auto ui_ptr = ui.GetPrivate<Titanium::UIModule>();
-
-		ui_ptr->ListViewClass(listview__).
-			ListSectionClass(listsection__).
-			EmailDialogClass(emaildialog__).
-			AnimationClass(animation__).
-			SwitchClass(switch__).
-			TwoDMatrixClass(twodmatrix__).
-			NotificationClass(notification__).
-			TextAreaClass(textarea__).
-			ClipboardClass(clipboard__).
-			PickerClass(picker__).
-			PickerColumnClass(pickercolumn__).
-			PickerRowClass(pickerrow__).
-			ViewClass(view__).
-			WindowClass(window__).
-			ButtonClass(button__).
-			ImageViewClass(imageview__).
-			LabelClass(label__).
-			SliderClass(slider__).
-			AlertDialogClass(alertDialog__).
-			ScrollViewClass(scrollview__).
-			TextFieldClass(textField__).
-			WebViewClass(webview__).
-			Tab(tab__).
-			TabGroup(tabgroup__).
-			TableViewClass(tableview__).
-			TableViewSectionClass(tableviewsection__).
-			TableViewRowClass(tableviewrow__).
-			ActivityIndicatorClass(activityIndicator__).
-			ActivityIndicatorStyleClass(activityIndicatorStyle__).
-			OptionDialogClass(optionDialog__).
-			ProgressBarClass(progressBar__).
-			ScrollableViewClass(scrollableView__).
-			SearchBarClass(searchBar__).
-			AttributedStringClass(attributedString__);
-
-		return ui;
+		return materialize("UI", [this] {
+			auto ui = get_context().CreateObject(ui__);
+			auto ui_ptr = ui.GetPrivate<Titanium::UIModule>();
+
+			ui_ptr->ListViewClass(listview__).
+				ListSectionClass(listsection__).
+				EmailDialogClass(emaildialog__).
+				AnimationClass(animation__).
+				SwitchClass(switch__).
+				TwoDMatrixClass(twodmatrix__).
+				NotificationClass(notification__).
+				TextAreaClass(textarea__).
+				ClipboardClass(clipboard__).
+				PickerClass(picker__).
+				PickerColumnClass(pickercolumn__).
+				PickerRowClass(pickerrow__).
+				ViewClass(view__).
+				WindowClass(window__).
+				ButtonClass(button__).
+				ImageViewClass(imageview__).
+				LabelClass(label__).
+				SliderClass(slider__).
+				AlertDialogClass(alertDialog__).
+				ScrollViewClass(scrollview__).
+				TextFieldClass(textField__).
+				WebViewClass(webview__).
+				Tab(tab__).
+				TabGroup(tabgroup__).
+				TableViewClass(tableview__).
+				TableViewSectionClass(tableviewsection__).
+				TableViewRowClass(tableviewrow__).
+				ActivityIndicatorClass(activityIndicator__).
+				ActivityIndicatorStyleClass(activityIndicatorStyle__).
+				OptionDialogClass(optionDialog__).
+				ProgressBarClass(progressBar__).
+				ScrollableViewClass(scrollableView__).
+				SearchBarClass(searchBar__).
+				AttributedStringClass(attributedString__);
+
+			return ui;
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, Utils)
 	{
-		return get_context().CreateObject(utils__);
+		return materialize("Utils", [this] {
+			return get_context().CreateObject(utils__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, XML)
 	{
-		return get_context().CreateObject(xml__);
+		return materialize("XML", [this] {
+			return get_context().CreateObject(xml__);
+		});
 	}
 
 	TITANIUM_PROPERTY_GETTER(TiModule, version)
@@ -503,27 +591,21 @@ namespace Titanium
 				  }).show();
 			  };
 
-			  // Load _app_info_.json
-			  Ti.App._loadAppInfo();
-			  // Load _app_props_.json
-			  Ti.App.Properties._loadAppProperties();
-
-			  // Let's set up our user agent in JS, way easier this way...
-			  Ti.userAgent = 'Appcelerator Titanium/' + Ti.version + ' (' + Ti.Platform.model + '/' + Ti.Platform.version + '; ' + Ti.Platform.osname + '; ' + Ti.Platform.locale + ';)';
-
-			  Ti.Network.encodeURIComponent = encodeURIComponent;
-			  Ti.Network.decodeURIComponent = decodeURIComponent;
-
 			  // Start analytics
 			  Ti.Analytics._start();
 
-			  L = Ti.Locale.getString;
+			  L = function (key, hint) {
+				  return Ti.Locale.getString(key, hint);
+			  };
 			} catch (E) {
 			  Ti.API.error("Failed to initialize Titanium: " + E.toString());
 			}
 			)js";
 
 		get_context().JSEvaluateScript(builtin_functions_script);
+
+		// Everything else in Ti is created on first access, see materialize
+		userAgent_default__ = true;
 	}
 
 	TiModule& TiModule::GlobalString(const JSClass& global_string) TITANIUM_NOEXCEPT
@@ -1003,6 +1085,11 @@ namespace Titanium
 
 	TITANIUM_PROPERTY_GETTER(TiModule, userAgent)
 	{
+		if (userAgent_default__) {
+			// Reads Ti.Platform, so wait until somebody asks
+			userAgent_default__ = false;
+			userAgent__ = static_cast<std::string>(get_context().JSEvaluateScript("'Appcelerator Titanium/' + Ti.version + ' (' + Ti.Platform.model + '/' + Ti.Platform.version + '; ' + Ti.Platform.osname + '; ' + Ti.Platform.locale + ';)'"));
+		}
 		return get_context().CreateString(userAgent__);
 	}
 
@@ -1025,6 +1112,7 @@ namespace Titanium
 
 	void TiModule::setUserAgent(const std::string& userAgent) TITANIUM_NOEXCEPT
 	{
+		userAgent_default__ = false;
 		userAgent__ = userAgent;
 	}
 
@@ -8,29 +8,27 @@
 
 #include "Titanium/UI/Constants.hpp"
 #include "Titanium/detail/TiLogger.hpp"
-#include <unordered_map>
-#include <mutex>
+#include "Titanium/detail/TiConstants.hpp"
 
 namespace Titanium
 {
 	namespace UI
 	{
+		static const detail::TiConstant<ANIMATION_CURVE> animationCurveNames[] = {
+			{ ANIMATION_CURVE::EASE_IN,     "ANIMATION_CURVE_EASE_IN" },
+			{ ANIMATION_CURVE::EASE_IN_OUT, "ANIMATION_CURVE_EASE_IN_OUT" },
+			{ ANIMATION_CURVE::EASE_OUT,    "ANIMATION_CURVE_EASE_OUT" },
+			{ ANIMATION_CURVE::LINEAR,      "ANIMATION_CURVE_LINEAR" },
+		};
+
 		std::string Constants::to_string(const ANIMATION_CURVE& animationCurve) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ANIMATION_CURVE::Unknown";
-			static std::unordered_map<ANIMATION_CURVE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[ANIMATION_CURVE::EASE_IN]     = "ANIMATION_CURVE_EASE_IN";
-      map[ANIMATION_CURVE::EASE_IN_OUT] = "ANIMATION_CURVE_EASE_IN_OUT";
-      map[ANIMATION_CURVE::EASE_OUT]    = "ANIMATION_CURVE_EASE_OUT";
-      map[ANIMATION_CURVE::LINEAR]      = "ANIMATION_CURVE_LINEAR";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(animationCurve);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(animationCurveNames, animationCurve);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -38,19 +36,10 @@ namespace Titanium
 
 		ANIMATION_CURVE Constants::to_ANIMATION_CURVE(const std::string& animationCurveName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ANIMATION_CURVE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["ANIMATION_CURVE_EASE_IN"]     = ANIMATION_CURVE::EASE_IN;
-      map["ANIMATION_CURVE_EASE_IN_OUT"] = ANIMATION_CURVE::EASE_IN_OUT;
-      map["ANIMATION_CURVE_EASE_OUT"]    = ANIMATION_CURVE::EASE_OUT;
-      map["ANIMATION_CURVE_LINEAR"]      = ANIMATION_CURVE::LINEAR;
-			});
-
 			ANIMATION_CURVE animationCurve = ANIMATION_CURVE::LINEAR;
-			const auto position = map.find(animationCurveName);
-			if (position != map.end()) {
-				animationCurve = position->second;
+			const auto position = detail::FindConstant(animationCurveNames, animationCurveName);
+			if (position != nullptr) {
+				animationCurve = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANIMATION_CURVE: Titanium::UI::ANIMATION_CURVE with name '", animationCurveName, "' does not exist");
 			}
@@ -60,19 +49,10 @@ namespace Titanium
 
 		ANIMATION_CURVE Constants::to_ANIMATION_CURVE(std::underlying_type<ANIMATION_CURVE>::type animationCurve_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ANIMATION_CURVE>::type, ANIMATION_CURVE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<ANIMATION_CURVE>::type>(ANIMATION_CURVE::EASE_IN)]     = ANIMATION_CURVE::EASE_IN;
-      map[static_cast<std::underlying_type<ANIMATION_CURVE>::type>(ANIMATION_CURVE::EASE_IN_OUT)] = ANIMATION_CURVE::EASE_IN_OUT;
-      map[static_cast<std::underlying_type<ANIMATION_CURVE>::type>(ANIMATION_CURVE::EASE_OUT)]    = ANIMATION_CURVE::EASE_OUT;
-      map[static_cast<std::underlying_type<ANIMATION_CURVE>::type>(ANIMATION_CURVE::LINEAR)]      = ANIMATION_CURVE::LINEAR;
-			});
-
 			ANIMATION_CURVE animationCurve = ANIMATION_CURVE::LINEAR;
-			const auto position = map.find(animationCurve_underlying_type);
-			if (position != map.end()) {
-				animationCurve = position->second;
+			const auto position = detail::FindConstant(animationCurveNames, animationCurve_underlying_type);
+			if (position != nullptr) {
+				animationCurve = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ANIMATION_CURVE: Titanium::UI::ANIMATION_CURVE with value '", animationCurve_underlying_type, "' does not exist");
 			}
@@ -85,25 +65,24 @@ namespace Titanium
 			return static_cast<std::underlying_type<ANIMATION_CURVE>::type>(animationCurve);
 		}
 
+		static const detail::TiConstant<AUTOLINK> autolinkNames[] = {
+			{ AUTOLINK::ALL,             "AUTOLINK_ALL" },
+			{ AUTOLINK::CALENDAR,        "AUTOLINK_CALENDAR" },
+			{ AUTOLINK::EMAIL_ADDRESSES, "AUTOLINK_EMAIL_ADDRESSES" },
+			{ AUTOLINK::MAP_ADDRESSES,   "AUTOLINK_MAP_ADDRESSES" },
+			{ AUTOLINK::NONE,            "AUTOLINK_NONE" },
+			{ AUTOLINK::PHONE_NUMBERS,   "AUTOLINK_PHONE_NUMBERS" },
+			{ AUTOLINK::URLS,            "AUTOLINK_URLS" },
+		};
+
 		std::string Constants::to_string(const AUTOLINK& autoLinkName) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "AUTOLINK::Unknown";
-			static std::unordered_map<AUTOLINK, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[AUTOLINK::ALL]             = "AUTOLINK_ALL";
-      map[AUTOLINK::CALENDAR]        = "AUTOLINK_CALENDAR";
-      map[AUTOLINK::EMAIL_ADDRESSES] = "AUTOLINK_EMAIL_ADDRESSES";
-      map[AUTOLINK::MAP_ADDRESSES]   = "AUTOLINK_MAP_ADDRESSES";
-      map[AUTOLINK::NONE]            = "AUTOLINK_NONE";
-      map[AUTOLINK::PHONE_NUMBERS]   = "AUTOLINK_PHONE_NUMBERS";
-      map[AUTOLINK::URLS]            = "AUTOLINK_URLS";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(autoLinkName);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(autolinkNames, autoLinkName);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -111,22 +90,10 @@ namespace Titanium
 
 		AUTOLINK Constants::to_AUTOLINK(const std::string& autoLinkName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, AUTOLINK> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["AUTOLINK_ALL"]             = AUTOLINK::ALL;
-      map["AUTOLINK_CALENDAR"]        = AUTOLINK::CALENDAR;
-      map["AUTOLINK_EMAIL_ADDRESSES"] = AUTOLINK::EMAIL_ADDRESSES;
-      map["AUTOLINK_MAP_ADDRESSES"]   = AUTOLINK::MAP_ADDRESSES;
-      map["AUTOLINK_NONE"]            = AUTOLINK::NONE;
-      map["AUTOLINK_PHONE_NUMBERS"]   = AUTOLINK::PHONE_NUMBERS;
-      map["AUTOLINK_URLS"]            = AUTOLINK::URLS;
-			});
-
 			AUTOLINK autoLink = AUTOLINK::NONE;
-			const auto position = map.find(autoLinkName);
-			if (position != map.end()) {
-				autoLink = position->second;
+			const auto position = detail::FindConstant(autolinkNames, autoLinkName);
+			if (position != nullptr) {
+				autoLink = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_AUTOLINK: Titanium::UI::AUTOLINK with name '", autoLinkName, "' does not exist");
 			}
@@ -162,24 +129,23 @@ namespace Titanium
 			return static_cast<std::underlying_type<AUTOLINK>::type>(autoLink);
 		}
 
+		static const detail::TiConstant<EXTEND_EDGE> extendEdgeNames[] = {
+			{ EXTEND_EDGE::ALL,    "EXTEND_EDGE_ALL" },
+			{ EXTEND_EDGE::BOTTOM, "EXTEND_EDGE_BOTTOM" },
+			{ EXTEND_EDGE::LEFT,   "EXTEND_EDGE_LEFT" },
+			{ EXTEND_EDGE::NONE,   "EXTEND_EDGE_NONE" },
+			{ EXTEND_EDGE::RIGHT,  "EXTEND_EDGE_RIGHT" },
+			{ EXTEND_EDGE::TOP,    "EXTEND_EDGE_TOP" },
+		};
+
 		std::string Constants::to_string(const EXTEND_EDGE& extendEdge) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "EXTEND_EDGE::Unknown";
-			static std::unordered_map<EXTEND_EDGE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[EXTEND_EDGE::ALL]    = "EXTEND_EDGE_ALL";
-      map[EXTEND_EDGE::BOTTOM] = "EXTEND_EDGE_BOTTOM";
-      map[EXTEND_EDGE::LEFT]   = "EXTEND_EDGE_LEFT";
-      map[EXTEND_EDGE::NONE]   = "EXTEND_EDGE_NONE";
-      map[EXTEND_EDGE::RIGHT]  = "EXTEND_EDGE_RIGHT";
-      map[EXTEND_EDGE::TOP]    = "EXTEND_EDGE_TOP";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(extendEdge);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(extendEdgeNames, extendEdge);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -187,21 +153,10 @@ namespace Titanium
 
 		EXTEND_EDGE Constants::to_EXTEND_EDGE(const std::string& extendEdgeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, EXTEND_EDGE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["EXTEND_EDGE_ALL"]    = EXTEND_EDGE::ALL;
-      map["EXTEND_EDGE_BOTTOM"] = EXTEND_EDGE::BOTTOM;
-      map["EXTEND_EDGE_LEFT"]   = EXTEND_EDGE::LEFT;
-      map["EXTEND_EDGE_NONE"]   = EXTEND_EDGE::NONE;
-      map["EXTEND_EDGE_RIGHT"]  = EXTEND_EDGE::RIGHT;
-      map["EXTEND_EDGE_TOP"]    = EXTEND_EDGE::TOP;
-			});
-
 			EXTEND_EDGE extendEdge = EXTEND_EDGE::NONE;
-			const auto position = map.find(extendEdgeName);
-			if (position != map.end()) {
-				extendEdge = position->second;
+			const auto position = detail::FindConstant(extendEdgeNames, extendEdgeName);
+			if (position != nullptr) {
+				extendEdge = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_EXTEND_EDGE: Titanium::UI::EXTEND_EDGE with name '", extendEdgeName, "' does not exist");
 			}
@@ -236,25 +191,24 @@ namespace Titanium
 			return static_cast<std::underlying_type<EXTEND_EDGE>::type>(extendEdge);
 		}
 
+		static const detail::TiConstant<ORIENTATION> orientationNames[] = {
+			{ ORIENTATION::FACE_DOWN,       "ORIENTATION_FACE_DOWN" },
+			{ ORIENTATION::FACE_UP,         "ORIENTATION_FACE_UP" },
+			{ ORIENTATION::LANDSCAPE_LEFT,  "ORIENTATION_LANDSCAPE_LEFT" },
+			{ ORIENTATION::LANDSCAPE_RIGHT, "ORIENTATION_LANDSCAPE_RIGHT" },
+			{ ORIENTATION::PORTRAIT,        "ORIENTATION_PORTRAIT" },
+			{ ORIENTATION::UNKNOWN,         "ORIENTATION_UNKNOWN" },
+			{ ORIENTATION::UPSIDE_PORTRAIT, "ORIENTATION_UPSIDE_PORTRAIT" },
+		};
+
 		std::string Constants::to_string(const ORIENTATION& orientation) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ORIENTATION::Unknown";
-			static std::unordered_map<ORIENTATION, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[ORIENTATION::PORTRAIT]        = "ORIENTATION_PORTRAIT";
-      map[ORIENTATION::UPSIDE_PORTRAIT] = "ORIENTATION_UPSIDE_PORTRAIT";
-      map[ORIENTATION::LANDSCAPE_LEFT]  = "ORIENTATION_LANDSCAPE_LEFT";
-      map[ORIENTATION::LANDSCAPE_RIGHT] = "ORIENTATION_LANDSCAPE_RIGHT";
-      map[ORIENTATION::FACE_UP]         = "ORIENTATION_FACE_UP";
-      map[ORIENTATION::FACE_DOWN]       = "ORIENTATION_FACE_DOWN";
-      map[ORIENTATION::UNKNOWN]         = "ORIENTATION_UNKNOWN";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(orientation);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(orientationNames, orientation);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -262,22 +216,10 @@ namespace Titanium
 
 		ORIENTATION Constants::to_ORIENTATION(const std::string& orientationName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ORIENTATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["ORIENTATION_PORTRAIT"]        = ORIENTATION::PORTRAIT;
-      map["ORIENTATION_UPSIDE_PORTRAIT"] = ORIENTATION::UPSIDE_PORTRAIT;
-      map["ORIENTATION_LANDSCAPE_LEFT"]  = ORIENTATION::LANDSCAPE_LEFT;
-      map["ORIENTATION_LANDSCAPE_RIGHT"] = ORIENTATION::LANDSCAPE_RIGHT;
-      map["ORIENTATION_FACE_UP"]         = ORIENTATION::FACE_UP;
-      map["ORIENTATION_FACE_DOWN"]       = ORIENTATION::FACE_DOWN;
-      map["ORIENTATION_UNKNOWN"]         = ORIENTATION::UNKNOWN;
-			});
-
 			ORIENTATION orientation = ORIENTATION::UNKNOWN;
-			const auto position = map.find(orientationName);
-			if (position != map.end()) {
-				orientation = position->second;
+			const auto position = detail::FindConstant(orientationNames, orientationName);
+			if (position != nullptr) {
+				orientation = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ORIENTATION: Titanium::UI::ORIENTATION with name '", orientationName, "' does not exist");
 			}
@@ -287,22 +229,10 @@ namespace Titanium
 
 		ORIENTATION Constants::to_ORIENTATION(std::underlying_type<ORIENTATION>::type orientation_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ORIENTATION>::type, ORIENTATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::PORTRAIT)]        = ORIENTATION::PORTRAIT;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::UPSIDE_PORTRAIT)] = ORIENTATION::UPSIDE_PORTRAIT;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::LANDSCAPE_LEFT)]  = ORIENTATION::LANDSCAPE_LEFT;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::LANDSCAPE_RIGHT)] = ORIENTATION::LANDSCAPE_RIGHT;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::FACE_UP)]         = ORIENTATION::FACE_UP;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::FACE_DOWN)]       = ORIENTATION::FACE_DOWN;
-      map[static_cast<std::underlying_type<ORIENTATION>::type>(ORIENTATION::UNKNOWN)]         = ORIENTATION::UNKNOWN;
-			});
-
 			ORIENTATION orientation = ORIENTATION::UNKNOWN;
-			const auto position = map.find(orientation_underlying_type);
-			if (position != map.end()) {
-				orientation = position->second;
+			const auto position = detail::FindConstant(orientationNames, orientation_underlying_type);
+			if (position != nullptr) {
+				orientation = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ORIENTATION: Titanium::UI::ORIENTATION with value '", orientation_underlying_type, "' does not exist");
 			}
@@ -315,22 +245,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<ORIENTATION>::type>(orientation);
 		}
 
+		static const detail::TiConstant<INPUT_BORDERSTYLE> inputBorderstyleNames[] = {
+			{ INPUT_BORDERSTYLE::BEZEL,   "INPUT_BORDERSTYLE_BEZEL" },
+			{ INPUT_BORDERSTYLE::LINE,    "INPUT_BORDERSTYLE_LINE" },
+			{ INPUT_BORDERSTYLE::NONE,    "INPUT_BORDERSTYLE_NONE" },
+			{ INPUT_BORDERSTYLE::ROUNDED, "INPUT_BORDERSTYLE_ROUNDED" },
+		};
+
 		std::string Constants::to_string(const INPUT_BORDERSTYLE& inputBorderstyle) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "INPUT_BORDERSTYLE::Unknown";
-			static std::unordered_map<INPUT_BORDERSTYLE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[INPUT_BORDERSTYLE::BEZEL]   = "INPUT_BORDERSTYLE_BEZEL";
-      map[INPUT_BORDERSTYLE::LINE]    = "INPUT_BORDERSTYLE_LINE";
-      map[INPUT_BORDERSTYLE::NONE]    = "INPUT_BORDERSTYLE_NONE";
-      map[INPUT_BORDERSTYLE::ROUNDED] = "INPUT_BORDERSTYLE_ROUNDED";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(inputBorderstyle);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(inputBorderstyleNames, inputBorderstyle);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -338,19 +267,10 @@ namespace Titanium
 
 		INPUT_BORDERSTYLE Constants::to_INPUT_BORDERSTYLE(const std::string& inputBorderStyleName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, INPUT_BORDERSTYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["INPUT_BORDERSTYLE_BEZEL"]   = INPUT_BORDERSTYLE::BEZEL;
-      map["INPUT_BORDERSTYLE_LINE"]    = INPUT_BORDERSTYLE::LINE;
-      map["INPUT_BORDERSTYLE_NONE"]    = INPUT_BORDERSTYLE::NONE;
-      map["INPUT_BORDERSTYLE_ROUNDED"] = INPUT_BORDERSTYLE::ROUNDED;
-			});
-
 			INPUT_BORDERSTYLE inputBorderStyle = INPUT_BORDERSTYLE::NONE;
-			const auto position = map.find(inputBorderStyleName);
-			if (position != map.end()) {
-				inputBorderStyle = position->second;
+			const auto position = detail::FindConstant(inputBorderstyleNames, inputBorderStyleName);
+			if (position != nullptr) {
+				inputBorderStyle = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_INPUT_BORDERSTYLE: Titanium::UI::INPUT_BORDERSTYLE with name '", inputBorderStyleName, "' does not exist");
 			}
@@ -360,19 +280,10 @@ namespace Titanium
 
 		INPUT_BORDERSTYLE Constants::to_INPUT_BORDERSTYLE(std::underlying_type<INPUT_BORDERSTYLE>::type inputBorderStyle_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<INPUT_BORDERSTYLE>::type, INPUT_BORDERSTYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<INPUT_BORDERSTYLE>::type>(INPUT_BORDERSTYLE::BEZEL)]   = INPUT_BORDERSTYLE::BEZEL;
-      map[static_cast<std::underlying_type<INPUT_BORDERSTYLE>::type>(INPUT_BORDERSTYLE::LINE)]    = INPUT_BORDERSTYLE::LINE;
-      map[static_cast<std::underlying_type<INPUT_BORDERSTYLE>::type>(INPUT_BORDERSTYLE::NONE)]    = INPUT_BORDERSTYLE::NONE;
-      map[static_cast<std::underlying_type<INPUT_BORDERSTYLE>::type>(INPUT_BORDERSTYLE::ROUNDED)] = INPUT_BORDERSTYLE::ROUNDED;
-			});
-
 			INPUT_BORDERSTYLE inputBorderStyle = INPUT_BORDERSTYLE::NONE;
-			const auto position = map.find(inputBorderStyle_underlying_type);
-			if (position != map.end()) {
-				inputBorderStyle = position->second;
+			const auto position = detail::FindConstant(inputBorderstyleNames, inputBorderStyle_underlying_type);
+			if (position != nullptr) {
+				inputBorderStyle = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_INPUT_BORDERSTYLE: Titanium::UI::INPUT_BORDERSTYLE with value '", inputBorderStyle_underlying_type, "' does not exist");
 			}
@@ -385,22 +296,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<INPUT_BORDERSTYLE>::type>(inputBorderStyle);
 		}
 
+		static const detail::TiConstant<INPUT_BUTTONMODE> inputButtonmodeNames[] = {
+			{ INPUT_BUTTONMODE::ALWAYS,  "INPUT_BUTTONMODE_ALWAYS" },
+			{ INPUT_BUTTONMODE::NEVER,   "INPUT_BUTTONMODE_NEVER" },
+			{ INPUT_BUTTONMODE::ONBLUR,  "INPUT_BUTTONMODE_ONBLUR" },
+			{ INPUT_BUTTONMODE::ONFOCUS, "INPUT_BUTTONMODE_ONFOCUS" },
+		};
+
 		std::string Constants::to_string(const INPUT_BUTTONMODE& inputButtonMode) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "INPUT_BUTTONMODE::Unknown";
-			static std::unordered_map<INPUT_BUTTONMODE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[INPUT_BUTTONMODE::ALWAYS]  = "INPUT_BUTTONMODE_ALWAYS";
-      map[INPUT_BUTTONMODE::NEVER]   = "INPUT_BUTTONMODE_NEVER";
-      map[INPUT_BUTTONMODE::ONBLUR]  = "INPUT_BUTTONMODE_ONBLUR";
-      map[INPUT_BUTTONMODE::ONFOCUS] = "INPUT_BUTTONMODE_ONFOCUS";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(inputButtonMode);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(inputButtonmodeNames, inputButtonMode);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -408,19 +318,10 @@ namespace Titanium
 
 		INPUT_BUTTONMODE Constants::to_INPUT_BUTTONMODE(const std::string& inputButtonModeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, INPUT_BUTTONMODE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["INPUT_BUTTONMODE_ALWAYS"]  = INPUT_BUTTONMODE::ALWAYS;
-      map["INPUT_BUTTONMODE_NEVER"]   = INPUT_BUTTONMODE::NEVER;
-      map["INPUT_BUTTONMODE_ONBLUR"]  = INPUT_BUTTONMODE::ONBLUR;
-      map["INPUT_BUTTONMODE_ONFOCUS"] = INPUT_BUTTONMODE::ONFOCUS;
-			});
-
 			INPUT_BUTTONMODE inputButtonMode = INPUT_BUTTONMODE::NEVER;
-			const auto position = map.find(inputButtonModeName);
-			if (position != map.end()) {
-				inputButtonMode = position->second;
+			const auto position = detail::FindConstant(inputButtonmodeNames, inputButtonModeName);
+			if (position != nullptr) {
+				inputButtonMode = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_INPUT_BUTTONMODE: Titanium::UI::INPUT_BUTTONMODE with name '", inputButtonModeName, "' does not exist");
 			}
@@ -430,19 +331,10 @@ namespace Titanium
 
 		INPUT_BUTTONMODE Constants::to_INPUT_BUTTONMODE(std::underlying_type<INPUT_BUTTONMODE>::type inputButtonMode_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<INPUT_BUTTONMODE>::type, INPUT_BUTTONMODE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<INPUT_BUTTONMODE>::type>(INPUT_BUTTONMODE::ALWAYS)]  = INPUT_BUTTONMODE::ALWAYS;
-      map[static_cast<std::underlying_type<INPUT_BUTTONMODE>::type>(INPUT_BUTTONMODE::NEVER)]   = INPUT_BUTTONMODE::NEVER;
-      map[static_cast<std::underlying_type<INPUT_BUTTONMODE>::type>(INPUT_BUTTONMODE::ONBLUR)]  = INPUT_BUTTONMODE::ONBLUR;
-      map[static_cast<std::underlying_type<INPUT_BUTTONMODE>::type>(INPUT_BUTTONMODE::ONFOCUS)] = INPUT_BUTTONMODE::ONFOCUS;
-			});
-
 			INPUT_BUTTONMODE inputButtonMode = INPUT_BUTTONMODE::NEVER;
-			const auto position = map.find(inputButtonMode_underlying_type);
-			if (position != map.end()) {
-				inputButtonMode = position->second;
+			const auto position = detail::FindConstant(inputButtonmodeNames, inputButtonMode_underlying_type);
+			if (position != nullptr) {
+				inputButtonMode = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_INPUT_BUTTONMODE: Titanium::UI::INPUT_BUTTONMODE with value '", inputButtonMode_underlying_type, "' does not exist");
 			}
@@ -455,22 +347,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<INPUT_BUTTONMODE>::type>(inputButtonMode);
 		}
 
+		static const detail::TiConstant<KEYBOARD_APPEARANCE> keyboardAppearanceNames[] = {
+			{ KEYBOARD_APPEARANCE::ALERT,   "KEYBOARD_APPEARANCE_ALERT" },
+			{ KEYBOARD_APPEARANCE::DARK,    "KEYBOARD_APPEARANCE_DARK" },
+			{ KEYBOARD_APPEARANCE::DEFAULT, "KEYBOARD_APPEARANCE_DEFAULT" },
+			{ KEYBOARD_APPEARANCE::LIGHT,   "KEYBOARD_APPEARANCE_LIGHT" },
+		};
+
 		std::string Constants::to_string(const KEYBOARD_APPEARANCE& keyboardAppearance) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "KEYBOARD_APPEARANCE_DEFAULT";
-			static std::unordered_map<KEYBOARD_APPEARANCE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[KEYBOARD_APPEARANCE::ALERT]   = "KEYBOARD_APPEARANCE_ALERT";
-      map[KEYBOARD_APPEARANCE::DEFAULT] = "KEYBOARD_APPEARANCE_DEFAULT";
-      map[KEYBOARD_APPEARANCE::DARK]    = "KEYBOARD_APPEARANCE_DARK";
-      map[KEYBOARD_APPEARANCE::LIGHT]   = "KEYBOARD_APPEARANCE_LIGHT";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(keyboardAppearance);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(keyboardAppearanceNames, keyboardAppearance);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -478,19 +369,10 @@ namespace Titanium
 
 		KEYBOARD_APPEARANCE Constants::to_KEYBOARD_APPEARANCE(const std::string& keyboardAppearanceName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, KEYBOARD_APPEARANCE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["KEYBOARD_APPEARANCE_ALERT"]   = KEYBOARD_APPEARANCE::ALERT;
-      map["KEYBOARD_APPEARANCE_DEFAULT"] = KEYBOARD_APPEARANCE::DEFAULT;
-      map["KEYBOARD_APPEARANCE_DARK"]    = KEYBOARD_APPEARANCE::DARK;
-      map["KEYBOARD_APPEARANCE_LIGHT"]   = KEYBOARD_APPEARANCE::LIGHT;
-			});
-
 			KEYBOARD_APPEARANCE keyboardAppearance = KEYBOARD_APPEARANCE::DEFAULT;
-			const auto position = map.find(keyboardAppearanceName);
-			if (position != map.end()) {
-				keyboardAppearance = position->second;
+			const auto position = detail::FindConstant(keyboardAppearanceNames, keyboardAppearanceName);
+			if (position != nullptr) {
+				keyboardAppearance = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KEYBOARD_APPEARANCE: Titanium::UI::KEYBOARD_APPEARANCE with name '", keyboardAppearanceName, "' does not exist");
 			}
@@ -500,19 +382,10 @@ namespace Titanium
 
 		KEYBOARD_APPEARANCE Constants::to_KEYBOARD_APPEARANCE(std::underlying_type<KEYBOARD_APPEARANCE>::type keyboardAppearance_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<KEYBOARD_APPEARANCE>::type, KEYBOARD_APPEARANCE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<KEYBOARD_APPEARANCE>::type>(KEYBOARD_APPEARANCE::ALERT)]   = KEYBOARD_APPEARANCE::ALERT;
-      map[static_cast<std::underlying_type<KEYBOARD_APPEARANCE>::type>(KEYBOARD_APPEARANCE::DEFAULT)] = KEYBOARD_APPEARANCE::DEFAULT;
-      map[static_cast<std::underlying_type<KEYBOARD_APPEARANCE>::type>(KEYBOARD_APPEARANCE::DARK)]    = KEYBOARD_APPEARANCE::DARK;
-      map[static_cast<std::underlying_type<KEYBOARD_APPEARANCE>::type>(KEYBOARD_APPEARANCE::LIGHT)]   = KEYBOARD_APPEARANCE::LIGHT;
-			});
-
 			KEYBOARD_APPEARANCE keyboardAppearance = KEYBOARD_APPEARANCE::DEFAULT;
-			const auto position = map.find(keyboardAppearance_underlying_type);
-			if (position != map.end()) {
-				keyboardAppearance = position->second;
+			const auto position = detail::FindConstant(keyboardAppearanceNames, keyboardAppearance_underlying_type);
+			if (position != nullptr) {
+				keyboardAppearance = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KEYBOARD_APPEARANCE: Titanium::UI::KEYBOARD_APPEARANCE with value '", keyboardAppearance_underlying_type, "' does not exist");
 			}
@@ -525,29 +398,28 @@ namespace Titanium
 			return static_cast<std::underlying_type<KEYBOARD_APPEARANCE>::type>(keyboardAppearance);
 		}
 
+		static const detail::TiConstant<KEYBOARD> keyboardNames[] = {
+			{ KEYBOARD::ASCII,               "KEYBOARD_ASCII" },
+			{ KEYBOARD::DECIMAL_PAD,         "KEYBOARD_DECIMAL_PAD" },
+			{ KEYBOARD::DEFAULT,             "KEYBOARD_DEFAULT" },
+			{ KEYBOARD::EMAIL,               "KEYBOARD_EMAIL" },
+			{ KEYBOARD::NAMEPHONE_PAD,       "KEYBOARD_NAMEPHONE_PAD" },
+			{ KEYBOARD::NUMBERS_PUNCTUATION, "KEYBOARD_NUMBERS_PUNCTUATION" },
+			{ KEYBOARD::NUMBER_PAD,          "KEYBOARD_NUMBER_PAD" },
+			{ KEYBOARD::PHONE_PAD,           "KEYBOARD_PHONE_PAD" },
+			{ KEYBOARD::TWITTER,             "KEYBOARD_TWITTER" },
+			{ KEYBOARD::URL,                 "KEYBOARD_URL" },
+			{ KEYBOARD::WEBSEARCH,           "KEYBOARD_WEBSEARCH" },
+		};
+
 		std::string Constants::to_string(const KEYBOARD& keyboard) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "KEYBOARD::Unknown";
-			static std::unordered_map<KEYBOARD, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[KEYBOARD::ASCII]               = "KEYBOARD_ASCII";
-      map[KEYBOARD::DECIMAL_PAD]         = "KEYBOARD_DECIMAL_PAD";
-      map[KEYBOARD::EMAIL]               = "KEYBOARD_EMAIL";
-      map[KEYBOARD::NAMEPHONE_PAD]       = "KEYBOARD_NAMEPHONE_PAD";
-      map[KEYBOARD::NUMBERS_PUNCTUATION] = "KEYBOARD_NUMBERS_PUNCTUATION";
-      map[KEYBOARD::NUMBER_PAD]          = "KEYBOARD_NUMBER_PAD";
-      map[KEYBOARD::PHONE_PAD]           = "KEYBOARD_PHONE_PAD";
-      map[KEYBOARD::DEFAULT]             = "KEYBOARD_DEFAULT";
-      map[KEYBOARD::WEBSEARCH]           = "KEYBOARD_WEBSEARCH";
-      map[KEYBOARD::TWITTER]             = "KEYBOARD_TWITTER";
-      map[KEYBOARD::URL]                 = "KEYBOARD_URL";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(keyboard);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(keyboardNames, keyboard);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -555,26 +427,10 @@ namespace Titanium
 
 		KEYBOARD Constants::to_KEYBOARD(const std::string& keyboardName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, KEYBOARD> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["KEYBOARD_ASCII"]               = KEYBOARD::ASCII;
-      map["KEYBOARD_DECIMAL_PAD"]         = KEYBOARD::DECIMAL_PAD;
-      map["KEYBOARD_EMAIL"]               = KEYBOARD::EMAIL;
-      map["KEYBOARD_NAMEPHONE_PAD"]       = KEYBOARD::NAMEPHONE_PAD;
-      map["KEYBOARD_NUMBERS_PUNCTUATION"] = KEYBOARD::NUMBERS_PUNCTUATION;
-      map["KEYBOARD_NUMBER_PAD"]          = KEYBOARD::NUMBER_PAD;
-      map["KEYBOARD_PHONE_PAD"]           = KEYBOARD::PHONE_PAD;
-      map["KEYBOARD_DEFAULT"]             = KEYBOARD::DEFAULT;
-      map["KEYBOARD_WEBSEARCH"]           = KEYBOARD::WEBSEARCH;
-      map["KEYBOARD_TWITTER"]             = KEYBOARD::TWITTER;
-      map["KEYBOARD_URL"]                 = KEYBOARD::URL;
-			});
-
 			KEYBOARD keyboard = KEYBOARD::DEFAULT;
-			const auto position = map.find(keyboardName);
-			if (position != map.end()) {
-				keyboard = position->second;
+			const auto position = detail::FindConstant(keyboardNames, keyboardName);
+			if (position != nullptr) {
+				keyboard = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KEYBOARD: Titanium::UI::KEYBOARD with name '", keyboardName, "' does not exist");
 			}
@@ -584,26 +440,10 @@ namespace Titanium
 
 		KEYBOARD Constants::to_KEYBOARD(std::underlying_type<KEYBOARD>::type keyboard_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<KEYBOARD>::type, KEYBOARD> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::ASCII)]               = KEYBOARD::ASCII;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::DECIMAL_PAD)]         = KEYBOARD::DECIMAL_PAD;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::EMAIL)]               = KEYBOARD::EMAIL;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::NAMEPHONE_PAD)]       = KEYBOARD::NAMEPHONE_PAD;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::NUMBERS_PUNCTUATION)] = KEYBOARD::NUMBERS_PUNCTUATION;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::NUMBER_PAD)]          = KEYBOARD::NUMBER_PAD;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::PHONE_PAD)]           = KEYBOARD::PHONE_PAD;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::DEFAULT)]             = KEYBOARD::DEFAULT;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::WEBSEARCH)]           = KEYBOARD::WEBSEARCH;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::TWITTER)]             = KEYBOARD::TWITTER;
-      map[static_cast<std::underlying_type<KEYBOARD>::type>(KEYBOARD::URL)]                 = KEYBOARD::URL;
-			});
-
 			KEYBOARD keyboard = KEYBOARD::DEFAULT;
-			const auto position = map.find(keyboard_underlying_type);
-			if (position != map.end()) {
-				keyboard = position->second;
+			const auto position = detail::FindConstant(keyboardNames, keyboard_underlying_type);
+			if (position != nullptr) {
+				keyboard = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_KEYBOARD: Titanium::UI::KEYBOARD with value '", keyboard_underlying_type, "' does not exist");
 			}
@@ -616,22 +456,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<KEYBOARD>::type>(keyboard);
 		}
 
+		static const detail::TiConstant<LIST_ACCESSORY_TYPE> listAccessoryTypeNames[] = {
+			{ LIST_ACCESSORY_TYPE::CHECKMARK,  "LIST_ACCESSORY_TYPE_CHECKMARK" },
+			{ LIST_ACCESSORY_TYPE::DETAIL,     "LIST_ACCESSORY_TYPE_DETAIL" },
+			{ LIST_ACCESSORY_TYPE::DISCLOSURE, "LIST_ACCESSORY_TYPE_DISCLOSURE" },
+			{ LIST_ACCESSORY_TYPE::NONE,       "LIST_ACCESSORY_TYPE_NONE" },
+		};
+
 		std::string Constants::to_string(const LIST_ACCESSORY_TYPE& listAccessoryType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "LIST_ACCESSORY_TYPE::Unknown";
-			static std::unordered_map<LIST_ACCESSORY_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[LIST_ACCESSORY_TYPE::CHECKMARK]  = "LIST_ACCESSORY_TYPE_CHECKMARK";
-      map[LIST_ACCESSORY_TYPE::DETAIL]     = "LIST_ACCESSORY_TYPE_DETAIL";
-      map[LIST_ACCESSORY_TYPE::DISCLOSURE] = "LIST_ACCESSORY_TYPE_DISCLOSURE";
-      map[LIST_ACCESSORY_TYPE::NONE]       = "LIST_ACCESSORY_TYPE_NONE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(listAccessoryType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(listAccessoryTypeNames, listAccessoryType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -639,19 +478,10 @@ namespace Titanium
 
 		LIST_ACCESSORY_TYPE Constants::to_LIST_ACCESSORY_TYPE(const std::string& listAccessoryTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, LIST_ACCESSORY_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["LIST_ACCESSORY_TYPE_CHECKMARK"]  = LIST_ACCESSORY_TYPE::CHECKMARK;
-      map["LIST_ACCESSORY_TYPE_DETAIL"]     = LIST_ACCESSORY_TYPE::DETAIL;
-      map["LIST_ACCESSORY_TYPE_DISCLOSURE"] = LIST_ACCESSORY_TYPE::DISCLOSURE;
-      map["LIST_ACCESSORY_TYPE_NONE"]       = LIST_ACCESSORY_TYPE::NONE;
-			});
-
 			LIST_ACCESSORY_TYPE listAccessoryType = LIST_ACCESSORY_TYPE::NONE;
-			const auto position = map.find(listAccessoryTypeName);
-			if (position != map.end()) {
-				listAccessoryType = position->second;
+			const auto position = detail::FindConstant(listAccessoryTypeNames, listAccessoryTypeName);
+			if (position != nullptr) {
+				listAccessoryType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LIST_ACCESSORY_TYPE: Titanium::UI::LIST_ACCESSORY_TYPE with name '", listAccessoryTypeName, "' does not exist");
 			}
@@ -661,19 +491,10 @@ namespace Titanium
 
 		LIST_ACCESSORY_TYPE Constants::to_LIST_ACCESSORY_TYPE(std::underlying_type<LIST_ACCESSORY_TYPE>::type listAccessoryType_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<LIST_ACCESSORY_TYPE>::type, LIST_ACCESSORY_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<LIST_ACCESSORY_TYPE>::type>(LIST_ACCESSORY_TYPE::CHECKMARK)]  = LIST_ACCESSORY_TYPE::CHECKMARK;
-      map[static_cast<std::underlying_type<LIST_ACCESSORY_TYPE>::type>(LIST_ACCESSORY_TYPE::DETAIL)]     = LIST_ACCESSORY_TYPE::DETAIL;
-      map[static_cast<std::underlying_type<LIST_ACCESSORY_TYPE>::type>(LIST_ACCESSORY_TYPE::DISCLOSURE)] = LIST_ACCESSORY_TYPE::DISCLOSURE;
-      map[static_cast<std::underlying_type<LIST_ACCESSORY_TYPE>::type>(LIST_ACCESSORY_TYPE::NONE)]       = LIST_ACCESSORY_TYPE::NONE;
-			});
-
 			LIST_ACCESSORY_TYPE listAccessoryType = LIST_ACCESSORY_TYPE::NONE;
-			const auto position = map.find(listAccessoryType_underlying_type);
-			if (position != map.end()) {
-				listAccessoryType = position->second;
+			const auto position = detail::FindConstant(listAccessoryTypeNames, listAccessoryType_underlying_type);
+			if (position != nullptr) {
+				listAccessoryType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LIST_ACCESSORY_TYPE: Titanium::UI::LIST_ACCESSORY_TYPE with value '", listAccessoryType_underlying_type, "' does not exist");
 			}
@@ -686,22 +507,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<LIST_ACCESSORY_TYPE>::type>(listAccessoryType);
 		}
 
+		static const detail::TiConstant<LIST_ITEM_TEMPLATE> listItemTemplateNames[] = {
+			{ LIST_ITEM_TEMPLATE::CONTACTS, "LIST_ITEM_TEMPLATE_CONTACTS" },
+			{ LIST_ITEM_TEMPLATE::DEFAULT,  "LIST_ITEM_TEMPLATE_DEFAULT" },
+			{ LIST_ITEM_TEMPLATE::SETTINGS, "LIST_ITEM_TEMPLATE_SETTINGS" },
+			{ LIST_ITEM_TEMPLATE::SUBTITLE, "LIST_ITEM_TEMPLATE_SUBTITLE" },
+		};
+
 		std::string Constants::to_string(const LIST_ITEM_TEMPLATE& listItemTemplate) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "LIST_ITEM_TEMPLATE::Unknown";
-			static std::unordered_map<LIST_ITEM_TEMPLATE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[LIST_ITEM_TEMPLATE::CONTACTS] = "LIST_ITEM_TEMPLATE_CONTACTS";
-      map[LIST_ITEM_TEMPLATE::DEFAULT]  = "LIST_ITEM_TEMPLATE_DEFAULT";
-      map[LIST_ITEM_TEMPLATE::SETTINGS] = "LIST_ITEM_TEMPLATE_SETTINGS";
-      map[LIST_ITEM_TEMPLATE::SUBTITLE] = "LIST_ITEM_TEMPLATE_SUBTITLE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(listItemTemplate);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(listItemTemplateNames, listItemTemplate);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -709,19 +529,10 @@ namespace Titanium
 
 		LIST_ITEM_TEMPLATE Constants::to_LIST_ITEM_TEMPLATE(const std::string& listItemTemplateName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, LIST_ITEM_TEMPLATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["LIST_ITEM_TEMPLATE_CONTACTS"] = LIST_ITEM_TEMPLATE::CONTACTS;
-      map["LIST_ITEM_TEMPLATE_DEFAULT"]  = LIST_ITEM_TEMPLATE::DEFAULT;
-      map["LIST_ITEM_TEMPLATE_SETTINGS"] = LIST_ITEM_TEMPLATE::SETTINGS;
-      map["LIST_ITEM_TEMPLATE_SUBTITLE"] = LIST_ITEM_TEMPLATE::SUBTITLE;
-			});
-
 			LIST_ITEM_TEMPLATE listItemTemplate = LIST_ITEM_TEMPLATE::DEFAULT;
-			const auto position = map.find(listItemTemplateName);
-			if (position != map.end()) {
-				listItemTemplate = position->second;
+			const auto position = detail::FindConstant(listItemTemplateNames, listItemTemplateName);
+			if (position != nullptr) {
+				listItemTemplate = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LIST_ITEM_TEMPLATE: Titanium::UI::LIST_ITEM_TEMPLATE with name '", listItemTemplateName, "' does not exist");
 			}
@@ -731,19 +542,10 @@ namespace Titanium
 
 		LIST_ITEM_TEMPLATE Constants::to_LIST_ITEM_TEMPLATE(std::underlying_type<LIST_ITEM_TEMPLATE>::type listItemTemplate_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<LIST_ITEM_TEMPLATE>::type, LIST_ITEM_TEMPLATE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<LIST_ITEM_TEMPLATE>::type>(LIST_ITEM_TEMPLATE::CONTACTS)] = LIST_ITEM_TEMPLATE::CONTACTS;
-      map[static_cast<std::underlying_type<LIST_ITEM_TEMPLATE>::type>(LIST_ITEM_TEMPLATE::DEFAULT)]  = LIST_ITEM_TEMPLATE::DEFAULT;
-      map[static_cast<std::underlying_type<LIST_ITEM_TEMPLATE>::type>(LIST_ITEM_TEMPLATE::SETTINGS)] = LIST_ITEM_TEMPLATE::SETTINGS;
-      map[static_cast<std::underlying_type<LIST_ITEM_TEMPLATE>::type>(LIST_ITEM_TEMPLATE::SUBTITLE)] = LIST_ITEM_TEMPLATE::SUBTITLE;
-			});
-
 			LIST_ITEM_TEMPLATE listItemTemplate = LIST_ITEM_TEMPLATE::DEFAULT;
-			const auto position = map.find(listItemTemplate_underlying_type);
-			if (position != map.end()) {
-				listItemTemplate = position->second;
+			const auto position = detail::FindConstant(listItemTemplateNames, listItemTemplate_underlying_type);
+			if (position != nullptr) {
+				listItemTemplate = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LIST_ITEM_TEMPLATE: Titanium::UI::LIST_ITEM_TEMPLATE with value '", listItemTemplate_underlying_type, "' does not exist");
 			}
@@ -756,20 +558,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<LIST_ITEM_TEMPLATE>::type>(listItemTemplate);
 		}
 
+		static const detail::TiConstant<NOTIFICATION_DURATION> notificationDurationNames[] = {
+			{ NOTIFICATION_DURATION::LONG,  "NOTIFICATION_DURATION_LONG" },
+			{ NOTIFICATION_DURATION::SHORT, "NOTIFICATION_DURATION_SHORT" },
+		};
+
 		std::string Constants::to_string(const NOTIFICATION_DURATION& notificationDuration) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "NOTIFICATION_DURATION::Unknown";
-			static std::unordered_map<NOTIFICATION_DURATION, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[NOTIFICATION_DURATION::LONG]  = "NOTIFICATION_DURATION_LONG";
-      map[NOTIFICATION_DURATION::SHORT] = "NOTIFICATION_DURATION_SHORT";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(notificationDuration);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(notificationDurationNames, notificationDuration);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -777,17 +578,10 @@ namespace Titanium
 
 		NOTIFICATION_DURATION Constants::to_NOTIFICATION_DURATION(const std::string& notificationDurationName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, NOTIFICATION_DURATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["NOTIFICATION_DURATION_LONG"]  = NOTIFICATION_DURATION::LONG;
-      map["NOTIFICATION_DURATION_SHORT"] = NOTIFICATION_DURATION::SHORT;
-			});
-
 			NOTIFICATION_DURATION notificationDuration = NOTIFICATION_DURATION::SHORT;
-			const auto position = map.find(notificationDurationName);
-			if (position != map.end()) {
-				notificationDuration = position->second;
+			const auto position = detail::FindConstant(notificationDurationNames, notificationDurationName);
+			if (position != nullptr) {
+				notificationDuration = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_NOTIFICATION_DURATION: Titanium::UI::NOTIFICATION_DURATION with name '", notificationDurationName, "' does not exist");
 			}
@@ -797,17 +591,10 @@ namespace Titanium
 
 		NOTIFICATION_DURATION Constants::to_NOTIFICATION_DURATION(std::underlying_type<NOTIFICATION_DURATION>::type notificationDuration_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<NOTIFICATION_DURATION>::type, NOTIFICATION_DURATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<NOTIFICATION_DURATION>::type>(NOTIFICATION_DURATION::LONG)]  = NOTIFICATION_DURATION::LONG;
-      map[static_cast<std::underlying_type<NOTIFICATION_DURATION>::type>(NOTIFICATION_DURATION::SHORT)] = NOTIFICATION_DURATION::SHORT;
-			});
-
 			NOTIFICATION_DURATION notificationDuration = NOTIFICATION_DURATION::SHORT;
-			const auto position = map.find(notificationDuration_underlying_type);
-			if (position != map.end()) {
-				notificationDuration = position->second;
+			const auto position = detail::FindConstant(notificationDurationNames, notificationDuration_underlying_type);
+			if (position != nullptr) {
+				notificationDuration = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_NOTIFICATION_DURATION: Titanium::UI::NOTIFICATION_DURATION with value '", notificationDuration_underlying_type, "' does not exist");
 			}
@@ -820,23 +607,22 @@ namespace Titanium
 			return static_cast<std::underlying_type<NOTIFICATION_DURATION>::type>(notificationDuration);
 		}
 
+		static const detail::TiConstant<PICKER_TYPE> pickerTypeNames[] = {
+			{ PICKER_TYPE::COUNT_DOWN_TIMER, "PICKER_TYPE_COUNT_DOWN_TIMER" },
+			{ PICKER_TYPE::DATE,             "PICKER_TYPE_DATE" },
+			{ PICKER_TYPE::DATE_AND_TIME,    "PICKER_TYPE_DATE_AND_TIME" },
+			{ PICKER_TYPE::PLAIN,            "PICKER_TYPE_PLAIN" },
+			{ PICKER_TYPE::TIME,             "PICKER_TYPE_TIME" },
+		};
+
 		std::string Constants::to_string(const PICKER_TYPE& pickerType) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "PICKER_TYPE::Unknown";
-			static std::unordered_map<PICKER_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[PICKER_TYPE::COUNT_DOWN_TIMER] = "PICKER_TYPE_COUNT_DOWN_TIMER";
-      map[PICKER_TYPE::DATE]             = "PICKER_TYPE_DATE";
-      map[PICKER_TYPE::DATE_AND_TIME]    = "PICKER_TYPE_DATE_AND_TIME";
-      map[PICKER_TYPE::PLAIN]            = "PICKER_TYPE_PLAIN";
-      map[PICKER_TYPE::TIME]             = "PICKER_TYPE_TIME";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(pickerType);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(pickerTypeNames, pickerType);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -844,20 +630,10 @@ namespace Titanium
 
 		PICKER_TYPE Constants::to_PICKER_TYPE(const std::string& pickerTypeName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, PICKER_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["PICKER_TYPE_COUNT_DOWN_TIMER"] = PICKER_TYPE::COUNT_DOWN_TIMER;
-      map["PICKER_TYPE_DATE"]             = PICKER_TYPE::DATE;
-      map["PICKER_TYPE_DATE_AND_TIME"]    = PICKER_TYPE::DATE_AND_TIME;
-      map["PICKER_TYPE_PLAIN"]            = PICKER_TYPE::PLAIN;
-      map["PICKER_TYPE_TIME"]             = PICKER_TYPE::TIME;
-			});
-
 			PICKER_TYPE pickerType = PICKER_TYPE::PLAIN;
-			const auto position = map.find(pickerTypeName);
-			if (position != map.end()) {
-				pickerType = position->second;
+			const auto position = detail::FindConstant(pickerTypeNames, pickerTypeName);
+			if (position != nullptr) {
+				pickerType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_PICKER_TYPE: Titanium::UI::PICKER_TYPE with name '", pickerTypeName, "' does not exist");
 			}
@@ -867,20 +643,10 @@ namespace Titanium
 
 		PICKER_TYPE Constants::to_PICKER_TYPE(std::underlying_type<PICKER_TYPE>::type pickerType_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<PICKER_TYPE>::type, PICKER_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<PICKER_TYPE>::type>(PICKER_TYPE::COUNT_DOWN_TIMER)] = PICKER_TYPE::COUNT_DOWN_TIMER;
-      map[static_cast<std::underlying_type<PICKER_TYPE>::type>(PICKER_TYPE::DATE)]             = PICKER_TYPE::DATE;
-      map[static_cast<std::underlying_type<PICKER_TYPE>::type>(PICKER_TYPE::DATE_AND_TIME)]    = PICKER_TYPE::DATE_AND_TIME;
-      map[static_cast<std::underlying_type<PICKER_TYPE>::type>(PICKER_TYPE::PLAIN)]            = PICKER_TYPE::PLAIN;
-      map[static_cast<std::underlying_type<PICKER_TYPE>::type>(PICKER_TYPE::TIME)]             = PICKER_TYPE::TIME;
-			});
-
 			PICKER_TYPE pickerType = PICKER_TYPE::PLAIN;
-			const auto position = map.find(pickerType_underlying_type);
-			if (position != map.end()) {
-				pickerType = position->second;
+			const auto position = detail::FindConstant(pickerTypeNames, pickerType_underlying_type);
+			if (position != nullptr) {
+				pickerType = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_PICKER_TYPE: Titanium::UI::PICKER_TYPE with value '", pickerType_underlying_type, "' does not exist");
 			}
@@ -893,29 +659,28 @@ namespace Titanium
 			return static_cast<std::underlying_type<PICKER_TYPE>::type>(pickerType);
 		}
 
+		static const detail::TiConstant<RETURNKEY> returnkeyNames[] = {
+			{ RETURNKEY::DEFAULT,        "RETURNKEY_DEFAULT" },
+			{ RETURNKEY::DONE,           "RETURNKEY_DONE" },
+			{ RETURNKEY::EMERGENCY_CALL, "RETURNKEY_EMERGENCY_CALL" },
+			{ RETURNKEY::GO,             "RETURNKEY_GO" },
+			{ RETURNKEY::GOOGLE,         "RETURNKEY_GOOGLE" },
+			{ RETURNKEY::JOIN,           "RETURNKEY_JOIN" },
+			{ RETURNKEY::NEXT,           "RETURNKEY_NEXT" },
+			{ RETURNKEY::ROUTE,          "RETURNKEY_ROUTE" },
+			{ RETURNKEY::SEARCH,         "RETURNKEY_SEARCH" },
+			{ RETURNKEY::SEND,           "RETURNKEY_SEND" },
+			{ RETURNKEY::YAHOO,          "RETURNKEY_YAHOO" },
+		};
+
 		std::string Constants::to_string(const RETURNKEY& returnKey) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "RETURNKEY::Unknown";
-			static std::unordered_map<RETURNKEY, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[RETURNKEY::DEFAULT]        = "RETURNKEY_DEFAULT";
-      map[RETURNKEY::DONE]           = "RETURNKEY_DONE";
-      map[RETURNKEY::EMERGENCY_CALL] = "RETURNKEY_EMERGENCY_CALL";
-      map[RETURNKEY::GO]             = "RETURNKEY_GO";
-      map[RETURNKEY::GOOGLE]         = "RETURNKEY_GOOGLE";
-      map[RETURNKEY::JOIN]           = "RETURNKEY_JOIN";
-      map[RETURNKEY::NEXT]           = "RETURNKEY_NEXT";
-      map[RETURNKEY::ROUTE]          = "RETURNKEY_ROUTE";
-      map[RETURNKEY::SEARCH]         = "RETURNKEY_SEARCH";
-      map[RETURNKEY::SEND]           = "RETURNKEY_SEND";
-      map[RETURNKEY::YAHOO]          = "RETURNKEY_YAHOO";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(returnKey);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(returnkeyNames, returnKey);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -923,26 +688,10 @@ namespace Titanium
 
 		RETURNKEY Constants::to_RETURNKEY(const std::string& returnKeyName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, RETURNKEY> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["RETURNKEY_DEFAULT"]        = RETURNKEY::DEFAULT;
-      map["RETURNKEY_DONE"]           = RETURNKEY::DONE;
-      map["RETURNKEY_EMERGENCY_CALL"] = RETURNKEY::EMERGENCY_CALL;
-      map["RETURNKEY_GO"]             = RETURNKEY::GO;
-      map["RETURNKEY_GOOGLE"]         = RETURNKEY::GOOGLE;
-      map["RETURNKEY_JOIN"]           = RETURNKEY::JOIN;
-      map["RETURNKEY_NEXT"]           = RETURNKEY::NEXT;
-      map["RETURNKEY_ROUTE"]          = RETURNKEY::ROUTE;
-      map["RETURNKEY_SEARCH"]         = RETURNKEY::SEARCH;
-      map["RETURNKEY_SEND"]           = RETURNKEY::SEND;
-      map["RETURNKEY_YAHOO"]          = RETURNKEY::YAHOO;
-			});
-
 			RETURNKEY returnKey = RETURNKEY::DEFAULT;
-			const auto position = map.find(returnKeyName);
-			if (position != map.end()) {
-				returnKey = position->second;
+			const auto position = detail::FindConstant(returnkeyNames, returnKeyName);
+			if (position != nullptr) {
+				returnKey = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_RETURNKEY: Titanium::UI::RETURNKEY with name '", returnKeyName, "' does not exist");
 			}
@@ -952,26 +701,10 @@ namespace Titanium
 
 		RETURNKEY Constants::to_RETURNKEY(std::underlying_type<RETURNKEY>::type returnKey_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<RETURNKEY>::type, RETURNKEY> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::DEFAULT)]        = RETURNKEY::DEFAULT;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::DONE)]           = RETURNKEY::DONE;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::EMERGENCY_CALL)] = RETURNKEY::EMERGENCY_CALL;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::GO)]             = RETURNKEY::GO;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::GOOGLE)]         = RETURNKEY::GOOGLE;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::JOIN)]           = RETURNKEY::JOIN;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::NEXT)]           = RETURNKEY::NEXT;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::ROUTE)]          = RETURNKEY::ROUTE;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::SEARCH)]         = RETURNKEY::SEARCH;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::SEND)]           = RETURNKEY::SEND;
-      map[static_cast<std::underlying_type<RETURNKEY>::type>(RETURNKEY::YAHOO)]          = RETURNKEY::YAHOO;
-			});
-
 			RETURNKEY returnKey = RETURNKEY::DEFAULT;
-			const auto position = map.find(returnKey_underlying_type);
-			if (position != map.end()) {
-				returnKey = position->second;
+			const auto position = detail::FindConstant(returnkeyNames, returnKey_underlying_type);
+			if (position != nullptr) {
+				returnKey = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_RETURNKEY: Titanium::UI::RETURNKEY with value '", returnKey_underlying_type, "' does not exist");
 			}
@@ -984,21 +717,20 @@ namespace Titanium
 			return static_cast<std::underlying_type<RETURNKEY>::type>(returnKey);
 		}
 
+		static const detail::TiConstant<TEXT_ALIGNMENT> textAlignmentNames[] = {
+			{ TEXT_ALIGNMENT::CENTER, "center" },
+			{ TEXT_ALIGNMENT::LEFT,   "left" },
+			{ TEXT_ALIGNMENT::RIGHT,  "right" },
+		};
+
 		std::string Constants::to_string(const TEXT_ALIGNMENT& textAlignment) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "TEXT_ALIGNMENT::Unknown";
-			static std::unordered_map<TEXT_ALIGNMENT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[TEXT_ALIGNMENT::CENTER] = "center";
-      map[TEXT_ALIGNMENT::LEFT]   = "left";
-      map[TEXT_ALIGNMENT::RIGHT]  = "right";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(textAlignment);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(textAlignmentNames, textAlignment);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1006,18 +738,10 @@ namespace Titanium
 
 		TEXT_ALIGNMENT Constants::to_TEXT_ALIGNMENT(const std::string& textAlignmentName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, TEXT_ALIGNMENT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["center"] = TEXT_ALIGNMENT::CENTER;
-      map["left"]   = TEXT_ALIGNMENT::LEFT;
-      map["right"]  = TEXT_ALIGNMENT::RIGHT;
-			});
-
 			TEXT_ALIGNMENT textAlignment = TEXT_ALIGNMENT::LEFT;
-			const auto position = map.find(textAlignmentName);
-			if (position != map.end()) {
-				textAlignment = position->second;
+			const auto position = detail::FindConstant(textAlignmentNames, textAlignmentName);
+			if (position != nullptr) {
+				textAlignment = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_ALIGNMENT: Titanium::UI::TEXT_ALIGNMENT with name '", textAlignmentName, "' does not exist");
 			}
@@ -1027,18 +751,10 @@ namespace Titanium
 
 		TEXT_ALIGNMENT Constants::to_TEXT_ALIGNMENT(std::underlying_type<TEXT_ALIGNMENT>::type textAlignment_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<TEXT_ALIGNMENT>::type, TEXT_ALIGNMENT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<TEXT_ALIGNMENT>::type>(TEXT_ALIGNMENT::CENTER)]        = TEXT_ALIGNMENT::CENTER;
-      map[static_cast<std::underlying_type<TEXT_ALIGNMENT>::type>(TEXT_ALIGNMENT::LEFT)]           = TEXT_ALIGNMENT::LEFT;
-      map[static_cast<std::underlying_type<TEXT_ALIGNMENT>::type>(TEXT_ALIGNMENT::RIGHT)] = TEXT_ALIGNMENT::RIGHT;
-			});
-
 			TEXT_ALIGNMENT textAlignment = TEXT_ALIGNMENT::LEFT;
-			const auto position = map.find(textAlignment_underlying_type);
-			if (position != map.end()) {
-				textAlignment = position->second;
+			const auto position = detail::FindConstant(textAlignmentNames, textAlignment_underlying_type);
+			if (position != nullptr) {
+				textAlignment = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_ALIGNMENT: Titanium::UI::TEXT_ALIGNMENT with value '", textAlignment_underlying_type, "' does not exist");
 			}
@@ -1051,22 +767,21 @@ namespace Titanium
 			return static_cast<std::underlying_type<TEXT_ALIGNMENT>::type>(textAlignment);
 		}
 
+		static const detail::TiConstant<TEXT_AUTOCAPITALIZATION> textAutocapitalizationNames[] = {
+			{ TEXT_AUTOCAPITALIZATION::ALL,       "TEXT_AUTOCAPITALIZATION_ALL" },
+			{ TEXT_AUTOCAPITALIZATION::NONE,      "TEXT_AUTOCAPITALIZATION_NONE" },
+			{ TEXT_AUTOCAPITALIZATION::SENTENCES, "TEXT_AUTOCAPITALIZATION_SENTENCES" },
+			{ TEXT_AUTOCAPITALIZATION::WORDS,     "TEXT_AUTOCAPITALIZATION_WORDS" },
+		};
+
 		std::string Constants::to_string(const TEXT_AUTOCAPITALIZATION& textAutoCapitalization) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "TEXT_AUTOCAPITALIZATION::Unknown";
-			static std::unordered_map<TEXT_AUTOCAPITALIZATION, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[TEXT_AUTOCAPITALIZATION::ALL]       = "TEXT_AUTOCAPITALIZATION_ALL";
-      map[TEXT_AUTOCAPITALIZATION::NONE]      = "TEXT_AUTOCAPITALIZATION_NONE";
-      map[TEXT_AUTOCAPITALIZATION::SENTENCES] = "TEXT_AUTOCAPITALIZATION_SENTENCES";
-      map[TEXT_AUTOCAPITALIZATION::WORDS]     = "TEXT_AUTOCAPITALIZATION_WORDS";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(textAutoCapitalization);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(textAutocapitalizationNames, textAutoCapitalization);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1074,19 +789,10 @@ namespace Titanium
 
 		TEXT_AUTOCAPITALIZATION Constants::to_TEXT_AUTOCAPITALIZATION(const std::string& textAutoCapitalizationName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, TEXT_AUTOCAPITALIZATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["TEXT_AUTOCAPITALIZATION_ALL"]       = TEXT_AUTOCAPITALIZATION::ALL;
-      map["TEXT_AUTOCAPITALIZATION_NONE"]      = TEXT_AUTOCAPITALIZATION::NONE;
-      map["TEXT_AUTOCAPITALIZATION_SENTENCES"] = TEXT_AUTOCAPITALIZATION::SENTENCES;
-      map["TEXT_AUTOCAPITALIZATION_WORDS"]     = TEXT_AUTOCAPITALIZATION::WORDS;
-			});
-
 			TEXT_AUTOCAPITALIZATION textAutoCapitalization = TEXT_AUTOCAPITALIZATION::NONE;
-			const auto position = map.find(textAutoCapitalizationName);
-			if (position != map.end()) {
-				textAutoCapitalization = position->second;
+			const auto position = detail::FindConstant(textAutocapitalizationNames, textAutoCapitalizationName);
+			if (position != nullptr) {
+				textAutoCapitalization = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_AUTOCAPITALIZATION: Titanium::UI::TEXT_AUTOCAPITALIZATION with name '", textAutoCapitalizationName, "' does not exist");
 			}
@@ -1096,19 +802,10 @@ namespace Titanium
 
 		TEXT_AUTOCAPITALIZATION Constants::to_TEXT_AUTOCAPITALIZATION(std::underlying_type<TEXT_AUTOCAPITALIZATION>::type textAutoCapitalization_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type, TEXT_AUTOCAPITALIZATION> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type>(TEXT_AUTOCAPITALIZATION::ALL)]       = TEXT_AUTOCAPITALIZATION::ALL;
-      map[static_cast<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type>(TEXT_AUTOCAPITALIZATION::NONE)]      = TEXT_AUTOCAPITALIZATION::NONE;
-      map[static_cast<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type>(TEXT_AUTOCAPITALIZATION::SENTENCES)] = TEXT_AUTOCAPITALIZATION::SENTENCES;
-      map[static_cast<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type>(TEXT_AUTOCAPITALIZATION::WORDS)]     = TEXT_AUTOCAPITALIZATION::WORDS;
-			});
-
 			TEXT_AUTOCAPITALIZATION textAutoCapitalization = TEXT_AUTOCAPITALIZATION::NONE;
-			const auto position = map.find(textAutoCapitalization_underlying_type);
-			if (position != map.end()) {
-				textAutoCapitalization = position->second;
+			const auto position = detail::FindConstant(textAutocapitalizationNames, textAutoCapitalization_underlying_type);
+			if (position != nullptr) {
+				textAutoCapitalization = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_AUTOCAPITALIZATION: Titanium::UI::TEXT_AUTOCAPITALIZATION with value '", textAutoCapitalization_underlying_type, "' does not exist");
 			}
@@ -1121,21 +818,20 @@ namespace Titanium
 			return static_cast<std::underlying_type<TEXT_AUTOCAPITALIZATION>::type>(textAutoCapitalization);
 		}
 
+		static const detail::TiConstant<TEXT_VERTICAL_ALIGNMENT> textVerticalAlignmentNames[] = {
+			{ TEXT_VERTICAL_ALIGNMENT::BOTTOM, "TEXT_VERTICAL_ALIGNMENT_BOTTOM" },
+			{ TEXT_VERTICAL_ALIGNMENT::CENTER, "TEXT_VERTICAL_ALIGNMENT_CENTER" },
+			{ TEXT_VERTICAL_ALIGNMENT::TOP,    "TEXT_VERTICAL_ALIGNMENT_TOP" },
+		};
+
 		std::string Constants::to_string(const TEXT_VERTICAL_ALIGNMENT& textVerticalAlignment) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "TEXT_VERTICAL_ALIGNMENT::Unknown";
-			static std::unordered_map<TEXT_VERTICAL_ALIGNMENT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[TEXT_VERTICAL_ALIGNMENT::BOTTOM] = "TEXT_VERTICAL_ALIGNMENT_BOTTOM";
-      map[TEXT_VERTICAL_ALIGNMENT::CENTER] = "TEXT_VERTICAL_ALIGNMENT_CENTER";
-      map[TEXT_VERTICAL_ALIGNMENT::TOP]    = "TEXT_VERTICAL_ALIGNMENT_TOP";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(textVerticalAlignment);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(textVerticalAlignmentNames, textVerticalAlignment);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1143,18 +839,10 @@ namespace Titanium
 
 		TEXT_VERTICAL_ALIGNMENT Constants::to_TEXT_VERTICAL_ALIGNMENT(const std::string& textVerticalAlignmentName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, TEXT_VERTICAL_ALIGNMENT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["TEXT_VERTICAL_ALIGNMENT_BOTTOM"] = TEXT_VERTICAL_ALIGNMENT::BOTTOM;
-      map["TEXT_VERTICAL_ALIGNMENT_CENTER"] = TEXT_VERTICAL_ALIGNMENT::CENTER;
-      map["TEXT_VERTICAL_ALIGNMENT_TOP"]    = TEXT_VERTICAL_ALIGNMENT::TOP;
-			});
-
 			TEXT_VERTICAL_ALIGNMENT textVerticalAlignment = TEXT_VERTICAL_ALIGNMENT::CENTER;
-			const auto position = map.find(textVerticalAlignmentName);
-			if (position != map.end()) {
-				textVerticalAlignment = position->second;
+			const auto position = detail::FindConstant(textVerticalAlignmentNames, textVerticalAlignmentName);
+			if (position != nullptr) {
+				textVerticalAlignment = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_VERTICAL_ALIGNMENT: Titanium::UI::TEXT_VERTICAL_ALIGNMENT with name '", textVerticalAlignmentName, "' does not exist");
 			}
@@ -1164,18 +852,10 @@ namespace Titanium
 
 		TEXT_VERTICAL_ALIGNMENT Constants::to_TEXT_VERTICAL_ALIGNMENT(std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type textVerticalAlignment_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type, TEXT_VERTICAL_ALIGNMENT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type>(TEXT_VERTICAL_ALIGNMENT::BOTTOM)] = TEXT_VERTICAL_ALIGNMENT::BOTTOM;
-      map[static_cast<std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type>(TEXT_VERTICAL_ALIGNMENT::CENTER)] = TEXT_VERTICAL_ALIGNMENT::CENTER;
-      map[static_cast<std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type>(TEXT_VERTICAL_ALIGNMENT::TOP)]    = TEXT_VERTICAL_ALIGNMENT::TOP;
-			});
-
 			TEXT_VERTICAL_ALIGNMENT textVerticalAlignment = TEXT_VERTICAL_ALIGNMENT::CENTER;
-			const auto position = map.find(textVerticalAlignment_underlying_type);
-			if (position != map.end()) {
-				textVerticalAlignment = position->second;
+			const auto position = detail::FindConstant(textVerticalAlignmentNames, textVerticalAlignment_underlying_type);
+			if (position != nullptr) {
+				textVerticalAlignment = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_VERTICAL_ALIGNMENT: Titanium::UI::TEXT_VERTICAL_ALIGNMENT with value '", textVerticalAlignment_underlying_type, "' does not exist");
 			}
@@ -1188,29 +868,28 @@ namespace Titanium
 			return static_cast<std::underlying_type<TEXT_VERTICAL_ALIGNMENT>::type>(textVerticalAlignment);
 		}
 
+		static const detail::TiConstant<URL_ERROR> urlErrorNames[] = {
+			{ URL_ERROR::AUTHENTICATION,     "URL_ERROR_AUTHENTICATION" },
+			{ URL_ERROR::BAD_URL,            "URL_ERROR_BAD_URL" },
+			{ URL_ERROR::CONNECT,            "URL_ERROR_CONNECT" },
+			{ URL_ERROR::FILE,               "URL_ERROR_FILE" },
+			{ URL_ERROR::FILE_NOT_FOUND,     "URL_ERROR_FILE_NOT_FOUND" },
+			{ URL_ERROR::HOST_LOOKUP,        "URL_ERROR_HOST_LOOKUP" },
+			{ URL_ERROR::REDIRECT_LOOP,      "URL_ERROR_REDIRECT_LOOP" },
+			{ URL_ERROR::SSL_FAILED,         "URL_ERROR_SSL_FAILED" },
+			{ URL_ERROR::TIMEOUT,            "URL_ERROR_TIMEOUT" },
+			{ URL_ERROR::UNKNOWN,            "URL_ERROR_UNKNOWN" },
+			{ URL_ERROR::UNSUPPORTED_SCHEME, "URL_ERROR_UNSUPPORTED_SCHEME" },
+		};
+
 		std::string Constants::to_string(const URL_ERROR& urlError) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "URL_ERROR::Unknown";
-			static std::unordered_map<URL_ERROR, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[URL_ERROR::AUTHENTICATION]     = "URL_ERROR_AUTHENTICATION";
-      map[URL_ERROR::BAD_URL]            = "URL_ERROR_BAD_URL";
-      map[URL_ERROR::CONNECT]            = "URL_ERROR_CONNECT";
-      map[URL_ERROR::FILE]               = "URL_ERROR_FILE";
-      map[URL_ERROR::FILE_NOT_FOUND]     = "URL_ERROR_FILE_NOT_FOUND";
-      map[URL_ERROR::HOST_LOOKUP]        = "URL_ERROR_HOST_LOOKUP";
-      map[URL_ERROR::REDIRECT_LOOP]      = "URL_ERROR_REDIRECT_LOOP";
-      map[URL_ERROR::SSL_FAILED]         = "URL_ERROR_SSL_FAILED";
-      map[URL_ERROR::TIMEOUT]            = "URL_ERROR_TIMEOUT";
-      map[URL_ERROR::UNKNOWN]            = "URL_ERROR_UNKNOWN";
-      map[URL_ERROR::UNSUPPORTED_SCHEME] = "URL_ERROR_UNSUPPORTED_SCHEME";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(urlError);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(urlErrorNames, urlError);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1218,26 +897,10 @@ namespace Titanium
 
 		URL_ERROR Constants::to_URL_ERROR(const std::string& urlErrorName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, URL_ERROR> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["URL_ERROR_AUTHENTICATION"]     = URL_ERROR::AUTHENTICATION;
-      map["URL_ERROR_BAD_URL"]            = URL_ERROR::BAD_URL;
-      map["URL_ERROR_CONNECT"]            = URL_ERROR::CONNECT;
-      map["URL_ERROR_FILE"]               = URL_ERROR::FILE;
-      map["URL_ERROR_FILE_NOT_FOUND"]     = URL_ERROR::FILE_NOT_FOUND;
-      map["URL_ERROR_HOST_LOOKUP"]        = URL_ERROR::HOST_LOOKUP;
-      map["URL_ERROR_REDIRECT_LOOP"]      = URL_ERROR::REDIRECT_LOOP;
-      map["URL_ERROR_SSL_FAILED"]         = URL_ERROR::SSL_FAILED;
-      map["URL_ERROR_TIMEOUT"]            = URL_ERROR::TIMEOUT;
-      map["URL_ERROR_UNKNOWN"]            = URL_ERROR::UNKNOWN;
-      map["URL_ERROR_UNSUPPORTED_SCHEME"] = URL_ERROR::UNSUPPORTED_SCHEME;
-			});
-
 			URL_ERROR urlError = URL_ERROR::UNKNOWN;
-			const auto position = map.find(urlErrorName);
-			if (position != map.end()) {
-				urlError = position->second;
+			const auto position = detail::FindConstant(urlErrorNames, urlErrorName);
+			if (position != nullptr) {
+				urlError = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_URL_ERROR: Titanium::UI::URL_ERROR with name '", urlErrorName, "' does not exist");
 			}
@@ -1247,26 +910,10 @@ namespace Titanium
 
 		URL_ERROR Constants::to_URL_ERROR(std::underlying_type<URL_ERROR>::type urlError_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<URL_ERROR>::type, URL_ERROR> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::AUTHENTICATION)]     = URL_ERROR::AUTHENTICATION;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::BAD_URL)]            = URL_ERROR::BAD_URL;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::CONNECT)]            = URL_ERROR::CONNECT;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::FILE)]               = URL_ERROR::FILE;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::FILE_NOT_FOUND)]     = URL_ERROR::FILE_NOT_FOUND;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::HOST_LOOKUP)]        = URL_ERROR::HOST_LOOKUP;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::REDIRECT_LOOP)]      = URL_ERROR::REDIRECT_LOOP;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::SSL_FAILED)]         = URL_ERROR::SSL_FAILED;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::TIMEOUT)]            = URL_ERROR::TIMEOUT;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::UNKNOWN)]            = URL_ERROR::UNKNOWN;
-      map[static_cast<std::underlying_type<URL_ERROR>::type>(URL_ERROR::UNSUPPORTED_SCHEME)] = URL_ERROR::UNSUPPORTED_SCHEME;
-			});
-
 			URL_ERROR urlError = URL_ERROR::UNKNOWN;
-			const auto position = map.find(urlError_underlying_type);
-			if (position != map.end()) {
-				urlError = position->second;
+			const auto position = detail::FindConstant(urlErrorNames, urlError_underlying_type);
+			if (position != nullptr) {
+				urlError = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_URL_ERROR: Titanium::UI::URL_ERROR with value '", urlError_underlying_type, "' does not exist");
 			}
@@ -1279,21 +926,20 @@ namespace Titanium
 			return static_cast<std::underlying_type<URL_ERROR>::type>(urlError);
 		}
 
+		static const detail::TiConstant<LAYOUT> layoutNames[] = {
+			{ LAYOUT::FILL,    "LAYOUT_FILL" },
+			{ LAYOUT::INHERIT, "LAYOUT_INHERIT" },
+			{ LAYOUT::SIZE,    "LAYOUT_SIZE" },
+		};
+
 		std::string Constants::to_string(const LAYOUT& layout) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "LAYOUT::Unknown";
-			static std::unordered_map<LAYOUT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[LAYOUT::FILL]    = "LAYOUT_FILL";
-      map[LAYOUT::INHERIT] = "LAYOUT_INHERIT";
-      map[LAYOUT::SIZE]    = "LAYOUT_SIZE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(layout);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(layoutNames, layout);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1301,18 +947,10 @@ namespace Titanium
 
 		LAYOUT Constants::to_LAYOUT(const std::string& layoutName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, LAYOUT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["LAYOUT_FILL"]    = LAYOUT::FILL;
-      map["LAYOUT_INHERIT"] = LAYOUT::INHERIT;
-      map["LAYOUT_SIZE"]    = LAYOUT::SIZE;
-			});
-
 			LAYOUT layout = LAYOUT::INHERIT;
-			const auto position = map.find(layoutName);
-			if (position != map.end()) {
-				layout = position->second;
+			const auto position = detail::FindConstant(layoutNames, layoutName);
+			if (position != nullptr) {
+				layout = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LAYOUT: Titanium::UI::LAYOUT with name '", layoutName, "' does not exist");
 			}
@@ -1322,18 +960,10 @@ namespace Titanium
 
 		LAYOUT Constants::to_LAYOUT(std::underlying_type<LAYOUT>::type layout_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<LAYOUT>::type, LAYOUT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<LAYOUT>::type>(LAYOUT::FILL)]    = LAYOUT::FILL;
-      map[static_cast<std::underlying_type<LAYOUT>::type>(LAYOUT::INHERIT)] = LAYOUT::INHERIT;
-      map[static_cast<std::underlying_type<LAYOUT>::type>(LAYOUT::SIZE)]    = LAYOUT::SIZE;
-			});
-
 			LAYOUT layout = LAYOUT::INHERIT;
-			const auto position = map.find(layout_underlying_type);
-			if (position != map.end()) {
-				layout = position->second;
+			const auto position = detail::FindConstant(layoutNames, layout_underlying_type);
+			if (position != nullptr) {
+				layout = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_LAYOUT: Titanium::UI::LAYOUT with value '", layout_underlying_type, "' does not exist");
 			}
@@ -1346,24 +976,23 @@ namespace Titanium
 			return static_cast<std::underlying_type<LAYOUT>::type>(layout);
 		}
 
+		static const detail::TiConstant<TEXT_STYLE> textStyleNames[] = {
+			{ TEXT_STYLE::BODY,        "TEXT_STYLE_BODY" },
+			{ TEXT_STYLE::CAPTION1,    "TEXT_STYLE_CAPTION1" },
+			{ TEXT_STYLE::CAPTION2,    "TEXT_STYLE_CAPTION2" },
+			{ TEXT_STYLE::FOOTNOTE,    "TEXT_STYLE_FOOTNOTE" },
+			{ TEXT_STYLE::HEADLINE,    "TEXT_STYLE_HEADLINE" },
+			{ TEXT_STYLE::SUBHEADLINE, "TEXT_STYLE_SUBHEADLINE" },
+		};
+
 		std::string Constants::to_string(const TEXT_STYLE& textStyle) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "TEXT_STYLE::Unknown";
-			static std::unordered_map<TEXT_STYLE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[TEXT_STYLE::BODY]        = "TEXT_STYLE_BODY";
-      map[TEXT_STYLE::CAPTION1]    = "TEXT_STYLE_CAPTION1";
-      map[TEXT_STYLE::CAPTION2]    = "TEXT_STYLE_CAPTION2";
-      map[TEXT_STYLE::FOOTNOTE]    = "TEXT_STYLE_FOOTNOTE";
-      map[TEXT_STYLE::HEADLINE]    = "TEXT_STYLE_HEADLINE";
-      map[TEXT_STYLE::SUBHEADLINE] = "TEXT_STYLE_SUBHEADLINE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(textStyle);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(textStyleNames, textStyle);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1371,21 +1000,10 @@ namespace Titanium
 
 		TEXT_STYLE Constants::to_TEXT_STYLE(const std::string& textStyleName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, TEXT_STYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["TEXT_STYLE_BODY"]        = TEXT_STYLE::BODY;
-      map["TEXT_STYLE_CAPTION1"]    = TEXT_STYLE::CAPTION1;
-      map["TEXT_STYLE_CAPTION2"]    = TEXT_STYLE::CAPTION2;
-      map["TEXT_STYLE_FOOTNOTE"]    = TEXT_STYLE::FOOTNOTE;
-      map["TEXT_STYLE_HEADLINE"]    = TEXT_STYLE::HEADLINE;
-      map["TEXT_STYLE_SUBHEADLINE"] = TEXT_STYLE::SUBHEADLINE;
-			});
-
 			TEXT_STYLE textStyle = TEXT_STYLE::BODY;
-			const auto position = map.find(textStyleName);
-			if (position != map.end()) {
-				textStyle = position->second;
+			const auto position = detail::FindConstant(textStyleNames, textStyleName);
+			if (position != nullptr) {
+				textStyle = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_STYLE: Titanium::UI::TEXT_STYLE with name '", textStyleName, "' does not exist");
 			}
@@ -1395,21 +1013,10 @@ namespace Titanium
 
 		TEXT_STYLE Constants::to_TEXT_STYLE(std::underlying_type<TEXT_STYLE>::type textStyle_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<TEXT_STYLE>::type, TEXT_STYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::BODY)]        = TEXT_STYLE::BODY;
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::CAPTION1)]    = TEXT_STYLE::CAPTION1;
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::CAPTION2)]    = TEXT_STYLE::CAPTION2;
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::FOOTNOTE)]    = TEXT_STYLE::FOOTNOTE;
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::HEADLINE)]    = TEXT_STYLE::HEADLINE;
-      map[static_cast<std::underlying_type<TEXT_STYLE>::type>(TEXT_STYLE::SUBHEADLINE)] = TEXT_STYLE::SUBHEADLINE;
-			});
-
 			TEXT_STYLE textStyle = TEXT_STYLE::BODY;
-			const auto position = map.find(textStyle_underlying_type);
-			if (position != map.end()) {
-				textStyle = position->second;
+			const auto position = detail::FindConstant(textStyleNames, textStyle_underlying_type);
+			if (position != nullptr) {
+				textStyle = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_TEXT_STYLE: Titanium::UI::TEXT_STYLE with value '", textStyle_underlying_type, "' does not exist");
 			}
@@ -1422,21 +1029,20 @@ namespace Titanium
 			return static_cast<std::underlying_type<TEXT_STYLE>::type>(textStyle);
 		}
 
+		static const detail::TiConstant<FONT_WEIGHT> fontWeightNames[] = {
+			{ FONT_WEIGHT::BOLD,     "bold" },
+			{ FONT_WEIGHT::NORMAL,   "normal" },
+			{ FONT_WEIGHT::SEMIBOLD, "semibold" },
+		};
+
 		std::string Constants::to_string(const FONT_WEIGHT& value) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "FONT_WEIGHT::Unknown";
-			static std::unordered_map<FONT_WEIGHT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[FONT_WEIGHT::NORMAL]    = "normal";
-			map[FONT_WEIGHT::SEMIBOLD]  = "semibold";
-			map[FONT_WEIGHT::BOLD]      = "bold";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(value);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(fontWeightNames, value);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1444,18 +1050,10 @@ namespace Titanium
 
 		FONT_WEIGHT Constants::to_FONT_WEIGHT(const std::string& valueName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, FONT_WEIGHT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map["normal"]   = FONT_WEIGHT::NORMAL;
-			map["semibold"] = FONT_WEIGHT::SEMIBOLD;
-			map["bold"]     = FONT_WEIGHT::BOLD;
-			});
-
 			FONT_WEIGHT value = FONT_WEIGHT::NORMAL;
-			const auto position = map.find(valueName);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(fontWeightNames, valueName);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FONT_WEIGHT: Titanium::UI::FONT_WEIGHT with name '", valueName, "' does not exist");
 			}
@@ -1465,18 +1063,10 @@ namespace Titanium
 
 		FONT_WEIGHT Constants::to_FONT_WEIGHT(std::underlying_type<FONT_WEIGHT>::type value_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<FONT_WEIGHT>::type, FONT_WEIGHT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[static_cast<std::underlying_type<FONT_WEIGHT>::type>(FONT_WEIGHT::NORMAL)]   = FONT_WEIGHT::NORMAL;
-			map[static_cast<std::underlying_type<FONT_WEIGHT>::type>(FONT_WEIGHT::SEMIBOLD)] = FONT_WEIGHT::SEMIBOLD;
-			map[static_cast<std::underlying_type<FONT_WEIGHT>::type>(FONT_WEIGHT::BOLD)]     = FONT_WEIGHT::BOLD;
-			});
-
 			FONT_WEIGHT value = FONT_WEIGHT::NORMAL;
-			const auto position = map.find(value_underlying_type);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(fontWeightNames, value_underlying_type);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FONT_WEIGHT: Titanium::UI::FONT_WEIGHT with value '", value_underlying_type, "' does not exist");
 			}
@@ -1489,20 +1079,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<FONT_WEIGHT>::type>(value);
 		}
 
+		static const detail::TiConstant<FONT_STYLE> fontStyleNames[] = {
+			{ FONT_STYLE::ITALIC, "italic" },
+			{ FONT_STYLE::NORMAL, "normal" },
+		};
+
 		std::string Constants::to_string(const FONT_STYLE& value) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "FONT_STYLE::Unknown";
-			static std::unordered_map<FONT_STYLE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[FONT_STYLE::NORMAL]    = "normal";
-			map[FONT_STYLE::ITALIC]    = "italic";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(value);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(fontStyleNames, value);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1510,17 +1099,10 @@ namespace Titanium
 
 		FONT_STYLE Constants::to_FONT_STYLE(const std::string& valueName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, FONT_STYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map["normal"]   = FONT_STYLE::NORMAL;
-			map["italic"]   = FONT_STYLE::ITALIC;
-			});
-
 			FONT_STYLE value = FONT_STYLE::NORMAL;
-			const auto position = map.find(valueName);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(fontStyleNames, valueName);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FONT_STYLE: Titanium::UI::FONT_STYLE with name '", valueName, "' does not exist");
 			}
@@ -1530,17 +1112,10 @@ namespace Titanium
 
 		FONT_STYLE Constants::to_FONT_STYLE(std::underlying_type<FONT_STYLE>::type value_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<FONT_STYLE>::type, FONT_STYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[static_cast<std::underlying_type<FONT_STYLE>::type>(FONT_STYLE::NORMAL)]   = FONT_STYLE::NORMAL;
-			map[static_cast<std::underlying_type<FONT_STYLE>::type>(FONT_STYLE::ITALIC)]   = FONT_STYLE::ITALIC;
-			});
-
 			FONT_STYLE value = FONT_STYLE::NORMAL;
-			const auto position = map.find(value_underlying_type);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(fontStyleNames, value_underlying_type);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_FONT_STYLE: Titanium::UI::FONT_STYLE with value '", value_underlying_type, "' does not exist");
 			}
@@ -1553,20 +1128,19 @@ namespace Titanium
 			return static_cast<std::underlying_type<FONT_STYLE>::type>(value);
 		}
 
+		static const detail::TiConstant<GRADIENT_TYPE> gradientTypeNames[] = {
+			{ GRADIENT_TYPE::LINEAR, "linear" },
+			{ GRADIENT_TYPE::RADIAL, "radial" },
+		};
+
 		std::string Constants::to_string(const GRADIENT_TYPE& value) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "GRADIENT_TYPE::Unknown";
-			static std::unordered_map<GRADIENT_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[GRADIENT_TYPE::LINEAR]    = "linear";
-			map[GRADIENT_TYPE::RADIAL]    = "radial";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(value);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(gradientTypeNames, value);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1574,17 +1148,10 @@ namespace Titanium
 
 		GRADIENT_TYPE Constants::to_GRADIENT_TYPE(const std::string& valueName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, GRADIENT_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map["linear"]   = GRADIENT_TYPE::LINEAR;
-			map["radial"]   = GRADIENT_TYPE::RADIAL;
-			});
-
 			GRADIENT_TYPE value = GRADIENT_TYPE::LINEAR;
-			const auto position = map.find(valueName);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(gradientTypeNames, valueName);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_GRADIENT_TYPE: Titanium::UI::GRADIENT_TYPE with name '", valueName, "' does not exist");
 			}
@@ -1594,17 +1161,10 @@ namespace Titanium
 
 		GRADIENT_TYPE Constants::to_GRADIENT_TYPE(std::underlying_type<GRADIENT_TYPE>::type value_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<GRADIENT_TYPE>::type, GRADIENT_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-			map[static_cast<std::underlying_type<GRADIENT_TYPE>::type>(GRADIENT_TYPE::LINEAR)]   = GRADIENT_TYPE::LINEAR;
-			map[static_cast<std::underlying_type<GRADIENT_TYPE>::type>(GRADIENT_TYPE::RADIAL)]   = GRADIENT_TYPE::RADIAL;
-			});
-
 			GRADIENT_TYPE value = GRADIENT_TYPE::LINEAR;
-			const auto position = map.find(value_underlying_type);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(gradientTypeNames, value_underlying_type);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_GRADIENT_TYPE: Titanium::UI::GRADIENT_TYPE with value '", value_underlying_type, "' does not exist");
 			}
@@ -1617,23 +1177,22 @@ namespace Titanium
 			return static_cast<std::underlying_type<GRADIENT_TYPE>::type>(value);
 		}
 
+		static const detail::TiConstant<UNIT> unitNames[] = {
+			{ UNIT::Cm,  "UNIT_CM" },
+			{ UNIT::Dip, "UNIT_DIP" },
+			{ UNIT::In,  "UNIT_IN" },
+			{ UNIT::Mm,  "UNIT_MM" },
+			{ UNIT::Px,  "UNIT_PX" },
+		};
+
 		std::string Constants::to_string(const UNIT& unit) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "UNIT::Unknown";
-			static std::unordered_map<UNIT, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[UNIT::Cm]  = "UNIT_CM";
-      map[UNIT::Dip] = "UNIT_DIP";
-      map[UNIT::In]  = "UNIT_IN";
-      map[UNIT::Mm]  = "UNIT_MM";
-      map[UNIT::Px]  = "UNIT_PX";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(unit);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(unitNames, unit);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1641,20 +1200,10 @@ namespace Titanium
 
 		UNIT Constants::to_UNIT(const std::string& unitName) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, UNIT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map["UNIT_CM"]  = UNIT::Cm;
-      map["UNIT_DIP"] = UNIT::Dip;
-      map["UNIT_IN"]  = UNIT::In;
-      map["UNIT_MM"]  = UNIT::Mm;
-      map["UNIT_PX"]  = UNIT::Px;
-			});
-
 			UNIT unit = UNIT::Dip;
-			const auto position = map.find(unitName);
-			if (position != map.end()) {
-				unit = position->second;
+			const auto position = detail::FindConstant(unitNames, unitName);
+			if (position != nullptr) {
+				unit = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_UNIT: Titanium::UI::UNIT with name '", unitName, "' does not exist");
 			}
@@ -1664,20 +1213,10 @@ namespace Titanium
 
 		UNIT Constants::to_UNIT(std::underlying_type<UNIT>::type unit_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<UNIT>::type, UNIT> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-      map[static_cast<std::underlying_type<UNIT>::type>(UNIT::Cm)]  = UNIT::Cm;
-      map[static_cast<std::underlying_type<UNIT>::type>(UNIT::Dip)] = UNIT::Dip;
-      map[static_cast<std::underlying_type<UNIT>::type>(UNIT::In)]  = UNIT::In;
-      map[static_cast<std::underlying_type<UNIT>::type>(UNIT::Mm)]  = UNIT::Mm;
-      map[static_cast<std::underlying_type<UNIT>::type>(UNIT::Px)]  = UNIT::Px;
-			});
-
 			UNIT unit = UNIT::Dip;
-			const auto position = map.find(unit_underlying_type);
-			if (position != map.end()) {
-				unit = position->second;
+			const auto position = detail::FindConstant(unitNames, unit_underlying_type);
+			if (position != nullptr) {
+				unit = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_UNIT: Titanium::UI::UNIT with value '", unit_underlying_type, "' does not exist");
 			}
@@ -1690,37 +1229,36 @@ namespace Titanium
 			return static_cast<std::underlying_type<UNIT>::type>(unit);
 		}
 
+		static const detail::TiConstant<ATTRIBUTE_TYPE> attributeTypeNames[] = {
+			{ ATTRIBUTE_TYPE::BACKGROUND_COLOR,    "ATTRIBUTE_TYPE_BACKGROUND_COLOR" },
+			{ ATTRIBUTE_TYPE::BASELINE_OFFSET,     "ATTRIBUTE_TYPE_BASELINE_OFFSET" },
+			{ ATTRIBUTE_TYPE::EXPANSION,           "ATTRIBUTE_TYPE_EXPANSION" },
+			{ ATTRIBUTE_TYPE::FONT,                "ATTRIBUTE_TYPE_FONT" },
+			{ ATTRIBUTE_TYPE::FOREGROUND_COLOR,    "ATTRIBUTE_TYPE_FOREGROUND_COLOR" },
+			{ ATTRIBUTE_TYPE::KERN,                "ATTRIBUTE_TYPE_KERN" },
+			{ ATTRIBUTE_TYPE::LIGATURE,            "ATTRIBUTE_TYPE_LIGATURE" },
+			{ ATTRIBUTE_TYPE::LINE_BREAK,          "ATTRIBUTE_TYPE_LINE_BREAK" },
+			{ ATTRIBUTE_TYPE::LINK,                "ATTRIBUTE_TYPE_LINK" },
+			{ ATTRIBUTE_TYPE::OBLIQUENESS,         "ATTRIBUTE_TYPE_OBLIQUENESS" },
+			{ ATTRIBUTE_TYPE::SHADOW,              "ATTRIBUTE_TYPE_SHADOW" },
+			{ ATTRIBUTE_TYPE::STRIKETHROUGH_COLOR, "ATTRIBUTE_TYPE_STRIKETHROUGH_COLOR" },
+			{ ATTRIBUTE_TYPE::STRIKETHROUGH_STYLE, "ATTRIBUTE_TYPE_STRIKETHROUGH_STYLE" },
+			{ ATTRIBUTE_TYPE::STROKE_COLOR,        "ATTRIBUTE_TYPE_STROKE_COLOR" },
+			{ ATTRIBUTE_TYPE::STROKE_WIDTH,        "ATTRIBUTE_TYPE_STROKE_WIDTH" },
+			{ ATTRIBUTE_TYPE::TEXT_EFFECT,         "ATTRIBUTE_TYPE_TEXT_EFFECT" },
+			{ ATTRIBUTE_TYPE::UNDERLINES_STYLE,    "ATTRIBUTE_TYPE_UNDERLINES_STYLE" },
+			{ ATTRIBUTE_TYPE::UNDERLINE_COLOR,     "ATTRIBUTE_TYPE_UNDERLINE_COLOR" },
+			{ ATTRIBUTE_TYPE::WRITING_DIRECTION,   "ATTRIBUTE_TYPE_WRITING_DIRECTION" },
+		};
+
 		std::string Constants::to_string(const ATTRIBUTE_TYPE& name) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ATTRIBUTE_TYPE::Unknown";
-			static std::unordered_map<ATTRIBUTE_TYPE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[ATTRIBUTE_TYPE::FONT] = "ATTRIBUTE_TYPE_FONT";
-				map[ATTRIBUTE_TYPE::FOREGROUND_COLOR] = "ATTRIBUTE_TYPE_FOREGROUND_COLOR";
-				map[ATTRIBUTE_TYPE::BACKGROUND_COLOR] = "ATTRIBUTE_TYPE_BACKGROUND_COLOR";
-				map[ATTRIBUTE_TYPE::STRIKETHROUGH_STYLE] = "ATTRIBUTE_TYPE_STRIKETHROUGH_STYLE";
-				map[ATTRIBUTE_TYPE::UNDERLINES_STYLE] = "ATTRIBUTE_TYPE_UNDERLINES_STYLE";
-				map[ATTRIBUTE_TYPE::LINK] = "ATTRIBUTE_TYPE_LINK";
-				map[ATTRIBUTE_TYPE::LIGATURE] = "ATTRIBUTE_TYPE_LIGATURE";
-				map[ATTRIBUTE_TYPE::UNDERLINE_COLOR] = "ATTRIBUTE_TYPE_UNDERLINE_COLOR";
-				map[ATTRIBUTE_TYPE::KERN] = "ATTRIBUTE_TYPE_KERN";
-				map[ATTRIBUTE_TYPE::STROKE_COLOR] = "ATTRIBUTE_TYPE_STROKE_COLOR";
-				map[ATTRIBUTE_TYPE::STROKE_WIDTH] = "ATTRIBUTE_TYPE_STROKE_WIDTH";
-				map[ATTRIBUTE_TYPE::SHADOW] = "ATTRIBUTE_TYPE_SHADOW";
-				map[ATTRIBUTE_TYPE::WRITING_DIRECTION] = "ATTRIBUTE_TYPE_WRITING_DIRECTION";
-				map[ATTRIBUTE_TYPE::TEXT_EFFECT] = "ATTRIBUTE_TYPE_TEXT_EFFECT";
-				map[ATTRIBUTE_TYPE::BASELINE_OFFSET] = "ATTRIBUTE_TYPE_BASELINE_OFFSET";
-				map[ATTRIBUTE_TYPE::STRIKETHROUGH_COLOR] = "ATTRIBUTE_TYPE_STRIKETHROUGH_COLOR";
-				map[ATTRIBUTE_TYPE::OBLIQUENESS] = "ATTRIBUTE_TYPE_OBLIQUENESS";
-				map[ATTRIBUTE_TYPE::EXPANSION] = "ATTRIBUTE_TYPE_EXPANSION";
-				map[ATTRIBUTE_TYPE::LINE_BREAK] = "ATTRIBUTE_TYPE_LINE_BREAK";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(attributeTypeNames, name);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1728,34 +1266,10 @@ namespace Titanium
 
 		ATTRIBUTE_TYPE Constants::to_ATTRIBUTE_TYPE(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ATTRIBUTE_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["ATTRIBUTE_TYPE_FONT"] = ATTRIBUTE_TYPE::FONT;
-				map["ATTRIBUTE_TYPE_FOREGROUND_COLOR"] = ATTRIBUTE_TYPE::FOREGROUND_COLOR;
-				map["ATTRIBUTE_TYPE_BACKGROUND_COLOR"] = ATTRIBUTE_TYPE::BACKGROUND_COLOR;
-				map["ATTRIBUTE_TYPE_STRIKETHROUGH_STYLE"] = ATTRIBUTE_TYPE::STRIKETHROUGH_STYLE;
-				map["ATTRIBUTE_TYPE_UNDERLINES_STYLE"] = ATTRIBUTE_TYPE::UNDERLINES_STYLE;
-				map["ATTRIBUTE_TYPE_LINK"] = ATTRIBUTE_TYPE::LINK;
-				map["ATTRIBUTE_TYPE_LIGATURE"] = ATTRIBUTE_TYPE::LIGATURE;
-				map["ATTRIBUTE_TYPE_UNDERLINE_COLOR"] = ATTRIBUTE_TYPE::UNDERLINE_COLOR;
-				map["ATTRIBUTE_TYPE_KERN"] = ATTRIBUTE_TYPE::KERN;
-				map["ATTRIBUTE_TYPE_STROKE_COLOR"] = ATTRIBUTE_TYPE::STROKE_COLOR;
-				map["ATTRIBUTE_TYPE_STROKE_WIDTH"] = ATTRIBUTE_TYPE::STROKE_WIDTH;
-				map["ATTRIBUTE_TYPE_SHADOW"] = ATTRIBUTE_TYPE::SHADOW;
-				map["ATTRIBUTE_TYPE_WRITING_DIRECTION"] = ATTRIBUTE_TYPE::WRITING_DIRECTION;
-				map["ATTRIBUTE_TYPE_TEXT_EFFECT"] = ATTRIBUTE_TYPE::TEXT_EFFECT;
-				map["ATTRIBUTE_TYPE_BASELINE_OFFSET"] = ATTRIBUTE_TYPE::BASELINE_OFFSET;
-				map["ATTRIBUTE_TYPE_STRIKETHROUGH_COLOR"] = ATTRIBUTE_TYPE::STRIKETHROUGH_COLOR;
-				map["ATTRIBUTE_TYPE_OBLIQUENESS"] = ATTRIBUTE_TYPE::OBLIQUENESS;
-				map["ATTRIBUTE_TYPE_EXPANSION"] = ATTRIBUTE_TYPE::EXPANSION;
-				map["ATTRIBUTE_TYPE_LINE_BREAK"] = ATTRIBUTE_TYPE::LINE_BREAK;
-			});
-
 			ATTRIBUTE_TYPE autoLink = ATTRIBUTE_TYPE::FONT;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				autoLink = position->second;
+			const auto position = detail::FindConstant(attributeTypeNames, name);
+			if (position != nullptr) {
+				autoLink = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ATTRIBUTE_TYPE: Titanium::UI::ATTRIBUTE_TYPE with name '", name, "' does not exist");
 			}
@@ -1765,34 +1279,10 @@ namespace Titanium
 
 		ATTRIBUTE_TYPE Constants::to_ATTRIBUTE_TYPE(std::underlying_type<ATTRIBUTE_TYPE>::type value_underlying_type) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::underlying_type<ATTRIBUTE_TYPE>::type, ATTRIBUTE_TYPE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::FONT)] = ATTRIBUTE_TYPE::FONT;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::FOREGROUND_COLOR)] = ATTRIBUTE_TYPE::FOREGROUND_COLOR;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::BACKGROUND_COLOR)] = ATTRIBUTE_TYPE::BACKGROUND_COLOR;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::STRIKETHROUGH_STYLE)] = ATTRIBUTE_TYPE::STRIKETHROUGH_STYLE;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::UNDERLINES_STYLE)] = ATTRIBUTE_TYPE::UNDERLINES_STYLE;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::LINK)] = ATTRIBUTE_TYPE::LINK;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::LIGATURE)] = ATTRIBUTE_TYPE::LIGATURE;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::UNDERLINE_COLOR)] = ATTRIBUTE_TYPE::UNDERLINE_COLOR;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::KERN)] = ATTRIBUTE_TYPE::KERN;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::STROKE_COLOR)] = ATTRIBUTE_TYPE::STROKE_COLOR;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::STROKE_WIDTH)] = ATTRIBUTE_TYPE::STROKE_WIDTH;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::SHADOW)] = ATTRIBUTE_TYPE::SHADOW;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::WRITING_DIRECTION)] = ATTRIBUTE_TYPE::WRITING_DIRECTION;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::TEXT_EFFECT)] = ATTRIBUTE_TYPE::TEXT_EFFECT;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::BASELINE_OFFSET)] = ATTRIBUTE_TYPE::BASELINE_OFFSET;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::STRIKETHROUGH_COLOR)] = ATTRIBUTE_TYPE::STRIKETHROUGH_COLOR;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::OBLIQUENESS)] = ATTRIBUTE_TYPE::OBLIQUENESS;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::EXPANSION)] = ATTRIBUTE_TYPE::EXPANSION;
-				map[static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(ATTRIBUTE_TYPE::LINE_BREAK)] = ATTRIBUTE_TYPE::LINE_BREAK;
-			});
-
 			ATTRIBUTE_TYPE value = ATTRIBUTE_TYPE::FONT;
-			const auto position = map.find(value_underlying_type);
-			if (position != map.end()) {
-				value = position->second;
+			const auto position = detail::FindConstant(attributeTypeNames, value_underlying_type);
+			if (position != nullptr) {
+				value = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ATTRIBUTE_TYPE: Titanium::UI::ATTRIBUTE_TYPE with value '", value_underlying_type, "' does not exist");
 			}
@@ -1805,40 +1295,39 @@ namespace Titanium
 			return static_cast<std::underlying_type<ATTRIBUTE_TYPE>::type>(attrType);
 		}
 
+		static const detail::TiConstant<ATTRIBUTE_STYLE> attributeStyleNames[] = {
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_CHAR_WRAPPING,     "ATTRIBUTE_STYLE_LINE_BREAK_BY_CHAR_WRAPPING" },
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_CLIPPING,          "ATTRIBUTE_STYLE_LINE_BREAK_BY_CLIPPING" },
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_HEAD,   "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_HEAD" },
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_MIDDLE, "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_MIDDLE" },
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_TAIL,   "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_TAIL" },
+			{ ATTRIBUTE_STYLE::LINE_BREAK_BY_WORD_WRAPPING,     "ATTRIBUTE_STYLE_LINE_BREAK_BY_WORD_WRAPPING" },
+			{ ATTRIBUTE_STYLE::TEXT_EFFECT_LETTERPRESS,         "ATTRIBUTE_STYLE_TEXT_EFFECT_LETTERPRESS" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_BY_WORD,               "ATTRIBUTE_STYLE_UNDERLINE_BY_WORD" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_DOUBLE,                "ATTRIBUTE_STYLE_UNDERLINE_DOUBLE" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_NONE,                  "ATTRIBUTE_STYLE_UNDERLINE_NONE" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH,          "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT,      "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT_DOT,  "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT_DOT" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DOT,           "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DOT" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_PATTERN_SOLID,         "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_SOLID" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_SINGLE,                "ATTRIBUTE_STYLE_UNDERLINE_SINGLE" },
+			{ ATTRIBUTE_STYLE::UNDERLINE_THICK,                 "ATTRIBUTE_STYLE_UNDERLINE_THICK" },
+			{ ATTRIBUTE_STYLE::WRITING_DIRECTION_EMBEDDING,     "ATTRIBUTE_STYLE_WRITING_DIRECTION_EMBEDDING" },
+			{ ATTRIBUTE_STYLE::WRITING_DIRECTION_LEFT_TO_RIGHT, "ATTRIBUTE_STYLE_WRITING_DIRECTION_LEFT_TO_RIGHT" },
+			{ ATTRIBUTE_STYLE::WRITING_DIRECTION_NATURAL,       "ATTRIBUTE_STYLE_WRITING_DIRECTION_NATURAL" },
+			{ ATTRIBUTE_STYLE::WRITING_DIRECTION_OVERRIDE,      "ATTRIBUTE_STYLE_WRITING_DIRECTION_OVERRIDE" },
+			{ ATTRIBUTE_STYLE::WRITING_DIRECTION_RIGHT_TO_LEFT, "ATTRIBUTE_STYLE_WRITING_DIRECTION_RIGHT_TO_LEFT" },
+		};
+
 		std::string Constants::to_string(const ATTRIBUTE_STYLE& name) TITANIUM_NOEXCEPT
 		{
 			static std::string unknown_string = "ATTRIBUTE_STYLE::Unknown";
-			static std::unordered_map<ATTRIBUTE_STYLE, std::string> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map[ATTRIBUTE_STYLE::UNDERLINE_NONE] = "ATTRIBUTE_STYLE_UNDERLINE_NONE";
-				map[ATTRIBUTE_STYLE::UNDERLINE_SINGLE] = "ATTRIBUTE_STYLE_UNDERLINE_SINGLE";
-				map[ATTRIBUTE_STYLE::UNDERLINE_THICK] = "ATTRIBUTE_STYLE_UNDERLINE_THICK";
-				map[ATTRIBUTE_STYLE::UNDERLINE_DOUBLE] = "ATTRIBUTE_STYLE_UNDERLINE_DOUBLE";
-				map[ATTRIBUTE_STYLE::UNDERLINE_PATTERN_SOLID] = "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_SOLID";
-				map[ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DOT] = "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DOT";
-				map[ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH] = "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH";
-				map[ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT] = "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT";
-				map[ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT_DOT] = "ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT_DOT";
-				map[ATTRIBUTE_STYLE::UNDERLINE_BY_WORD] = "ATTRIBUTE_STYLE_UNDERLINE_BY_WORD";
-				map[ATTRIBUTE_STYLE::WRITING_DIRECTION_EMBEDDING] = "ATTRIBUTE_STYLE_WRITING_DIRECTION_EMBEDDING";
-				map[ATTRIBUTE_STYLE::WRITING_DIRECTION_OVERRIDE] = "ATTRIBUTE_STYLE_WRITING_DIRECTION_OVERRIDE";
-				map[ATTRIBUTE_STYLE::WRITING_DIRECTION_NATURAL] = "ATTRIBUTE_STYLE_WRITING_DIRECTION_NATURAL";
-				map[ATTRIBUTE_STYLE::WRITING_DIRECTION_LEFT_TO_RIGHT] = "ATTRIBUTE_STYLE_WRITING_DIRECTION_LEFT_TO_RIGHT";
-				map[ATTRIBUTE_STYLE::WRITING_DIRECTION_RIGHT_TO_LEFT] = "ATTRIBUTE_STYLE_WRITING_DIRECTION_RIGHT_TO_LEFT";
-				map[ATTRIBUTE_STYLE::TEXT_EFFECT_LETTERPRESS] = "ATTRIBUTE_STYLE_TEXT_EFFECT_LETTERPRESS";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_WORD_WRAPPING] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_WORD_WRAPPING";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_CHAR_WRAPPING] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_CHAR_WRAPPING";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_CLIPPING] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_CLIPPING";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_HEAD] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_HEAD";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_TAIL] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_TAIL";
-				map[ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_MIDDLE] = "ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_MIDDLE";
-			});
 
 			std::string string = unknown_string;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				string = position->second;
+			const auto position = detail::FindConstant(attributeStyleNames, name);
+			if (position != nullptr) {
+				string = position->name;
 			}
 
 			return string;
@@ -1846,37 +1335,10 @@ namespace Titanium
 
 		ATTRIBUTE_STYLE Constants::to_ATTRIBUTE_STYLE(const std::string& name) TITANIUM_NOEXCEPT
 		{
-			static std::unordered_map<std::string, ATTRIBUTE_STYLE> map;
-			static std::once_flag of;
-			std::call_once(of, []() {
-				map["ATTRIBUTE_STYLE_UNDERLINE_NONE"] = ATTRIBUTE_STYLE::UNDERLINE_NONE;
-				map["ATTRIBUTE_STYLE_UNDERLINE_SINGLE"] = ATTRIBUTE_STYLE::UNDERLINE_SINGLE;
-				map["ATTRIBUTE_STYLE_UNDERLINE_THICK"] = ATTRIBUTE_STYLE::UNDERLINE_THICK;
-				map["ATTRIBUTE_STYLE_UNDERLINE_DOUBLE"] = ATTRIBUTE_STYLE::UNDERLINE_DOUBLE;
-				map["ATTRIBUTE_STYLE_UNDERLINE_PATTERN_SOLID"] = ATTRIBUTE_STYLE::UNDERLINE_PATTERN_SOLID;
-				map["ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DOT"] = ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DOT;
-				map["ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH"] = ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH;
-				map["ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT"] = ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT;
-				map["ATTRIBUTE_STYLE_UNDERLINE_PATTERN_DASH_DOT_DOT"] = ATTRIBUTE_STYLE::UNDERLINE_PATTERN_DASH_DOT_DOT;
-				map["ATTRIBUTE_STYLE_UNDERLINE_BY_WORD"] = ATTRIBUTE_STYLE::UNDERLINE_BY_WORD;
-				map["ATTRIBUTE_STYLE_WRITING_DIRECTION_EMBEDDING"] = ATTRIBUTE_STYLE::WRITING_DIRECTION_EMBEDDING;
-				map["ATTRIBUTE_STYLE_WRITING_DIRECTION_OVERRIDE"] = ATTRIBUTE_STYLE::WRITING_DIRECTION_OVERRIDE;
-				map["ATTRIBUTE_STYLE_WRITING_DIRECTION_NATURAL"] = ATTRIBUTE_STYLE::WRITING_DIRECTION_NATURAL;
-				map["ATTRIBUTE_STYLE_WRITING_DIRECTION_LEFT_TO_RIGHT"] = ATTRIBUTE_STYLE::WRITING_DIRECTION_LEFT_TO_RIGHT;
-				map["ATTRIBUTE_STYLE_WRITING_DIRECTION_RIGHT_TO_LEFT"] = ATTRIBUTE_STYLE::WRITING_DIRECTION_RIGHT_TO_LEFT;
-				map["ATTRIBUTE_STYLE_TEXT_EFFECT_LETTERPRESS"] = ATTRIBUTE_STYLE::TEXT_EFFECT_LETTERPRESS;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_WORD_WRAPPING"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_WORD_WRAPPING;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_CHAR_WRAPPING"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_CHAR_WRAPPING;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_CLIPPING"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_CLIPPING;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_HEAD"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_HEAD;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_TAIL"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_TAIL;
-				map["ATTRIBUTE_STYLE_LINE_BREAK_BY_TRUNCATING_MIDDLE"] = ATTRIBUTE_STYLE::LINE_BREAK_BY_TRUNCATING_MIDDLE;
-			});
-
 			ATTRIBUTE_STYLE autoLink = ATTRIBUTE_STYLE::UNDERLINE_NONE;
-			const auto position = map.find(name);
-			if (position != map.end()) {
-				autoLink = position->second;
+			const auto position = detail::FindConstant(attributeStyleNames, name);
+			if (position != nullptr) {
+				autoLink = position->value;
 			} else {
 				TITANIUM_LOG_WARN("Constants::to_ATTRIBUTE_STYLE: Titanium::UI::ATTRIBUTE_STYLE with name '", name, "' does not exist");
 			}
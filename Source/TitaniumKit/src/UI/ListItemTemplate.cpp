@@ -0,0 +1,105 @@
+/**
+ * TitaniumKit ListItemTemplate
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/UI/ListItemTemplate.hpp"
+#include "Titanium/Module.hpp"
+
+namespace Titanium
+{
+	namespace UI
+	{
+		std::shared_ptr<ListItemTemplate> ListItemTemplate::Compile(const JSObject& js_template, const JSObject& listview_exports) TITANIUM_NOEXCEPT
+		{
+			auto processTemplates = static_cast<JSObject>(listview_exports.GetProperty("processTemplates"));
+			auto templateOptions = static_cast<JSObject>(listview_exports.GetProperty("templateOptions"));
+			processTemplates({ js_template }, listview_exports);
+
+			const auto plan = std::make_shared<ListItemTemplate>();
+			if (!plan->compileNode(js_template, templateOptions, -1)) {
+				return nullptr;
+			}
+			return plan;
+		}
+
+		bool ListItemTemplate::compileNode(const JSObject& js_template, JSObject& templateOptions, const std::int32_t& parent) TITANIUM_NOEXCEPT
+		{
+			const auto createView = js_template.GetProperty("createView");
+			if (!createView.IsObject() || !static_cast<JSObject>(createView).IsFunction()) {
+				return false;
+			}
+			const auto options = templateOptions({ js_template }, templateOptions);
+			if (!options.IsObject()) {
+				return false;
+			}
+			const auto js_options = static_cast<JSObject>(options);
+			const auto bindId = js_template.GetProperty("bindId");
+			const auto type = js_template.GetProperty("type");
+
+			const auto index = static_cast<std::int32_t>(nodes__.size());
+			nodes__.push_back(Node {
+				js_template,
+				static_cast<JSObject>(createView),
+				parent,
+				bindId.IsUndefined() ? "" : static_cast<std::string>(bindId),
+				js_options,
+				static_cast<std::unordered_map<std::string, JSValue>>(js_options),
+				type.IsString() && static_cast<std::string>(type) == "Ti.UI.Label"
+			});
+
+			const auto childTemplates = js_template.GetProperty("childTemplates");
+			if (childTemplates.IsObject() && static_cast<JSObject>(childTemplates).IsArray()) {
+				const auto js_children = static_cast<JSObject>(childTemplates);
+				const auto length = static_cast<std::uint32_t>(js_children.GetProperty("length"));
+				for (std::uint32_t i = 0; i < length; i++) {
+					const auto child = js_children.GetProperty(i);
+					if (!child.IsObject() || !compileNode(static_cast<JSObject>(child), templateOptions, index)) {
+						return false;
+					}
+				}
+			}
+			// Like createSectionItemView, a view joins its parent once its children joined it
+			if (parent >= 0) {
+				addOrder__.push_back(static_cast<std::uint32_t>(index));
+			}
+			return true;
+		}
+
+		void ListItemTemplate::bindNode(ListItemInstance& instance, const std::uint32_t& index, JSObject& view, std::unordered_map<std::string, JSValue>&& values) const TITANIUM_NOEXCEPT
+		{
+			const auto& node = nodes__.at(index);
+			auto& bound = instance.bound.at(index);
+			auto& initial = instance.initial.at(index);
+
+			auto changed = view.get_context().CreateObject();
+			auto dirty = false;
+			for (const auto& value : values) {
+				const auto found = bound.find(value.first);
+				if (found == bound.end() || !(found->second == value.second)) {
+					// Remember what the view had, so the property can be reset once no item binds it
+					if (node.defaults.find(value.first) == node.defaults.end() && initial.find(value.first) == initial.end()) {
+						initial.emplace(value.first, view.GetProperty(value.first));
+					}
+					changed.SetProperty(value.first, value.second);
+					dirty = true;
+				}
+			}
+			for (const auto& value : bound) {
+				if (values.find(value.first) != values.end()) {
+					continue;
+				}
+				const auto option = node.defaults.find(value.first);
+				changed.SetProperty(value.first, option != node.defaults.end() ? option->second : initial.at(value.first));
+				dirty = true;
+			}
+			if (dirty) {
+				Module::applyProperties(changed, view);
+			}
+			bound = std::move(values);
+		}
+	} // namespace UI
+} // namespace Titanium
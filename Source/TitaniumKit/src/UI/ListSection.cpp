@@ -9,6 +9,7 @@
 #include "Titanium/UI/ListSection.hpp"
 #include "Titanium/detail/TiImpl.hpp"
 #include "Titanium/UI/ListView.hpp"
+#include "Titanium/detail/TiKeyedDiff.hpp"
 #include <boost/algorithm/string.hpp>
 
 namespace Titanium
@@ -60,14 +61,26 @@ namespace Titanium
 			return items;
 		}
 
-		bool ListDataItem_contains(const ListDataItem& item, const std::string& query, const bool& caseInsensitive)
+		bool ListDataItem_searchableText(const ListDataItem& item, std::string& text)
 		{
 			const auto notFound = item.properties.end();
-			const auto searchableTextFound = (item.properties.find("searchableText") != notFound);
-			if (!searchableTextFound && (item.properties.find("title") == notFound)) {
+			auto found = item.properties.find("searchableText");
+			if (found == notFound) {
+				found = item.properties.find("title");
+			}
+			if (found == notFound) {
+				return false;
+			}
+			text = static_cast<std::string>(found->second);
+			return true;
+		}
+
+		bool ListDataItem_contains(const ListDataItem& item, const std::string& query, const bool& caseInsensitive)
+		{
+			std::string content;
+			if (!ListDataItem_searchableText(item, content)) {
 				return false;
 			}
-			const auto content = searchableTextFound ? static_cast<std::string>(item.properties.at("searchableText")) : static_cast<std::string>(item.properties.at("title"));
 			if (caseInsensitive) {
 				return (boost::algorithm::to_lower_copy(content).find(query) != std::string::npos);
 			} else {
@@ -75,11 +88,56 @@ namespace Titanium
 			}
 		}
 
+		bool ListDataItem_itemIds(const std::vector<ListDataItem>& items, std::vector<std::string>& itemIds)
+		{
+			itemIds.reserve(items.size());
+			for (const auto& item : items) {
+				const auto found = item.properties.find("itemId");
+				if (found == item.properties.end() || found->second.IsUndefined() || found->second.IsNull()) {
+					return false;
+				}
+				itemIds.push_back(static_cast<std::string>(found->second));
+			}
+			return true;
+		}
+
+		static bool ListDataItem_valueEquals(const JSValue& a, const JSValue& b)
+		{
+			if (a == b) {
+				return true;
+			}
+			// Objects such as fonts are rebuilt by every setItems, compare their content
+			if (!a.IsObject() || !b.IsObject()) {
+				return false;
+			}
+			return static_cast<std::string>(a.ToJSONString()) == static_cast<std::string>(b.ToJSONString());
+		}
+
+		static bool ListDataItem_valuesEqual(const std::unordered_map<std::string, JSValue>& a, const std::unordered_map<std::string, JSValue>& b)
+		{
+			if (a.size() != b.size()) {
+				return false;
+			}
+			for (const auto& pair : a) {
+				const auto found = b.find(pair.first);
+				if (found == b.end() || !ListDataItem_valueEquals(pair.second, found->second)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool ListDataItem_equals(const ListDataItem& a, const ListDataItem& b)
+		{
+			return a.templateId == b.templateId && ListDataItem_valuesEqual(a.properties, b.properties) && ListDataItem_valuesEqual(a.bindings, b.bindings);
+		}
+
 		ListSection::ListSection(const JSContext& js_context) TITANIUM_NOEXCEPT
 			: Module(js_context),
 			listviewAnimationProperties_ctor__(js_context.CreateObject(JSExport<Titanium::UI::ListViewAnimationProperties>::Class())),
 			footerTitle__(""),
-			headerTitle__("")
+			headerTitle__(""),
+			itemStore__(std::make_shared<detail::TiItemStore<JSValue>>())
 		{
 			TITANIUM_LOG_DEBUG("ListSection:: ctor ", this);
 		}
@@ -100,16 +158,61 @@ namespace Titanium
 
 		std::vector<ListDataItem> ListSection::get_items() const TITANIUM_NOEXCEPT
 		{
-			return items__;
+			std::vector<ListDataItem> items;
+			items.reserve(itemStore__->size());
+			for (std::uint32_t i = 0; i < itemStore__->size(); i++) {
+				items.push_back(loadItem(i));
+			}
+			return items;
 		}
 
 		void ListSection::set_items(const std::vector<ListDataItem>& values) TITANIUM_NOEXCEPT
 		{
-			fireListSectionEvent("clear", 0, static_cast<std::uint32_t>(items__.size()));
-			items__ = values;
+			if (applyItemsDiff(values)) {
+				return;
+			}
+			fireListSectionEvent("clear", 0, get_itemCount());
+			itemStore__->Clear();
+			itemViews__.clear();
+			storeItems(0, values);
+			searchIndex__ = nullptr;
 			fireListSectionEvent("append", 0, static_cast<std::uint32_t>(values.size()));
 		}
 
+		bool ListSection::applyItemsDiff(const std::vector<ListDataItem>& values) TITANIUM_NOEXCEPT
+		{
+			std::vector<std::string> oldItemIds;
+			std::vector<std::string> newItemIds;
+			if (itemStore__->size() == 0 || values.empty() || !getItemIds(oldItemIds) || !ListDataItem_itemIds(values, newItemIds)) {
+				return false;
+			}
+			const auto diff = detail::TiKeyedDiff(oldItemIds, newItemIds);
+			if (!diff.valid || diff.kept.empty()) {
+				return false;
+			}
+
+			const std::shared_ptr<ListViewAnimationProperties> animation;
+			for (const auto& range : diff.deletes) {
+				deleteItemsAt(range.index, range.count, animation);
+			}
+			for (const auto& range : diff.inserts) {
+				const std::vector<ListDataItem> dataItems(values.begin() + range.index, values.begin() + range.index + range.count);
+				if (range.index == get_itemCount()) {
+					appendItems(dataItems, animation);
+				} else {
+					insertItemsAt(range.index, dataItems, animation);
+				}
+			}
+			// Kept items now sit at their new index; only rebind the ones that changed
+			for (const auto& pair : diff.kept) {
+				const auto& dataItem = values.at(pair.first);
+				if (!itemEquals(pair.first, dataItem)) {
+					updateItemAt(pair.first, dataItem, animation);
+				}
+			}
+			return true;
+		}
+
 		void ListSection::setItems(const std::vector<ListDataItem>& dataItems, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
 			set_items(dataItems);
@@ -117,47 +220,181 @@ namespace Titanium
 
 		void ListSection::appendItems(const std::vector<ListDataItem>& dataItems, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			const auto index = static_cast<std::uint32_t>(items__.size());
-			items__.insert(items__.end(), dataItems.begin(), dataItems.end());
+			const auto index = get_itemCount();
+			storeItems(index, dataItems);
+			if (searchIndex__) {
+				std::string text;
+				for (std::uint32_t i = index; i < get_itemCount(); i++) {
+					if (getItemSearchableText(i, text)) {
+						searchIndex__->Insert(i, text);
+					}
+				}
+			}
 			fireListSectionEvent("append", index, static_cast<std::uint32_t>(dataItems.size()));
 		}
 
 		void ListSection::insertItemsAt(const std::uint32_t& index, const std::vector<ListDataItem>& dataItems, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			TITANIUM_ASSERT(items__.size() > index);
-			items__.insert(items__.begin() + index, dataItems.begin(), dataItems.end());
+			TITANIUM_ASSERT(get_itemCount() > index);
+			storeItems(index, dataItems);
+			// Every following item moved
+			searchIndex__ = nullptr;
 			fireListSectionEvent("insert", index, static_cast<std::uint32_t>(dataItems.size()));
 		}
 
 		void ListSection::replaceItemsAt(const std::uint32_t& index, const std::uint32_t& count, const std::vector<ListDataItem>& dataItems, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			TITANIUM_ASSERT(items__.size() >= index + count);
-			items__.erase(items__.begin() + index, items__.begin() + index + count);
-			items__.insert(items__.begin() + index, dataItems.begin(), dataItems.end());
+			TITANIUM_ASSERT(get_itemCount() >= index + count);
+			itemStore__->Erase(index, count);
+			itemViews__.erase(itemViews__.begin() + index, itemViews__.begin() + index + count);
+			storeItems(index, dataItems);
+			searchIndex__ = nullptr;
 			fireListSectionEvent("replace", index, /* item count */ static_cast<std::uint32_t>(dataItems.size()), /* affected rows */ count);
 		}
 
 		void ListSection::deleteItemsAt(const std::uint32_t& index, const std::uint32_t& count, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			TITANIUM_ASSERT(items__.size() >= index + count);
+			TITANIUM_ASSERT(get_itemCount() >= index + count);
 			fireListSectionEvent("delete", index, count, count);
-			items__.erase(items__.begin() + index, items__.begin() + index + count);
+			itemStore__->Erase(index, count);
+			itemViews__.erase(itemViews__.begin() + index, itemViews__.begin() + index + count);
+			searchIndex__ = nullptr;
 		}
 
 		ListDataItem ListSection::getItemAt(const std::uint32_t& index) TITANIUM_NOEXCEPT
 		{
-			TITANIUM_ASSERT(items__.size() > index);
-			return items__.at(index);
+			TITANIUM_ASSERT(get_itemCount() > index);
+			return loadItem(index);
+		}
+
+		JSObject ListSection::getItemObjectAt(const std::uint32_t& index) const TITANIUM_NOEXCEPT
+		{
+			TITANIUM_ASSERT(get_itemCount() > index);
+			const auto js_context = get_context();
+			auto object = js_context.CreateObject();
+			auto properties = js_context.CreateObject();
+			object.SetProperty("template", js_context.CreateString(itemStore__->get_templateAt(index)));
+			itemStore__->ForEach(index, [&](const std::string& key, const JSValue& value, const bool& binding) {
+				(binding ? object : properties).SetProperty(key, value);
+			});
+			object.SetProperty("properties", properties);
+			return object;
 		}
 
 		void ListSection::updateItemAt(const std::uint32_t& index, const ListDataItem& dataItem, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			try {
-				items__.at(index) = dataItem;
-				fireListSectionEvent("update", index);
-			} catch (std::out_of_range e) {
+			if (index >= get_itemCount()) {
 				TITANIUM_API_LOG_WARN("ListSection::updateItemAt() index is out of range");
+				return;
+			}
+			itemStore__->Update(index, dataItem.templateId, dataItem.properties, dataItem.bindings);
+			itemViews__.at(index) = dataItem.view;
+			if (searchIndex__) {
+				std::string text;
+				if (ListDataItem_searchableText(dataItem, text)) {
+					searchIndex__->Insert(index, text);
+				} else {
+					searchIndex__->Erase(index);
+				}
+			}
+			fireListSectionEvent("update", index);
+		}
+
+		std::vector<std::uint32_t> ListSection::searchItems(const std::string& query, const bool& caseInsensitive) TITANIUM_NOEXCEPT
+		{
+			if (!searchIndex__) {
+				searchIndex__ = std::make_shared<detail::TiSearchIndex>();
+				std::string text;
+				for (std::uint32_t i = 0; i < get_itemCount(); i++) {
+					if (getItemSearchableText(i, text)) {
+						searchIndex__->Insert(i, text);
+					}
+				}
 			}
+			return searchIndex__->Search(query, caseInsensitive);
+		}
+
+		void ListSection::storeItems(const std::uint32_t& index, const std::vector<ListDataItem>& dataItems) TITANIUM_NOEXCEPT
+		{
+			for (std::uint32_t i = 0; i < dataItems.size(); i++) {
+				const auto& item = dataItems.at(i);
+				itemStore__->Insert(index + i, item.templateId, item.properties, item.bindings);
+			}
+			std::vector<std::shared_ptr<View>> views;
+			views.reserve(dataItems.size());
+			for (const auto& item : dataItems) {
+				views.push_back(item.view);
+			}
+			itemViews__.insert(itemViews__.begin() + index, views.begin(), views.end());
+		}
+
+		ListDataItem ListSection::loadItem(const std::uint32_t& index) const TITANIUM_NOEXCEPT
+		{
+			ListDataItem item;
+			item.templateId = itemStore__->get_templateAt(index);
+			itemStore__->ForEach(index, [&item](const std::string& key, const JSValue& value, const bool& binding) {
+				(binding ? item.bindings : item.properties).emplace(key, value);
+			});
+			item.view = itemViews__.at(index);
+			return item;
+		}
+
+		bool ListSection::getItemSearchableText(const std::uint32_t& index, std::string& text) TITANIUM_NOEXCEPT
+		{
+			auto value = itemStore__->FindProperty(index, itemStore__->InternKey("searchableText"));
+			if (value == nullptr) {
+				value = itemStore__->FindProperty(index, itemStore__->InternKey("title"));
+			}
+			if (value == nullptr) {
+				return false;
+			}
+			text = static_cast<std::string>(*value);
+			return true;
+		}
+
+		bool ListSection::getItemIdAt(const uint32_t& itemIndex, std::string& itemId) TITANIUM_NOEXCEPT
+		{
+			const auto value = itemStore__->FindProperty(itemIndex, itemStore__->InternKey("itemId"));
+			if (value == nullptr || value->IsUndefined() || value->IsNull()) {
+				return false;
+			}
+			itemId = static_cast<std::string>(*value);
+			return true;
+		}
+
+		bool ListSection::getItemIds(std::vector<std::string>& itemIds) TITANIUM_NOEXCEPT
+		{
+			const auto itemIdKey = itemStore__->InternKey("itemId");
+			itemIds.reserve(get_itemCount());
+			for (std::uint32_t i = 0; i < get_itemCount(); i++) {
+				const auto value = itemStore__->FindProperty(i, itemIdKey);
+				if (value == nullptr || value->IsUndefined() || value->IsNull()) {
+					return false;
+				}
+				itemIds.push_back(static_cast<std::string>(*value));
+			}
+			return true;
+		}
+
+		bool ListSection::itemEquals(const std::uint32_t& index, const ListDataItem& dataItem) TITANIUM_NOEXCEPT
+		{
+			const auto& shape = itemStore__->get_shapeAt(index);
+			if (itemStore__->get_templateAt(index) != dataItem.templateId || shape.propertyCount != dataItem.properties.size() || shape.keys.size() - shape.propertyCount != dataItem.bindings.size()) {
+				return false;
+			}
+			for (const auto& property : dataItem.properties) {
+				const auto value = itemStore__->FindProperty(index, itemStore__->InternKey(property.first));
+				if (value == nullptr || !ListDataItem_valueEquals(*value, property.second)) {
+					return false;
+				}
+			}
+			for (const auto& binding : dataItem.bindings) {
+				const auto value = itemStore__->FindBinding(index, itemStore__->InternKey(binding.first));
+				if (value == nullptr || !ListDataItem_valueEquals(*value, binding.second)) {
+					return false;
+				}
+			}
+			return true;
 		}
 
 		void ListSection::fireListSectionEvent(const std::string& event_name, const std::uint32_t& index, const std::uint32_t& itemCount, const std::uint32_t& affectedRows)
@@ -173,19 +410,17 @@ namespace Titanium
 
 		void ListSection::setViewForSectionItem(const std::uint32_t& itemIndex, const std::shared_ptr<View>& view) 
 		{
-			TITANIUM_ASSERT(items__.size() > itemIndex);
+			TITANIUM_ASSERT(get_itemCount() > itemIndex);
 
 			TITANIUM_LOG_DEBUG("ListSectin::setViewForSectionItem at ", itemIndex, " ", view.get(), " for ", this);
 
-			auto item = items__.at(itemIndex);
-			item.view = view;
-			items__.at(itemIndex) = item;
+			itemViews__.at(itemIndex) = view;
 		}
 
 		std::shared_ptr<View> ListSection::getViewForSectionItem(const std::uint32_t& itemIndex) 
 		{
-			if (items__.size() > itemIndex) {
-				return items__.at(itemIndex).view;
+			if (get_itemCount() > itemIndex) {
+				return itemViews__.at(itemIndex);
 			} else {
 				return nullptr;
 			}
@@ -281,8 +516,9 @@ namespace Titanium
 		TITANIUM_PROPERTY_GETTER(ListSection, items)
 		{
 			std::vector<JSValue> js_items;
-			for (auto & item : get_items()) {
-				js_items.push_back(ListDataItem_to_js(get_context(), item));
+			js_items.reserve(get_itemCount());
+			for (std::uint32_t i = 0; i < get_itemCount(); i++) {
+				js_items.push_back(getItemObjectAt(i));
 			}
 			return get_context().CreateArray(js_items);
 		}
@@ -423,7 +659,7 @@ namespace Titanium
 				const auto _0 = arguments.at(0);
 				TITANIUM_ASSERT(_0.IsNumber());
 				const auto itemIndex = static_cast<std::uint32_t>(_0);
-				return ListDataItem_to_js(get_context(), getItemAt(itemIndex));
+				return getItemObjectAt(itemIndex);
 			}
 			return get_context().CreateUndefined();
 		}
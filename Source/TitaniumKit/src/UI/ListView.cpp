@@ -10,7 +10,10 @@
 #include "Titanium/UI/ListViewAnimationProperties.hpp"
 #include "Titanium/UI/SearchBar.hpp"
 #include "Titanium/UI/listview_js.hpp"
-#include <boost/algorithm/string.hpp>
+#include "Titanium/UI/Constants.hpp"
+#include "Titanium/detail/TiThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace Titanium
 {
@@ -28,6 +31,9 @@ namespace Titanium
 			ti_listview_exports__(js_context.CreateObject()),
 			sectionViewCreateFunction__(js_context.CreateObject()),
 			sectionViewItemCreateFunction__(js_context.CreateObject()),
+			sectionItemBindFunction__(js_context.CreateObject()),
+			hookItemClickFunction__(js_context.CreateObject()),
+			compiledTemplates__(js_context.CreateUndefined()),
 			model__(std::make_shared<ListModel<ListSection>>())
 		{
 		}
@@ -43,7 +49,9 @@ namespace Titanium
 
 		void ListView::set_sections(const std::vector<std::shared_ptr<ListSection>>& sections) TITANIUM_NOEXCEPT
 		{
-			return model__->set_sections(sections);
+			model__->set_sections(sections);
+			rowHeightsValid__ = false;
+			refreshItemViews();
 		}
 
 		void ListView::loadJS()
@@ -70,6 +78,521 @@ namespace Titanium
 			TITANIUM_ASSERT(js_createSectionViewItemAt.IsObject());
 			sectionViewItemCreateFunction__ = static_cast<JSObject>(js_createSectionViewItemAt);
 			TITANIUM_ASSERT(sectionViewItemCreateFunction__.IsFunction());
+
+			auto js_bindSectionItemAt = ti_listview_exports__.GetProperty("bindSectionItemAt");
+			TITANIUM_ASSERT(js_bindSectionItemAt.IsObject());
+			sectionItemBindFunction__ = static_cast<JSObject>(js_bindSectionItemAt);
+			TITANIUM_ASSERT(sectionItemBindFunction__.IsFunction());
+
+			auto js_hookItemClick = ti_listview_exports__.GetProperty("hookItemClick");
+			TITANIUM_ASSERT(js_hookItemClick.IsObject());
+			hookItemClickFunction__ = static_cast<JSObject>(js_hookItemClick);
+			TITANIUM_ASSERT(hookItemClickFunction__.IsFunction());
+		}
+
+		std::shared_ptr<ListItemTemplate> ListView::getItemTemplate(const std::string& templateId)
+		{
+			auto js_templates = get_object().GetProperty("templates");
+			if (itemTemplates__.empty() || !(js_templates == compiledTemplates__)) {
+				// New templates; make sure the default template is among them
+				auto prepareListView = static_cast<JSObject>(ti_listview_exports__.GetProperty("prepareListView"));
+				prepareListView({ get_object() }, ti_listview_exports__);
+				js_templates = get_object().GetProperty("templates");
+				compiledTemplates__ = js_templates;
+				itemTemplates__.clear();
+			}
+			if (!js_templates.IsObject()) {
+				return nullptr;
+			}
+
+			auto found = itemTemplates__.find(templateId);
+			if (found == itemTemplates__.end()) {
+				const auto js_template = static_cast<JSObject>(js_templates).GetProperty(templateId);
+				if (!js_template.IsObject()) {
+					// Items without a known template use the default one
+					return templateId == defaultItemTemplate__ ? nullptr : getItemTemplate(defaultItemTemplate__);
+				}
+				// A template that fails to compile is kept as nullptr so listview.js handles it
+				found = itemTemplates__.emplace(templateId, ListItemTemplate::Compile(static_cast<JSObject>(js_template), ti_listview_exports__)).first;
+			}
+			return found->second;
+		}
+
+		std::shared_ptr<View> ListView::createItemViewFromTemplate(const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex)
+		{
+			const auto plan = getItemTemplate(section->getItemTemplateAt(itemIndex));
+			if (!plan) {
+				return nullptr;
+			}
+			const auto& nodes = plan->get_nodes();
+
+			ListItemInstance instance;
+			instance.plan = plan;
+			instance.bound.resize(nodes.size());
+			instance.initial.resize(nodes.size());
+			std::vector<JSObject> js_views;
+			js_views.reserve(nodes.size());
+			for (const auto& node : nodes) {
+				auto createView = node.createView;
+				auto js_template = node.js_template;
+				const auto js_view = createView({ node.options }, js_template);
+				TITANIUM_ASSERT(js_view.IsObject());
+				auto view_object = static_cast<JSObject>(js_view);
+				if (!node.bindId.empty()) {
+					view_object.SetProperty("bindId", get_context().CreateString(node.bindId));
+				}
+				hookItemClickFunction__({ get_object(), view_object }, ti_listview_exports__);
+				instance.views.push_back(view_object.GetPrivate<View>());
+				js_views.push_back(view_object);
+			}
+			bindItemInstance(instance, section, itemIndex);
+			for (const auto index : plan->get_addOrder()) {
+				instance.views.at(nodes.at(index).parent).lock()->add(js_views.at(index));
+			}
+
+			if (itemInstances__.size() >= itemInstancesPruneSize__) {
+				for (auto it = itemInstances__.begin(); it != itemInstances__.end();) {
+					if (it->second.views.front().expired()) {
+						it = itemInstances__.erase(it);
+					} else {
+						++it;
+					}
+				}
+				itemInstancesPruneSize__ = (std::max)(static_cast<std::size_t>(64), itemInstances__.size() * 2);
+			}
+			const auto root = instance.views.front().lock();
+			itemInstances__[root.get()] = std::move(instance);
+			return root;
+		}
+
+		std::vector<std::unordered_map<std::string, JSValue>> ListView::resolveItemValues(const ListItemTemplate& plan, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex) const
+		{
+			const auto js_context = get_context();
+			const auto& nodes = plan.get_nodes();
+			std::vector<std::unordered_map<std::string, JSValue>> resolved(nodes.size());
+			std::vector<bool> hasBinding(nodes.size(), false);
+
+			std::unordered_map<std::string, JSValue> properties;
+			section->forEachItemValueAt(itemIndex, [&](const std::string& key, const JSValue& value, const bool& binding) {
+				if (!binding) {
+					properties.emplace(key, value);
+					return;
+				}
+				if (value.IsUndefined()) {
+					return;
+				}
+				for (std::size_t i = 0; i < nodes.size(); i++) {
+					if (!nodes.at(i).bindId.empty() && nodes.at(i).bindId == key) {
+						hasBinding.at(i) = true;
+						if (value.IsObject()) {
+							resolved.at(i) = static_cast<std::unordered_map<std::string, JSValue>>(static_cast<JSObject>(value));
+						}
+					}
+				}
+			});
+
+			// As in listview.js, views without a binding of their own share the item properties
+			for (std::size_t i = 0; i < nodes.size(); i++) {
+				const auto& node = nodes.at(i);
+				auto& values = resolved.at(i);
+				if (!hasBinding.at(i)) {
+					if (node.defaults.find("height") == node.defaults.end() && properties.find("height") == properties.end()) {
+						properties.emplace("height", js_context.CreateString(Constants::to_string(LAYOUT::SIZE)));
+					}
+					// builtin template has different format
+					if (node.label) {
+						const auto title = properties.find("title");
+						const auto text = title == properties.end() ? js_context.CreateUndefined() : title->second;
+						properties.erase("text");
+						properties.emplace("text", text);
+					}
+					values = properties;
+				}
+			}
+			return resolved;
+		}
+
+		void ListView::bindItemInstance(ListItemInstance& instance, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex)
+		{
+			auto resolved = resolveItemValues(*instance.plan, section, itemIndex);
+			for (std::uint32_t i = 0; i < resolved.size(); i++) {
+				const auto view = instance.views.at(i).lock();
+				if (!view) {
+					continue;
+				}
+				auto view_object = view->get_object();
+				instance.plan->bindNode(instance, i, view_object, std::move(resolved.at(i)));
+			}
+		}
+
+		bool ListView::snapshotItem(const ListItemTemplate& plan, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex, ListItemSnapshot& snapshot) const
+		{
+			const auto& root = plan.get_nodes().front();
+			std::unordered_map<std::string, JSValue> properties;
+			JSValue binding = get_context().CreateUndefined();
+			section->forEachItemValueAt(itemIndex, [&](const std::string& key, const JSValue& value, const bool& isBinding) {
+				if (!isBinding) {
+					properties.emplace(key, value);
+				} else if (!root.bindId.empty() && key == root.bindId) {
+					binding = value;
+				}
+			});
+			if (!binding.IsUndefined()) {
+				properties = binding.IsObject() ? static_cast<std::unordered_map<std::string, JSValue>>(static_cast<JSObject>(binding)) : std::unordered_map<std::string, JSValue>();
+			}
+
+			const auto copy = [&snapshot](const std::pair<const std::string, JSValue>& value) {
+				if (value.second.IsString() || value.second.IsNumber() || value.second.IsBoolean()) {
+					snapshot.values[value.first] = static_cast<std::string>(value.second);
+				}
+			};
+			for (const auto& value : root.defaults) {
+				copy(value);
+			}
+			for (const auto& value : properties) {
+				copy(value);
+			}
+
+			// A root without a height sizes to its content, as do SIZE, FILL and auto
+			const auto height = snapshot.values.find("height");
+			return height != snapshot.values.end()
+				&& height->second != Constants::to_string(LAYOUT::SIZE)
+				&& height->second != Constants::to_string(LAYOUT::FILL)
+				&& height->second != "auto";
+		}
+
+		std::function<double(const ListItemSnapshot&)> ListView::createItemMeasure()
+		{
+			return nullptr;
+		}
+
+		void ListView::itemViewPrepared(const std::shared_ptr<View>& view, const double& height)
+		{
+		}
+
+		void ListView::prepareItems(const std::uint32_t& position, const std::uint32_t& count)
+		{
+			if (!itemMeasure__) {
+				itemMeasure__ = createItemMeasure();
+				if (!itemMeasure__) {
+					return;
+				}
+			}
+			if (!itemPrepareQueue__) {
+				itemPrepareQueue__ = std::make_shared<detail::TiPrepareQueue<double>>([](std::function<void()> task) {
+					detail::TiThreadPool::ComputePool().Post(std::move(task));
+				});
+			}
+			loadJS();
+
+			// Values are copied out of JavaScript here, on the JS thread; only the copies reach the worker.
+			// Items before itemPreparedEnd__ were looked at already.
+			const auto end = (std::min)(position + count, getItemOffsets().back());
+			for (auto current = (std::max)(position, itemPreparedEnd__); current < end; current++) {
+				const auto index = getSectionItemIndex(current);
+				const auto section = model__->getSectionAtIndex(std::get<0>(index));
+				const auto plan = getItemTemplate(section->getItemTemplateAt(std::get<1>(index)));
+				ListItemSnapshot snapshot;
+				if (!plan || !snapshotItem(*plan, section, std::get<1>(index), snapshot)) {
+					continue;
+				}
+				const auto measure = itemMeasure__;
+				itemPrepareQueue__->Schedule(current, [measure, snapshot]() {
+					return measure(snapshot);
+				});
+			}
+			itemPreparedEnd__ = (std::max)(itemPreparedEnd__, end);
+		}
+
+		void ListView::attachPreparedItem(const std::shared_ptr<View>& view, const std::uint32_t& position)
+		{
+			double height = 0;
+			if (view && itemPrepareQueue__ && itemPrepareQueue__->Take(position, height) && !std::isnan(height)) {
+				itemViewPrepared(view, height);
+				const auto index = getSectionItemIndex(position);
+				setItemHeight(std::get<0>(index), std::get<1>(index), height);
+			}
+		}
+
+		void ListView::cancelPreparedItems()
+		{
+			if (itemPrepareQueue__) {
+				itemPrepareQueue__->Cancel();
+			}
+			itemPreparedEnd__ = 0;
+			// Platforms capture layout state such as the list width in the measure function
+			itemMeasure__ = nullptr;
+		}
+
+		void ListView::bindSectionItemViewAt(const std::shared_ptr<View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex)
+		{
+			loadJS();
+			const auto section = model__->getSectionAtIndex(sectionIndex);
+			const auto found = itemInstances__.find(view.get());
+			if (found != itemInstances__.end() && found->second.views.front().lock() == view) {
+				bindItemInstance(found->second, section, itemIndex);
+				return;
+			}
+			const std::vector<JSValue> args { get_object(), section->get_object(), section->getItemObjectAt(itemIndex), view->get_object() };
+			sectionItemBindFunction__(args, ti_listview_exports__);
+		}
+
+		void ListView::setVisibleItems(const std::uint32_t& firstItem, const std::uint32_t& itemCount)
+		{
+			if (!itemViewRecycler__) {
+				itemViewRecycler__ = std::make_shared<detail::TiViewRecycler<View>>();
+				itemViewRecycler__->set_callbacks(
+					[this](const std::uint32_t& position) {
+						const auto index = getSectionItemIndex(position);
+						const auto templateId = model__->getSectionAtIndex(std::get<0>(index))->getItemTemplateAt(std::get<1>(index));
+						return templateId.empty() ? defaultItemTemplate__ : templateId;
+					},
+					[this](const std::uint32_t& position) {
+						const auto index = getSectionItemIndex(position);
+						const auto view = createSectionItemViewAt<View>(std::get<0>(index), std::get<1>(index));
+						itemViewRealized(view, std::get<0>(index), std::get<1>(index));
+						attachPreparedItem(view, position);
+						return view;
+					},
+					[this](const std::shared_ptr<View>& view, const std::uint32_t& position) {
+						const auto index = getSectionItemIndex(position);
+						bindSectionItemViewAt(view, std::get<0>(index), std::get<1>(index));
+						itemViewRealized(view, std::get<0>(index), std::get<1>(index));
+						attachPreparedItem(view, position);
+					},
+					[this](const std::shared_ptr<View>& view, const std::uint32_t&) {
+						itemViewReleased(view);
+					});
+			}
+			itemViewRecycler__->set_viewport(firstItem, itemCount, getItemOffsets().back());
+			if (itemPrepareQueue__) {
+				// Results for items that scrolled away would never be taken.
+				// Dropped positions past the window are prepared again when they come back into it.
+				const auto last = firstItem + itemCount + itemPrepareAhead__;
+				itemPrepareQueue__->Retain(firstItem, last);
+				itemPreparedEnd__ = (std::min)(itemPreparedEnd__, last);
+			}
+			// Items about to scroll in are prepared while these are on screen
+			prepareItems(firstItem + itemCount, itemPrepareAhead__);
+		}
+
+		std::shared_ptr<View> ListView::getRealizedItemViewAt(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const
+		{
+			if (!itemViewRecycler__) {
+				return nullptr;
+			}
+			return itemViewRecycler__->get_view(getItemPosition(sectionIndex, itemIndex));
+		}
+
+		std::size_t ListView::get_realizedItemViewCount() const TITANIUM_NOEXCEPT
+		{
+			return itemViewRecycler__ ? itemViewRecycler__->get_live_count() : 0;
+		}
+
+		void ListView::itemViewRealized(const std::shared_ptr<View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex)
+		{
+		}
+
+		void ListView::itemViewReleased(const std::shared_ptr<View>& view)
+		{
+		}
+
+		void ListView::refreshItemViews(const bool& realize)
+		{
+			itemOffsetsValid__ = false;
+			// Positions moved or items changed under the work queued for them
+			cancelPreparedItems();
+			if (!itemViewRecycler__) {
+				return;
+			}
+			if (realize) {
+				itemViewRecycler__->Refresh(getItemOffsets().back());
+			} else {
+				itemViewRecycler__->Recycle();
+			}
+		}
+
+		const std::vector<std::uint32_t>& ListView::getItemOffsets() const
+		{
+			if (!itemOffsetsValid__) {
+				const auto sections = model__->get_sections();
+				itemOffsets__.assign(1, 0);
+				for (const auto section : sections) {
+					itemOffsets__.push_back(itemOffsets__.back() + section->get_itemCount());
+				}
+				itemOffsetsValid__ = true;
+			}
+			return itemOffsets__;
+		}
+
+		std::tuple<std::uint32_t, std::uint32_t> ListView::getSectionItemIndex(const std::uint32_t& position) const
+		{
+			const auto& offsets = getItemOffsets();
+			// The last section starting at or before position
+			const auto found = std::upper_bound(offsets.begin(), offsets.end() - 1, position) - 1;
+			return std::make_tuple(static_cast<std::uint32_t>(found - offsets.begin()), position - *found);
+		}
+
+		std::uint32_t ListView::getItemPosition(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const
+		{
+			const auto& offsets = getItemOffsets();
+			return offsets.at(std::min<std::size_t>(sectionIndex, offsets.size() - 1)) + itemIndex;
+		}
+
+		detail::TiRowHeights& ListView::getRowHeights() const
+		{
+			const auto count = getItemOffsets().back();
+			if (rowHeightsValid__ && rowHeights__.size() == count) {
+				return rowHeights__;
+			}
+			const auto sections = model__->get_sections();
+			std::vector<std::uint32_t> templates;
+			templates.reserve(count);
+			for (const auto section : sections) {
+				const auto itemCount = section->get_itemCount();
+				for (std::uint32_t i = 0; i < itemCount; i++) {
+					templates.push_back(getRowTemplateId(section->getItemTemplateAt(i)));
+				}
+			}
+			rowHeights__.Reset(templates);
+
+			// Items laid out before keep their height while their template stays the same
+			if (!itemHeights__.empty()) {
+				std::uint32_t position = 0;
+				for (const auto section : sections) {
+					const auto itemCount = section->get_itemCount();
+					for (std::uint32_t i = 0; i < itemCount; i++, position++) {
+						const auto found = itemHeights__.find(getItemHeightKey(section, i));
+						if (found != itemHeights__.end()) {
+							rowHeights__.Measure(position, found->second);
+						}
+					}
+				}
+			}
+			rowHeightsValid__ = true;
+			return rowHeights__;
+		}
+
+		std::uint32_t ListView::getRowTemplateId(const std::string& templateId) const
+		{
+			const auto name = templateId.empty() ? defaultItemTemplate__ : templateId;
+			const auto found = rowTemplateIds__.find(name);
+			if (found != rowTemplateIds__.end()) {
+				return found->second;
+			}
+			const auto id = static_cast<std::uint32_t>(rowTemplateIds__.size());
+			rowTemplateIds__.emplace(name, id);
+			return id;
+		}
+
+		std::string ListView::getItemHeightKey(const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex) const
+		{
+			std::string itemId;
+			if (!section->getItemIdAt(itemIndex, itemId)) {
+				return "";
+			}
+			const auto templateId = section->getItemTemplateAt(itemIndex);
+			return (templateId.empty() ? defaultItemTemplate__ : templateId) + '\n' + itemId;
+		}
+
+		void ListView::updateRowHeights(const std::string& name, const std::shared_ptr<ListSection>& section, const std::uint32_t& itemIndex, const std::uint32_t& itemCount, const std::uint32_t& affectedRows)
+		{
+			if (!rowHeightsValid__) {
+				return;
+			}
+			const auto sectionIndex = model__->getSectionIndex(section);
+			if (sectionIndex < 0) {
+				rowHeightsValid__ = false;
+				return;
+			}
+			const auto position = getItemPosition(sectionIndex, itemIndex);
+
+			// Items now at itemIndex come in estimated, or with the height they had under their itemId
+			const auto insert = [&](const bool& reuse) {
+				std::vector<std::uint32_t> templates;
+				for (auto i = itemIndex; i < itemIndex + itemCount; i++) {
+					templates.push_back(getRowTemplateId(section->getItemTemplateAt(i)));
+				}
+				rowHeights__.Insert(position, templates);
+				if (itemHeights__.empty()) {
+					return;
+				}
+				for (auto i = itemIndex; i < itemIndex + itemCount; i++) {
+					const auto key = getItemHeightKey(section, i);
+					const auto found = itemHeights__.find(key);
+					if (found == itemHeights__.end()) {
+						continue;
+					}
+					if (reuse) {
+						rowHeights__.Measure(position + i - itemIndex, found->second);
+					} else {
+						itemHeights__.erase(found);
+					}
+				}
+			};
+
+			if (name == "append" || name == "insert") {
+				insert(true);
+			} else if (name == "clear" || name == "delete") {
+				rowHeights__.Erase(position, itemCount);
+			} else if (name == "replace" || name == "update") {
+				// Updated content is laid out again
+				rowHeights__.Erase(position, affectedRows);
+				insert(false);
+			} else {
+				rowHeightsValid__ = false;
+			}
+		}
+
+		void ListView::setVisibleRange(const double& offset, const double& height)
+		{
+			visibleHeight__ = height;
+			const auto& heights = getRowHeights();
+			const auto first = heights.RowAt(offset);
+			const auto last = (std::min)(heights.RowAt(offset + height) + 1, heights.size());
+			setVisibleItems(first, last > first ? last - first : 0);
+		}
+
+		void ListView::setItemHeight(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex, const double& height)
+		{
+			if (std::isnan(height) || height < 0 || sectionIndex >= model__->get_sectionCount()) {
+				return;
+			}
+			const auto section = model__->getSectionAtIndex(sectionIndex);
+			if (itemIndex >= section->get_itemCount()) {
+				return;
+			}
+			auto& heights = getRowHeights();
+			heights.Measure(getItemPosition(sectionIndex, itemIndex), height);
+
+			const auto key = getItemHeightKey(section, itemIndex);
+			if (!key.empty()) {
+				// Heights of items that are gone are dropped all at once
+				if (itemHeights__.size() > 2 * heights.size() + 1024) {
+					itemHeights__.clear();
+				}
+				itemHeights__[key] = height;
+			}
+		}
+
+		double ListView::getItemOffset(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const
+		{
+			const auto& heights = getRowHeights();
+			return heights.Offset((std::min)(getItemPosition(sectionIndex, itemIndex), heights.size()));
+		}
+
+		std::tuple<std::uint32_t, std::uint32_t> ListView::getItemAtOffset(const double& offset) const
+		{
+			const auto& heights = getRowHeights();
+			if (heights.size() == 0) {
+				return std::make_tuple(0, 0);
+			}
+			return getSectionItemIndex((std::min)(heights.RowAt(offset), heights.size() - 1));
+		}
+
+		double ListView::get_contentHeight() const
+		{
+			return getRowHeights().get_totalHeight();
 		}
 
 		TITANIUM_PROPERTY_READWRITE(ListView, std::string, footerTitle)
@@ -105,22 +628,19 @@ namespace Titanium
 			}
 
 			// Create default section to show results
-			const auto section = static_cast<JSObject>(get_context().JSEvaluateScript("Ti.UI.createListSection({ headerTitle: 'Search Results' });")).GetPrivate<Titanium::UI::ListSection>();
+			const auto section = get_context().CreateObject(JSExport<Titanium::UI::ListSection>::Class()).CallAsConstructor().GetPrivate<Titanium::UI::ListSection>();
+			section->set_headerTitle("Search Results");
 			const std::vector<std::shared_ptr<ListSection>> sections { section };
 			const auto caseInsensitive = get_caseInsensitiveSearch();
-			const auto normalizedQuery = caseInsensitive ? boost::algorithm::to_lower_copy(query) : query;
 			const auto saved_sections = model__->get_saved_sections();
 			std::vector<std::tuple<size_t, size_t>> saved_position;
 			std::vector<ListDataItem> items;
 			for (size_t sectionIndex = 0; sectionIndex < saved_sections.size(); sectionIndex++) {
-				const auto savedItems = saved_sections.at(sectionIndex)->get_items();
-				for (size_t itemIndex = 0; itemIndex < savedItems.size(); itemIndex++) {
-					const auto item = savedItems.at(itemIndex);
-					if (ListDataItem_contains(item, normalizedQuery, caseInsensitive)) {
-						// Save "original" position so we can search it easily later on
-						saved_position.push_back(std::make_tuple(sectionIndex, itemIndex));
-						items.push_back(item);
-					}
+				const auto savedSection = saved_sections.at(sectionIndex);
+				for (const auto itemIndex : savedSection->searchItems(query, caseInsensitive)) {
+					// Save "original" position so we can search it easily later on
+					saved_position.push_back(std::make_tuple(sectionIndex, itemIndex));
+					items.push_back(savedSection->getItemAt(itemIndex));
 				}
 			}
 			model__->save_positions(saved_position);
@@ -134,13 +654,15 @@ namespace Titanium
 				model__->save();
 			}
 
+			// Each keystroke refines the last query, which the section indexes only filter
 			const auto caseInsensitive = get_caseInsensitiveSearch();
-			const auto normalizedQuery = caseInsensitive ? boost::algorithm::to_lower_copy(query) : query;
 			std::vector<std::string> suggestions;
 			for (const auto section : model__->get_saved_sections()) {
-				for (const auto item : section->get_items()) {
-					if (ListDataItem_contains(item, normalizedQuery, caseInsensitive)) {
-						suggestions.push_back(static_cast<std::string>(item.properties.at("title")));
+				for (const auto itemIndex : section->searchItems(query, caseInsensitive)) {
+					const auto item = section->getItemAt(itemIndex);
+					const auto title = item.properties.find("title");
+					if (title != item.properties.end()) {
+						suggestions.push_back(static_cast<std::string>(title->second));
 					}
 				}
 			}
@@ -161,27 +683,40 @@ namespace Titanium
 
 		void ListView::scrollToItem(const uint32_t& sectionIndex, const uint32_t& itemIndex, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			// Only virtualized lists know where items sit before they are laid out
+			if (itemViewRecycler__ && visibleHeight__ > 0) {
+				setVisibleRange(getItemOffset(sectionIndex, itemIndex), visibleHeight__);
+				return;
+			}
 			TITANIUM_LOG_WARN("ListView::scrollToItem: Unimplemented");
 		}
 
 		void ListView::appendSection(const std::vector<std::shared_ptr<ListSection>>& sections, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
 			model__->appendSection(sections);
+			rowHeightsValid__ = false;
+			refreshItemViews();
 		}
 
 		void ListView::deleteSectionAt(const uint32_t& index, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
 			model__->deleteSectionAt(index);
+			rowHeightsValid__ = false;
+			refreshItemViews();
 		}
 
 		void ListView::insertSectionAt(const uint32_t& index, const std::vector<std::shared_ptr<ListSection>>& section, const std::shared_ptr<ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
 			model__->insertSectionAt(index, section);
+			rowHeightsValid__ = false;
+			refreshItemViews();
 		}
 
 		void ListView::replaceSectionAt(const uint32_t& index, const std::vector<std::shared_ptr<ListSection>>& sections, const std::shared_ptr<ListViewAnimationProperties>& animationn) TITANIUM_NOEXCEPT
 		{
 			model__->replaceSectionAt(index, sections);
+			rowHeightsValid__ = false;
+			refreshItemViews();
 		}
 
 		void ListView::setMarker(const ListViewMarkerProps& marker) TITANIUM_NOEXCEPT
@@ -198,6 +733,10 @@ namespace Titanium
 			event_args.SetProperty("itemCount", ctx.CreateNumber(itemCount));
 			event_args.SetProperty("sectionIndex", get_context().CreateNumber(model__->getSectionIndex(section)));
 
+			// "clear" and "delete" fire while the items are still there
+			updateRowHeights(name, section, itemIndex, itemCount, affectedRows);
+			refreshItemViews(name != "clear" && name != "delete");
+
 			fireEvent(name, event_args);
 		}
 
@@ -579,6 +1118,16 @@ namespace Titanium
 		{
 			if (arguments.size() >= 1) {
 				this_object.SetProperty("templates", arguments.at(0));
+				itemTemplates__.clear();
+				cancelPreparedItems();
+				// Heights were measured with the old templates
+				itemHeights__.clear();
+				rowHeightsValid__ = false;
+				// Pooled views were built from the old templates
+				if (itemViewRecycler__) {
+					itemViewRecycler__->Clear();
+					refreshItemViews();
+				}
 			}
 			return this_object.get_context().CreateUndefined();
 		}
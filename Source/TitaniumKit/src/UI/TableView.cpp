@@ -12,6 +12,7 @@
 #include "Titanium/UI/TableViewAnimationProperties.hpp"
 #include "Titanium/UI/SearchBar.hpp"
 #include "Titanium/detail/TiImpl.hpp"
+#include "Titanium/detail/TiKeyedDiff.hpp"
 
 #define CREATE_TITANIUM_UI_INSTANCE(OUT, PARAM, NAME) \
   JSValue Titanium_property = get_context().get_global_object().GetProperty("Titanium"); \
@@ -55,7 +56,10 @@ namespace Titanium
 
 		void TableView::set_sections(const std::vector<std::shared_ptr<TableViewSection>>& sections) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
+			const auto erased = model__->get_sections();
 			model__->set_sections(sections);
+			sectionsChanged(version, 0, erased, sections);
 		}
 
 		std::vector<JSObject> TableView::get_data() const TITANIUM_NOEXCEPT
@@ -79,6 +83,15 @@ namespace Titanium
 
 		void TableView::set_data(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT
 		{
+			if (!applyDataDiff(data)) {
+				resetData(data);
+			}
+		}
+
+		void TableView::resetData(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT
+		{
+			const auto version = model__->get_version();
+			const auto erased = model__->get_sections();
 			model__->clear();
 			for (std::uint32_t i = 0; i < data.size(); i++) {
 				const auto datum    = data.at(i);
@@ -90,17 +103,87 @@ namespace Titanium
 					if (model__->empty()) {
 						createEmptyTableViewSection();
 					}
-					auto row = datum.GetPrivate<Titanium::UI::TableViewRow>();
+					model__->first()->add(createTableViewRow(datum), false);
+				}
+			}
+			sectionsChanged(version, 0, erased, model__->get_sections());
+		}
 
-					// if row is not TableViewRow, create new one.
-					if (row == nullptr) {
-						CREATE_TITANIUM_UI_INSTANCE(js_row, datum, TableViewRow);
-						row = js_row.GetPrivate<Titanium::UI::TableViewRow>();
-						row->set_data(datum);
-					}
-					model__->first()->add(row, false);
+		std::shared_ptr<TableViewRow> TableView::createTableViewRow(const JSObject& datum)
+		{
+			auto row = datum.GetPrivate<Titanium::UI::TableViewRow>();
+
+			// if row is not TableViewRow, create new one.
+			if (row == nullptr) {
+				CREATE_TITANIUM_UI_INSTANCE(js_row, datum, TableViewRow);
+				row = js_row.GetPrivate<Titanium::UI::TableViewRow>();
+				row->set_data(datum);
+			}
+			return row;
+		}
+
+		bool TableView::applyDataDiff(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT
+		{
+			// Only data made of rows without header, as get_data() returns it
+			if (model__->get_sectionCount() != 1 || data.empty()) {
+				return false;
+			}
+			const auto section = model__->first();
+			const auto rows = section->get_rows();
+			if (section->hasHeader() || rows.empty()) {
+				return false;
+			}
+
+			const auto itemIdOf = [](const JSObject& object, std::vector<std::string>& itemIds) -> bool {
+				const auto itemId = object.GetProperty("itemId");
+				if (itemId.IsUndefined() || itemId.IsNull()) {
+					return false;
+				}
+				itemIds.push_back(static_cast<std::string>(itemId));
+				return true;
+			};
+			std::vector<std::string> oldItemIds;
+			std::vector<std::string> newItemIds;
+			oldItemIds.reserve(rows.size());
+			newItemIds.reserve(data.size());
+			for (const auto row : rows) {
+				if (!itemIdOf(row->get_data(), oldItemIds)) {
+					return false;
+				}
+			}
+			for (const auto datum : data) {
+				if (datum.GetPrivate<Titanium::UI::TableViewSection>() != nullptr || !itemIdOf(datum, newItemIds)) {
+					return false;
+				}
+			}
+			const auto diff = detail::TiKeyedDiff(oldItemIds, newItemIds);
+			if (!diff.valid || diff.kept.empty()) {
+				return false;
+			}
+
+			for (const auto& range : diff.deletes) {
+				for (std::uint32_t i = 0; i < range.count; i++) {
+					section->remove(range.index);
 				}
 			}
+			for (const auto& range : diff.inserts) {
+				for (auto i = range.index; i < range.index + range.count; i++) {
+					section->add(createTableViewRow(data.at(i)), i);
+				}
+			}
+			// Kept rows now sit at their new index; only replace the ones that changed
+			for (const auto& pair : diff.kept) {
+				const auto datum = data.at(pair.first);
+				const auto row = rows.at(pair.second);
+				if (datum.GetPrivate<Titanium::UI::TableViewRow>() == row) {
+					continue;
+				}
+				if (datum.GetPrivate<Titanium::UI::TableViewRow>() == nullptr && static_cast<std::string>(row->get_data().ToJSONString()) == static_cast<std::string>(datum.ToJSONString())) {
+					continue;
+				}
+				section->update(pair.first, createTableViewRow(datum));
+			}
+			return true;
 		}
 
 		void TableView::setData(const std::vector<JSObject>& data, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -190,7 +273,10 @@ namespace Titanium
 		{
 			const auto properties = get_context().CreateObject();
 			CREATE_TITANIUM_UI_INSTANCE(js_section, properties, TableViewSection);
-			model__->appendSection(js_section.GetPrivate<Titanium::UI::TableViewSection>());
+			const auto section = js_section.GetPrivate<Titanium::UI::TableViewSection>();
+			const auto version = model__->get_version();
+			model__->appendSection(section);
+			sectionsChanged(version, model__->get_sectionCount() - 1, {}, { section });
 		}
 
 		void TableView::appendRow(const std::vector<std::shared_ptr<TableViewRow>>& rows, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -215,31 +301,83 @@ namespace Titanium
 
 		void TableView::appendSection(const std::vector<std::shared_ptr<TableViewSection>>& sections, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
+			const auto index = model__->get_sectionCount();
 			for (const auto section : sections) {
 				model__->appendSection(section);
 			}
+			sectionsChanged(version, index, {}, sections);
 		}
 
-		ListRowSearchResult TableView::searchRowByIndex(const std::uint32_t& index) TITANIUM_NOEXCEPT
+		void TableView::sectionsChanged(const std::uint64_t& version, const std::uint32_t& index, const std::vector<std::shared_ptr<TableViewSection>>& erased, const std::vector<std::shared_ptr<TableViewSection>>& inserted)
 		{
-			ListRowSearchResult result;
-			std::uint32_t sectionIndex = 0;
-			std::uint32_t rowCount = 0;
-			for (const auto section : model__->get_sections()) {
-				auto sectionRowCount = section->get_rowCount();
-				if (sectionRowCount + rowCount > index) {
-					std::uint32_t rowIndexInSection = index - rowCount;
-					if (section->get_rowCount() > rowIndexInSection) {
-						result.found = true;
-						result.rowIndex = rowIndexInSection;
-						break;
-					}
-				} else {
-					rowCount += sectionRowCount;
+			const auto tableView = get_object().GetPrivate<TableView>();
+			for (const auto section : inserted) {
+				section->attachTableView(tableView);
+			}
+
+			// The index follows the change only if it was up to date before it
+			if (!rowIndexValid__ || rowIndexVersion__ != version) {
+				rowIndexValid__ = false;
+				return;
+			}
+			for (const auto section : erased) {
+				for (const auto row : section->get_rows()) {
+					rowIndex__.EraseRow(row.get());
+				}
+			}
+			std::vector<std::uint32_t> sizes;
+			sizes.reserve(inserted.size());
+			for (const auto section : inserted) {
+				sizes.push_back(section->get_rowCount());
+			}
+			rowIndex__.SpliceSections(index, static_cast<std::uint32_t>(erased.size()), sizes);
+			for (std::uint32_t i = 0; i < inserted.size(); i++) {
+				for (const auto row : inserted.at(i)->get_rows()) {
+					rowIndex__.InsertRow(row.get(), index + i);
+				}
+			}
+
+			const auto sections = model__->get_sections();
+			rowIndexSections__.clear();
+			for (std::uint32_t sectionIndex = 0; sectionIndex < sections.size(); sectionIndex++) {
+				rowIndexSections__.emplace(sections.at(sectionIndex).get(), sectionIndex);
+			}
+			rowIndexVersion__ = model__->get_version();
+		}
+
+		const detail::TiRowIndex& TableView::getRowIndex() TITANIUM_NOEXCEPT
+		{
+			if (rowIndexValid__ && rowIndexVersion__ == model__->get_version()) {
+				return rowIndex__;
+			}
+			const auto sections = model__->get_sections();
+			std::vector<std::uint32_t> sizes;
+			sizes.reserve(sections.size());
+			for (const auto section : sections) {
+				sizes.push_back(section->get_rowCount());
+			}
+			rowIndex__.Reset(sizes);
+			rowIndexSections__.clear();
+			for (std::uint32_t sectionIndex = 0; sectionIndex < sections.size(); sectionIndex++) {
+				const auto section = sections.at(sectionIndex);
+				rowIndexSections__.emplace(section.get(), sectionIndex);
+				for (const auto row : section->get_rows()) {
+					rowIndex__.InsertRow(row.get(), sectionIndex);
 				}
-				sectionIndex++;
 			}
-			result.sectionIndex = sectionIndex;
+			rowIndexValid__ = true;
+			rowIndexVersion__ = model__->get_version();
+			return rowIndex__;
+		}
+
+		ListRowSearchResult TableView::searchRowByIndex(const std::uint32_t& index) TITANIUM_NOEXCEPT
+		{
+			const auto location = getRowIndex().Locate(index);
+			ListRowSearchResult result;
+			result.found = location.found;
+			result.sectionIndex = location.section;
+			result.rowIndex = location.row;
 			return result;
 		}
 
@@ -253,16 +391,18 @@ namespace Titanium
 
 		void TableView::deleteRow(const std::shared_ptr<TableViewRow>& row, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
-			for (const auto section : model__->get_sections()) {
-				if (section->remove(row)) {
-					break;
-				}
+			std::uint32_t sectionIndex = 0;
+			if (getRowIndex().FindRow(row.get(), sectionIndex)) {
+				model__->getSectionAtIndex(sectionIndex)->remove(row);
 			}
 		}
 
 		void TableView::deleteSection(const uint32_t& sectionIndex, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
+			const auto section = model__->getSectionAtIndex(sectionIndex);
 			model__->deleteSectionAt(sectionIndex);
+			sectionsChanged(version, sectionIndex, { section }, {});
 		}
 
 		void TableView::insertRowAfter(const uint32_t& index, const std::shared_ptr<TableViewRow>& row, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -275,7 +415,9 @@ namespace Titanium
 
 		void TableView::insertSectionAfter(const uint32_t& index, const std::shared_ptr<TableViewSection>& section, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
 			model__->insertSectionAfter(index, { section });
+			sectionsChanged(version, index + 1, {}, { section });
 		}
 
 		void TableView::insertRowBefore(const uint32_t& index, const std::shared_ptr<TableViewRow>& row, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -288,7 +430,9 @@ namespace Titanium
 
 		void TableView::insertSectionBefore(const uint32_t& index, const std::shared_ptr<TableViewSection>& section, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
 			model__->insertSectionBefore(index, { section });
+			sectionsChanged(version, index, {}, { section });
 		}
 
 		void TableView::scrollToIndex(const uint32_t& index, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -321,11 +465,34 @@ namespace Titanium
 
 		void TableView::updateSection(const uint32_t& index, const std::shared_ptr<TableViewSection>& section, const std::shared_ptr<TableViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
 		{
+			const auto version = model__->get_version();
+			const auto erased = model__->getSectionAtIndex(index);
 			model__->updateSection(index, section);
+			sectionsChanged(version, index, { erased }, { section });
 		}
 
 		void TableView::fireTableViewSectionEvent(const std::string& name, const std::shared_ptr<TableViewSection>& section, const std::shared_ptr<TableViewRow>& row, const std::uint32_t& rowIndex, const std::shared_ptr<TableViewRow>& old_row)
 		{
+			if (rowIndexValid__) {
+				const auto found = rowIndexSections__.find(section.get());
+				if (found == rowIndexSections__.end()) {
+					// Not one of ours (any more)
+				} else if (name == "append") {
+					rowIndex__.Resize(found->second, 1);
+					rowIndex__.InsertRow(row.get(), found->second);
+				} else if (name == "remove") {
+					rowIndex__.Resize(found->second, -1);
+					rowIndex__.EraseRow(row.get());
+				} else if (name == "update") {
+					if (old_row) {
+						rowIndex__.EraseRow(old_row.get());
+					}
+					rowIndex__.InsertRow(row.get(), found->second);
+				} else {
+					rowIndexValid__ = false;
+				}
+			}
+
 			const auto ctx = get_context();
 			auto event_args = ctx.CreateObject();
 			event_args.SetProperty("section", get_object());
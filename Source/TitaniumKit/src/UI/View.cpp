@@ -39,6 +39,72 @@ namespace Titanium
 			setLayoutDelegate();
 		}
 
+		void View::setProperties(const JSObject& props, JSObject& this_object) TITANIUM_NOEXCEPT
+		{
+			if (!layoutDelegate__) {
+				Titanium::Module::setProperties(props, this_object);
+				return;
+			}
+
+			static const struct
+			{
+				const char* name;
+				bool (View::*set)(const JSValue&);
+			} layoutSetters[] {
+				{ "top", &View::js_set_top },
+				{ "left", &View::js_set_left },
+				{ "bottom", &View::js_set_bottom },
+				{ "right", &View::js_set_right },
+				{ "center", &View::js_set_center },
+				{ "width", &View::js_set_width },
+				{ "height", &View::js_set_height },
+				{ "layout", &View::js_set_layout },
+				{ "horizontalWrap", &View::js_set_horizontalWrap },
+				{ "zIndex", &View::js_set_zIndex }
+			};
+
+			struct Property
+			{
+				std::string name;
+				JSValue value;
+				bool (View::*set)(const JSValue&);
+			};
+
+			// Read every value once, sorting out those of the layout setters
+			const auto propertyNames = props.GetPropertyNames();
+			const auto length = propertyNames.GetCount();
+			std::vector<Property> layout;
+			std::vector<Property> others;
+			others.reserve(length);
+			for (std::size_t i = 0; i < length; i++) {
+				const auto name = static_cast<std::string>(propertyNames.GetNameAtIndex(i));
+				Property property { name, props.GetProperty(name), nullptr };
+				for (const auto& setter : layoutSetters) {
+					if (name == setter.name) {
+						property.set = setter.set;
+						break;
+					}
+				}
+				if (property.set) {
+					layout.push_back(property);
+				} else {
+					others.push_back(property);
+				}
+			}
+
+			// Geometry goes first so the other setters see where the view ends up
+			layoutDelegate__->beginLayoutUpdate();
+			for (const auto& property : layout) {
+				if (!(this->*property.set)(property.value)) {
+					this_object.SetProperty(property.name, property.value);
+				}
+			}
+			for (const auto& property : others) {
+				this_object.SetProperty(property.name, property.value);
+			}
+			layoutDelegate__->endLayoutUpdate();
+		}
+
 		TITANIUM_PROPERTY_READWRITE(View, bool, accessibilityHidden)
 		TITANIUM_PROPERTY_READWRITE(View, std::string, accessibilityHint)
 		TITANIUM_PROPERTY_READWRITE(View, std::string, accessibilityLabel)
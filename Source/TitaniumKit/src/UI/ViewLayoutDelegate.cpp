@@ -486,6 +486,44 @@ namespace Titanium
 			TITANIUM_LOG_WARN("ViewLayoutDelegate::enableEvent: Unimplemented");
 		}
 
+		void ViewLayoutDelegate::beginLayoutUpdate() TITANIUM_NOEXCEPT
+		{
+			++layoutUpdateDepth__;
+		}
+
+		void ViewLayoutDelegate::endLayoutUpdate() TITANIUM_NOEXCEPT
+		{
+			TITANIUM_ASSERT(layoutUpdateDepth__ > 0);
+			if (layoutUpdateDepth__ > 0) {
+				--layoutUpdateDepth__;
+			}
+			if (layoutUpdateDepth__ == 0 && layoutRequested__) {
+				const auto fire_event = layoutEventRequested__;
+				layoutRequested__ = false;
+				layoutEventRequested__ = false;
+				requestLayout(fire_event);
+			}
+		}
+
+		bool ViewLayoutDelegate::isUpdatingLayout() const TITANIUM_NOEXCEPT
+		{
+			return layoutUpdateDepth__ > 0;
+		}
+
+		void ViewLayoutDelegate::requestLayout(const bool& fire_event)
+		{
+		}
+
+		bool ViewLayoutDelegate::holdLayoutRequest(const bool& fire_event) TITANIUM_NOEXCEPT
+		{
+			if (!isUpdatingLayout()) {
+				return false;
+			}
+			layoutRequested__ = true;
+			layoutEventRequested__ = layoutEventRequested__ || fire_event;
+			return true;
+		}
+
 		ViewLayoutEventDelegate::ViewLayoutEventDelegate(View* view) TITANIUM_NOEXCEPT :
 			view__(view)
 		{
@@ -94,10 +94,7 @@ function ensureLoadTemplates(listview) {
 // Create item views from section
 function createSectionView(listview, section) {
 	section.listview = listview;
-	listview.templates = listview.templates || [];
-	listview.defaultItemTemplate = listview.defaultItemTemplate || Ti.UI.LIST_ITEM_TEMPLATE_DEFAULT;
-
-	ensureLoadTemplates(listview);
+	prepareListView(listview);
 
 	var views = [];
 	var items = section.items;
@@ -107,23 +104,77 @@ function createSectionView(listview, section) {
 	return views;
 }
 
-function createSectionItemView(listview, item, template, parent) {
-	var options = template.properties;
-	if (options === void 0) {
-		options = {top:0, left:0, width:Ti.UI.SIZE, height:Ti.UI.SIZE};
-	}
+function prepareListView(listview) {
+	listview.templates = listview.templates || [];
+	listview.defaultItemTemplate = listview.defaultItemTemplate || Ti.UI.LIST_ITEM_TEMPLATE_DEFAULT;
 
-	if (template.createView === void 0) {
-		processTemplates(template);
+	ensureLoadTemplates(listview);
+}
+
+function lookupTemplate(listview, item) {
+	if (item.template !== void 0 && listview.templates[item.template] !== void 0) {
+		return listview.templates[item.template];
 	}
+	return listview.templates[listview.defaultItemTemplate];
+}
 
-	var view = template.createView(options);
+// Properties of item that go to the view created from template
+function itemProperties(item, template, options) {
+	if (template.bindId !== void 0 && item[template.bindId] !== void 0) {
+		return item[template.bindId];
+	} else if (item.properties !== void 0) {
+		if (options.height === void 0 && item.properties.height === void 0) {
+			item.properties.height = Ti.UI.SIZE;
+		}
+		// builtin template has different format
+		if (template.type == 'Ti.UI.Label') {
+			item.properties.text = item.properties.title;
+		}
+		return item.properties;
+	}
+	return {};
+}
 
-	if (template.bindId !== void 0) {
-		view.bindId = template.bindId;
+// Apply only the properties that differ from what the view was last bound to.
+// Properties the item no longer sets go back to the template's value, or to
+// the value the view had before an item first set them.
+function bindView(view, properties, options) {
+	var bound = view._bound_ || {},
+		initial = view._initial_ || {},
+		changed = {},
+		dirty = false,
+		key;
+	for (key in properties) {
+		if (!(key in options) && !(key in initial)) {
+			initial[key] = view[key];
+		}
+		if (bound[key] !== properties[key]) {
+			changed[key] = properties[key];
+			dirty = true;
+		}
+	}
+	for (key in bound) {
+		if (!(key in properties)) {
+			changed[key] = key in options ? options[key] : initial[key];
+			dirty = true;
+		}
+	}
+	if (dirty) {
+		view.applyProperties(changed);
 	}
+	view._initial_ = initial;
+	view._bound_ = {};
+	for (key in properties) {
+		view._bound_[key] = properties[key];
+	}
+}
+
+function templateOptions(template) {
+	return template.properties !== void 0 ? template.properties : {top:0, left:0, width:Ti.UI.SIZE, height:Ti.UI.SIZE};
+}
 
-	// hook click and fire listview event with bindId
+// hook click and fire listview event with bindId
+function hookItemClick(listview, view) {
 	view.addEventListener('click', function() {
 		// check if other view already processes the event
 		if (listview._itemclick_section_) {
@@ -143,24 +194,33 @@ function createSectionItemView(listview, item, template, parent) {
 			delete listview._itemclick_itemIndex_;
 		}
 	});
+}
 
-	if (template.bindId !== void 0 && item[template.bindId] !== void 0) {
-		view.applyProperties(item[template.bindId]);
-	} else if (item.properties !== void 0) {
-		if (options.height === void 0 && item.properties.height === void 0) {
-			item.properties.height = Ti.UI.SIZE;
-		}
-		// builtin template has different format
-		if (template.type == 'Ti.UI.Label') {
-			item.properties.text = item.properties.title;
-			view.applyProperties(item.properties);
-		} else {
-			view.applyProperties(item.properties);
-		}
+function createSectionItemView(listview, item, template, parent, root) {
+	var options = templateOptions(template);
+
+	if (template.createView === void 0) {
+		processTemplates(template);
+	}
+
+	var view = template.createView(options);
+
+	if (template.bindId !== void 0) {
+		view.bindId = template.bindId;
 	}
+
+	// remember every view of the item so it can be bound again when recycled
+	root = root || view;
+	root._views_ = root._views_ || [];
+	root._views_.push({view: view, template: template});
+
+	hookItemClick(listview, view);
+
+	bindView(view, itemProperties(item, template, options), options);
+
 	if (template.childTemplates !== void 0 && Array.isArray(template.childTemplates)) {
 		for (var i = 0; i < template.childTemplates.length; i++) {
-			createSectionItemView(listview, item, template.childTemplates[i], view);
+			createSectionItemView(listview, item, template.childTemplates[i], view, root);
 		}
 	}
 	if (parent !== void 0) {
@@ -171,14 +231,26 @@ function createSectionItemView(listview, item, template, parent) {
 
 // Create list item for custom template
 function createSectionItemAt(listview, section, item) {
-	var template = listview.templates[listview.defaultItemTemplate];
-	if (item.template !== void 0 && listview.templates[item.template] !== void 0 ) {
-		template = listview.templates[item.template];
+	prepareListView(listview);
+	return createSectionItemView(listview, item, lookupTemplate(listview, item));
+}
+
+// Bind a recycled item view, created for the same template, to another item
+function bindSectionItemAt(listview, section, item, view) {
+	var views = view._views_;
+	for (var i = 0; i < views.length; i++) {
+		var options = templateOptions(views[i].template);
+		bindView(views[i].view, itemProperties(item, views[i].template, options), options);
 	}
-	return createSectionItemView(listview, item, template);
+	return view;
 }
 
 this.exports = {};
 this.exports.createSectionItemAt = createSectionItemAt;
+this.exports.bindSectionItemAt = bindSectionItemAt;
 this.exports.createSectionView = createSectionView;
 this.exports.processTemplates  = processTemplates;
+// used by the native template compiler, see Titanium::UI::ListItemTemplate
+this.exports.prepareListView   = prepareListView;
+this.exports.templateOptions   = templateOptions;
+this.exports.hookItemClick     = hookItemClick;
@@ -0,0 +1,109 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiKeyedDiff.hpp"
+#include <algorithm>
+#include <unordered_map>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		static void AppendRange(std::vector<TiDiffRange>& ranges, const std::uint32_t& index, const bool& descending)
+		{
+			if (!ranges.empty()) {
+				auto& last = ranges.back();
+				if (descending && last.index == index + 1) {
+					last.index = index;
+					last.count++;
+					return;
+				}
+				if (!descending && last.index + last.count == index) {
+					last.count++;
+					return;
+				}
+			}
+			ranges.push_back({ index, 1 });
+		}
+
+		TiKeyedDiffResult TiKeyedDiff(const std::vector<std::string>& oldKeys, const std::vector<std::string>& newKeys)
+		{
+			TiKeyedDiffResult result;
+			result.valid = false;
+
+			const auto missing = static_cast<std::uint32_t>(-1);
+			std::unordered_map<std::string, std::uint32_t> oldIndexes;
+			oldIndexes.reserve(oldKeys.size());
+			for (std::uint32_t i = 0; i < oldKeys.size(); i++) {
+				if (!oldIndexes.emplace(oldKeys[i], i).second) {
+					return result;
+				}
+			}
+
+			// Old index of every new item, or missing when it is new
+			std::vector<std::uint32_t> sources(newKeys.size(), missing);
+			{
+				std::unordered_map<std::string, std::uint32_t> newIndexes;
+				newIndexes.reserve(newKeys.size());
+				for (std::uint32_t i = 0; i < newKeys.size(); i++) {
+					if (!newIndexes.emplace(newKeys[i], i).second) {
+						return result;
+					}
+					const auto found = oldIndexes.find(newKeys[i]);
+					if (found != oldIndexes.end()) {
+						sources[i] = found->second;
+					}
+				}
+			}
+
+			// Longest increasing run of old indexes by patience sorting;
+			// tails holds the new index ending the best run of each length
+			std::vector<std::uint32_t> tails;
+			std::vector<std::uint32_t> previous(newKeys.size(), missing);
+			for (std::uint32_t i = 0; i < newKeys.size(); i++) {
+				if (sources[i] == missing) {
+					continue;
+				}
+				const auto position = std::lower_bound(tails.begin(), tails.end(), sources[i], [&sources](const std::uint32_t& tail, const std::uint32_t& source) {
+					return sources[tail] < source;
+				});
+				if (position != tails.begin()) {
+					previous[i] = *(position - 1);
+				}
+				if (position == tails.end()) {
+					tails.push_back(i);
+				} else {
+					*position = i;
+				}
+			}
+
+			std::vector<bool> oldKept(oldKeys.size(), false);
+			std::vector<bool> newKept(newKeys.size(), false);
+			result.kept.resize(tails.size());
+			auto length = tails.size();
+			for (auto i = tails.empty() ? missing : tails.back(); i != missing; i = previous[i]) {
+				oldKept[sources[i]] = true;
+				newKept[i] = true;
+				result.kept[--length] = std::make_pair(i, sources[i]);
+			}
+
+			for (auto i = static_cast<std::uint32_t>(oldKeys.size()); i > 0; i--) {
+				if (!oldKept[i - 1]) {
+					AppendRange(result.deletes, i - 1, true);
+				}
+			}
+			for (std::uint32_t i = 0; i < newKeys.size(); i++) {
+				if (!newKept[i]) {
+					AppendRange(result.inserts, i, false);
+				}
+			}
+			result.valid = true;
+			return result;
+		}
+	} // namespace detail
+}  // namespace Titanium
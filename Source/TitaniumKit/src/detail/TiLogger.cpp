@@ -0,0 +1,106 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiLogger.hpp"
+#include <exception>
+#include <vector>
+
+namespace Titanium
+{
+	namespace detail
+	{
+#ifdef NDEBUG
+		std::atomic<int> TiLoggerLevel::min_severity__ { static_cast<int>(TiLoggerSeverityType::Ti_INFO) };
+#else
+		std::atomic<int> TiLoggerLevel::min_severity__ { static_cast<int>(TiLoggerSeverityType::Ti_TRACE) };
+#endif
+
+		void TiLoggerLevel::Set(const TiLoggerSeverityType& severity)
+		{
+			min_severity__.store(static_cast<int>(severity), std::memory_order_relaxed);
+		}
+
+		TiLoggerSeverityType TiLoggerLevel::Get()
+		{
+			return static_cast<TiLoggerSeverityType>(min_severity__.load(std::memory_order_relaxed));
+		}
+
+		static std::mutex& FlushMutex()
+		{
+			static std::mutex mutex;
+			return mutex;
+		}
+
+		static std::vector<std::weak_ptr<TiLoggerInterface>>& Loggers()
+		{
+			static std::vector<std::weak_ptr<TiLoggerInterface>> loggers;
+			return loggers;
+		}
+
+		void TiLoggerRegister(const std::weak_ptr<TiLoggerInterface>& logger)
+		{
+			std::lock_guard<std::mutex> lock(FlushMutex());
+			Loggers().push_back(logger);
+		}
+
+		void TiLoggerFlushAll()
+		{
+			std::lock_guard<std::mutex> lock(FlushMutex());
+			for (const auto& weak : Loggers()) {
+				if (const auto logger = weak.lock()) {
+					logger->Flush();
+				}
+			}
+		}
+
+		void TiLoggerShutdown()
+		{
+			std::lock_guard<std::mutex> lock(FlushMutex());
+			for (const auto& weak : Loggers()) {
+				if (const auto logger = weak.lock()) {
+					logger->Stop();
+				}
+			}
+		}
+
+		// std::terminate may be called while a lock below is held, by the
+		// terminating thread or by a writer. Losing the tail of the log beats
+		// hanging the crash handler, so nothing here waits.
+		static void FlushForCrash()
+		{
+			std::unique_lock<std::mutex> lock(FlushMutex(), std::try_to_lock);
+			if (!lock.owns_lock()) {
+				return;
+			}
+			for (const auto& weak : Loggers()) {
+				if (const auto logger = weak.lock()) {
+					logger->TryFlush();
+				}
+			}
+		}
+
+		static std::terminate_handler previous_terminate_handler = nullptr;
+
+		static void FlushOnTerminate()
+		{
+			FlushForCrash();
+			if (previous_terminate_handler) {
+				previous_terminate_handler();
+			}
+			std::abort();
+		}
+
+		void TiLoggerInstallCrashHandler()
+		{
+			static std::once_flag installed;
+			std::call_once(installed, [] {
+				previous_terminate_handler = std::set_terminate(FlushOnTerminate);
+			});
+		}
+	} // namespace detail
+}  // namespace Titanium
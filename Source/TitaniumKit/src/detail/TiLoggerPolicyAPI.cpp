@@ -32,7 +32,14 @@ namespace Titanium
 				api__->log(message);
 			} else {
 				// defaults to std::clog
-				std::clog << message << std::endl;
+				std::clog << message << '\n';
+			}
+		}
+
+		void TiLoggerPolicyAPI::Flush()
+		{
+			if (!api__) {
+				std::clog.flush();
 			}
 		}
 	} // namespace detail
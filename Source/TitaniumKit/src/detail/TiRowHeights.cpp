@@ -0,0 +1,248 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiRowHeights.hpp"
+#include <algorithm>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		TiRowHeights::TiRowHeights(const double& defaultHeight)
+			: defaultHeight__(defaultHeight)
+			, measuredHeight__(0)
+			, measuredCount__(0)
+			, templateCount__(0)
+			, dirty__(true)
+			, step__(0)
+		{
+		}
+
+		void TiRowHeights::Reset(const std::vector<std::uint32_t>& templates)
+		{
+			rows__.clear();
+			templateHeights__.assign(templateCount__, 0);
+			templateMeasured__.assign(templateCount__, 0);
+			measuredHeight__ = 0;
+			measuredCount__ = 0;
+			Insert(0, templates);
+		}
+
+		void TiRowHeights::Insert(const std::uint32_t& row, const std::vector<std::uint32_t>& templates)
+		{
+			for (const auto templateId : templates) {
+				if (templateId >= templateCount__) {
+					templateCount__ = templateId + 1;
+				}
+			}
+			templateHeights__.resize(templateCount__, 0);
+			templateMeasured__.resize(templateCount__, 0);
+
+			std::vector<Row> inserted;
+			inserted.reserve(templates.size());
+			for (const auto templateId : templates) {
+				inserted.push_back(Row { templateId, false, 0 });
+			}
+			rows__.insert(rows__.begin() + std::min<std::size_t>(row, rows__.size()), inserted.begin(), inserted.end());
+			dirty__ = true;
+		}
+
+		void TiRowHeights::Erase(const std::uint32_t& row, const std::uint32_t& count)
+		{
+			const auto first = rows__.begin() + std::min<std::size_t>(row, rows__.size());
+			const auto last = first + std::min<std::size_t>(count, rows__.end() - first);
+			for (auto it = first; it != last; ++it) {
+				Account(*it, -1);
+			}
+			rows__.erase(first, last);
+			dirty__ = true;
+		}
+
+		void TiRowHeights::Measure(const std::uint32_t& row, const double& height)
+		{
+			Change(row, true, height);
+		}
+
+		void TiRowHeights::Forget(const std::uint32_t& row)
+		{
+			Change(row, false, 0);
+		}
+
+		void TiRowHeights::Change(const std::uint32_t& index, const bool& measured, const double& height)
+		{
+			auto& row = rows__.at(index);
+			if (!dirty__) {
+				const auto delta = (measured ? height : 0) - (row.measured ? row.height : 0);
+				// Unsigned wrap-around makes a negative count subtract
+				const auto count = static_cast<std::uint32_t>(measured ? 0 : 1) - static_cast<std::uint32_t>(row.measured ? 0 : 1);
+				Update(index, delta, row.templateId, count);
+			}
+			Account(row, -1);
+			row.measured = measured;
+			row.height = height;
+			Account(row, 1);
+		}
+
+		void TiRowHeights::Account(const Row& row, const std::int32_t& sign)
+		{
+			if (!row.measured) {
+				return;
+			}
+			templateHeights__[row.templateId] += sign * row.height;
+			templateMeasured__[row.templateId] += static_cast<std::uint32_t>(sign);
+			measuredHeight__ += sign * row.height;
+			measuredCount__ += static_cast<std::uint32_t>(sign);
+		}
+
+		void TiRowHeights::Update(const std::uint32_t& row, const double& measured, const std::uint32_t& templateId, const std::uint32_t& unmeasured) const
+		{
+			for (auto i = row + 1; i < measured__.size(); i += i & (0 - i)) {
+				measured__[i] += measured;
+				unmeasured__[i * templateCount__ + templateId] += unmeasured;
+			}
+		}
+
+		void TiRowHeights::Rebuild() const
+		{
+			const auto n = static_cast<std::uint32_t>(rows__.size());
+			measured__.assign(n + 1, 0);
+			unmeasured__.assign((n + 1) * static_cast<std::size_t>(templateCount__), 0);
+
+			// Linear construction: each node passes its sums up to its parent
+			for (std::uint32_t i = 1; i <= n; i++) {
+				const auto& row = rows__[i - 1];
+				if (row.measured) {
+					measured__[i] += row.height;
+				} else {
+					unmeasured__[i * templateCount__ + row.templateId]++;
+				}
+				const auto parent = i + (i & (0 - i));
+				if (parent <= n) {
+					measured__[parent] += measured__[i];
+					for (std::uint32_t t = 0; t < templateCount__; t++) {
+						unmeasured__[parent * templateCount__ + t] += unmeasured__[i * templateCount__ + t];
+					}
+				}
+			}
+			step__ = 1;
+			while (step__ * 2 <= n) {
+				step__ *= 2;
+			}
+			if (n == 0) {
+				step__ = 0;
+			}
+			dirty__ = false;
+		}
+
+		std::vector<double> TiRowHeights::Estimates() const
+		{
+			std::vector<double> estimates(templateCount__);
+			for (std::uint32_t t = 0; t < templateCount__; t++) {
+				estimates[t] = Estimate(t);
+			}
+			return estimates;
+		}
+
+		bool TiRowHeights::IsMeasured(const std::uint32_t& row) const
+		{
+			return rows__.at(row).measured;
+		}
+
+		std::uint32_t TiRowHeights::get_templateAt(const std::uint32_t& row) const
+		{
+			return rows__.at(row).templateId;
+		}
+
+		double TiRowHeights::get_heightAt(const std::uint32_t& row) const
+		{
+			const auto& found = rows__.at(row);
+			return found.measured ? found.height : Estimate(found.templateId);
+		}
+
+		double TiRowHeights::Estimate(const std::uint32_t& templateId) const
+		{
+			if (templateId < templateCount__ && templateMeasured__[templateId] > 0) {
+				return templateHeights__[templateId] / templateMeasured__[templateId];
+			}
+			if (measuredCount__ > 0) {
+				return measuredHeight__ / measuredCount__;
+			}
+			return defaultHeight__;
+		}
+
+		double TiRowHeights::Offset(const std::uint32_t& row) const
+		{
+			if (dirty__) {
+				Rebuild();
+			}
+			const auto estimates = Estimates();
+			double offset = 0;
+			for (auto i = std::min<std::size_t>(row, rows__.size()); i > 0; i -= i & (0 - i)) {
+				offset += measured__[i];
+				for (std::uint32_t t = 0; t < templateCount__; t++) {
+					offset += unmeasured__[i * templateCount__ + t] * estimates[t];
+				}
+			}
+			return offset;
+		}
+
+		std::uint32_t TiRowHeights::RowAt(const double& offset) const
+		{
+			if (dirty__) {
+				Rebuild();
+			}
+			if (offset < 0) {
+				return 0;
+			}
+			const auto estimates = Estimates();
+			// Find the most rows whose total height does not pass offset
+			std::size_t position = 0;
+			auto remaining = offset;
+			for (auto step = step__; step > 0; step /= 2) {
+				const auto next = position + step;
+				if (next >= measured__.size()) {
+					continue;
+				}
+				auto height = measured__[next];
+				for (std::uint32_t t = 0; t < templateCount__; t++) {
+					height += unmeasured__[next * templateCount__ + t] * estimates[t];
+				}
+				if (height <= remaining) {
+					position = next;
+					remaining -= height;
+				}
+			}
+			return static_cast<std::uint32_t>(position);
+		}
+
+		double TiRowHeights::get_totalHeight() const
+		{
+			return Offset(size());
+		}
+
+		std::uint32_t TiRowHeights::get_measuredCount() const
+		{
+			return measuredCount__;
+		}
+
+		std::uint32_t TiRowHeights::size() const
+		{
+			return static_cast<std::uint32_t>(rows__.size());
+		}
+
+		double TiRowHeights::get_defaultHeight() const
+		{
+			return defaultHeight__;
+		}
+
+		void TiRowHeights::set_defaultHeight(const double& defaultHeight)
+		{
+			defaultHeight__ = defaultHeight;
+		}
+	} // namespace detail
+}  // namespace Titanium
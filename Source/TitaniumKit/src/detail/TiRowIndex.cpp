@@ -0,0 +1,153 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiRowIndex.hpp"
+#include <algorithm>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		TiRowIndex::TiRowIndex()
+			: tree__(1, 0)
+			, count__(0)
+			, step__(0)
+			, nextId__(0)
+		{
+		}
+
+		void TiRowIndex::Reset(const std::vector<std::uint32_t>& sizes)
+		{
+			sizes__ = sizes;
+			ids__.clear();
+			for (std::uint32_t i = 0; i < sizes.size(); i++) {
+				ids__.push_back(i);
+			}
+			nextId__ = static_cast<std::uint32_t>(sizes.size());
+			rows__.clear();
+			Build();
+		}
+
+		void TiRowIndex::SpliceSections(const std::uint32_t& section, const std::uint32_t& erased, const std::vector<std::uint32_t>& sizes)
+		{
+			const auto first = std::min<std::size_t>(section, sizes__.size());
+			const auto last = std::min<std::size_t>(first + erased, sizes__.size());
+			sizes__.erase(sizes__.begin() + first, sizes__.begin() + last);
+			ids__.erase(ids__.begin() + first, ids__.begin() + last);
+			sizes__.insert(sizes__.begin() + first, sizes.begin(), sizes.end());
+			std::vector<std::uint32_t> ids;
+			for (std::size_t i = 0; i < sizes.size(); i++) {
+				ids.push_back(nextId__++);
+			}
+			ids__.insert(ids__.begin() + first, ids.begin(), ids.end());
+			Build();
+		}
+
+		void TiRowIndex::Build()
+		{
+			const auto n = static_cast<std::uint32_t>(sizes__.size());
+			tree__.assign(n + 1, 0);
+			positions__.clear();
+			count__ = 0;
+
+			// Linear construction: each node passes its sum up to its parent
+			for (std::uint32_t i = 1; i <= n; i++) {
+				tree__[i] += sizes__[i - 1];
+				count__ += sizes__[i - 1];
+				const auto parent = i + (i & (0 - i));
+				if (parent <= n) {
+					tree__[parent] += tree__[i];
+				}
+				positions__.emplace(ids__[i - 1], i - 1);
+			}
+			step__ = 1;
+			while (step__ * 2 <= n) {
+				step__ *= 2;
+			}
+			if (n == 0) {
+				step__ = 0;
+			}
+		}
+
+		void TiRowIndex::Resize(const std::uint32_t& section, const std::int32_t& delta)
+		{
+			// Unsigned wrap-around makes a negative delta subtract
+			const auto change = static_cast<std::uint32_t>(delta);
+			for (auto i = section + 1; i < tree__.size(); i += i & (0 - i)) {
+				tree__[i] += change;
+			}
+			sizes__.at(section) += change;
+			count__ += change;
+		}
+
+		TiRowLocation TiRowIndex::Locate(const std::uint32_t& index) const
+		{
+			TiRowLocation location { false, get_sectionCount(), 0 };
+			if (index >= count__) {
+				return location;
+			}
+			// Find the last section whose offset is not above index
+			std::uint32_t position = 0;
+			auto remaining = index;
+			for (auto step = step__; step > 0; step /= 2) {
+				const auto next = position + step;
+				if (next < tree__.size() && tree__[next] <= remaining) {
+					position = next;
+					remaining -= tree__[next];
+				}
+			}
+			location.found = true;
+			location.section = position;
+			location.row = remaining;
+			return location;
+		}
+
+		std::uint32_t TiRowIndex::Offset(const std::uint32_t& section) const
+		{
+			std::uint32_t offset = 0;
+			for (auto i = std::min<std::size_t>(section, tree__.size() - 1); i > 0; i -= i & (0 - i)) {
+				offset += tree__[i];
+			}
+			return offset;
+		}
+
+		void TiRowIndex::InsertRow(const void* row, const std::uint32_t& section)
+		{
+			rows__[row] = ids__.at(section);
+		}
+
+		void TiRowIndex::EraseRow(const void* row)
+		{
+			rows__.erase(row);
+		}
+
+		bool TiRowIndex::FindRow(const void* row, std::uint32_t& section) const
+		{
+			const auto found = rows__.find(row);
+			if (found == rows__.end()) {
+				return false;
+			}
+			const auto position = positions__.find(found->second);
+			if (position == positions__.end()) {
+				return false;
+			}
+			section = position->second;
+			return true;
+		}
+
+		std::uint32_t TiRowIndex::get_rowCount() const
+		{
+			return count__;
+		}
+
+		std::uint32_t TiRowIndex::get_sectionCount() const
+		{
+			return static_cast<std::uint32_t>(tree__.size() - 1);
+		}
+	} // namespace detail
+}  // namespace Titanium
@@ -0,0 +1,169 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiSearchIndex.hpp"
+#include <algorithm>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		TiSearchIndex::TiSearchIndex()
+			: posted__(0)
+			, stale__(0)
+			, last_valid__(false)
+			, last_case_insensitive__(false)
+		{
+		}
+
+		std::string TiSearchIndex::Fold(const std::string& text)
+		{
+			std::string folded(text);
+			for (auto& c : folded) {
+				if (c >= 'A' && c <= 'Z') {
+					c = static_cast<char>(c - 'A' + 'a');
+				}
+			}
+			return folded;
+		}
+
+		std::vector<std::uint32_t> TiSearchIndex::Trigrams(const std::string& folded)
+		{
+			std::vector<std::uint32_t> trigrams;
+			if (folded.size() < 3) {
+				return trigrams;
+			}
+			trigrams.reserve(folded.size() - 2);
+			for (std::size_t i = 0; i + 2 < folded.size(); i++) {
+				trigrams.push_back(
+					(static_cast<std::uint32_t>(static_cast<unsigned char>(folded[i])) << 16) |
+					(static_cast<std::uint32_t>(static_cast<unsigned char>(folded[i + 1])) << 8) |
+					static_cast<std::uint32_t>(static_cast<unsigned char>(folded[i + 2])));
+			}
+			std::sort(trigrams.begin(), trigrams.end());
+			trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+			return trigrams;
+		}
+
+		void TiSearchIndex::Insert(const std::uint32_t& id, const std::string& text)
+		{
+			Erase(id);
+
+			Document document;
+			document.text = text;
+			document.folded = Fold(text);
+			for (const auto trigram : Trigrams(document.folded)) {
+				postings__[trigram].push_back(id);
+				posted__++;
+			}
+			documents__.emplace(id, std::move(document));
+			last_valid__ = false;
+		}
+
+		void TiSearchIndex::Erase(const std::uint32_t& id)
+		{
+			const auto found = documents__.find(id);
+			if (found == documents__.end()) {
+				return;
+			}
+			stale__ += Trigrams(found->second.folded).size();
+			documents__.erase(found);
+			last_valid__ = false;
+			if (stale__ > posted__ - stale__) {
+				Compact();
+			}
+		}
+
+		void TiSearchIndex::Clear()
+		{
+			documents__.clear();
+			postings__.clear();
+			posted__ = 0;
+			stale__ = 0;
+			last_valid__ = false;
+		}
+
+		void TiSearchIndex::Compact()
+		{
+			postings__.clear();
+			posted__ = 0;
+			stale__ = 0;
+			for (const auto& document : documents__) {
+				for (const auto trigram : Trigrams(document.second.folded)) {
+					postings__[trigram].push_back(document.first);
+					posted__++;
+				}
+			}
+		}
+
+		std::vector<std::uint32_t> TiSearchIndex::Search(const std::string& query, const bool& caseInsensitive)
+		{
+			const auto folded = Fold(query);
+			const auto& needle = caseInsensitive ? folded : query;
+			const auto matches = [&](const std::uint32_t& id) {
+				const auto found = documents__.find(id);
+				if (found == documents__.end()) {
+					return false;
+				}
+				const auto& haystack = caseInsensitive ? found->second.folded : found->second.text;
+				return haystack.find(needle) != std::string::npos;
+			};
+
+			std::vector<std::uint32_t> result;
+			if (last_valid__ && last_case_insensitive__ == caseInsensitive && needle.find(last_query__) != std::string::npos) {
+				// Refining the last query; its result already holds every match
+				for (const auto id : last_result__) {
+					if (matches(id)) {
+						result.push_back(id);
+					}
+				}
+			} else if (folded.size() >= 3) {
+				const std::vector<std::uint32_t>* shortest = nullptr;
+				for (const auto trigram : Trigrams(folded)) {
+					const auto found = postings__.find(trigram);
+					if (found == postings__.end()) {
+						shortest = nullptr;
+						break;
+					}
+					if (shortest == nullptr || found->second.size() < shortest->size()) {
+						shortest = &found->second;
+					}
+				}
+				if (shortest != nullptr) {
+					// Stale and re-inserted documents may be listed twice
+					auto candidates = *shortest;
+					std::sort(candidates.begin(), candidates.end());
+					candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+					for (const auto id : candidates) {
+						if (matches(id)) {
+							result.push_back(id);
+						}
+					}
+				}
+			} else {
+				for (const auto& document : documents__) {
+					if (matches(document.first)) {
+						result.push_back(document.first);
+					}
+				}
+				std::sort(result.begin(), result.end());
+			}
+
+			last_valid__ = true;
+			last_case_insensitive__ = caseInsensitive;
+			last_query__ = needle;
+			last_result__ = result;
+			return result;
+		}
+
+		std::size_t TiSearchIndex::size() const
+		{
+			return documents__.size();
+		}
+	} // namespace detail
+}  // namespace Titanium
@@ -0,0 +1,92 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiThreadPool.hpp"
+#include "Titanium/detail/TiLogger.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		TiThreadPool::TiThreadPool(const std::size_t& thread_count)
+		{
+			const auto count = std::max<std::size_t>(1, thread_count);
+			threads__.reserve(count);
+			for (std::size_t i = 0; i < count; i++) {
+				threads__.emplace_back(&TiThreadPool::Run, this);
+			}
+		}
+
+		TiThreadPool::~TiThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				stopping__ = true;
+			}
+			condition__.notify_all();
+			for (auto& thread : threads__) {
+				if (thread.joinable()) {
+					thread.join();
+				}
+			}
+		}
+
+		void TiThreadPool::Post(std::function<void()> task)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex__);
+				tasks__.push_back(std::move(task));
+			}
+			condition__.notify_one();
+		}
+
+		std::size_t TiThreadPool::get_thread_count() const
+		{
+			return threads__.size();
+		}
+
+		TiThreadPool& TiThreadPool::IOPool()
+		{
+			// I/O workers mostly sleep in the kernel, so a handful is plenty.
+			static TiThreadPool pool(std::min<std::size_t>(4, std::max<std::size_t>(2, std::thread::hardware_concurrency())));
+			return pool;
+		}
+
+		TiThreadPool& TiThreadPool::ComputePool()
+		{
+			// Leave a core to the JS thread that consumes the results.
+			static TiThreadPool pool(std::min<std::size_t>(4, std::max<std::size_t>(1, std::thread::hardware_concurrency() - 1)));
+			return pool;
+		}
+
+		void TiThreadPool::Run()
+		{
+			while (true) {
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(mutex__);
+					condition__.wait(lock, [this] { return stopping__ || !tasks__.empty(); });
+					if (stopping__ && tasks__.empty()) {
+						return;
+					}
+					task = std::move(tasks__.front());
+					tasks__.pop_front();
+				}
+				try {
+					task();
+				} catch (const std::exception& e) {
+					TITANIUM_LOG_ERROR("TiThreadPool: task threw ", e.what());
+				} catch (...) {
+					TITANIUM_LOG_ERROR("TiThreadPool: task threw an unknown exception");
+				}
+			}
+		}
+	} // namespace detail
+}  // namespace Titanium
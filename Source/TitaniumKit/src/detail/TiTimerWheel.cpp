@@ -0,0 +1,195 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiTimerWheel.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		TiTimerWheel::TiTimerWheel(const std::chrono::milliseconds& resolution, const std::chrono::milliseconds& now)
+			: resolution__(std::max(resolution, std::chrono::milliseconds(1)))
+			, current__(0)
+		{
+			slots__[0].resize(1 << RootBits);
+			for (std::size_t level = 1; level < Levels; level++) {
+				slots__[level].resize(1 << LevelBits);
+			}
+			current__ = ToTick(now, false);
+		}
+
+		std::uint64_t TiTimerWheel::ToTick(const std::chrono::milliseconds& time, const bool& round_up) const
+		{
+			const auto count = static_cast<std::uint64_t>(std::max<std::chrono::milliseconds::rep>(time.count(), 0));
+			const auto resolution = static_cast<std::uint64_t>(resolution__.count());
+			return round_up ? (count + resolution - 1) / resolution : count / resolution;
+		}
+
+		void TiTimerWheel::Schedule(const std::uint32_t& id, const std::chrono::milliseconds& delay, const bool& repeating, const std::chrono::milliseconds& now)
+		{
+			Cancel(id);
+
+			// Nothing to walk through after an idle gap, start from now
+			if (entries__.empty()) {
+				current__ = std::max(current__, ToTick(now, false));
+			}
+
+			Entry entry;
+			// Rounding up keeps the delay a lower bound
+			entry.expires = std::max(ToTick(now + delay, true), current__ + 1);
+			entry.interval = repeating ? std::max<std::uint64_t>(ToTick(delay, true), 1) : 0;
+			const auto inserted = entries__.emplace(id, entry);
+			Insert(id, inserted.first->second);
+		}
+
+		bool TiTimerWheel::Cancel(const std::uint32_t& id)
+		{
+			const auto found = entries__.find(id);
+			if (found == entries__.end()) {
+				return false;
+			}
+			slots__[found->second.level][found->second.slot].erase(found->second.position);
+			entries__.erase(found);
+			return true;
+		}
+
+		void TiTimerWheel::Insert(const std::uint32_t& id, Entry& entry)
+		{
+			const auto delta = entry.expires > current__ ? entry.expires - current__ : 0;
+			auto placed = entry.expires;
+			entry.level = 0;
+			while (entry.level + 1 < Levels && delta >= (std::uint64_t(1) << (RootBits + LevelBits * entry.level))) {
+				entry.level++;
+			}
+			if (entry.level + 1 == Levels) {
+				// Beyond the top level; park in its furthest slot and place again when it comes around
+				const auto span = std::uint64_t(1) << (RootBits + LevelBits * entry.level);
+				placed = current__ + std::min(delta, span - 1);
+			}
+			if (entry.level == 0) {
+				entry.slot = static_cast<std::size_t>(placed & ((1 << RootBits) - 1));
+			} else {
+				entry.slot = static_cast<std::size_t>((placed >> (RootBits + LevelBits * (entry.level - 1))) & ((1 << LevelBits) - 1));
+			}
+			auto& slot = slots__[entry.level][entry.slot];
+			entry.position = slot.insert(slot.end(), id);
+		}
+
+		bool TiTimerWheel::Cascade(const std::size_t& level)
+		{
+			const auto index = static_cast<std::size_t>((current__ >> (RootBits + LevelBits * (level - 1))) & ((1 << LevelBits) - 1));
+			std::list<std::uint32_t> pending;
+			pending.swap(slots__[level][index]);
+			while (!pending.empty()) {
+				const auto id = pending.front();
+				pending.pop_front();
+				Insert(id, entries__.at(id));
+			}
+			return index == 0;
+		}
+
+		std::vector<TiTimerWheelExpired> TiTimerWheel::Advance(const std::chrono::milliseconds& now)
+		{
+			std::vector<TiTimerWheelExpired> expired;
+			const auto target = ToTick(now, false);
+			while (current__ < target) {
+				// Nothing happens on the ticks in between
+				const auto next = entries__.empty() ? target + 1 : NextTick();
+				if (next > target) {
+					current__ = target;
+					break;
+				}
+				current__ = next;
+
+				if ((current__ & ((1 << RootBits) - 1)) == 0) {
+					for (std::size_t level = 1; level < Levels && Cascade(level); level++) {
+					}
+				}
+
+				std::list<std::uint32_t> due;
+				due.swap(slots__[0][static_cast<std::size_t>(current__ & ((1 << RootBits) - 1))]);
+				for (const auto id : due) {
+					const auto found = entries__.find(id);
+					auto& entry = found->second;
+					if (entry.interval == 0) {
+						entries__.erase(found);
+						expired.push_back({ id, false });
+						continue;
+					}
+					// Runs missed while the wheel was not driven collapse into this one
+					entry.expires = current__ + entry.interval;
+					if (entry.expires <= target) {
+						entry.expires = target + entry.interval;
+					}
+					Insert(id, entry);
+					expired.push_back({ id, true });
+				}
+			}
+			return expired;
+		}
+
+		std::chrono::milliseconds TiTimerWheel::NextExpiry() const
+		{
+			return std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(NextTick() * static_cast<std::uint64_t>(resolution__.count())));
+		}
+
+		std::uint64_t TiTimerWheel::NextTick() const
+		{
+			const auto root_mask = (std::uint64_t(1) << RootBits) - 1;
+			const auto level_mask = (std::uint64_t(1) << LevelBits) - 1;
+
+			// The first level holds the timers due within its span
+			auto next = std::numeric_limits<std::uint64_t>::max();
+			for (std::uint64_t tick = current__ + 1; tick <= current__ + root_mask; tick++) {
+				if (!slots__[0][static_cast<std::size_t>(tick & root_mask)].empty()) {
+					next = tick;
+					break;
+				}
+			}
+
+			// A higher level slot cascades when the tick reaches its start,
+			// which is no later than any timer in it.
+			for (std::size_t level = 1; level < Levels; level++) {
+				const auto shift = RootBits + LevelBits * (level - 1);
+				for (std::uint64_t step = 1; step <= level_mask + 1; step++) {
+					const auto start = ((current__ >> shift) + step) << shift;
+					if (start >= next) {
+						break;
+					}
+					if (!slots__[level][static_cast<std::size_t>((start >> shift) & level_mask)].empty()) {
+						next = start;
+						break;
+					}
+				}
+			}
+			return next;
+		}
+
+		bool TiTimerWheel::Contains(const std::uint32_t& id) const
+		{
+			return entries__.find(id) != entries__.end();
+		}
+
+		bool TiTimerWheel::empty() const
+		{
+			return entries__.empty();
+		}
+
+		std::size_t TiTimerWheel::size() const
+		{
+			return entries__.size();
+		}
+
+		std::chrono::milliseconds TiTimerWheel::get_resolution() const
+		{
+			return resolution__;
+		}
+	} // namespace detail
+}  // namespace Titanium
@@ -0,0 +1,360 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiTrace.hpp"
+#include <cstdio>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiTraceSegment
+		{
+			char* base { nullptr };
+			std::size_t capacity { 0 };
+			std::atomic<std::size_t> offset { 0 };
+			// Writers between Reserve and Commit; the segment is unmapped
+			// only once this drops to zero.
+			std::atomic<std::uint32_t> writers { 0 };
+#ifdef _WIN32
+			HANDLE file { INVALID_HANDLE_VALUE };
+			HANDLE mapping { nullptr };
+#else
+			int fd { -1 };
+#endif
+		};
+
+		struct TiTraceCallSite
+		{
+			TiLoggerSeverityType severity;
+			std::string file;
+			std::uint32_t line;
+			std::string format;
+		};
+
+		struct TiTraceState
+		{
+			// Guards everything below except current, which writers read
+			// without it.
+			std::mutex mutex;
+			std::atomic<TiTraceSegment*> current { nullptr };
+			std::string path;
+			std::size_t segment_size { 0 };
+			std::size_t max_segments { 0 };
+			std::uint64_t sequence { 0 };
+			std::vector<TiTraceCallSite> sites;
+			std::atomic<std::uint64_t> dropped { 0 };
+		};
+
+		static TiTraceState& State()
+		{
+			static TiTraceState state;
+			return state;
+		}
+
+		std::atomic<bool> TiTrace::enabled__ { false };
+
+		static TiTraceSegment* MapSegment(const std::string& path, const std::size_t& capacity)
+		{
+			std::unique_ptr<TiTraceSegment> segment(new TiTraceSegment());
+			segment->capacity = capacity;
+#ifdef _WIN32
+			const std::wstring wide_path(path.begin(), path.end());
+			segment->file = CreateFile2(wide_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, CREATE_ALWAYS, nullptr);
+			if (segment->file == INVALID_HANDLE_VALUE) {
+				return nullptr;
+			}
+			// Sizing the mapping beyond the end of the file grows the file
+			segment->mapping = CreateFileMappingFromApp(segment->file, nullptr, PAGE_READWRITE, capacity, nullptr);
+			if (segment->mapping == nullptr) {
+				CloseHandle(segment->file);
+				return nullptr;
+			}
+			segment->base = static_cast<char*>(MapViewOfFileFromApp(segment->mapping, FILE_MAP_WRITE, 0, capacity));
+			if (segment->base == nullptr) {
+				CloseHandle(segment->mapping);
+				CloseHandle(segment->file);
+				return nullptr;
+			}
+#else
+			segment->fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+			if (segment->fd < 0) {
+				return nullptr;
+			}
+			if (::ftruncate(segment->fd, static_cast<off_t>(capacity)) != 0) {
+				::close(segment->fd);
+				return nullptr;
+			}
+			int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+			// Fault the pages in now rather than on the writers' time
+			flags |= MAP_POPULATE;
+#endif
+			const auto base = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, flags, segment->fd, 0);
+			if (base == MAP_FAILED) {
+				::close(segment->fd);
+				return nullptr;
+			}
+			segment->base = static_cast<char*>(base);
+#endif
+			return segment.release();
+		}
+
+		static void UnmapSegment(TiTraceSegment* segment)
+		{
+			// Trim the unused tail so closed segments only take what they hold
+			const auto used = std::min(segment->offset.load(), segment->capacity);
+#ifdef _WIN32
+			UnmapViewOfFile(segment->base);
+			CloseHandle(segment->mapping);
+			LARGE_INTEGER size;
+			size.QuadPart = static_cast<LONGLONG>(used);
+			if (SetFilePointerEx(segment->file, size, nullptr, FILE_BEGIN)) {
+				SetEndOfFile(segment->file);
+			}
+			CloseHandle(segment->file);
+#else
+			::munmap(segment->base, segment->capacity);
+			if (::ftruncate(segment->fd, static_cast<off_t>(used)) != 0) {
+				// The tail is zero and the decoder stops there anyway
+			}
+			::close(segment->fd);
+#endif
+			delete segment;
+		}
+
+		static std::vector<char> EncodeSite(const std::uint32_t& id, const TiTraceCallSite& site)
+		{
+			TiTraceSite body;
+			body.site = id;
+			body.line = site.line;
+			body.file_length = static_cast<std::uint16_t>(std::min<std::size_t>(site.file.size(), 0xFFFF));
+			body.format_length = static_cast<std::uint16_t>(std::min<std::size_t>(site.format.size(), 0xFFFF));
+			body.reserved = 0;
+
+			TiTraceRecordHeader header;
+			header.size = TiTraceAlign(sizeof(header) + sizeof(body) + body.file_length + body.format_length);
+			header.type = static_cast<std::uint8_t>(TiTraceRecordType::Site);
+			header.severity = static_cast<std::uint8_t>(site.severity);
+			header.argc = 0;
+
+			std::vector<char> record(header.size, 0);
+			std::memcpy(record.data(), &header, sizeof(header));
+			std::memcpy(record.data() + sizeof(header), &body, sizeof(body));
+			std::memcpy(record.data() + sizeof(header) + sizeof(body), site.file.data(), body.file_length);
+			std::memcpy(record.data() + sizeof(header) + sizeof(body) + body.file_length, site.format.data(), body.format_length);
+			return record;
+		}
+
+		// Switches to the next segment. Called with state.mutex held.
+		static void RotateLocked(TiTraceState& state)
+		{
+			const auto previous = state.current.load();
+			const auto path = state.path + "." + std::to_string(state.sequence % state.max_segments);
+			const auto next = MapSegment(path, state.segment_size);
+
+			if (next != nullptr) {
+				TiTraceFileHeader header;
+				std::memset(&header, 0, sizeof(header));
+				std::memcpy(header.magic, TiTraceMagic, sizeof(header.magic));
+				header.version = TiTraceVersion;
+				header.header_size = sizeof(header);
+				header.capacity = state.segment_size;
+				header.sequence = state.sequence;
+				header.system_clock_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+				header.steady_clock_ns = TiTrace::Now();
+				std::memcpy(next->base, &header, sizeof(header));
+
+				// Every segment carries all sites so it can be decoded on its own
+				std::size_t offset = sizeof(header);
+				for (std::size_t i = 0; i < state.sites.size(); i++) {
+					const auto record = EncodeSite(static_cast<std::uint32_t>(i + 1), state.sites[i]);
+					if (offset + record.size() > next->capacity) {
+						break;
+					}
+					std::memcpy(next->base + offset, record.data(), record.size());
+					offset += record.size();
+				}
+				next->offset = offset;
+				state.sequence++;
+			}
+
+			state.current.store(next);
+
+			if (previous != nullptr) {
+				while (previous->writers.load() != 0) {
+					std::this_thread::yield();
+				}
+				UnmapSegment(previous);
+			}
+		}
+
+		static char* ReserveImpl(TiTraceState& state, const std::uint32_t& size, void*& reserved, const bool& locked)
+		{
+			while (true) {
+				const auto segment = state.current.load();
+				if (segment == nullptr) {
+					return nullptr;
+				}
+
+				// Announce ourselves, then make sure the segment was not retired
+				// in the meantime; RotateLocked publishes first and waits second.
+				segment->writers.fetch_add(1);
+				if (state.current.load() != segment) {
+					segment->writers.fetch_sub(1);
+					continue;
+				}
+
+				const auto offset = segment->offset.fetch_add(size, std::memory_order_relaxed);
+				if (offset + size <= segment->capacity) {
+					reserved = segment;
+					return segment->base + offset;
+				}
+				const auto too_large = size > segment->capacity - sizeof(TiTraceFileHeader);
+				segment->writers.fetch_sub(1);
+
+				if (too_large) {
+					state.dropped++;
+					return nullptr;
+				}
+
+				// Whoever gets the lock first rotates; the rest find a fresh segment
+				std::unique_lock<std::mutex> lock(state.mutex, std::defer_lock);
+				if (!locked) {
+					lock.lock();
+				}
+				const auto current = state.current.load();
+				if (current != nullptr && current->offset.load() + size > current->capacity) {
+					RotateLocked(state);
+				}
+			}
+		}
+
+		char* TiTrace::Reserve(const std::uint32_t& size, void*& segment)
+		{
+			return ReserveImpl(State(), size, segment, false);
+		}
+
+		void TiTrace::Commit(void* segment, char* record, const TiTraceRecordHeader& header)
+		{
+			std::memcpy(record + sizeof(header.size), reinterpret_cast<const char*>(&header) + sizeof(header.size), sizeof(header) - sizeof(header.size));
+			// A reader that sees the size sees the whole record
+			std::atomic_thread_fence(std::memory_order_release);
+			std::memcpy(record, &header.size, sizeof(header.size));
+			static_cast<TiTraceSegment*>(segment)->writers.fetch_sub(1, std::memory_order_release);
+		}
+
+		static void CloseLocked(TiTraceState& state)
+		{
+			const auto previous = state.current.exchange(nullptr);
+			if (previous != nullptr) {
+				while (previous->writers.load() != 0) {
+					std::this_thread::yield();
+				}
+				UnmapSegment(previous);
+			}
+		}
+
+		bool TiTrace::Open(const std::string& path, const std::size_t& segment_size, const std::size_t& max_segments)
+		{
+			auto& state = State();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			enabled__ = false;
+			CloseLocked(state);
+
+			state.path = path;
+			state.segment_size = std::max<std::size_t>(segment_size, 64 * 1024);
+			state.max_segments = std::max<std::size_t>(max_segments, 1);
+			state.sequence = 0;
+			state.dropped = 0;
+
+			// Leftovers from an earlier run would be decoded as part of this one
+			for (std::size_t i = 0; i < state.max_segments; i++) {
+				std::remove((path + "." + std::to_string(i)).c_str());
+			}
+
+			RotateLocked(state);
+			enabled__ = state.current.load() != nullptr;
+			return enabled__;
+		}
+
+		void TiTrace::Close()
+		{
+			auto& state = State();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			enabled__ = false;
+			CloseLocked(state);
+		}
+
+		void TiTrace::Flush()
+		{
+			auto& state = State();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			const auto segment = state.current.load();
+			if (segment == nullptr) {
+				return;
+			}
+#ifdef _WIN32
+			FlushViewOfFile(segment->base, 0);
+#else
+			::msync(segment->base, segment->capacity, MS_ASYNC);
+#endif
+		}
+
+		std::uint32_t TiTrace::Intern(const TiLoggerSeverityType& severity, const char* file, const std::uint32_t& line, const char* format)
+		{
+			auto& state = State();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			state.sites.push_back({ severity, file, line, format });
+			const auto id = static_cast<std::uint32_t>(state.sites.size());
+
+			// Later segments get it from RotateLocked; the current one needs it now
+			const auto record = EncodeSite(id, state.sites.back());
+			void* segment = nullptr;
+			const auto reserved = ReserveImpl(state, static_cast<std::uint32_t>(record.size()), segment, true);
+			if (reserved != nullptr) {
+				std::memcpy(reserved + sizeof(TiTraceRecordHeader), record.data() + sizeof(TiTraceRecordHeader), record.size() - sizeof(TiTraceRecordHeader));
+				TiTraceRecordHeader header;
+				std::memcpy(&header, record.data(), sizeof(header));
+				Commit(segment, reserved, header);
+			}
+			return id;
+		}
+
+		std::uint64_t TiTrace::get_dropped()
+		{
+			return State().dropped;
+		}
+
+		std::uint64_t TiTrace::get_segments()
+		{
+			auto& state = State();
+			std::lock_guard<std::mutex> lock(state.mutex);
+			return state.sequence;
+		}
+
+		std::uint32_t TiTrace::ThreadId()
+		{
+			static std::atomic<std::uint32_t> next { 0 };
+			static TITANIUM_THREAD_LOCAL std::uint32_t id = 0;
+			if (id == 0) {
+				id = ++next;
+			}
+			return id;
+		}
+	} // namespace detail
+}  // namespace Titanium
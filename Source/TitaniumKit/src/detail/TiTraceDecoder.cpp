@@ -0,0 +1,314 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiTraceDecoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Titanium
+{
+	namespace detail
+	{
+		struct TiTraceDecodedSite
+		{
+			std::uint8_t severity;
+			std::string file;
+			std::uint32_t line;
+			std::string format;
+		};
+
+		// Bounds-checked reads over one segment
+		class TiTraceReader final
+		{
+		public:
+			TiTraceReader(const std::vector<char>& data, const std::size_t& begin, const std::size_t& end)
+				: data__(data)
+				, position__(begin)
+				, end__(end)
+			{
+			}
+
+			template <typename T>
+			T Read()
+			{
+				Check(sizeof(T));
+				T value;
+				std::memcpy(&value, data__.data() + position__, sizeof(T));
+				position__ += sizeof(T);
+				return value;
+			}
+
+			std::string ReadString(const std::size_t& length)
+			{
+				Check(length);
+				std::string value(data__.data() + position__, length);
+				position__ += length;
+				return value;
+			}
+
+		private:
+			void Check(const std::size_t& length) const
+			{
+				if (length > end__ - position__) {
+					throw std::runtime_error("TiTraceDecoder: record is truncated");
+				}
+			}
+
+			const std::vector<char>& data__;
+			std::size_t position__;
+			const std::size_t end__;
+		};
+
+		static TiTraceDecodedArg ReadArg(TiTraceReader& reader)
+		{
+			TiTraceDecodedArg arg { TiTraceArgType::Int, 0, 0, 0, false, "" };
+			arg.type = static_cast<TiTraceArgType>(reader.Read<std::uint8_t>());
+			switch (arg.type) {
+				case TiTraceArgType::Int:
+					arg.int_value = reader.Read<std::int64_t>();
+					break;
+				case TiTraceArgType::UInt:
+					arg.uint_value = reader.Read<std::uint64_t>();
+					break;
+				case TiTraceArgType::Double:
+					arg.double_value = reader.Read<double>();
+					break;
+				case TiTraceArgType::Bool:
+					arg.bool_value = reader.Read<std::uint8_t>() != 0;
+					break;
+				case TiTraceArgType::String:
+					arg.string_value = reader.ReadString(reader.Read<std::uint16_t>());
+					break;
+				default:
+					throw std::runtime_error("TiTraceDecoder: unknown argument type");
+			}
+			return arg;
+		}
+
+		void TiTraceDecoder::Load(const std::string& path)
+		{
+			std::ifstream stream(path, std::ios_base::binary);
+			if (!stream.is_open()) {
+				throw std::runtime_error("TiTraceDecoder: unable to open " + path);
+			}
+			const std::vector<char> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+			TiTraceFileHeader header;
+			if (data.size() < sizeof(header)) {
+				throw std::runtime_error("TiTraceDecoder: " + path + " is not a trace segment");
+			}
+			std::memcpy(&header, data.data(), sizeof(header));
+			if (std::memcmp(header.magic, TiTraceMagic, sizeof(header.magic)) != 0 || header.version != TiTraceVersion || header.header_size < sizeof(header)) {
+				throw std::runtime_error("TiTraceDecoder: " + path + " is not a trace segment");
+			}
+
+			std::unordered_map<std::uint32_t, TiTraceDecodedSite> sites;
+			std::size_t offset = header.header_size;
+			while (data.size() - offset >= sizeof(TiTraceRecordHeader)) {
+				TiTraceRecordHeader record;
+				std::memcpy(&record, data.data() + offset, sizeof(record));
+				if (record.size == 0) {
+					break;
+				}
+				if (record.size < sizeof(record) || record.size > data.size() - offset) {
+					throw std::runtime_error("TiTraceDecoder: " + path + " has a corrupt record");
+				}
+
+				TiTraceReader reader(data, offset + sizeof(record), offset + record.size);
+				const auto type = static_cast<TiTraceRecordType>(record.type);
+				if (type == TiTraceRecordType::Site) {
+					const auto body = reader.Read<TiTraceSite>();
+					TiTraceDecodedSite site;
+					site.severity = record.severity;
+					site.line = body.line;
+					site.file = reader.ReadString(body.file_length);
+					site.format = reader.ReadString(body.format_length);
+					sites[body.site] = site;
+				} else if (type == TiTraceRecordType::Event) {
+					const auto body = reader.Read<TiTraceEvent>();
+					TiTraceDecodedEvent event;
+					event.sequence = header.sequence;
+					event.system_clock_ns = header.system_clock_ns + (body.steady_clock_ns - header.steady_clock_ns);
+					event.thread = body.thread;
+					event.severity = record.severity;
+					event.site = body.site;
+					event.line = 0;
+					const auto site = sites.find(body.site);
+					if (site != sites.end()) {
+						event.file = site->second.file;
+						event.line = site->second.line;
+						event.format = site->second.format;
+					}
+					for (std::uint16_t i = 0; i < record.argc; i++) {
+						event.args.push_back(ReadArg(reader));
+					}
+					events__.push_back(event);
+				}
+				// Unknown record types are skipped, newer writers may add some
+				offset += record.size;
+			}
+		}
+
+		std::vector<TiTraceDecodedEvent> TiTraceDecoder::get_events() const
+		{
+			auto events = events__;
+			std::stable_sort(events.begin(), events.end(), [](const TiTraceDecodedEvent& a, const TiTraceDecodedEvent& b) {
+				return a.sequence < b.sequence;
+			});
+			return events;
+		}
+
+		static std::string ArgToString(const TiTraceDecodedArg& arg)
+		{
+			std::ostringstream stream;
+			switch (arg.type) {
+				case TiTraceArgType::Int:
+					stream << arg.int_value;
+					break;
+				case TiTraceArgType::UInt:
+					stream << arg.uint_value;
+					break;
+				case TiTraceArgType::Double:
+					stream << arg.double_value;
+					break;
+				case TiTraceArgType::Bool:
+					stream << (arg.bool_value ? "true" : "false");
+					break;
+				case TiTraceArgType::String:
+					stream << arg.string_value;
+					break;
+			}
+			return stream.str();
+		}
+
+		std::string TiTraceDecoder::Format(const TiTraceDecodedEvent& event)
+		{
+			std::string message;
+			std::size_t next = 0;
+			std::size_t position = 0;
+			while (true) {
+				const auto placeholder = event.format.find("{}", position);
+				if (placeholder == std::string::npos || next == event.args.size()) {
+					break;
+				}
+				message += event.format.substr(position, placeholder - position);
+				message += ArgToString(event.args[next++]);
+				position = placeholder + 2;
+			}
+			message += event.format.substr(position);
+
+			// Arguments without a placeholder are not lost
+			for (; next < event.args.size(); next++) {
+				message += " " + ArgToString(event.args[next]);
+			}
+			return message;
+		}
+
+		static const char* SeverityName(const std::uint8_t& severity)
+		{
+			static const char* names[] = { "TRACE", "DEBUG", "INFO", "WARN", "ERROR" };
+			return severity < 5 ? names[severity] : "?";
+		}
+
+		static std::string FormatTime(const std::int64_t& system_clock_ns)
+		{
+			const auto seconds = static_cast<std::time_t>(system_clock_ns / 1000000000);
+			const auto nanoseconds = static_cast<long>(system_clock_ns % 1000000000);
+			char date[32];
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::gmtime(&seconds));
+			char fraction[16];
+			std::snprintf(fraction, sizeof(fraction), ".%09ldZ", nanoseconds);
+			return std::string(date) + fraction;
+		}
+
+		std::string TiTraceDecoder::ToText(const TiTraceDecodedEvent& event)
+		{
+			std::ostringstream stream;
+			stream << FormatTime(event.system_clock_ns) << " [" << SeverityName(event.severity) << "] ";
+			stream << "t" << event.thread << " " << event.file << ":" << event.line << " " << Format(event);
+			return stream.str();
+		}
+
+		static std::string QuoteJSON(const std::string& value)
+		{
+			std::string quoted = "\"";
+			for (const auto c : value) {
+				switch (c) {
+					case '"':
+						quoted += "\\\"";
+						break;
+					case '\\':
+						quoted += "\\\\";
+						break;
+					case '\n':
+						quoted += "\\n";
+						break;
+					case '\r':
+						quoted += "\\r";
+						break;
+					case '\t':
+						quoted += "\\t";
+						break;
+					default:
+						if (static_cast<unsigned char>(c) < 0x20) {
+							char escaped[8];
+							std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+							quoted += escaped;
+						} else {
+							quoted += c;
+						}
+				}
+			}
+			return quoted + "\"";
+		}
+
+		std::string TiTraceDecoder::ToJSON(const TiTraceDecodedEvent& event)
+		{
+			std::ostringstream stream;
+			stream << "{\"time\":" << QuoteJSON(FormatTime(event.system_clock_ns));
+			stream << ",\"time_ns\":" << event.system_clock_ns;
+			stream << ",\"severity\":" << QuoteJSON(SeverityName(event.severity));
+			stream << ",\"thread\":" << event.thread;
+			stream << ",\"file\":" << QuoteJSON(event.file);
+			stream << ",\"line\":" << event.line;
+			stream << ",\"format\":" << QuoteJSON(event.format);
+			stream << ",\"message\":" << QuoteJSON(Format(event));
+			stream << ",\"args\":[";
+			for (std::size_t i = 0; i < event.args.size(); i++) {
+				const auto& arg = event.args[i];
+				if (i > 0) {
+					stream << ",";
+				}
+				if (arg.type == TiTraceArgType::String) {
+					stream << QuoteJSON(arg.string_value);
+				} else if (arg.type == TiTraceArgType::Double) {
+					if (std::isfinite(arg.double_value)) {
+						std::ostringstream number;
+						number << std::setprecision(17) << arg.double_value;
+						stream << number.str();
+					} else {
+						stream << "null";
+					}
+				} else {
+					stream << ArgToString(arg);
+				}
+			}
+			stream << "]}";
+			return stream.str();
+		}
+	} // namespace detail
+}  // namespace Titanium
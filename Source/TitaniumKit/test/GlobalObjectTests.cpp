@@ -409,4 +409,168 @@ TEST_F(GlobalObjectTests, requireNestedModule)
 
 	XCTAssertTrue(result.IsString());
 	XCTAssertEqual("Hello, World", static_cast<std::string>(result));
-}
\ No newline at end of file
+}
+TEST_F(GlobalObjectTests, requireModuleScope)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<NativeGlobalObjectExample>::Class());
+	auto global_object = js_context.get_global_object();
+
+	std::string app_js = R"js(
+		var scope = require('scope');
+		[scope.filename, scope.dirname, scope.global].join(',');
+	)js";
+
+	std::string scope_js = R"js(
+		exports.filename = __filename;
+		exports.dirname = __dirname;
+		exports.global = (this === global);
+	)js";
+
+	auto global_object_ptr = global_object.GetPrivate<NativeGlobalObjectExample>();
+	XCTAssertNotEqual(nullptr, global_object_ptr);
+
+	global_object_ptr->add_require("node_modules/scope.js", scope_js);
+	JSValue result = js_context.JSEvaluateScript(app_js);
+
+	XCTAssertTrue(result.IsString());
+	XCTAssertEqual("/node_modules/scope.js,/node_modules,true", static_cast<std::string>(result));
+
+	// A syntax error is reported by require() itself
+	global_object_ptr->add_require("node_modules/broken.js", "exports.broken = function() {");
+	result = js_context.JSEvaluateScript("try { require('broken'); 'loaded'; } catch (E) { 'threw'; }");
+	XCTAssertEqual("threw", static_cast<std::string>(result));
+}
+
+TEST_F(GlobalObjectTests, requireManifest)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<NativeGlobalObjectExample>::Class());
+	auto global_object = js_context.get_global_object();
+
+	std::string manifest_json = R"js({
+		"files": ["app.js", "node_modules/hello/lib/hello.js"],
+		"packages": { "node_modules/hello": "node_modules/hello/lib/hello.js" }
+	})js";
+
+	std::string hello_js = R"js(
+		exports.hello = function(name) {
+			return 'Hello, ' + name;
+		};
+	)js";
+
+	std::string extra_js = R"js(
+		exports.extra = true;
+	)js";
+
+	auto global_object_ptr = global_object.GetPrivate<NativeGlobalObjectExample>();
+	XCTAssertNotEqual(nullptr, global_object_ptr);
+
+	global_object_ptr->add_require("_require_manifest_.json", manifest_json);
+	global_object_ptr->add_require("node_modules/hello/lib/hello.js", hello_js);
+
+	// Resolved from the manifest alone, package.json is never looked at
+	JSValue result = js_context.JSEvaluateScript("require('hello').hello('World');");
+	XCTAssertTrue(result.IsString());
+	XCTAssertEqual("Hello, World", static_cast<std::string>(result));
+	XCTAssertEqual(1, global_object_ptr->get_exists_count());
+
+	// Modules missing from the manifest still resolve the old way
+	global_object_ptr->add_require("node_modules/extra.js", extra_js);
+	result = js_context.JSEvaluateScript("require('extra').extra;");
+	XCTAssertTrue(result.IsBoolean());
+	XCTAssertTrue(static_cast<bool>(result));
+	XCTAssertTrue(global_object_ptr->get_exists_count() > 1);
+}
+
+TEST_F(GlobalObjectTests, timers)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<NativeGlobalObjectExample>::Class());
+	auto global_object = js_context.get_global_object();
+	auto global_object_ptr = global_object.GetPrivate<NativeGlobalObjectExample>();
+	XCTAssertNotEqual(nullptr, global_object_ptr);
+
+	js_context.JSEvaluateScript(R"js(
+		var log = [];
+		var ticks = 0;
+		setTimeout(function () { log.push('b'); }, 25);
+		setTimeout(function () { log.push('a'); }, 5);
+		var cleared = setTimeout(function () { log.push('never'); }, 15);
+		clearTimeout(cleared);
+		var interval = setInterval(function () {
+			if (++ticks == 3) {
+				clearInterval(interval);
+			}
+		}, 10);
+	)js");
+
+	// Nothing runs until the clock moves
+	XCTAssertEqual("", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+
+	global_object_ptr->advance_clock(std::chrono::milliseconds(20));
+	XCTAssertEqual("a", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+	XCTAssertEqual(2, static_cast<std::uint32_t>(js_context.JSEvaluateScript("ticks;")));
+
+	global_object_ptr->advance_clock(std::chrono::milliseconds(100));
+	XCTAssertEqual("a,b", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+	XCTAssertEqual(3, static_cast<std::uint32_t>(js_context.JSEvaluateScript("ticks;")));
+
+	// A timeout set from a callback lands on a later tick
+	js_context.JSEvaluateScript("setTimeout(function () { log.push('c'); setTimeout(function () { log.push('d'); }, 0); }, 0);");
+	global_object_ptr->advance_clock(std::chrono::milliseconds(1));
+	XCTAssertEqual("a,b,c", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+	global_object_ptr->advance_clock(std::chrono::milliseconds(1));
+	XCTAssertEqual("a,b,c,d", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+
+	// A long interval wakes the platform timer when it is due, not every tick
+	const auto fired = global_object_ptr->get_timer_fired_count();
+	js_context.JSEvaluateScript("var minutes = 0; setInterval(function () { minutes++; }, 60000);");
+	global_object_ptr->advance_clock(std::chrono::milliseconds(120000));
+	XCTAssertEqual(2, static_cast<std::uint32_t>(js_context.JSEvaluateScript("minutes;")));
+	XCTAssertTrue(global_object_ptr->get_timer_fired_count() - fired < 10);
+}
+
+TEST_F(GlobalObjectTests, timersClearedInBatch)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<NativeGlobalObjectExample>::Class());
+	auto global_object_ptr = js_context.get_global_object().GetPrivate<NativeGlobalObjectExample>();
+	XCTAssertNotEqual(nullptr, global_object_ptr);
+
+	// Callbacks clear timers that are due in the same batch, both from the
+	// wheel and from the zero-delay queue
+	js_context.JSEvaluateScript(R"js(
+		var log = [];
+		var later, repeat, soon;
+		setTimeout(function () {
+			log.push('first');
+			clearTimeout(later);
+			clearInterval(repeat);
+		}, 5);
+		later = setTimeout(function () { log.push('later'); }, 5);
+		repeat = setInterval(function () { log.push('repeat'); }, 5);
+		setTimeout(function () {
+			setTimeout(function () { log.push('now'); clearTimeout(soon); }, 0);
+			soon = setTimeout(function () { log.push('soon'); }, 0);
+		}, 4);
+	)js");
+	global_object_ptr->advance_clock(std::chrono::milliseconds(25));
+	XCTAssertEqual("now,first", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+}
+
+TEST_F(GlobalObjectTests, timersKeepShortDelays)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<NativeGlobalObjectExample>::Class());
+	auto global_object_ptr = js_context.get_global_object().GetPrivate<NativeGlobalObjectExample>();
+	XCTAssertNotEqual(nullptr, global_object_ptr);
+
+	// 1ms and 3ms are not rounded up to a coarser tick
+	js_context.JSEvaluateScript("var log = []; setTimeout(function () { log.push(1); }, 1); setTimeout(function () { log.push(3); }, 3);");
+	global_object_ptr->advance_clock(std::chrono::milliseconds(1));
+	XCTAssertEqual("1", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+	global_object_ptr->advance_clock(std::chrono::milliseconds(2));
+	XCTAssertEqual("1,3", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+
+	// Rearming for different delays reuses the one platform Timer
+	js_context.JSEvaluateScript("setTimeout(function () { log.push(50); }, 50); setTimeout(function () { log.push(7); }, 7);");
+	global_object_ptr->advance_clock(std::chrono::milliseconds(100));
+	XCTAssertEqual("1,3,7,50", static_cast<std::string>(js_context.JSEvaluateScript("log.join(',');")));
+	XCTAssertEqual(1, global_object_ptr->get_timer_count());
+}
@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/GlobalObject.hpp"
+#include "Titanium/Network/HTTPClient.hpp"
+#include "gtest/gtest.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+#define XCTAssertNoThrow ASSERT_NO_THROW
+
+using namespace Titanium;
+using namespace HAL;
+
+// Exposes the receive path of the portable HTTPClient core so it can be driven
+// from a plain socket.
+class LoopbackHTTPClient final : public Titanium::Network::HTTPClient, public JSExport<LoopbackHTTPClient>
+{
+public:
+	LoopbackHTTPClient(const JSContext& js_context) TITANIUM_NOEXCEPT
+		: Titanium::Network::HTTPClient(js_context)
+	{
+	}
+
+	static void JSExportInitialize()
+	{
+		JSExport<LoopbackHTTPClient>::SetClassVersion(1);
+		JSExport<LoopbackHTTPClient>::SetParent(JSExport<Titanium::Network::HTTPClient>::Class());
+	}
+
+	using Titanium::Network::HTTPClient::beginResponse;
+	using Titanium::Network::HTTPClient::nextReadSize;
+	using Titanium::Network::HTTPClient::appendResponseData;
+	using Titanium::Network::HTTPClient::getResponseBytes;
+};
+
+// Serves a single GET with a body of the given size on 127.0.0.1.
+class LoopbackServer final
+{
+public:
+	explicit LoopbackServer(const std::size_t& body_size)
+		: body_size__(body_size)
+	{
+		listen_fd__ = socket(AF_INET, SOCK_STREAM, 0);
+		EXPECT_LE(0, listen_fd__) << "socket: " << std::strerror(errno);
+		sockaddr_in address {};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		EXPECT_EQ(0, bind(listen_fd__, reinterpret_cast<sockaddr*>(&address), sizeof(address))) << "bind: " << std::strerror(errno);
+		EXPECT_EQ(0, listen(listen_fd__, 1)) << "listen: " << std::strerror(errno);
+		socklen_t length = sizeof(address);
+		EXPECT_EQ(0, getsockname(listen_fd__, reinterpret_cast<sockaddr*>(&address), &length)) << "getsockname: " << std::strerror(errno);
+		port__ = ntohs(address.sin_port);
+		thread__ = std::thread(&LoopbackServer::Serve, this);
+	}
+
+	~LoopbackServer()
+	{
+		thread__.join();
+		close(listen_fd__);
+	}
+
+	std::uint16_t get_port() const
+	{
+		return port__;
+	}
+
+private:
+	void Serve()
+	{
+		const auto fd = accept(listen_fd__, nullptr, nullptr);
+		if (fd < 0) {
+			ADD_FAILURE() << "accept: " << std::strerror(errno);
+			return;
+		}
+
+		std::string request;
+		char buffer[1024];
+		while (request.find("\r\n\r\n") == std::string::npos) {
+			const auto count = recv(fd, buffer, sizeof(buffer), 0);
+			if (count <= 0) {
+				ADD_FAILURE() << "recv: " << (count < 0 ? std::strerror(errno) : "connection closed before the request ended");
+				close(fd);
+				return;
+			}
+			request.append(buffer, count);
+		}
+
+		const auto header = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body_size__) + "\r\nConnection: close\r\n\r\n";
+		if (send(fd, header.data(), header.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(header.size())) {
+			ADD_FAILURE() << "send: " << std::strerror(errno);
+			close(fd);
+			return;
+		}
+
+		std::vector<char> chunk(256 * 1024, 'x');
+		auto remaining = body_size__;
+		while (remaining > 0) {
+			const auto count = send(fd, chunk.data(), std::min(remaining, chunk.size()), MSG_NOSIGNAL);
+			if (count <= 0) {
+				ADD_FAILURE() << "send: " << std::strerror(errno);
+				break;
+			}
+			remaining -= count;
+		}
+		close(fd);
+	}
+
+	std::size_t body_size__;
+	int listen_fd__ { -1 };
+	std::uint16_t port__ { 0 };
+	std::thread thread__;
+};
+
+// Connects, sends a GET and returns the socket positioned at the start of the
+// body. Any body bytes that arrived with the headers end up in leftover.
+// Returns -1 and records a failure when any step fails.
+static int OpenLoopbackResponse(const std::uint16_t& port, std::int64_t& content_length, std::string& leftover)
+{
+	content_length = -1;
+	const auto fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0) {
+		ADD_FAILURE() << "socket: " << std::strerror(errno);
+		return -1;
+	}
+
+	sockaddr_in address {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+	if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		ADD_FAILURE() << "connect: " << std::strerror(errno);
+		close(fd);
+		return -1;
+	}
+
+	const std::string request = "GET / HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+	if (send(fd, request.data(), request.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(request.size())) {
+		ADD_FAILURE() << "send: " << std::strerror(errno);
+		close(fd);
+		return -1;
+	}
+
+	std::string response;
+	char buffer[1024];
+	std::size_t end = std::string::npos;
+	while ((end = response.find("\r\n\r\n")) == std::string::npos) {
+		const auto count = recv(fd, buffer, sizeof(buffer), 0);
+		if (count <= 0) {
+			ADD_FAILURE() << "recv: " << (count < 0 ? std::strerror(errno) : "connection closed before the headers ended");
+			close(fd);
+			return -1;
+		}
+		response.append(buffer, count);
+	}
+
+	const auto header = response.find("Content-Length: ");
+	if (header != std::string::npos) {
+		content_length = std::atoll(response.c_str() + header + 16);
+	}
+	leftover = response.substr(end + 4);
+	return fd;
+}
+
+class HTTPClientLoopbackTests : public testing::Test
+{
+protected:
+	std::shared_ptr<LoopbackHTTPClient> createClient(const JSContext& js_context)
+	{
+		auto HTTPClient = js_context.CreateObject(JSExport<LoopbackHTTPClient>::Class());
+		auto client = HTTPClient.CallAsConstructor();
+		js_context.get_global_object().SetProperty("client", client);
+		return client.GetPrivate<LoopbackHTTPClient>();
+	}
+
+	JSContextGroup js_context_group;
+};
+
+TEST_F(HTTPClientLoopbackTests, AdaptiveReadSize)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto client = createClient(js_context);
+
+	client->beginResponse(-1);
+	XCTAssertEqual(Titanium::Network::HTTPClient::MinReadSize, client->nextReadSize());
+
+	// short reads keep the size where it is
+	std::vector<std::uint8_t> chunk(Titanium::Network::HTTPClient::MaxReadSize * 2);
+	client->appendResponseData(chunk.data(), 100);
+	XCTAssertEqual(Titanium::Network::HTTPClient::MinReadSize, client->nextReadSize());
+
+	// full reads double it up to the cap
+	for (int i = 0; i < 10; i++) {
+		client->appendResponseData(chunk.data(), client->nextReadSize());
+	}
+	XCTAssertEqual(Titanium::Network::HTTPClient::MaxReadSize, client->nextReadSize());
+
+	// and a new response starts small again
+	client->beginResponse(1000);
+	XCTAssertEqual(Titanium::Network::HTTPClient::MinReadSize, client->nextReadSize());
+}
+
+TEST_F(HTTPClientLoopbackTests, ThrottledProgress)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto client = createClient(js_context);
+	js_context.JSEvaluateScript("var events = 0, last = 0; client.ondatastream = function (e) { events++; last = e.progress; };");
+
+	const std::vector<std::uint8_t> chunk(100);
+	client->set_progressInterval(std::chrono::milliseconds(60 * 1000));
+	client->beginResponse(1000);
+	for (int i = 0; i < 10; i++) {
+		client->appendResponseData(chunk.data(), chunk.size());
+	}
+	// only the first chunk gets through inside the interval
+	XCTAssertEqual(1, static_cast<std::int32_t>(js_context.JSEvaluateScript("events")));
+	XCTAssertEqual(1000, client->getResponseBytes().size());
+
+	client->set_progressInterval(std::chrono::milliseconds(0));
+	client->beginResponse(1000);
+	for (int i = 0; i < 10; i++) {
+		client->appendResponseData(chunk.data(), chunk.size());
+	}
+	XCTAssertEqual(11, static_cast<std::int32_t>(js_context.JSEvaluateScript("events")));
+	XCTAssertEqual(1.0, static_cast<double>(js_context.JSEvaluateScript("last")));
+}
+
+TEST_F(HTTPClientLoopbackTests, LoopbackBody)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto client = createClient(js_context);
+
+	// A few megabytes is enough to take the read size from its floor to its cap.
+	const std::size_t body_size = 4 * 1024 * 1024;
+	LoopbackServer server(body_size);
+	std::int64_t content_length = 0;
+	std::string leftover;
+	const auto fd = OpenLoopbackResponse(server.get_port(), content_length, leftover);
+	XCTAssertNotEqual(-1, fd);
+	XCTAssertEqual(static_cast<std::int64_t>(body_size), content_length);
+
+	client->beginResponse(content_length);
+	client->appendResponseData(reinterpret_cast<const std::uint8_t*>(leftover.data()), leftover.size());
+	std::vector<std::uint8_t> buffer(Titanium::Network::HTTPClient::MaxReadSize);
+	std::size_t reads = 0;
+	std::size_t smallest_request = Titanium::Network::HTTPClient::MaxReadSize;
+	ssize_t count = 0;
+	while (true) {
+		const auto request = client->nextReadSize();
+		smallest_request = std::min(smallest_request, request);
+		count = recv(fd, buffer.data(), request, 0);
+		if (count <= 0) {
+			break;
+		}
+		reads++;
+		client->appendResponseData(buffer.data(), count);
+	}
+	close(fd);
+	XCTAssertEqual(0, count) << std::strerror(errno);
+
+	// every byte arrives intact, and in far fewer reads than the fixed 1000 byte
+	// reads the Windows client used to make
+	const auto& data = client->getResponseBytes();
+	XCTAssertEqual(body_size, data.size());
+	XCTAssertTrue(std::all_of(data.begin(), data.end(), [](const std::uint8_t& byte) { return byte == 'x'; }));
+	XCTAssertTrue(smallest_request >= Titanium::Network::HTTPClient::MinReadSize);
+	XCTAssertTrue(reads <= body_size / 1000);
+	RecordProperty("reads", static_cast<int>(reads));
+}
@@ -117,3 +117,129 @@ TEST_F(ModuleTests, properties)
 	result = js_context.JSEvaluateScript("module.lifecycleContainer;");
 	XCTAssertTrue(result.IsNull());
 }
+
+TEST_F(ModuleTests, eventListeners)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+	auto nativeModuleExample = js_context.CreateObject(JSExport<NativeModuleExample>::Class());
+	global_object.SetProperty("NativeModuleExample", nativeModuleExample);
+
+	JSValue result = js_context.CreateNull();
+	XCTAssertNoThrow(result = js_context.JSEvaluateScript("var module = new NativeModuleExample(); module;"));
+	auto module_ptr = static_cast<JSObject>(result).GetPrivate<NativeModuleExample>();
+	XCTAssertNotEqual(nullptr, module_ptr);
+
+	const auto tick = Titanium::Module::InternEvent("tick");
+	XCTAssertEqual(tick, Titanium::Module::InternEvent("tick"));
+	XCTAssertNotEqual(tick, Titanium::Module::InternEvent("tock"));
+	XCTAssertFalse(module_ptr->hasEventListener(tick));
+
+	// The first listener removes itself and the second one and adds a third,
+	// all while 'tick' is being dispatched.
+	XCTAssertNoThrow(js_context.JSEvaluateScript(
+		"var calls = [];"
+		"function second(e) { calls.push('second'); }"
+		"function third(e) { calls.push('third'); }"
+		"function first(e) {"
+		"  calls.push('first:' + e.type);"
+		"  module.removeEventListener('tick', first);"
+		"  module.removeEventListener('tick', second);"
+		"  module.addEventListener('tick', third);"
+		"}"
+		"module.addEventListener('tick', first);"
+		"module.addEventListener('tick', second);"
+		"module.addEventListener('tick', second);"));
+	XCTAssertTrue(module_ptr->hasEventListener(tick));
+	XCTAssertTrue(module_ptr->hasEventListener("tick"));
+
+	module_ptr->fireEvent(tick, js_context.CreateObject());
+	result = js_context.JSEvaluateScript("calls.join(',');");
+	XCTAssertEqual("first:tick", static_cast<std::string>(result));
+
+	module_ptr->fireEvent("tick");
+	result = js_context.JSEvaluateScript("calls.join(',');");
+	XCTAssertEqual("first:tick,third", static_cast<std::string>(result));
+
+	XCTAssertNoThrow(js_context.JSEvaluateScript("module.removeEventListener('tick', third);"));
+	XCTAssertFalse(module_ptr->hasEventListener(tick));
+	// Nobody listening is a no-op
+	module_ptr->fireEvent(tick, js_context.CreateObject());
+	module_ptr->fireEvent("tock");
+	result = js_context.JSEvaluateScript("calls.length;");
+	XCTAssertEqual(2, static_cast<std::int32_t>(result));
+}
+
+TEST_F(ModuleTests, eventCoalescing)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+	auto nativeModuleExample = js_context.CreateObject(JSExport<NativeModuleExample>::Class());
+	global_object.SetProperty("NativeModuleExample", nativeModuleExample);
+
+	JSValue result = js_context.CreateNull();
+	XCTAssertNoThrow(result = js_context.JSEvaluateScript("var module = new NativeModuleExample(); module;"));
+	auto module_ptr = static_cast<JSObject>(result).GetPrivate<NativeModuleExample>();
+	XCTAssertNotEqual(nullptr, module_ptr);
+
+	Titanium::Module::EventCoalescingPolicy policy;
+	XCTAssertTrue(Titanium::Module::ParseEventCoalescing("throttle(250)", policy));
+	XCTAssertTrue(Titanium::Module::EventCoalescingMode::Throttle == policy.mode);
+	XCTAssertEqual(250, policy.interval.count());
+	XCTAssertTrue(Titanium::Module::ParseEventCoalescing("batch(8, 50)", policy));
+	XCTAssertEqual(8, policy.batch_size);
+	XCTAssertEqual(50, policy.interval.count());
+	XCTAssertFalse(Titanium::Module::ParseEventCoalescing("throttle()", policy));
+	XCTAssertFalse(Titanium::Module::ParseEventCoalescing("sometimes", policy));
+
+	XCTAssertNoThrow(js_context.JSEvaluateScript(
+		"var latest = [], throttled = [], batches = [], every = [];"
+		"module.addEventListener('latest', function(e) { latest.push(e.value + '/' + e.dropped + '/' + e.merged); }, { coalesce: 'latest-only' });"
+		"module.addEventListener('throttled', function(e) { throttled.push(e.value + '/' + e.dropped); }, { coalesce: 'throttle(1000)' });"
+		"module.addEventListener('batched', function(e) { batches.push(e.events.map(function(b) { return b.value; }).join('+')); }, { coalesce: 'batch(3)' });"
+		"module.addEventListener('batched', function(e) { every.push(e.value); });"));
+
+	const auto fire = [&](const std::string& name, const std::int32_t& value) {
+		auto event = js_context.CreateObject();
+		event.SetProperty("value", js_context.CreateNumber(value));
+		module_ptr->fireEvent(name, event);
+	};
+
+	// Only the newest of a burst is delivered
+	for (std::int32_t i = 1; i <= 5; ++i) {
+		fire("latest", i);
+	}
+	result = js_context.JSEvaluateScript("latest.length;");
+	XCTAssertEqual(0, static_cast<std::int32_t>(result));
+	module_ptr->flushEvents();
+	result = js_context.JSEvaluateScript("latest.join(',');");
+	XCTAssertEqual("5/4/1", static_cast<std::string>(result));
+
+	// The first throttled event goes out at once, the rest wait
+	for (std::int32_t i = 1; i <= 4; ++i) {
+		fire("throttled", i);
+	}
+	result = js_context.JSEvaluateScript("throttled.join(',');");
+	XCTAssertEqual("1/0", static_cast<std::string>(result));
+	module_ptr->flushEvents();
+	result = js_context.JSEvaluateScript("throttled.join(',');");
+	XCTAssertEqual("1/0,4/2", static_cast<std::string>(result));
+
+	// A full batch is delivered without waiting, a partial one on flush
+	for (std::int32_t i = 1; i <= 5; ++i) {
+		fire("batched", i);
+	}
+	result = js_context.JSEvaluateScript("batches.join(',');");
+	XCTAssertEqual("1+2+3", static_cast<std::string>(result));
+	// A listener that did not ask for batches gets every event as it is fired
+	result = js_context.JSEvaluateScript("every.join(',');");
+	XCTAssertEqual("1,2,3,4,5", static_cast<std::string>(result));
+	module_ptr->flushEvents();
+	result = js_context.JSEvaluateScript("batches.join(',');");
+	XCTAssertEqual("1+2+3,4+5", static_cast<std::string>(result));
+
+	// Nothing pending, nothing delivered
+	module_ptr->flushEvents();
+	result = js_context.JSEvaluateScript("latest.length + throttled.length + batches.length + every.length;");
+	XCTAssertEqual(10, static_cast<std::int32_t>(result));
+}
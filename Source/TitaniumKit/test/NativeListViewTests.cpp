@@ -9,6 +9,7 @@
 #include "Titanium/GlobalObject.hpp"
 #include "Titanium/UImodule.hpp"
 #include "Titanium/UI/ListSection.hpp"
+#include "Titanium/UI/ListItemTemplate.hpp"
 #include "NativeListViewExample.hpp"
 #include "Titanium/UI/listview_js.hpp"
 #include "gtest/gtest.h"
@@ -586,6 +587,136 @@ TEST_F(ListViewTests, createSectionView_resource_listview_js_custom)
 	XCTAssertEqual("Patata", static_cast<std::string>(js_context.JSEvaluateScript("result[1].views[2].properties.text")));
 }
 
+TEST_F(ListViewTests, bindSectionItemAt_resource_listview_js_custom)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+
+	js_context.JSEvaluateScript(TI_INIT_SCRIPT, global_object);
+
+	auto export_object = js_context.CreateObject();
+	export_object.SetProperty("global", global_object);
+
+	js_context.JSEvaluateScript(listview_js, export_object);
+
+	XCTAssertTrue(export_object.HasProperty("exports"));
+	auto js_exports = static_cast<JSObject>(export_object.GetProperty("exports"));
+
+	auto js_create = js_exports.GetProperty("createSectionItemAt");
+	XCTAssertTrue(js_create.IsObject());
+	auto js_bind = js_exports.GetProperty("bindSectionItemAt");
+	XCTAssertTrue(js_bind.IsObject());
+	auto create = static_cast<JSObject>(js_create);
+	auto bind = static_cast<JSObject>(js_bind);
+	XCTAssertTrue(bind.IsFunction());
+
+	auto js_listview_custom_template = js_context.JSEvaluateScript(LISTVIEW_LIST_ITEM_TEMPLATE_CUSTOM);
+	XCTAssertTrue(js_listview_custom_template.IsObject());
+	global_object.SetProperty("LISTVIEW_LIST_ITEM_TEMPLATE_CUSTOM", js_listview_custom_template);
+
+	auto js_listview = static_cast<JSObject>(js_context.JSEvaluateScript(R"js(
+		var listview = {
+			templates: {
+				TEST: LISTVIEW_LIST_ITEM_TEMPLATE_CUSTOM
+			},
+			defaultItemTemplate: 'TEST'
+		};
+		listview;
+	)js"));
+	auto js_section = static_cast<JSObject>(js_context.JSEvaluateScript(R"js(
+		var section = {
+			items: [
+				{ info: {text: 'Carrot'}, es_info: {text: 'Zanahoria'}, pic: {image: 'carrot.png'}},
+				{ info: {text: 'Potato', color: 'red'}, es_info: {text: 'Zanahoria'}, pic: {image: 'carrot.png'}}
+			]
+		};
+		section;
+	)js"));
+
+	const auto item0 = js_context.JSEvaluateScript("section.items[0]");
+	const auto item1 = js_context.JSEvaluateScript("section.items[1]");
+
+	const std::vector<JSValue> create_args { js_listview, js_section, item0 };
+	auto view = create(create_args, js_exports);
+	XCTAssertTrue(view.IsObject());
+	global_object.SetProperty("view", view);
+	XCTAssertEqual("Carrot", static_cast<std::string>(js_context.JSEvaluateScript("view.views[1].properties.text")));
+
+	// Recycle the view for the second item: only the label that differs is touched
+	js_context.JSEvaluateScript("view.views.forEach(function(v) { delete v.properties; });");
+	const std::vector<JSValue> bind_args { js_listview, js_section, item1, view };
+	bind(bind_args, js_exports);
+	XCTAssertTrue(js_context.JSEvaluateScript("view.views[0].properties").IsUndefined());
+	XCTAssertEqual("Potato", static_cast<std::string>(js_context.JSEvaluateScript("view.views[1].properties.text")));
+	XCTAssertEqual("red", static_cast<std::string>(js_context.JSEvaluateScript("view.views[1].properties.color")));
+	XCTAssertTrue(js_context.JSEvaluateScript("view.views[2].properties").IsUndefined());
+
+	// And back again; the color the first item does not set returns to the template's
+	js_context.JSEvaluateScript("view.views.forEach(function(v) { delete v.properties; });");
+	const std::vector<JSValue> rebind_args { js_listview, js_section, item0, view };
+	bind(rebind_args, js_exports);
+	XCTAssertEqual("Carrot", static_cast<std::string>(js_context.JSEvaluateScript("view.views[1].properties.text")));
+	XCTAssertEqual("black", static_cast<std::string>(js_context.JSEvaluateScript("view.views[1].properties.color")));
+	XCTAssertTrue(js_context.JSEvaluateScript("view.views[2].properties").IsUndefined());
+}
+
+TEST_F(ListViewTests, ListItemTemplate_rebind_custom)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+
+	js_context.JSEvaluateScript(TI_INIT_SCRIPT, global_object);
+
+	auto export_object = js_context.CreateObject();
+	export_object.SetProperty("global", global_object);
+
+	js_context.JSEvaluateScript(listview_js, export_object);
+
+	XCTAssertTrue(export_object.HasProperty("exports"));
+	auto js_exports = static_cast<JSObject>(export_object.GetProperty("exports"));
+
+	auto js_listview_custom_template = js_context.JSEvaluateScript(LISTVIEW_LIST_ITEM_TEMPLATE_CUSTOM);
+	XCTAssertTrue(js_listview_custom_template.IsObject());
+
+	const auto plan = Titanium::UI::ListItemTemplate::Compile(static_cast<JSObject>(js_listview_custom_template), js_exports);
+	XCTAssertTrue(plan != nullptr);
+	const auto& nodes = plan->get_nodes();
+	XCTAssertEqual(4U, nodes.size());
+	XCTAssertEqual(-1, nodes.at(0).parent);
+	XCTAssertEqual("info", nodes.at(2).bindId);
+	XCTAssertEqual(3U, plan->get_addOrder().size());
+
+	Titanium::UI::ListItemInstance instance;
+	instance.plan = plan;
+	instance.bound.resize(nodes.size());
+	instance.initial.resize(nodes.size());
+
+	auto createView = nodes.at(2).createView;
+	auto js_template = nodes.at(2).js_template;
+	auto label = static_cast<JSObject>(createView({ nodes.at(2).options }, js_template));
+	global_object.SetProperty("label", label);
+	js_context.JSEvaluateScript("label.opacity = 0.5;");
+
+	// The first item sets a template property and one the template leaves alone
+	plan->bindNode(instance, 2, label, static_cast<std::unordered_map<std::string, JSValue>>(static_cast<JSObject>(js_context.JSEvaluateScript("({ text: 'Carrot', color: 'red', opacity: 1 })"))));
+	XCTAssertEqual("Carrot", static_cast<std::string>(label.GetProperty("text")));
+	XCTAssertEqual("red", static_cast<std::string>(label.GetProperty("color")));
+	XCTAssertEqual(1, static_cast<double>(label.GetProperty("opacity")));
+
+	// The second item binds other keys; dropped ones go back to the template's value or to the view's own
+	plan->bindNode(instance, 2, label, static_cast<std::unordered_map<std::string, JSValue>>(static_cast<JSObject>(js_context.JSEvaluateScript("({ text: 'Potato', backgroundColor: 'blue' })"))));
+	XCTAssertEqual("Potato", static_cast<std::string>(label.GetProperty("text")));
+	XCTAssertEqual("black", static_cast<std::string>(label.GetProperty("color")));
+	XCTAssertEqual(0.5, static_cast<double>(label.GetProperty("opacity")));
+	XCTAssertEqual("blue", static_cast<std::string>(label.GetProperty("backgroundColor")));
+
+	// And an item without a binding resets everything it was bound to
+	plan->bindNode(instance, 2, label, {});
+	XCTAssertTrue(label.GetProperty("text").IsUndefined());
+	XCTAssertTrue(label.GetProperty("backgroundColor").IsUndefined());
+	XCTAssertEqual(0.5, static_cast<double>(label.GetProperty("opacity")));
+}
+
 TEST_F(ListViewTests, resource_listview_js_corporate)
 {
 	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
@@ -66,3 +66,23 @@ TEST_F(TitaniumTests, logging)
 	XCTAssertEqual("__TITANIUM_USER_AGENT__", userAgent);
 
 }
+
+TEST_F(TitaniumTests, lazyNamespaces)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+
+	auto Titanium = js_context.CreateObject(JSExport<NativeTiExample>::Class());
+	auto Titanium_ptr = Titanium.GetPrivate<NativeTiExample>();
+	XCTAssertNotEqual(nullptr, Titanium_ptr);
+	global_object.SetProperty("Ti", Titanium);
+	XCTAssertTrue(Titanium_ptr->get_materialized_namespaces().empty());
+
+	// Same object every time, created once
+	auto result = js_context.JSEvaluateScript("Ti.API === Ti.API;");
+	XCTAssertTrue(static_cast<bool>(result));
+
+	const auto materialized = Titanium_ptr->get_materialized_namespaces();
+	XCTAssertEqual(1, materialized.size());
+	XCTAssertEqual("API", materialized[0].name);
+}
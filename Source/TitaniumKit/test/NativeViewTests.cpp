@@ -230,3 +230,38 @@ TEST_F(ViewTests, basic_functionality)
 	XCTAssertTrue(UI.HasProperty("Button"));
 
 }
+
+TEST_F(ViewTests, applyProperties_lays_out_once)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+
+	auto View = js_context.CreateObject(JSExport<NativeViewExample>::Class());
+	JSObject view = View.CallAsConstructor();
+	const auto view_ptr = view.GetPrivate<NativeViewExample>();
+	XCTAssertNotEqual(nullptr, view_ptr);
+	const auto layout = view_ptr->getViewLayoutDelegate<NativeViewLayoutDelegate>();
+	XCTAssertNotEqual(nullptr, layout);
+
+	// Set one at a time, each layout property lays the view out
+	const auto before = layout->get_layoutCount();
+	view.SetProperty("top", js_context.CreateNumber(10));
+	view.SetProperty("width", js_context.CreateNumber(100));
+	XCTAssertEqual(before + 2, layout->get_layoutCount());
+
+	// Set together, they lay it out once
+	auto props = js_context.CreateObject();
+	props.SetProperty("top", js_context.CreateNumber(20));
+	props.SetProperty("left", js_context.CreateNumber(5));
+	props.SetProperty("width", js_context.CreateNumber(200));
+	props.SetProperty("height", js_context.CreateNumber(50));
+	props.SetProperty("backgroundColor", js_context.CreateString("red"));
+	Titanium::Module::applyProperties(props, view);
+	XCTAssertEqual(before + 3, layout->get_layoutCount());
+	XCTAssertEqual("20", layout->get_top());
+	XCTAssertEqual("200", layout->get_width());
+	XCTAssertEqual("red", layout->get_backgroundColor());
+
+	// Nothing held back is left over
+	view.SetProperty("height", js_context.CreateNumber(60));
+	XCTAssertEqual(before + 4, layout->get_layoutCount());
+}
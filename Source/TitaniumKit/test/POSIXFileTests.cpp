@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/GlobalObject.hpp"
+#include "Titanium/Blob.hpp"
+#include "Titanium/Filesystem/POSIX/File.hpp"
+#include "gtest/gtest.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <unistd.h>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+#define XCTAssertNoThrow ASSERT_NO_THROW
+
+using namespace Titanium;
+using namespace HAL;
+
+class POSIXFileTests : public testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		char tmpl[] = "/tmp/TitaniumKitPOSIXFileTests.XXXXXX";
+		XCTAssertNotEqual(nullptr, mkdtemp(tmpl));
+		directory = tmpl;
+	}
+
+	virtual void TearDown()
+	{
+		JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+		createFile(js_context, directory)->deleteDirectory(true);
+	}
+
+	std::shared_ptr<Titanium::Filesystem::File> createFile(const JSContext& js_context, const std::string& path)
+	{
+		auto File = js_context.CreateObject(JSExport<Titanium::Filesystem::POSIX::File>::Class());
+		auto file = File.CallAsConstructor(js_context.CreateString(path));
+		return file.GetPrivate<Titanium::Filesystem::File>();
+	}
+
+	JSContextGroup js_context_group;
+	std::string directory;
+};
+
+TEST_F(POSIXFileTests, ReadWrite)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto file = createFile(js_context, directory + "/data.txt");
+
+	XCTAssertFalse(file->exists());
+	XCTAssertTrue(file->createFile());
+	XCTAssertFalse(file->createFile());
+	XCTAssertTrue(file->isFile());
+	XCTAssertEqual("data.txt", file->get_name());
+	XCTAssertEqual("txt", file->extension());
+
+	XCTAssertTrue(file->write("Hello", false));
+	XCTAssertTrue(file->append(", World"));
+	XCTAssertEqual(12, file->get_size());
+
+	const auto bytes = file->readBytes(7, 100);
+	XCTAssertEqual("World", std::string(bytes.begin(), bytes.end()));
+
+	const auto blob = file->read();
+	XCTAssertNotEqual(nullptr, blob);
+	XCTAssertEqual("Hello, World", blob->get_text());
+
+	XCTAssertTrue(file->rename("renamed.txt"));
+	XCTAssertEqual("renamed.txt", file->get_name());
+	XCTAssertTrue(file->deleteFile());
+	XCTAssertFalse(file->exists());
+}
+
+TEST_F(POSIXFileTests, MappedRead)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto file = createFile(js_context, directory + "/large.bin");
+
+	std::vector<std::uint8_t> data(Titanium::Filesystem::POSIX::File::MmapThreshold * 2 + 123);
+	for (std::size_t i = 0; i < data.size(); i++) {
+		data[i] = static_cast<std::uint8_t>(i % 251);
+	}
+	XCTAssertTrue(file->write(data, 0, static_cast<std::uint32_t>(data.size()), false));
+	XCTAssertEqual(data, file->getContent());
+
+	// unaligned offset goes through the mmap path as well
+	const auto offset = static_cast<std::uint32_t>(4099);
+	const auto slice = file->readBytes(offset, static_cast<std::uint32_t>(Titanium::Filesystem::POSIX::File::MmapThreshold));
+	XCTAssertEqual(Titanium::Filesystem::POSIX::File::MmapThreshold, slice.size());
+	XCTAssertTrue(std::equal(slice.begin(), slice.end(), data.begin() + offset));
+}
+
+TEST_F(POSIXFileTests, Async)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto file = createFile(js_context, directory + "/async.bin");
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool written = false;
+	std::uint32_t written_bytes = 0;
+
+	const std::vector<std::uint8_t> data { 1, 2, 3, 4, 5, 6, 7, 8 };
+	file->writeAsync(data, 2, 4, false, [&](const ErrorResponse& error, const std::uint32_t& count) {
+		std::lock_guard<std::mutex> lock(mutex);
+		XCTAssertTrue(error.success);
+		written_bytes = count;
+		written = true;
+		condition.notify_one();
+	});
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		condition.wait(lock, [&] { return written; });
+	}
+	XCTAssertEqual(4, written_bytes);
+
+	bool read = false;
+	std::vector<std::uint8_t> content;
+	file->readAllBytesAsync([&](const ErrorResponse& error, const std::vector<std::uint8_t>& bytes) {
+		std::lock_guard<std::mutex> lock(mutex);
+		content = bytes;
+		read = true;
+		condition.notify_one();
+	});
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		condition.wait(lock, [&] { return read; });
+	}
+	XCTAssertEqual(std::vector<std::uint8_t>({ 3, 4, 5, 6 }), content);
+}
+
+TEST_F(POSIXFileTests, Directories)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto folder = createFile(js_context, directory + "/folder");
+
+	XCTAssertTrue(folder->createDirectory());
+	XCTAssertTrue(folder->isDirectory());
+	XCTAssertTrue(createFile(js_context, directory + "/folder/a.txt")->write("a", false));
+	XCTAssertTrue(createFile(js_context, directory + "/folder/sub")->createDirectory());
+	XCTAssertTrue(createFile(js_context, directory + "/folder/sub/b.txt")->write("b", false));
+
+	auto listing = folder->getDirectoryListing();
+	std::sort(listing.begin(), listing.end());
+	XCTAssertEqual(std::vector<std::string>({ "a.txt", "sub" }), listing);
+
+	XCTAssertFalse(folder->deleteDirectory(false));
+	XCTAssertTrue(folder->deleteDirectory(true));
+	XCTAssertFalse(folder->exists());
+}
+
+TEST_F(POSIXFileTests, ListDirectory)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto folder = createFile(js_context, directory + "/cache");
+
+	XCTAssertTrue(folder->createDirectory());
+	XCTAssertTrue(createFile(js_context, directory + "/cache/a.png")->write("aaaa", false));
+	XCTAssertTrue(createFile(js_context, directory + "/cache/b.txt")->write("b", false));
+	XCTAssertTrue(createFile(js_context, directory + "/cache/images")->createDirectory());
+	XCTAssertTrue(createFile(js_context, directory + "/cache/images/c.png")->write("cc", false));
+
+	Titanium::Filesystem::DirectoryListingOptions options;
+	auto entries = folder->listDirectory(options);
+	XCTAssertEqual(3, entries.size());
+	for (const auto& entry : entries) {
+		XCTAssertFalse(entry.hasStats);
+	}
+
+	options.recursive = true;
+	options.withStats = true;
+	options.filter = "*.png";
+	entries = folder->listDirectory(options);
+	std::sort(entries.begin(), entries.end(), [](const Titanium::Filesystem::DirectoryEntry& a, const Titanium::Filesystem::DirectoryEntry& b) {
+		return a.name < b.name;
+	});
+	XCTAssertEqual(2, entries.size());
+	XCTAssertEqual("a.png", entries.at(0).name);
+	XCTAssertEqual(4, entries.at(0).size);
+	XCTAssertEqual("images/c.png", entries.at(1).name);
+	XCTAssertEqual(2, entries.at(1).size);
+	XCTAssertTrue(entries.at(1).hasStats);
+
+	// the visitor can stop the enumeration early
+	std::size_t visited = 0;
+	options.filter = "";
+	XCTAssertFalse(folder->enumerateDirectory(options, [&visited](const Titanium::Filesystem::DirectoryEntry&) {
+		return ++visited < 2;
+	}));
+	XCTAssertEqual(2, visited);
+}
@@ -0,0 +1,328 @@
+/**
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/GlobalObject.hpp"
+#include "Titanium/Buffer.hpp"
+#include "Titanium/Network/Socket/POSIX/TCP.hpp"
+#include "Titanium/Network/Socket/AcceptDict.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium;
+using namespace HAL;
+using Titanium::Network::Socket::POSIX::EventLoop;
+
+class POSIXSocketTests : public testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		// Batches are queued here and run by the test thread, which plays the JS thread.
+		loop.set_dispatcher([this](const std::function<void()>& batch) {
+			std::lock_guard<std::mutex> lock(mutex);
+			batches.push_back(batch);
+			condition.notify_one();
+		});
+	}
+
+	// Runs delivered batches until done() holds or a few seconds have passed.
+	bool pump(const std::function<bool()>& done)
+	{
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!done()) {
+			std::function<void()> batch;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				if (!condition.wait_until(lock, deadline, [this] { return !batches.empty(); })) {
+					return false;
+				}
+				batch = batches.front();
+				batches.pop_front();
+			}
+			batch();
+		}
+		return true;
+	}
+
+	// Waits until the loop has run everything posted to it so far.
+	bool sync(EventLoop& target)
+	{
+		const auto ran = std::make_shared<std::promise<void>>();
+		auto future = ran->get_future();
+		target.Post([ran]() { ran->set_value(); });
+		return future.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+	}
+
+	std::shared_ptr<Titanium::Network::Socket::POSIX::TCP> createSocket(JSContext& js_context, const std::string& name)
+	{
+		auto TCP = js_context.CreateObject(JSExport<Titanium::Network::Socket::POSIX::TCP>::Class());
+		auto socket = TCP.CallAsConstructor();
+		js_context.get_global_object().SetProperty(name, socket);
+		const auto tcp = socket.GetPrivate<Titanium::Network::Socket::POSIX::TCP>();
+		tcp->set_eventLoop(loop);
+		return tcp;
+	}
+
+	std::shared_ptr<Titanium::Buffer> createBuffer(JSContext& js_context, const std::string& content)
+	{
+		auto Buffer = js_context.CreateObject(JSExport<Titanium::Buffer>::Class());
+		const auto buffer = Buffer.CallAsConstructor().GetPrivate<Titanium::Buffer>();
+		buffer->construct(std::vector<std::uint8_t>(content.begin(), content.end()));
+		return buffer;
+	}
+
+	// Connects a client to a listening server and returns the accepted side.
+	std::shared_ptr<Titanium::Network::Socket::POSIX::TCP> connectPair(JSContext& js_context,
+		const std::shared_ptr<Titanium::Network::Socket::POSIX::TCP>& server,
+		const std::shared_ptr<Titanium::Network::Socket::POSIX::TCP>& client)
+	{
+		js_context.JSEvaluateScript("var inbound = null, connected = false;"
+			"server.accepted = function (e) { inbound = e.inbound; };"
+			"client.connected = function (e) { connected = true; };");
+
+		server->set_host("127.0.0.1");
+		server->set_port(0);
+		server->listen();
+		EXPECT_EQ(Titanium::Network::Socket::State::Listening, server->get_state());
+		EXPECT_NE(0, server->get_port());
+		server->accept({ js_context.CreateNull(), std::chrono::milliseconds(0) });
+
+		client->set_host("127.0.0.1");
+		client->set_port(server->get_port());
+		client->set_noDelay(true);
+		client->connect();
+
+		const auto ready = pump([&js_context] {
+			return static_cast<bool>(js_context.JSEvaluateScript("connected && inbound !== null"));
+		});
+		EXPECT_TRUE(ready);
+		if (!ready) {
+			return nullptr;
+		}
+		return static_cast<JSObject>(js_context.JSEvaluateScript("inbound")).GetPrivate<Titanium::Network::Socket::POSIX::TCP>();
+	}
+
+	// Declared so that JS objects go first, then the loop, then what the dispatcher uses
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::deque<std::function<void()>> batches;
+	EventLoop loop;
+	JSContextGroup js_context_group;
+};
+
+TEST_F(POSIXSocketTests, Echo)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto server = createSocket(js_context, "server");
+	const auto client = createSocket(js_context, "client");
+	const auto inbound = connectPair(js_context, server, client);
+	XCTAssertNotEqual(nullptr, inbound);
+	XCTAssertEqual(Titanium::Network::Socket::State::Connected, client->get_state());
+	XCTAssertEqual(Titanium::Network::Socket::State::Connected, inbound->get_state());
+
+	// async write from the client, async read on the accepted socket
+	const auto request = createBuffer(js_context, "Hello, Titanium");
+	std::int32_t written = -1;
+	client->writeAsync(request, 0, request->get_length(), [&written](const ErrorResponse& error, const std::int32_t& count) {
+		written = count;
+	});
+
+	const auto received = createBuffer(js_context, std::string(64, '\0'));
+	std::int32_t read = -1;
+	inbound->readAsync(received, 0, 64, [&read](const ErrorResponse& error, const std::int32_t& count) {
+		read = count;
+	});
+	XCTAssertTrue(pump([&] { return written >= 0 && read >= 0; }));
+	XCTAssertEqual(15, written);
+	XCTAssertEqual(15, read);
+	XCTAssertEqual("Hello, Titanium", std::string(received->getDataRef().begin(), received->getDataRef().begin() + read));
+
+	// and the blocking calls back the other way
+	const auto reply = createBuffer(js_context, "pong");
+	XCTAssertEqual(4, inbound->write(reply, 0, 4));
+	XCTAssertEqual(4, client->read(received, 0, 64));
+	XCTAssertEqual("pong", std::string(received->getDataRef().begin(), received->getDataRef().begin() + 4));
+
+	// closing the peer ends the stream
+	inbound->close();
+	XCTAssertEqual(-1, client->read(received, 0, 64));
+	client->close();
+	server->close();
+	XCTAssertEqual(Titanium::Network::Socket::State::Closed, server->get_state());
+}
+
+TEST_F(POSIXSocketTests, ScatterReadBatchesCallbacks)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto server = createSocket(js_context, "server");
+	const auto client = createSocket(js_context, "client");
+	const auto inbound = connectPair(js_context, server, client);
+	XCTAssertNotEqual(nullptr, inbound);
+
+	// Three reads queued into slices of the same buffer before any data arrives
+	const auto received = createBuffer(js_context, std::string(12, '.'));
+	std::vector<std::int32_t> counts;
+	for (std::uint32_t i = 0; i < 3; i++) {
+		inbound->readAsync(received, i * 4, 4, [&counts](const ErrorResponse& error, const std::int32_t& count) {
+			counts.push_back(count);
+		});
+	}
+	// Let the loop see them (readv returns EAGAIN) before sending
+	XCTAssertTrue(sync(loop));
+	const auto batches_before = loop.get_batches();
+
+	const auto data = createBuffer(js_context, "aaaabbbbcccc");
+	XCTAssertEqual(12, client->write(data, 0, 12));
+
+	XCTAssertTrue(pump([&counts] { return counts.size() == 3; }));
+	XCTAssertEqual(std::vector<std::int32_t>({ 4, 4, 4 }), counts);
+	XCTAssertEqual("aaaabbbbcccc", std::string(received->getDataRef().begin(), received->getDataRef().end()));
+	// one readv, one hop to the JS thread
+	XCTAssertEqual(batches_before + 1, loop.get_batches());
+}
+
+TEST_F(POSIXSocketTests, GatherWrite)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto server = createSocket(js_context, "server");
+	const auto client = createSocket(js_context, "client");
+	const auto inbound = connectPair(js_context, server, client);
+	XCTAssertNotEqual(nullptr, inbound);
+
+	// Large enough to fill the socket buffers, so the loop has to wait for EPOLLOUT
+	const std::size_t size = 4 * 1024 * 1024;
+	const auto first = createBuffer(js_context, std::string(size, 'x'));
+	const auto second = createBuffer(js_context, std::string(size, 'y'));
+	std::vector<std::int32_t> written;
+	const auto callback = [&written](const ErrorResponse& error, const std::int32_t& count) {
+		written.push_back(count);
+	};
+	client->writeAsync(first, 0, static_cast<std::uint32_t>(size), callback);
+	client->writeAsync(second, 0, static_cast<std::uint32_t>(size), callback);
+
+	std::size_t total = 0;
+	std::size_t ys = 0;
+	const auto received = createBuffer(js_context, std::string(256 * 1024, '\0'));
+	while (total < size * 2) {
+		const auto count = inbound->read(received, 0, received->get_length());
+		XCTAssertTrue(count > 0);
+		total += count;
+		ys += std::count(received->getDataRef().begin(), received->getDataRef().begin() + count, 'y');
+	}
+	XCTAssertEqual(size, ys);
+	XCTAssertTrue(pump([&written] { return written.size() == 2; }));
+	XCTAssertEqual(std::vector<std::int32_t>({ static_cast<std::int32_t>(size), static_cast<std::int32_t>(size) }), written);
+}
+
+TEST_F(POSIXSocketTests, CloseCancelsPendingReads)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto server = createSocket(js_context, "server");
+	const auto client = createSocket(js_context, "client");
+	const auto inbound = connectPair(js_context, server, client);
+	XCTAssertNotEqual(nullptr, inbound);
+
+	const auto received = createBuffer(js_context, std::string(16, '\0'));
+	bool done = false;
+	ErrorResponse result;
+	inbound->readAsync(received, 0, 16, [&](const ErrorResponse& error, const std::int32_t& count) {
+		result = error;
+		done = true;
+	});
+	inbound->close();
+	XCTAssertTrue(pump([&done] { return done; }));
+	XCTAssertFalse(result.success);
+}
+
+TEST_F(POSIXSocketTests, BufferChangesWhileRequestsArePending)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	const auto server = createSocket(js_context, "server");
+	const auto client = createSocket(js_context, "client");
+	const auto inbound = connectPair(js_context, server, client);
+	XCTAssertNotEqual(nullptr, inbound);
+
+	// The buffer shrinks after the read is queued, the read only fills what is left
+	const auto received = createBuffer(js_context, std::string(16, '.'));
+	std::int32_t read = -1;
+	inbound->readAsync(received, 4, 8, [&read](const ErrorResponse& error, const std::int32_t& count) {
+		read = count;
+	});
+	XCTAssertTrue(sync(loop));
+	received->getDataRef().resize(6);
+	received->getDataRef().shrink_to_fit();
+
+	// The write sends what the buffer held when it was queued
+	const auto data = createBuffer(js_context, "abcdefgh");
+	std::int32_t written = -1;
+	client->writeAsync(data, 0, 8, [&written](const ErrorResponse& error, const std::int32_t& count) {
+		written = count;
+	});
+	data->clear();
+	data->getDataRef().clear();
+
+	XCTAssertTrue(pump([&] { return written >= 0 && read >= 0; }));
+	XCTAssertEqual(8, written);
+	XCTAssertEqual(2, read);
+	XCTAssertEqual("....ab", std::string(received->getDataRef().begin(), received->getDataRef().end()));
+
+	// An empty read completes at once instead of looking like the end of the stream
+	XCTAssertEqual(0, inbound->read(received, 0, 0));
+}
+
+TEST_F(POSIXSocketTests, ConnectError)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+
+	// Grab a free port and close it again, nothing listens there afterwards
+	const auto probe = createSocket(js_context, "probe");
+	probe->set_host("127.0.0.1");
+	probe->listen();
+	const auto port = probe->get_port();
+	probe->close();
+
+	const auto client = createSocket(js_context, "client");
+	js_context.JSEvaluateScript("var failed = false; client.error = function (e) { failed = !e.success; };");
+	client->set_host("127.0.0.1");
+	client->set_port(port);
+	client->connect();
+	XCTAssertTrue(pump([&js_context] { return static_cast<bool>(js_context.JSEvaluateScript("failed")); }));
+	XCTAssertEqual(Titanium::Network::Socket::State::Error, client->get_state());
+}
+
+TEST_F(POSIXSocketTests, CallbacksWaitForTheJSThread)
+{
+	// No dispatcher: nothing runs on the I/O thread, the JS thread pumps the loop
+	EventLoop idle;
+	std::thread::id ran_on;
+	idle.Post([&idle, &ran_on]() {
+		idle.Deliver([&ran_on]() { ran_on = std::this_thread::get_id(); });
+	});
+	XCTAssertTrue(sync(idle));
+	XCTAssertEqual(0, idle.get_delivered());
+	XCTAssertEqual(1, idle.RunPendingCallbacks());
+	XCTAssertEqual(std::this_thread::get_id(), ran_on);
+
+	// Setting a dispatcher later hands out what was queued before
+	idle.Post([&idle]() { idle.Deliver([]() {}); });
+	XCTAssertTrue(sync(idle));
+	std::promise<void> dispatched;
+	idle.set_dispatcher([&dispatched](const std::function<void()>& batch) { dispatched.set_value(); });
+	XCTAssertEqual(std::future_status::ready, dispatched.get_future().wait_for(std::chrono::seconds(5)));
+	XCTAssertEqual(1, idle.get_batches());
+}
@@ -0,0 +1,99 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiConstants.hpp"
+#include "gtest/gtest.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+enum class RETURNKEY : std::uint32_t {
+	DEFAULT = 7,
+	DONE = 1,
+	GO = 2,
+	NEXT = 4,
+	SEARCH = 5,
+	SEND = 6
+};
+
+static const TiConstant<RETURNKEY> returnKeyNames[] = {
+	{ RETURNKEY::DEFAULT, "RETURNKEY_DEFAULT" },
+	{ RETURNKEY::DONE,    "RETURNKEY_DONE" },
+	{ RETURNKEY::GO,      "RETURNKEY_GO" },
+	{ RETURNKEY::NEXT,    "RETURNKEY_NEXT" },
+	{ RETURNKEY::SEARCH,  "RETURNKEY_SEARCH" },
+	{ RETURNKEY::SEND,    "RETURNKEY_SEND" },
+};
+
+TEST(TiConstantsTests, NamesAndValuesAreUnique)
+{
+	XCTAssertTrue(TiConstantsUnique(returnKeyNames));
+
+	const TiConstant<RETURNKEY> duplicateNames[] = {
+		{ RETURNKEY::GO,   "RETURNKEY_GO" },
+		{ RETURNKEY::SEND, "RETURNKEY_GO" },
+	};
+	XCTAssertFalse(TiConstantsUnique(duplicateNames));
+
+	const TiConstant<RETURNKEY> duplicateValues[] = {
+		{ RETURNKEY::GO, "RETURNKEY_GO" },
+		{ RETURNKEY::GO, "RETURNKEY_SEND" },
+	};
+	XCTAssertFalse(TiConstantsUnique(duplicateValues));
+}
+
+TEST(TiConstantsTests, FindsByNameAndValue)
+{
+	for (const auto& entry : returnKeyNames) {
+		const auto byName = FindConstant(returnKeyNames, std::string(entry.name));
+		XCTAssertTrue(byName != nullptr);
+		XCTAssertTrue(byName->value == entry.value);
+
+		const auto byValue = FindConstant(returnKeyNames, entry.value);
+		XCTAssertTrue(byValue != nullptr);
+		XCTAssertEqual(std::string(entry.name), byValue->name);
+
+		const auto byUnderlying = FindConstant(returnKeyNames, static_cast<std::uint32_t>(entry.value));
+		XCTAssertEqual(byValue, byUnderlying);
+	}
+
+	XCTAssertTrue(FindConstant(returnKeyNames, std::string("")) == nullptr);
+	XCTAssertTrue(FindConstant(returnKeyNames, std::string("RETURNKEY_")) == nullptr);
+	XCTAssertTrue(FindConstant(returnKeyNames, std::string("RETURNKEY_SENDS")) == nullptr);
+	XCTAssertTrue(FindConstant(returnKeyNames, std::string("RETURNKEY_ZZZ")) == nullptr);
+	XCTAssertTrue(FindConstant(returnKeyNames, static_cast<std::uint32_t>(3)) == nullptr);
+}
+
+TEST(TiConstantsTests, MatchesALazyMap)
+{
+	// What the Constants classes did before: a map built on first use under call_once
+	const auto lazyMap = [](const std::string& name) {
+		static std::unordered_map<std::string, RETURNKEY> map;
+		static std::once_flag of;
+		std::call_once(of, []() {
+			for (const auto& entry : returnKeyNames) {
+				map[entry.name] = entry.value;
+			}
+		});
+		const auto position = map.find(name);
+		return position != map.end() ? position->second : RETURNKEY::DEFAULT;
+	};
+
+	const std::vector<std::string> names { "RETURNKEY_DONE", "RETURNKEY_SEND", "RETURNKEY_GO", "RETURNKEY_NONE" };
+	for (const auto& name : names) {
+		const auto position = FindConstant(returnKeyNames, name);
+		XCTAssertTrue(lazyMap(name) == (position != nullptr ? position->value : RETURNKEY::DEFAULT));
+	}
+}
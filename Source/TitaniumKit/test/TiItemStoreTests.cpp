@@ -0,0 +1,183 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiItemStore.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+// Heap bytes currently allocated, to measure what items cost
+static std::size_t heap_bytes = 0;
+static const std::size_t heap_header = 16;
+
+void* operator new(std::size_t size)
+{
+	const auto block = static_cast<std::size_t*>(std::malloc(size + heap_header));
+	if (block == nullptr) {
+		throw std::bad_alloc();
+	}
+	block[0] = size;
+	heap_bytes += size;
+	return reinterpret_cast<char*>(block) + heap_header;
+}
+
+void operator delete(void* pointer) noexcept
+{
+	if (pointer == nullptr) {
+		return;
+	}
+	const auto block = reinterpret_cast<std::size_t*>(static_cast<char*>(pointer) - heap_header);
+	heap_bytes -= block[0];
+	std::free(block);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	operator delete(pointer);
+}
+
+using namespace Titanium::detail;
+
+// Stands in for JSValue: a context and a value reference
+struct Value
+{
+	const void* context;
+	const void* group;
+	std::uintptr_t ref;
+
+	bool operator==(const Value& other) const
+	{
+		return ref == other.ref;
+	}
+};
+
+static Value value(const std::uintptr_t& ref)
+{
+	return Value { nullptr, nullptr, ref };
+}
+
+using Map = std::unordered_map<std::string, Value>;
+
+// ListDataItem as it was stored before
+struct MapItem
+{
+	Map properties;
+	std::string templateId;
+	Map bindings;
+	std::shared_ptr<void> view;
+};
+
+TEST(TiItemStoreTests, StoresItemsByShape)
+{
+	TiItemStore<Value> store;
+	store.Insert(0, "contact", Map { { "title", value(1) }, { "itemId", value(2) } }, Map { { "avatar", value(3) } });
+	store.Insert(1, "contact", Map { { "itemId", value(12) }, { "title", value(11) } }, Map { { "avatar", value(13) } });
+	store.Insert(0, "header", Map { { "title", value(21) } }, Map {});
+
+	XCTAssertEqual(3, store.size());
+	// Same keys in another order share a shape
+	XCTAssertEqual(2, store.get_shapeCount());
+	XCTAssertEqual("header", store.get_templateAt(0));
+	XCTAssertEqual("contact", store.get_templateAt(2));
+
+	const auto title = store.InternKey("title");
+	const auto avatar = store.InternKey("avatar");
+	XCTAssertEqual(11, store.FindProperty(2, title)->ref);
+	XCTAssertEqual(13, store.FindBinding(2, avatar)->ref);
+	XCTAssertTrue(store.FindProperty(2, avatar) == nullptr);
+	XCTAssertTrue(store.FindBinding(0, avatar) == nullptr);
+
+	Map properties;
+	Map bindings;
+	store.ForEach(1, [&](const std::string& key, const Value& value, const bool& binding) {
+		(binding ? bindings : properties).emplace(key, value);
+	});
+	XCTAssertEqual(2, properties.size());
+	XCTAssertEqual(1, properties.at("title").ref);
+	XCTAssertEqual(3, bindings.at("avatar").ref);
+
+	// Same shape updates in place, another shape moves the values
+	const auto values = store.get_valueCount();
+	store.Update(1, "contact", Map { { "title", value(4) }, { "itemId", value(2) } }, Map { { "avatar", value(3) } });
+	XCTAssertEqual(values, store.get_valueCount());
+	XCTAssertEqual(4, store.FindProperty(1, title)->ref);
+	store.Update(1, "header", Map { { "title", value(5) } }, Map {});
+	XCTAssertEqual("header", store.get_templateAt(1));
+	XCTAssertEqual(5, store.FindProperty(1, title)->ref);
+	XCTAssertEqual(2, store.get_shapeCount());
+
+	store.Erase(0, 2);
+	XCTAssertEqual(1, store.size());
+	XCTAssertEqual(11, store.FindProperty(0, title)->ref);
+	XCTAssertEqual(3, store.get_valueCount());
+
+	store.Clear();
+	XCTAssertEqual(0, store.size());
+}
+
+TEST(TiItemStoreTests, CompactsAfterChurn)
+{
+	TiItemStore<Value> store;
+	const auto title = store.InternKey("title");
+	for (std::uintptr_t i = 0; i < 1000; i++) {
+		store.Insert(store.size(), "", Map { { "title", value(i) } }, Map {});
+	}
+	for (std::uintptr_t round = 0; round < 5; round++) {
+		for (std::size_t i = 0; i < store.size(); i += 2) {
+			store.Update(i, (round % 2) ? "a" : "b", Map { { "title", value(i + round) } }, Map {});
+		}
+		store.Erase(0, 100);
+		XCTAssertTrue(store.get_valueCount() <= 2 * store.size());
+	}
+	XCTAssertEqual(500, store.size());
+	// Item 0 was item 100 when the last round updated it, item 1 was never at an even index
+	XCTAssertEqual(100 + 4, store.FindProperty(0, title)->ref);
+	XCTAssertEqual(501, store.FindProperty(1, title)->ref);
+}
+
+TEST(TiItemStoreTests, BytesPerItem)
+{
+	const std::size_t count = 10000;
+	const auto item = [](const std::size_t& i, Map& properties, Map& bindings) {
+		properties = Map { { "title", value(i) }, { "itemId", value(i + 1) }, { "color", value(i + 2) }, { "accessoryType", value(i + 3) } };
+		bindings = Map { { "avatar", value(i + 4) }, { "subtitle", value(i + 5) } };
+	};
+	Map properties;
+	Map bindings;
+
+	auto start = heap_bytes;
+	std::vector<MapItem> items;
+	items.reserve(count);
+	for (std::size_t i = 0; i < count; i++) {
+		item(i, properties, bindings);
+		items.push_back(MapItem { properties, i % 2 ? "contact" : "favorite", bindings, nullptr });
+	}
+	const auto before = heap_bytes - start;
+
+	start = heap_bytes;
+	{
+		TiItemStore<Value> store;
+		for (std::size_t i = 0; i < count; i++) {
+			item(i, properties, bindings);
+			store.Insert(store.size(), i % 2 ? "contact" : "favorite", properties, bindings);
+		}
+		const auto after = heap_bytes - start;
+
+		RecordProperty("map_bytes_per_item", static_cast<int>(before / count));
+		RecordProperty("store_bytes_per_item", static_cast<int>(after / count));
+		XCTAssertEqual(2, store.get_shapeCount());
+		XCTAssertTrue(after * 3 < before);
+	}
+}
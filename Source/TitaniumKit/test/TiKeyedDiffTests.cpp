@@ -0,0 +1,115 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiKeyedDiff.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+// Applies the diff the way ListSection does and returns the result
+static std::vector<std::string> apply(std::vector<std::string> keys, const std::vector<std::string>& newKeys, const TiKeyedDiffResult& diff)
+{
+	for (const auto& range : diff.deletes) {
+		keys.erase(keys.begin() + range.index, keys.begin() + range.index + range.count);
+	}
+	for (const auto& range : diff.inserts) {
+		keys.insert(keys.begin() + range.index, newKeys.begin() + range.index, newKeys.begin() + range.index + range.count);
+	}
+	return keys;
+}
+
+static std::vector<std::string> keys(const std::string& letters)
+{
+	std::vector<std::string> result;
+	for (const auto c : letters) {
+		result.push_back(std::string(1, c));
+	}
+	return result;
+}
+
+TEST(TiKeyedDiffTests, MinimalMutations)
+{
+	const auto before = keys("abcdef");
+	const auto after = keys("abxdfe");
+	const auto diff = TiKeyedDiff(before, after);
+	XCTAssertTrue(diff.valid);
+	XCTAssertEqual(after, apply(before, after, diff));
+
+	// c goes, x comes, and one of e and f moves
+	XCTAssertEqual(4, diff.kept.size());
+	XCTAssertEqual(2, diff.deletes.size());
+	XCTAssertEqual(2, diff.inserts.size());
+	for (const auto& pair : diff.kept) {
+		XCTAssertEqual(before[pair.second], after[pair.first]);
+	}
+
+	// Unchanged lists need no mutation
+	const auto same = TiKeyedDiff(before, before);
+	XCTAssertTrue(same.deletes.empty());
+	XCTAssertTrue(same.inserts.empty());
+	XCTAssertEqual(before.size(), same.kept.size());
+
+	// Contiguous changes come out as ranges
+	const auto grown = TiKeyedDiff(keys("abc"), keys("xyabcz"));
+	XCTAssertTrue(grown.deletes.empty());
+	XCTAssertEqual(2, grown.inserts.size());
+	XCTAssertEqual(0, grown.inserts[0].index);
+	XCTAssertEqual(2, grown.inserts[0].count);
+	XCTAssertEqual(5, grown.inserts[1].index);
+
+	const auto shrunk = TiKeyedDiff(keys("abcdef"), keys("af"));
+	XCTAssertEqual(1, shrunk.deletes.size());
+	XCTAssertEqual(1, shrunk.deletes[0].index);
+	XCTAssertEqual(4, shrunk.deletes[0].count);
+}
+
+TEST(TiKeyedDiffTests, RejectsRepeatedKeys)
+{
+	XCTAssertFalse(TiKeyedDiff(keys("aba"), keys("ab")).valid);
+	XCTAssertFalse(TiKeyedDiff(keys("ab"), keys("abb")).valid);
+	XCTAssertTrue(TiKeyedDiff(keys(""), keys("ab")).valid);
+}
+
+TEST(TiKeyedDiffTests, RandomEditsOnLargeLists)
+{
+	std::mt19937 random(11);
+	std::vector<std::string> before;
+	for (std::uint32_t i = 0; i < 100000; i++) {
+		before.push_back("item" + std::to_string(i));
+	}
+
+	// Edit a few rows the way a refreshed feed does
+	auto after = before;
+	for (std::uint32_t i = 0; i < 100; i++) {
+		after.erase(after.begin() + random() % after.size());
+		after.insert(after.begin() + random() % after.size(), "new" + std::to_string(i));
+	}
+	for (std::uint32_t i = 0; i < 20; i++) {
+		std::swap(after[random() % after.size()], after[random() % after.size()]);
+	}
+
+	const auto diff = TiKeyedDiff(before, after);
+	XCTAssertTrue(diff.valid);
+	XCTAssertEqual(after, apply(before, after, diff));
+
+	// Most rows keep their place
+	XCTAssertTrue(diff.kept.size() > before.size() - 200);
+	std::uint32_t touched = 0;
+	for (const auto& range : diff.inserts) {
+		touched += range.count;
+	}
+	XCTAssertTrue(touched < 200);
+}
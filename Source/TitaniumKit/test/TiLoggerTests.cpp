@@ -0,0 +1,175 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/GlobalObject.hpp"
+#include "Titanium/Module.hpp"
+#include "Titanium/detail/TiBase.hpp"
+#include "Titanium/detail/TiLoggerPolicyFile.hpp"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+#define XCTAssertNoThrow ASSERT_NO_THROW
+
+using namespace Titanium;
+using namespace HAL;
+using Titanium::detail::TiLoggerLevel;
+using Titanium::detail::TiLoggerSeverityType;
+
+class TiLoggerTests : public testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		severity = TiLoggerLevel::Get();
+	}
+
+	virtual void TearDown()
+	{
+		TiLoggerLevel::Set(severity);
+	}
+
+	TiLoggerSeverityType severity;
+	JSContextGroup js_context_group;
+};
+
+TEST_F(TiLoggerTests, FilteredArgumentsAreNotEvaluated)
+{
+	std::size_t evaluated = 0;
+	const auto expensive = [&evaluated] {
+		evaluated++;
+		return std::string("expensive");
+	};
+
+	TiLoggerLevel::Set(TiLoggerSeverityType::Ti_WARN);
+	XCTAssertFalse(TiLoggerLevel::IsEnabled(TiLoggerSeverityType::Ti_DEBUG));
+	XCTAssertTrue(TiLoggerLevel::IsEnabled(TiLoggerSeverityType::Ti_ERROR));
+	for (int i = 0; i < 100; i++) {
+		TITANIUM_LOG_DEBUG("value: ", expensive());
+	}
+	XCTAssertEqual(0, evaluated);
+}
+
+TEST_F(TiLoggerTests, RingKeepsPerProducerOrder)
+{
+	const std::size_t producers = 4;
+	const std::size_t per_producer = 100000;
+	Titanium::detail::TiLoggerRing<std::pair<std::size_t, std::size_t>> ring(1024);
+	XCTAssertEqual(1024, ring.get_capacity());
+
+	std::vector<std::thread> threads;
+	for (std::size_t p = 0; p < producers; p++) {
+		threads.emplace_back([&ring, p, per_producer] {
+			for (std::size_t i = 0; i < per_producer; i++) {
+				while (!ring.TryPush(std::make_pair(p, i))) {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	std::vector<std::size_t> next(producers, 0);
+	std::size_t received = 0;
+	bool ordered = true;
+	std::pair<std::size_t, std::size_t> value;
+	while (received < producers * per_producer) {
+		if (!ring.TryPop(value)) {
+			std::this_thread::yield();
+			continue;
+		}
+		ordered = ordered && value.second == next[value.first];
+		next[value.first] = value.second + 1;
+		received++;
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	XCTAssertTrue(ordered);
+	XCTAssertFalse(ring.TryPop(value));
+}
+
+TEST_F(TiLoggerTests, FileLoggerWritesBatches)
+{
+	TiLoggerLevel::Set(TiLoggerSeverityType::Ti_TRACE);
+	const auto logger = Titanium::detail::TiLogger<Titanium::detail::TiLoggerPolicyFile>::Instance("TiLoggerTests.log");
+	for (int i = 0; i < 1000; i++) {
+		logger->Print<TiLoggerSeverityType::Ti_INFO>("line ", i);
+	}
+	logger->Flush();
+
+	std::ifstream file("TiLoggerTests.log");
+	std::string line;
+	std::size_t lines = 0;
+	std::string last;
+	while (std::getline(file, line)) {
+		last = line;
+		lines++;
+	}
+	XCTAssertEqual(0, logger->get_dropped());
+	XCTAssertEqual(1000, lines);
+	XCTAssertEqual("[INFO] line 999", last);
+
+	// Once shut down, messages are written without a writer thread
+	Titanium::detail::TiLoggerShutdown();
+	logger->Print<TiLoggerSeverityType::Ti_INFO>("after shutdown");
+	logger->TryFlush();
+	std::ifstream after("TiLoggerTests.log");
+	last.clear();
+	while (std::getline(after, line)) {
+		last = line;
+	}
+	XCTAssertEqual("[INFO] after shutdown", last);
+}
+
+// Measures what logging costs every Module::fireEvent with and without
+// DEBUG messages enabled.
+TEST_F(TiLoggerTests, FireEventOverhead)
+{
+	JSContext js_context = js_context_group.CreateContext(JSExport<Titanium::GlobalObject>::Class());
+	auto global_object = js_context.get_global_object();
+	auto Module = js_context.CreateObject(JSExport<Titanium::Module>::Class());
+	global_object.SetProperty("Module", Module);
+	XCTAssertNoThrow(js_context.JSEvaluateScript("var count = 0; var module = new Module(); module.addEventListener('tick', function (e) { count++; });"));
+	const auto module = static_cast<JSObject>(js_context.JSEvaluateScript("module")).GetPrivate<Titanium::Module>();
+	XCTAssertNotEqual(nullptr, module);
+
+	// Keep the console quiet while we measure
+	std::ostringstream sink;
+	const auto clog_buffer = std::clog.rdbuf(sink.rdbuf());
+	const auto cout_buffer = std::cout.rdbuf(sink.rdbuf());
+
+	const int events = 20000;
+	const auto measure = [&](const TiLoggerSeverityType& level) {
+		TiLoggerLevel::Set(level);
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < events; i++) {
+			module->fireEvent("tick");
+		}
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		Titanium::detail::TiLoggerFlushAll();
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / events;
+	};
+	const auto debug_ns = measure(TiLoggerSeverityType::Ti_DEBUG);
+	const auto filtered_ns = measure(TiLoggerSeverityType::Ti_ERROR);
+
+	std::clog.rdbuf(clog_buffer);
+	std::cout.rdbuf(cout_buffer);
+
+	XCTAssertEqual(events * 2, static_cast<std::int32_t>(js_context.JSEvaluateScript("count")));
+	RecordProperty("debug_ns_per_event", static_cast<int>(debug_ns));
+	RecordProperty("filtered_ns_per_event", static_cast<int>(filtered_ns));
+}
@@ -0,0 +1,287 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiPrepareQueue.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+// Holds work back until the test runs it, standing in for a worker thread
+class HeldExecutor
+{
+public:
+	void operator()(std::function<void()> task)
+	{
+		tasks.push_back(std::move(task));
+	}
+
+	void RunAll()
+	{
+		while (!tasks.empty()) {
+			auto task = std::move(tasks.front());
+			tasks.pop_front();
+			task();
+		}
+	}
+
+	std::deque<std::function<void()>> tasks;
+};
+
+TEST(TiPrepareQueueTests, PreparesAheadOfUse)
+{
+	auto executor = std::make_shared<HeldExecutor>();
+	TiPrepareQueue<std::string> queue([executor](std::function<void()> task) { (*executor)(std::move(task)); });
+
+	XCTAssertTrue(queue.Schedule(0, [] { return std::string("row 0"); }));
+	XCTAssertTrue(queue.Schedule(1, [] { return std::string("row 1"); }));
+	// Already pending
+	XCTAssertFalse(queue.Schedule(1, [] { return std::string("again"); }));
+	XCTAssertEqual(2, queue.get_pendingCount());
+	XCTAssertTrue(queue.Contains(1));
+	XCTAssertFalse(queue.Contains(2));
+
+	std::string result;
+	XCTAssertFalse(queue.Take(0, result));
+
+	executor->RunAll();
+	XCTAssertEqual(0, queue.get_pendingCount());
+	XCTAssertEqual(2, queue.get_readyCount());
+	// Already ready
+	XCTAssertFalse(queue.Schedule(0, [] { return std::string("again"); }));
+
+	XCTAssertTrue(queue.Take(1, result));
+	XCTAssertEqual("row 1", result);
+	XCTAssertFalse(queue.Take(1, result));
+	XCTAssertFalse(queue.Contains(1));
+	XCTAssertTrue(queue.Take(0, result));
+	XCTAssertEqual("row 0", result);
+	XCTAssertFalse(queue.Take(7, result));
+}
+
+TEST(TiPrepareQueueTests, CancelDropsStaleWork)
+{
+	auto executor = std::make_shared<HeldExecutor>();
+	TiPrepareQueue<int> queue([executor](std::function<void()> task) { (*executor)(std::move(task)); });
+
+	auto runs = 0;
+	queue.Schedule(0, [&runs] { runs++; return 10; });
+	queue.Schedule(1, [&runs] { runs++; return 11; });
+	executor->RunAll();
+	queue.Schedule(2, [&runs] { runs++; return 12; });
+	XCTAssertEqual(2, runs);
+
+	// The list changed: results made for the old items must not be used
+	queue.Cancel();
+	XCTAssertEqual(1, queue.get_generation());
+	XCTAssertEqual(0, queue.get_readyCount());
+	XCTAssertEqual(0, queue.get_pendingCount());
+
+	// Work queued before the cancel never runs, the same key may be scheduled again
+	XCTAssertTrue(queue.Schedule(2, [&runs] { runs++; return 22; }));
+	executor->RunAll();
+	XCTAssertEqual(3, runs);
+
+	int result = 0;
+	XCTAssertFalse(queue.Take(0, result));
+	XCTAssertTrue(queue.Take(2, result));
+	XCTAssertEqual(22, result);
+}
+
+TEST(TiPrepareQueueTests, RetainDropsKeysOutsideTheRange)
+{
+	auto executor = std::make_shared<HeldExecutor>();
+	TiPrepareQueue<int> queue([executor](std::function<void()> task) { (*executor)(std::move(task)); });
+
+	auto runs = 0;
+	for (std::uint32_t key = 0; key < 4; key++) {
+		queue.Schedule(key, [&runs, key] { runs++; return static_cast<int>(key); });
+	}
+	executor->RunAll();
+	for (std::uint32_t key = 4; key < 8; key++) {
+		queue.Schedule(key, [&runs, key] { runs++; return static_cast<int>(key); });
+	}
+	XCTAssertEqual(4, runs);
+
+	// The list scrolled: keep ready 2 and 3, pending 4 and 5
+	queue.Retain(2, 6);
+	XCTAssertEqual(2, queue.get_readyCount());
+	XCTAssertEqual(2, queue.get_pendingCount());
+	XCTAssertFalse(queue.Contains(1));
+	XCTAssertFalse(queue.Contains(6));
+	// Unlike Cancel, retained work stays current
+	XCTAssertEqual(0, queue.get_generation());
+
+	// Dropped work that has not started is skipped
+	executor->RunAll();
+	XCTAssertEqual(6, runs);
+	XCTAssertEqual(4, queue.get_readyCount());
+	int result = 0;
+	XCTAssertFalse(queue.Take(0, result));
+	XCTAssertFalse(queue.Take(7, result));
+	XCTAssertTrue(queue.Take(5, result));
+	XCTAssertEqual(5, result);
+
+	// A dropped key may be scheduled again
+	XCTAssertTrue(queue.Schedule(7, [&runs] { runs++; return 77; }));
+	executor->RunAll();
+	XCTAssertTrue(queue.Take(7, result));
+	XCTAssertEqual(77, result);
+}
+
+TEST(TiPrepareQueueTests, DiscardsWorkCancelledWhileRunning)
+{
+	std::mutex mutex;
+	std::condition_variable condition;
+	auto started = false;
+	auto release = false;
+	std::thread worker;
+
+	{
+		TiPrepareQueue<int> queue([&worker](std::function<void()> task) { worker = std::thread(std::move(task)); });
+		queue.Schedule(0, [&] {
+			std::unique_lock<std::mutex> lock(mutex);
+			started = true;
+			condition.notify_all();
+			condition.wait(lock, [&] { return release; });
+			return 1;
+		});
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&] { return started; });
+		}
+		queue.Cancel();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			release = true;
+		}
+		condition.notify_all();
+		worker.join();
+
+		int result = 0;
+		XCTAssertFalse(queue.Take(0, result));
+		XCTAssertEqual(0, queue.get_readyCount());
+	}
+
+	// Work may also finish after the queue itself is gone
+	release = false;
+	started = false;
+	{
+		TiPrepareQueue<int> queue([&worker](std::function<void()> task) { worker = std::thread(std::move(task)); });
+		queue.Schedule(0, [&] {
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&] { return release; });
+			return 1;
+		});
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		release = true;
+	}
+	condition.notify_all();
+	worker.join();
+}
+
+TEST(TiPrepareQueueTests, KeepsAheadOfAScrollingViewport)
+{
+	// Two workers prepare rows while the owner walks down the list the way a
+	// ListView creates its rows, cancelling once halfway as if the list mutated.
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::deque<std::function<void()>> tasks;
+	auto stopping = false;
+	std::vector<std::thread> workers;
+	for (auto i = 0; i < 2; i++) {
+		workers.emplace_back([&] {
+			while (true) {
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					condition.wait(lock, [&] { return stopping || !tasks.empty(); });
+					if (tasks.empty()) {
+						return;
+					}
+					task = std::move(tasks.front());
+					tasks.pop_front();
+				}
+				task();
+			}
+		});
+	}
+
+	std::atomic<std::uint32_t> prepared { 0 };
+	const std::uint32_t rows = 2000;
+	const std::uint32_t ahead = 32;
+	std::uint32_t taken = 0;
+	std::uint32_t version = 0;
+	{
+		TiPrepareQueue<std::uint32_t> queue([&](std::function<void()> task) {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				tasks.push_back(std::move(task));
+			}
+			condition.notify_one();
+		});
+		const auto prepare = [&](const std::uint32_t& row) {
+			const auto stamp = version * rows + row;
+			queue.Schedule(row, [&prepared, stamp] {
+				prepared++;
+				return stamp;
+			});
+		};
+
+		for (std::uint32_t row = 0; row < ahead; row++) {
+			prepare(row);
+		}
+		for (std::uint32_t row = 0; row < rows; row++) {
+			if (row == rows / 2) {
+				version++;
+				queue.Cancel();
+			}
+			if (row + ahead < rows) {
+				prepare(row + ahead);
+			}
+			// Rows scheduled before the list changed were dropped; the owner builds those itself
+			const auto dropped = row >= rows / 2 && row < rows / 2 + ahead;
+			std::uint32_t stamp = 0;
+			auto found = queue.Take(row, stamp);
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+			while (!found && !dropped && std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::yield();
+				found = queue.Take(row, stamp);
+			}
+			if (found) {
+				taken++;
+				// Never a result prepared before the list changed
+				XCTAssertEqual(version * rows + row, stamp);
+			}
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	condition.notify_all();
+	for (auto& worker : workers) {
+		worker.join();
+	}
+	RecordProperty("prepared", static_cast<int>(prepared));
+	XCTAssertEqual(rows - ahead, taken);
+}
@@ -0,0 +1,172 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiRowHeights.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+static bool near(const double& a, const double& b)
+{
+	return std::abs(a - b) < 1e-6 * (1 + std::abs(a) + std::abs(b));
+}
+
+TEST(TiRowHeightsTests, EstimatesUnmeasuredRows)
+{
+	TiRowHeights heights(40);
+	heights.Reset({ 0, 0, 1, 1, 0 });
+	XCTAssertEqual(5, heights.size());
+	XCTAssertTrue(near(200, heights.get_totalHeight()));
+	XCTAssertTrue(near(80, heights.Offset(2)));
+
+	// Template 0 averages its measured rows, template 1 falls back to every measured row
+	heights.Measure(0, 60);
+	heights.Measure(1, 100);
+	XCTAssertTrue(near(80, heights.Estimate(0)));
+	XCTAssertTrue(near(80, heights.Estimate(1)));
+	XCTAssertTrue(near(80, heights.get_heightAt(4)));
+	XCTAssertTrue(near(60 + 100 + 80 * 3, heights.get_totalHeight()));
+
+	heights.Measure(2, 20);
+	XCTAssertTrue(near(20, heights.Estimate(1)));
+	XCTAssertTrue(near(60 + 100 + 20 + 20 + 80, heights.get_totalHeight()));
+	XCTAssertTrue(near(180, heights.Offset(3)));
+
+	// Remeasured and forgotten rows
+	heights.Measure(0, 100);
+	XCTAssertTrue(near(100, heights.Estimate(0)));
+	heights.Forget(2);
+	XCTAssertFalse(heights.IsMeasured(2));
+	XCTAssertTrue(near(100, heights.Estimate(1)));
+	XCTAssertEqual(2, heights.get_measuredCount());
+	XCTAssertTrue(near(500, heights.get_totalHeight()));
+}
+
+TEST(TiRowHeightsTests, FindsRowsAtOffsets)
+{
+	TiRowHeights heights(10);
+	heights.Reset({ 0, 0, 0, 0 });
+	heights.Measure(0, 10);
+	heights.Measure(1, 30);
+	// Rows span [0, 10), [10, 40), then two rows estimated at 20
+	XCTAssertEqual(0, heights.RowAt(-5));
+	XCTAssertEqual(0, heights.RowAt(0));
+	XCTAssertEqual(0, heights.RowAt(9.5));
+	XCTAssertEqual(1, heights.RowAt(10));
+	XCTAssertEqual(1, heights.RowAt(39));
+	XCTAssertEqual(2, heights.RowAt(40));
+	XCTAssertEqual(3, heights.RowAt(79));
+	XCTAssertEqual(4, heights.RowAt(80));
+	XCTAssertEqual(4, heights.RowAt(1000));
+
+	heights.Reset({});
+	XCTAssertEqual(0, heights.RowAt(0));
+	XCTAssertTrue(near(0, heights.get_totalHeight()));
+}
+
+TEST(TiRowHeightsTests, MatchesBruteForceUnderEdits)
+{
+	std::mt19937 random(11);
+	const std::uint32_t templates = 4;
+	std::vector<std::uint32_t> rowTemplates;
+	std::vector<double> rowHeights;  // NAN while unmeasured
+	TiRowHeights heights(50);
+
+	const auto check = [&]() {
+		std::vector<double> sum(templates + 1, 0);
+		std::vector<std::uint32_t> count(templates + 1, 0);
+		for (std::size_t i = 0; i < rowTemplates.size(); i++) {
+			if (!std::isnan(rowHeights[i])) {
+				sum[rowTemplates[i]] += rowHeights[i];
+				count[rowTemplates[i]]++;
+				sum[templates] += rowHeights[i];
+				count[templates]++;
+			}
+		}
+		double offset = 0;
+		for (std::uint32_t i = 0; i < rowTemplates.size(); i++) {
+			const auto t = rowTemplates[i];
+			const auto expected = !std::isnan(rowHeights[i]) ? rowHeights[i] : count[t] ? sum[t] / count[t] : count[templates] ? sum[templates] / count[templates] : 50;
+			ASSERT_TRUE(near(offset, heights.Offset(i))) << "row " << i;
+			ASSERT_EQ(i, heights.RowAt(offset + expected / 2)) << "row " << i;
+			offset += expected;
+		}
+		ASSERT_TRUE(near(offset, heights.get_totalHeight()));
+	};
+
+	for (std::uint32_t i = 0; i < 300; i++) {
+		rowTemplates.push_back(random() % templates);
+		rowHeights.push_back(NAN);
+	}
+	heights.Reset(rowTemplates);
+	check();
+
+	for (auto round = 0; round < 200; round++) {
+		const auto op = random() % 5;
+		if (op == 0) {
+			const auto at = static_cast<std::uint32_t>(random() % (rowTemplates.size() + 1));
+			std::vector<std::uint32_t> inserted { static_cast<std::uint32_t>(random() % templates), static_cast<std::uint32_t>(random() % templates) };
+			rowTemplates.insert(rowTemplates.begin() + at, inserted.begin(), inserted.end());
+			rowHeights.insert(rowHeights.begin() + at, inserted.size(), NAN);
+			heights.Insert(at, inserted);
+		} else if (op == 1 && rowTemplates.size() > 3) {
+			const auto at = static_cast<std::uint32_t>(random() % (rowTemplates.size() - 3));
+			rowTemplates.erase(rowTemplates.begin() + at, rowTemplates.begin() + at + 3);
+			rowHeights.erase(rowHeights.begin() + at, rowHeights.begin() + at + 3);
+			heights.Erase(at, 3);
+		} else if (op == 2 && !rowTemplates.empty()) {
+			const auto at = static_cast<std::uint32_t>(random() % rowTemplates.size());
+			rowHeights[at] = NAN;
+			heights.Forget(at);
+		} else if (!rowTemplates.empty()) {
+			const auto at = static_cast<std::uint32_t>(random() % rowTemplates.size());
+			rowHeights[at] = 20 + random() % 200;
+			heights.Measure(at, rowHeights[at]);
+		}
+		check();
+	}
+}
+
+TEST(TiRowHeightsTests, JumpsWithoutMeasuringRowsAbove)
+{
+	// 100,000 Ti.UI.SIZE rows of three templates, only those on screen measured
+	const std::uint32_t rows = 100000;
+	std::vector<std::uint32_t> templates;
+	for (std::uint32_t i = 0; i < rows; i++) {
+		templates.push_back(i % 10 == 0 ? 1 : i % 7 == 0 ? 2 : 0);
+	}
+	TiRowHeights heights;
+	heights.Reset(templates);
+	for (std::uint32_t i = 0; i < 12; i++) {
+		heights.Measure(i, templates[i] == 1 ? 28 : templates[i] == 2 ? 90 : 64);
+	}
+	// The scroll extent, built once
+	XCTAssertTrue(heights.get_totalHeight() > 0);
+
+	// Scroll straight to row 40,000 and lay out a screenful there
+	const auto offset = heights.Offset(40000);
+	XCTAssertEqual(40000, heights.RowAt(offset));
+	for (std::uint32_t i = 40000; i < 40012; i++) {
+		heights.Measure(i, templates[i] == 1 ? 28 : templates[i] == 2 ? 90 : 64);
+	}
+	XCTAssertEqual(40000, heights.RowAt(heights.Offset(40000)));
+	XCTAssertEqual(40011, heights.RowAt(heights.Offset(40012) - 1));
+
+	XCTAssertEqual(24, heights.get_measuredCount());
+	XCTAssertTrue(near(64, heights.Estimate(0)));
+	XCTAssertTrue(near(28, heights.Estimate(1)));
+	XCTAssertTrue(near(90, heights.Estimate(2)));
+}
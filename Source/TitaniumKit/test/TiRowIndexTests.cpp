@@ -0,0 +1,155 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiRowIndex.hpp"
+#include "gtest/gtest.h"
+
+#include <random>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+TEST(TiRowIndexTests, LocatesAcrossEmptySections)
+{
+	TiRowIndex index;
+	index.Reset({ 2, 0, 3, 0 });
+	XCTAssertEqual(5, index.get_rowCount());
+	XCTAssertEqual(4, index.get_sectionCount());
+
+	const std::vector<std::pair<std::uint32_t, std::uint32_t>> expected { { 0, 0 }, { 0, 1 }, { 2, 0 }, { 2, 1 }, { 2, 2 } };
+	for (std::uint32_t i = 0; i < expected.size(); i++) {
+		const auto location = index.Locate(i);
+		XCTAssertTrue(location.found);
+		XCTAssertEqual(expected[i].first, location.section);
+		XCTAssertEqual(expected[i].second, location.row);
+	}
+	const auto past = index.Locate(5);
+	XCTAssertFalse(past.found);
+	XCTAssertEqual(4, past.section);
+
+	XCTAssertEqual(0, index.Offset(0));
+	XCTAssertEqual(2, index.Offset(2));
+	XCTAssertEqual(5, index.Offset(4));
+
+	index.Resize(1, 4);
+	index.Resize(2, -3);
+	XCTAssertEqual(6, index.get_rowCount());
+	XCTAssertEqual(1, index.Locate(2).section);
+	XCTAssertEqual(0, index.Locate(2).row);
+	XCTAssertFalse(index.Locate(6).found);
+
+	index.Reset({});
+	XCTAssertFalse(index.Locate(0).found);
+	XCTAssertEqual(0, index.Locate(0).section);
+}
+
+TEST(TiRowIndexTests, HashesRowsToSections)
+{
+	int rows[3];
+	TiRowIndex index;
+	index.Reset({ 1, 2 });
+	index.InsertRow(&rows[0], 0);
+	index.InsertRow(&rows[1], 1);
+
+	std::uint32_t section = 0;
+	XCTAssertTrue(index.FindRow(&rows[1], section));
+	XCTAssertEqual(1, section);
+	XCTAssertFalse(index.FindRow(&rows[2], section));
+	index.EraseRow(&rows[1]);
+	XCTAssertFalse(index.FindRow(&rows[1], section));
+}
+
+TEST(TiRowIndexTests, KeepsRowsWhileSectionsMove)
+{
+	int rows[4];
+	TiRowIndex index;
+	index.Reset({ 1, 2 });
+	index.InsertRow(&rows[0], 0);
+	index.InsertRow(&rows[1], 1);
+
+	// Two sections come in before the second one
+	index.SpliceSections(1, 0, { 3, 0 });
+	index.InsertRow(&rows[2], 1);
+	XCTAssertEqual(4, index.get_sectionCount());
+	XCTAssertEqual(6, index.get_rowCount());
+	XCTAssertEqual(3, index.Locate(4).section);
+
+	std::uint32_t section = 0;
+	XCTAssertTrue(index.FindRow(&rows[0], section));
+	XCTAssertEqual(0, section);
+	XCTAssertTrue(index.FindRow(&rows[1], section));
+	XCTAssertEqual(3, section);
+	XCTAssertTrue(index.FindRow(&rows[2], section));
+	XCTAssertEqual(1, section);
+
+	// The first section is replaced; its row is gone with it
+	index.SpliceSections(0, 1, { 5 });
+	index.InsertRow(&rows[3], 0);
+	XCTAssertFalse(index.FindRow(&rows[0], section));
+	XCTAssertTrue(index.FindRow(&rows[3], section));
+	XCTAssertEqual(0, section);
+	XCTAssertTrue(index.FindRow(&rows[1], section));
+	XCTAssertEqual(3, section);
+	XCTAssertEqual(10, index.get_rowCount());
+
+	index.Resize(3, 1);
+	index.SpliceSections(3, 1, {});
+	XCTAssertEqual(3, index.get_sectionCount());
+	XCTAssertEqual(8, index.get_rowCount());
+	XCTAssertFalse(index.FindRow(&rows[1], section));
+	XCTAssertFalse(index.Locate(8).found);
+}
+
+// 10k mixed inserts and deletes by flat index over 200 sections give the
+// same answers as the section-by-section walk the table view used to do
+TEST(TiRowIndexTests, MixedInsertsAndDeletesMatchASectionWalk)
+{
+	const std::uint32_t sections = 200;
+	const std::vector<std::uint32_t> initial(sections, 50);
+
+	// Same operations for both: a flat index and whether to insert there
+	std::mt19937 random(43);
+	std::vector<std::pair<std::uint32_t, bool>> ops;
+	std::uint32_t total = sections * 50;
+	for (std::uint32_t op = 0; op < 10000; op++) {
+		const auto insert = random() % 2 == 0;
+		ops.push_back(std::make_pair(static_cast<std::uint32_t>(random() % total), insert));
+		total += insert ? 1 : -1;
+	}
+
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> indexed_result;
+	TiRowIndex index;
+	index.Reset(initial);
+	for (const auto& op : ops) {
+		const auto location = index.Locate(op.first);
+		indexed_result.push_back(std::make_pair(location.section, location.row));
+		index.Resize(location.section, op.second ? 1 : -1);
+	}
+
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> walked_result;
+	auto sizes = initial;
+	for (const auto& op : ops) {
+		std::uint32_t offset = 0;
+		std::uint32_t section = 0;
+		while (op.first >= offset + sizes[section]) {
+			offset += sizes[section++];
+		}
+		walked_result.push_back(std::make_pair(section, op.first - offset));
+		sizes[section] += op.second ? 1 : -1;
+	}
+
+	XCTAssertEqual(walked_result, indexed_result);
+	XCTAssertEqual(total, index.get_rowCount());
+	for (std::uint32_t section = 0; section < sections; section++) {
+		XCTAssertEqual(sizes[section], index.Offset(section + 1) - index.Offset(section));
+	}
+}
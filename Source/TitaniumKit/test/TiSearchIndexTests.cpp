@@ -0,0 +1,100 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiSearchIndex.hpp"
+#include "gtest/gtest.h"
+
+#include <random>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+static std::vector<std::uint32_t> scan(const std::vector<std::string>& texts, const std::string& query, const bool& caseInsensitive)
+{
+	std::vector<std::uint32_t> ids;
+	const auto needle = caseInsensitive ? TiSearchIndex::Fold(query) : query;
+	for (std::uint32_t id = 0; id < texts.size(); id++) {
+		const auto haystack = caseInsensitive ? TiSearchIndex::Fold(texts[id]) : texts[id];
+		if (haystack.find(needle) != std::string::npos) {
+			ids.push_back(id);
+		}
+	}
+	return ids;
+}
+
+TEST(TiSearchIndexTests, MatchesSubstrings)
+{
+	TiSearchIndex index;
+	index.Insert(0, "Carrots");
+	index.Insert(1, "Potatoes");
+	index.Insert(2, "Sweet potato");
+	index.Insert(3, "Ta");
+
+	XCTAssertEqual(std::vector<std::uint32_t>({ 1, 2 }), index.Search("POTAT", true));
+	XCTAssertEqual(std::vector<std::uint32_t>({ 1 }), index.Search("Potat", false));
+	XCTAssertEqual(std::vector<std::uint32_t>({ 1, 2, 3 }), index.Search("ta", true));
+	XCTAssertEqual(std::vector<std::uint32_t>({ 0, 1, 2, 3 }), index.Search("", true));
+	XCTAssertTrue(index.Search("turnip", true).empty());
+}
+
+TEST(TiSearchIndexTests, FollowsInsertAndErase)
+{
+	TiSearchIndex index;
+	index.Insert(0, "Carrots");
+	index.Insert(1, "Potatoes");
+	XCTAssertEqual(std::vector<std::uint32_t>({ 1 }), index.Search("pot", true));
+
+	// A refined query must not keep a document changed since the last one
+	index.Insert(1, "Turnips");
+	XCTAssertTrue(index.Search("pota", true).empty());
+	XCTAssertEqual(std::vector<std::uint32_t>({ 1 }), index.Search("turn", true));
+
+	index.Erase(1);
+	XCTAssertTrue(index.Search("turn", true).empty());
+	XCTAssertEqual(1, index.size());
+
+	// Enough churn to compact the postings
+	for (std::uint32_t round = 0; round < 10; round++) {
+		for (std::uint32_t id = 0; id < 100; id++) {
+			index.Insert(id, "item " + std::to_string(id * (round + 1)));
+		}
+	}
+	XCTAssertEqual(std::vector<std::uint32_t>({ 10 }), index.Search("item 100", true));
+	XCTAssertEqual(std::vector<std::uint32_t>({ 5, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59 }), index.Search("item 5", true));
+
+	index.Clear();
+	XCTAssertEqual(0, index.size());
+	XCTAssertTrue(index.Search("", true).empty());
+}
+
+TEST(TiSearchIndexTests, IncrementalTypingOnFiftyThousandContacts)
+{
+	const std::vector<std::string> first { "John", "Jane", "Joanna", "Jonah", "Maria", "Mario", "Li", "Ana", "Pieter", "Sofia", "Chen", "Olu" };
+	const std::vector<std::string> last { "Smith", "Johnson", "Nakamura", "Okafor", "Garcia", "Van der Berg", "Kowalski", "O'Brien", "Haddad", "Nguyen" };
+	std::mt19937 random(7);
+	std::vector<std::string> texts;
+	TiSearchIndex index;
+	for (std::uint32_t id = 0; id < 50000; id++) {
+		texts.push_back(first[random() % first.size()] + " " + last[random() % last.size()] + " " + std::to_string(random() % 10000));
+		index.Insert(id, texts.back());
+	}
+
+	// One search per keystroke, each refining the last
+	const std::string typed = "Johnson 12";
+	for (std::size_t length = 1; length <= typed.size(); length++) {
+		const auto query = typed.substr(0, length);
+		XCTAssertEqual(scan(texts, query, true), index.Search(query, true));
+	}
+	// Backspace and a fresh query go through the postings again
+	XCTAssertEqual(scan(texts, "Johnson", false), index.Search("Johnson", false));
+	XCTAssertEqual(scan(texts, "ana", true), index.Search("ana", true));
+}
@@ -0,0 +1,207 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiTimerWheel.hpp"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+using std::chrono::milliseconds;
+
+// Drives a wheel on a virtual clock, one resolution step at a time
+class TiTimerWheelTests : public testing::Test
+{
+protected:
+	std::vector<std::uint32_t> advance(TiTimerWheel& wheel, const milliseconds& by)
+	{
+		std::vector<std::uint32_t> ids;
+		const auto end = now + by;
+		while (now < end) {
+			now += std::min(wheel.get_resolution(), end - now);
+			for (const auto& expired : wheel.Advance(now)) {
+				ids.push_back(expired.id);
+				fired[expired.id].push_back(now);
+			}
+		}
+		return ids;
+	}
+
+	milliseconds now { 0 };
+	std::map<std::uint32_t, std::vector<milliseconds>> fired;
+};
+
+TEST_F(TiTimerWheelTests, TimeoutNeverEarly)
+{
+	TiTimerWheel wheel(milliseconds(10), now);
+	now = milliseconds(19);
+	wheel.Schedule(1, milliseconds(10), false, now);
+	wheel.Schedule(2, milliseconds(0), false, now);
+	XCTAssertEqual(2, wheel.size());
+
+	// 19 + 10 rounds up to the tick at 30, 19 + 0 to the tick at 20
+	auto batch = wheel.Advance(milliseconds(29));
+	XCTAssertEqual(1, batch.size());
+	XCTAssertEqual(2, batch[0].id);
+	batch = wheel.Advance(milliseconds(30));
+	XCTAssertEqual(1, batch.size());
+	XCTAssertEqual(1, batch[0].id);
+	XCTAssertTrue(wheel.empty());
+}
+
+TEST_F(TiTimerWheelTests, SameTickIsOneBatchInOrder)
+{
+	TiTimerWheel wheel(milliseconds(5), now);
+	for (std::uint32_t id = 0; id < 100; id++) {
+		wheel.Schedule(id, milliseconds(3), false, now);
+	}
+	now = milliseconds(5);
+	const auto batch = wheel.Advance(now);
+	XCTAssertEqual(100, batch.size());
+	for (std::uint32_t id = 0; id < 100; id++) {
+		XCTAssertEqual(id, batch[id].id);
+		XCTAssertFalse(batch[id].repeating);
+	}
+}
+
+TEST_F(TiTimerWheelTests, IntervalAndCancel)
+{
+	TiTimerWheel wheel(milliseconds(1), now);
+	wheel.Schedule(1, milliseconds(10), true, now);
+	wheel.Schedule(2, milliseconds(15), false, now);
+	XCTAssertTrue(wheel.Cancel(2));
+	XCTAssertFalse(wheel.Cancel(2));
+
+	advance(wheel, milliseconds(55));
+	XCTAssertEqual(5, fired[1].size());
+	for (std::size_t i = 0; i < fired[1].size(); i++) {
+		XCTAssertEqual(milliseconds(10 * (i + 1)), fired[1][i]);
+	}
+	XCTAssertEqual(0, fired.count(2));
+	XCTAssertTrue(wheel.Contains(1));
+	XCTAssertTrue(wheel.Cancel(1));
+	XCTAssertTrue(wheel.empty());
+}
+
+TEST_F(TiTimerWheelTests, MissedIntervalsCollapse)
+{
+	TiTimerWheel wheel(milliseconds(10), now);
+	wheel.Schedule(1, milliseconds(10), true, now);
+
+	// Nobody drove the wheel for a second, e.g. the app was suspended
+	now = milliseconds(1000);
+	const auto batch = wheel.Advance(now);
+	XCTAssertEqual(1, batch.size());
+	XCTAssertTrue(batch[0].repeating);
+
+	advance(wheel, milliseconds(10));
+	XCTAssertEqual(1, fired[1].size());
+	XCTAssertEqual(milliseconds(1010), fired[1][0]);
+}
+
+TEST_F(TiTimerWheelTests, CascadesAcrossLevels)
+{
+	TiTimerWheel wheel(milliseconds(1), now);
+	std::mt19937 random(42);
+	std::map<std::uint32_t, milliseconds> due;
+	for (std::uint32_t id = 0; id < 2000; id++) {
+		// Up to about 70 minutes, which reaches every level
+		const milliseconds delay(random() % (1 << 22));
+		wheel.Schedule(id, delay, false, now);
+		due[id] = delay;
+	}
+	// Far beyond the top level, parked until it comes around
+	wheel.Schedule(5000, milliseconds(std::uint64_t(1) << 27), false, now);
+
+	std::size_t count = 0;
+	while (count < due.size()) {
+		now += milliseconds(997);
+		for (const auto& expired : wheel.Advance(now)) {
+			XCTAssertTrue(due.count(expired.id) == 1);
+			XCTAssertTrue(now >= due[expired.id]);
+			XCTAssertTrue(now - due[expired.id] < milliseconds(997));
+			count++;
+		}
+	}
+	XCTAssertEqual(1, wheel.size());
+	XCTAssertTrue(wheel.Contains(5000));
+
+	const auto batch = wheel.Advance(milliseconds(std::uint64_t(1) << 27));
+	XCTAssertEqual(1, batch.size());
+	XCTAssertEqual(5000, batch[0].id);
+}
+
+TEST_F(TiTimerWheelTests, NextExpiry)
+{
+	TiTimerWheel wheel(milliseconds(10), now);
+	wheel.Schedule(1, milliseconds(60000), true, now);
+	// At most that far, the timer may have to move down a level first
+	XCTAssertTrue(wheel.NextExpiry() <= milliseconds(60000));
+	wheel.Schedule(2, milliseconds(25), false, now);
+	XCTAssertEqual(milliseconds(30), wheel.NextExpiry());
+
+	// Sleeping until the next expiry wakes for each timer and a few
+	// cascades, not for every tick in between
+	std::size_t wakeups = 0;
+	while (fired[1].size() < 2) {
+		now = wheel.NextExpiry();
+		for (const auto& expired : wheel.Advance(now)) {
+			fired[expired.id].push_back(now);
+		}
+		wakeups++;
+	}
+	XCTAssertEqual(milliseconds(30), fired[2][0]);
+	XCTAssertEqual(milliseconds(60000), fired[1][0]);
+	XCTAssertEqual(milliseconds(120000), fired[1][1]);
+	XCTAssertTrue(wakeups < 10);
+}
+
+TEST_F(TiTimerWheelTests, NextExpiryAcrossLevels)
+{
+	TiTimerWheel wheel(milliseconds(1), now);
+	std::mt19937 random(7);
+	std::map<std::uint32_t, milliseconds> due;
+	for (std::uint32_t id = 0; id < 200; id++) {
+		const milliseconds delay(1 + random() % (1 << 22));
+		wheel.Schedule(id, delay, false, now);
+		due[id] = delay;
+	}
+
+	std::size_t count = 0;
+	while (!wheel.empty()) {
+		const auto next = wheel.NextExpiry();
+		XCTAssertTrue(next > now);
+		now = next;
+		for (const auto& expired : wheel.Advance(now)) {
+			XCTAssertEqual(due[expired.id], now);
+			count++;
+		}
+	}
+	XCTAssertEqual(due.size(), count);
+}
+
+TEST_F(TiTimerWheelTests, IdleGapIsSkipped)
+{
+	TiTimerWheel wheel(milliseconds(10), now);
+	wheel.Schedule(1, milliseconds(10), false, now);
+	advance(wheel, milliseconds(10));
+	XCTAssertTrue(wheel.empty());
+
+	// A day later the wheel starts from now instead of walking the gap
+	now += milliseconds(24 * 60 * 60 * 1000);
+	wheel.Schedule(2, milliseconds(50), false, now);
+	XCTAssertEqual(now + milliseconds(50), wheel.NextExpiry());
+	XCTAssertEqual(1, wheel.Advance(now + milliseconds(50)).size());
+}
@@ -0,0 +1,173 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiBase.hpp"
+#include "Titanium/detail/TiTrace.hpp"
+#include "Titanium/detail/TiTraceDecoder.hpp"
+#include "Titanium/detail/TiLoggerPolicyTrace.hpp"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+#define XCTAssertNoThrow ASSERT_NO_THROW
+
+using namespace Titanium::detail;
+
+class TiTraceTests : public testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		severity = TiLoggerLevel::Get();
+		TiLoggerLevel::Set(TiLoggerSeverityType::Ti_TRACE);
+	}
+
+	virtual void TearDown()
+	{
+		TiTrace::Close();
+		TiLoggerLevel::Set(severity);
+	}
+
+	std::vector<TiTraceDecodedEvent> decode(const std::string& path, const std::size_t& segments)
+	{
+		TiTraceDecoder decoder;
+		for (std::size_t i = 0; i < segments; i++) {
+			const auto segment = path + "." + std::to_string(i);
+			if (std::ifstream(segment).good()) {
+				decoder.Load(segment);
+			}
+		}
+		return decoder.get_events();
+	}
+
+	TiLoggerSeverityType severity;
+};
+
+TEST_F(TiTraceTests, RoundTrip)
+{
+	XCTAssertTrue(TiTrace::Open("TiTraceTests.trace"));
+	const std::string name = "app.js";
+	TITANIUM_TRACE_INFO("loaded {} in {} ms", name, 12.5);
+	TITANIUM_TRACE_WARN("{} of {} ok: {}", -3, 7u, true);
+	TITANIUM_TRACE_DEBUG("no placeholder", "extra");
+	TiTrace::Close();
+
+	const auto events = decode("TiTraceTests.trace", 4);
+	XCTAssertEqual(3, events.size());
+	XCTAssertEqual("loaded app.js in 12.5 ms", TiTraceDecoder::Format(events[0]));
+	XCTAssertEqual(static_cast<std::uint8_t>(TiLoggerSeverityType::Ti_INFO), events[0].severity);
+	XCTAssertEqual("-3 of 7 ok: true", TiTraceDecoder::Format(events[1]));
+	XCTAssertEqual(TiTraceArgType::UInt, events[1].args[1].type);
+	XCTAssertEqual("no placeholder extra", TiTraceDecoder::Format(events[2]));
+	XCTAssertNotEqual(std::string::npos, events[0].file.find("TiTraceTests.cpp"));
+	XCTAssertEqual(TiTrace::ThreadId(), events[0].thread);
+
+	const auto json = TiTraceDecoder::ToJSON(events[0]);
+	XCTAssertNotEqual(std::string::npos, json.find("\"args\":[\"app.js\",12.5]"));
+	XCTAssertNotEqual(std::string::npos, json.find("\"severity\":\"INFO\""));
+}
+
+TEST_F(TiTraceTests, FilteredSeverityWritesNothing)
+{
+	XCTAssertTrue(TiTrace::Open("TiTraceTests.trace"));
+	TiLoggerLevel::Set(TiLoggerSeverityType::Ti_WARN);
+	std::size_t evaluated = 0;
+	for (int i = 0; i < 10; i++) {
+		TITANIUM_TRACE_DEBUG("{}", ++evaluated);
+	}
+	TITANIUM_TRACE_ERROR("kept");
+	TiTrace::Close();
+
+	XCTAssertEqual(0, evaluated);
+	XCTAssertEqual(1, decode("TiTraceTests.trace", 4).size());
+}
+
+TEST_F(TiTraceTests, RotationKeepsNewestSegments)
+{
+	// 64 KiB segments hold a couple of thousand events each
+	XCTAssertTrue(TiTrace::Open("TiTraceTests.trace", 64 * 1024, 3));
+	const int count = 20000;
+	for (int i = 0; i < count; i++) {
+		TITANIUM_TRACE_INFO("event {}", i);
+	}
+	XCTAssertTrue(TiTrace::get_segments() > 3);
+	TiTrace::Close();
+
+	// Only the last three segments remain, decoded in order with no gaps
+	const auto events = decode("TiTraceTests.trace", 3);
+	XCTAssertFalse(events.empty());
+	XCTAssertTrue(events.size() < static_cast<std::size_t>(count));
+	for (std::size_t i = 1; i < events.size(); i++) {
+		XCTAssertEqual(events[i - 1].args[0].int_value + 1, events[i].args[0].int_value);
+	}
+	XCTAssertEqual(count - 1, events.back().args[0].int_value);
+	XCTAssertEqual(0, TiTrace::get_dropped());
+}
+
+TEST_F(TiTraceTests, ConcurrentWriters)
+{
+	XCTAssertTrue(TiTrace::Open("TiTraceTests.trace", 64 * 1024 * 1024, 1));
+	const std::size_t threads = 4;
+	const std::size_t per_thread = 50000;
+	std::vector<std::thread> writers;
+	for (std::size_t t = 0; t < threads; t++) {
+		writers.emplace_back([t, per_thread] {
+			for (std::size_t i = 0; i < per_thread; i++) {
+				TITANIUM_TRACE_INFO("writer {} event {}", t, i);
+			}
+		});
+	}
+	for (auto& writer : writers) {
+		writer.join();
+	}
+	TiTrace::Close();
+
+	const auto events = decode("TiTraceTests.trace", 1);
+	XCTAssertEqual(threads * per_thread, events.size());
+	std::vector<std::uint64_t> next(threads, 0);
+	for (const auto& event : events) {
+		const auto writer = event.args[0].uint_value;
+		XCTAssertEqual(next[writer], event.args[1].uint_value);
+		next[writer]++;
+	}
+}
+
+TEST_F(TiTraceTests, LoggerPolicy)
+{
+	const auto logger = TiLogger<TiLoggerPolicyTrace>::Instance("TiTraceTests.policy");
+	logger->Print<TiLoggerSeverityType::Ti_WARN>("low memory: ", 12, " MB");
+	logger->Flush();
+	TiTrace::Close();
+
+	const auto events = decode("TiTraceTests.policy", 4);
+	XCTAssertEqual(1, events.size());
+	XCTAssertEqual(static_cast<std::uint8_t>(TiLoggerSeverityType::Ti_WARN), events[0].severity);
+	XCTAssertEqual("low memory: 12 MB", TiTraceDecoder::Format(events[0]));
+}
+
+TEST_F(TiTraceTests, CostPerEvent)
+{
+	XCTAssertTrue(TiTrace::Open("TiTraceTests.trace", 64 * 1024 * 1024, 1));
+	const int count = 1000000;
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < count; i++) {
+		TITANIUM_TRACE_INFO("tick {} {}", i, 0.5);
+	}
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	TiTrace::Close();
+
+	const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / count;
+	RecordProperty("ns_per_event", static_cast<int>(ns));
+}
@@ -0,0 +1,154 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+#include "Titanium/detail/TiViewRecycler.hpp"
+#include "gtest/gtest.h"
+
+#include <set>
+
+#define XCTAssertEqual ASSERT_EQ
+#define XCTAssertNotEqual ASSERT_NE
+#define XCTAssertTrue ASSERT_TRUE
+#define XCTAssertFalse ASSERT_FALSE
+
+using namespace Titanium::detail;
+
+// Stands in for a native view; remembers what it was bound to
+struct FakeView
+{
+	std::string key;
+	std::uint32_t position;
+	bool attached;
+};
+
+// A headless list: every third row uses the "header" template
+class TiViewRecyclerTests : public testing::Test
+{
+protected:
+	virtual void SetUp()
+	{
+		recycler.set_callbacks(
+			[this](const std::uint32_t& position) {
+				return key_at(position);
+			},
+			[this](const std::uint32_t& position) {
+				auto view = std::make_shared<FakeView>();
+				view->key = key_at(position);
+				view->position = position;
+				view->attached = true;
+				live++;
+				return view;
+			},
+			[this](const std::shared_ptr<FakeView>& view, const std::uint32_t& position) {
+				EXPECT_EQ(key_at(position), view->key);
+				EXPECT_FALSE(view->attached);
+				view->position = position;
+				view->attached = true;
+				live++;
+			},
+			[this](const std::shared_ptr<FakeView>& view, const std::uint32_t& position) {
+				EXPECT_EQ(position, view->position);
+				view->attached = false;
+				live--;
+			});
+	}
+
+	std::string key_at(const std::uint32_t& position) const
+	{
+		return position % 3 == 0 ? "header" : "row";
+	}
+
+	TiViewRecycler<FakeView> recycler { 4, 8 };
+	std::size_t live { 0 };
+};
+
+TEST_F(TiViewRecyclerTests, RealizesViewportAndOverscan)
+{
+	recycler.set_viewport(10, 20, 100);
+	XCTAssertEqual(28, recycler.get_live_count());
+	XCTAssertEqual(28, live);
+	XCTAssertFalse(recycler.get_view(5));
+	for (std::uint32_t position = 6; position < 34; position++) {
+		const auto view = recycler.get_view(position);
+		XCTAssertTrue(view != nullptr);
+		XCTAssertEqual(position, view->position);
+	}
+	XCTAssertFalse(recycler.get_view(34));
+
+	// Clamped at both ends
+	recycler.set_viewport(0, 20, 22);
+	XCTAssertEqual(22, recycler.get_live_count());
+	XCTAssertEqual(22, live);
+}
+
+TEST_F(TiViewRecyclerTests, ScrollsHundredThousandItemsWithBoundedViews)
+{
+	const std::uint32_t item_count = 100000;
+	const std::uint32_t visible = 20;
+
+	std::size_t max_live = 0;
+	for (std::uint32_t first = 0; first + visible <= item_count; first += 7) {
+		recycler.set_viewport(first, visible, item_count);
+		max_live = std::max(max_live, recycler.get_live_count());
+		XCTAssertEqual(recycler.get_live_count(), live);
+		const auto view = recycler.get_view(first);
+		XCTAssertEqual(first, view->position);
+		XCTAssertEqual(key_at(first), view->key);
+	}
+	// And a fling back to the top
+	recycler.set_viewport(0, visible, item_count);
+	XCTAssertEqual(0, recycler.get_view(0)->position);
+
+	XCTAssertTrue(max_live <= visible + 2 * 4);
+	const auto stats = recycler.get_stats();
+	// Views were created for about one screen; every later row reused one
+	XCTAssertTrue(stats.created <= 2 * (visible + 2 * 4));
+	XCTAssertTrue(stats.rebound >= item_count - stats.created);
+	XCTAssertEqual(0, stats.dropped);
+	XCTAssertTrue(recycler.get_live_count() + recycler.get_pooled_count() <= stats.created);
+}
+
+TEST_F(TiViewRecyclerTests, ReusesOnlyMatchingTemplate)
+{
+	recycler.set_viewport(0, 6, 1000);
+	std::set<FakeView*> headers;
+	for (std::uint32_t position = 0; position < 10; position++) {
+		const auto view = recycler.get_view(position);
+		if (view->key == "header") {
+			headers.insert(view.get());
+		}
+	}
+	recycler.set_viewport(500, 6, 1000);
+	for (std::uint32_t position = 496; position < 510; position++) {
+		const auto view = recycler.get_view(position);
+		XCTAssertEqual(key_at(position), view->key);
+		if (view->key == "row") {
+			XCTAssertTrue(headers.find(view.get()) == headers.end());
+		}
+	}
+}
+
+TEST_F(TiViewRecyclerTests, RefreshRebindsFromPools)
+{
+	recycler.set_viewport(0, 10, 50);
+	const auto created = recycler.get_stats().created;
+
+	recycler.Refresh(50);
+	XCTAssertEqual(14, recycler.get_live_count());
+	XCTAssertEqual(created, recycler.get_stats().created);
+
+	// The list shrank below the viewport
+	recycler.Refresh(5);
+	XCTAssertEqual(5, recycler.get_live_count());
+	XCTAssertEqual(5, live);
+
+	recycler.Clear();
+	XCTAssertEqual(0, recycler.get_live_count());
+	XCTAssertEqual(0, recycler.get_pooled_count());
+	XCTAssertEqual(0, live);
+}
@@ -0,0 +1,48 @@
+/**
+ * TitaniumKit
+ *
+ * Copyright (c) 2016 by Appcelerator, Inc. All Rights Reserved.
+ * Licensed under the terms of the Apache Public License.
+ * Please see the LICENSE included with this distribution for details.
+ */
+
+// Turns TiTrace segments back into text or JSON (one object per line).
+//
+// usage: ti-trace-decode [--json] app.trace.0 app.trace.1 ...
+
+#include "Titanium/detail/TiTraceDecoder.hpp"
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+int main(int argc, char* argv[])
+{
+	using Titanium::detail::TiTraceDecoder;
+
+	bool json = false;
+	TiTraceDecoder decoder;
+	std::size_t segments = 0;
+	try {
+		for (int i = 1; i < argc; i++) {
+			if (std::strcmp(argv[i], "--json") == 0) {
+				json = true;
+			} else {
+				decoder.Load(argv[i]);
+				segments++;
+			}
+		}
+	} catch (const std::runtime_error& e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	if (segments == 0) {
+		std::cerr << "usage: " << argv[0] << " [--json] <trace segment>..." << std::endl;
+		return 2;
+	}
+
+	for (const auto& event : decoder.get_events()) {
+		std::cout << (json ? TiTraceDecoder::ToJSON(event) : TiTraceDecoder::ToText(event)) << '\n';
+	}
+	return 0;
+}
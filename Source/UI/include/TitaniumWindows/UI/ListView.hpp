@@ -44,6 +44,7 @@ namespace TitaniumWindows
 			virtual void deleteSectionAt(const uint32_t& sectionIndex, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT override;
 			virtual void insertSectionAt(const uint32_t& sectionIndex, const std::vector<std::shared_ptr<Titanium::UI::ListSection>>& section, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT override;
 			virtual void replaceSectionAt(const uint32_t& sectionIndex, const std::vector<std::shared_ptr<Titanium::UI::ListSection>>& section, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT override;
+			virtual void scrollToItem(const uint32_t& sectionIndex, const uint32_t& itemIndex, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT override;
 
 			ListView(const JSContext&) TITANIUM_NOEXCEPT;
 
@@ -72,16 +73,32 @@ namespace TitaniumWindows
 			void resetListViewDataBinding();
 			void clearListViewData();
 
+			static Windows::UI::Xaml::Controls::ScrollViewer^ GetScrollView(Windows::UI::Xaml::DependencyObject^ obj);
+
+		protected:
+			virtual void itemViewRealized(const std::shared_ptr<Titanium::UI::View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) override;
+			virtual void itemViewReleased(const std::shared_ptr<Titanium::UI::View>& view) override;
+			virtual std::function<double(const Titanium::UI::ListItemSnapshot&)> createItemMeasure() override;
+			virtual void itemViewPrepared(const std::shared_ptr<Titanium::UI::View>& view, const double& height) override;
+
 		private:
 			void unregisterSectionLayoutNode(const std::shared_ptr<Titanium::UI::ListSection>& section);
 			void registerListViewItemAsLayoutNode(const std::shared_ptr<Titanium::UI::View>& view);
 			void unregisterListViewItemAsLayoutNode(const std::shared_ptr<Titanium::UI::View>& view);
-			void appendListViewItemForSection(const std::shared_ptr<TitaniumWindows::UI::View>& view, ::Platform::Collections::Vector<Windows::UI::Xaml::UIElement^>^ group);
-			void insertListViewItemForSection(const std::shared_ptr<TitaniumWindows::UI::View>& view, ::Platform::Collections::Vector<Windows::UI::Xaml::UIElement^>^ group, const std::uint32_t& index);
 			void bindCollectionViewSource();
 			void unbindCollectionViewSource();
 
+			// Each item of the XAML list is a host that holds the view of the item only while it is near the viewport
+			Windows::UI::Xaml::Controls::Border^ createItemHost(const double& height) const;
+			Windows::UI::Xaml::Controls::Border^ getItemHost(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const;
+
+			// Records the heights of the items on screen and realizes the item views the scroll viewport shows
+			void updateVisibleItems();
+			// Scroll offset less the section headers and footers above it, which are not items
+			double getItemScrollOffset(const double& offset) const;
+
 			Windows::UI::Xaml::Controls::ListView^ listview__;
+			Windows::UI::Xaml::Controls::ScrollViewer^ scrollview__;
 			Windows::UI::Xaml::Data::CollectionViewSource^ collectionViewSource__;
 
 			// This is the "view" of the underlying list view items that is shown in the UI. It may be filtered from set_searchText
@@ -90,6 +107,9 @@ namespace TitaniumWindows
 #pragma warning(push)
 #pragma warning(disable : 4251)
 			Windows::Foundation::EventRegistrationToken itemclick_event__;
+			Windows::Foundation::EventRegistrationToken loaded_event__;
+			Windows::Foundation::EventRegistrationToken sizechanged_event__;
+			Windows::Foundation::EventRegistrationToken viewchanged_event__;
 #pragma warning(pop)
 
 		};
@@ -112,6 +112,9 @@ namespace TitaniumWindows
 			
 			double oldScrollPosX__ { -1 };
 			double oldScrollPosY__ { -1 };
+
+			// While set, row events leave the collection view source bound
+			bool batchingRows__ { false };
 #pragma warning(push)
 #pragma warning(disable : 4251)
 
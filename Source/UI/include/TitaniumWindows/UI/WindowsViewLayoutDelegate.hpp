@@ -457,7 +457,8 @@ namespace TitaniumWindows
 				use_own_size__ = true;
 			}
 
-			virtual void requestLayout(const bool& fire_event = false);
+			virtual void requestLayout(const bool& fire_event = false) override;
+			virtual void endLayoutUpdate() TITANIUM_NOEXCEPT override;
 
 			// compute its fixed size when either width or height (not both) is Ti.UI.SIZE
 			virtual Titanium::LayoutEngine::Rect computeRelativeSize(const double& x, const double& y,  const double& baseWidth, const double& baseHeight);
@@ -531,6 +532,9 @@ namespace TitaniumWindows
 			bool use_own_size__ { false };
 			bool is_transforming_layout__ { false }; // true when animate() is transforming layout
 
+			// Ti.App defaultUnit while properties are set together, see beginLayoutUpdate
+			std::string layout_default_units__;
+
 			Titanium::LayoutEngine::Rect oldRect__;
 
 			struct animate_call__ {
@@ -12,6 +12,9 @@
 #include "TitaniumWindows/UI/WindowsViewLayoutDelegate.hpp"
 #include "TitaniumWindows/Utility.hpp"
 #include "Titanium/detail/TiImpl.hpp"
+#include "Titanium/App.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace TitaniumWindows
 {
@@ -20,6 +23,58 @@ namespace TitaniumWindows
 		using namespace Platform::Collections;
 		using namespace Windows::UI::Xaml;
 
+		/*
+		 * Lays the root view of a list item out with the LayoutEngine from its snapshot
+		 * alone, so it can run on a worker thread. Only roots with a fixed or percentage
+		 * height are measured, the height of others depends on content the worker
+		 * cannot see, such as the text of a label.
+		 */
+		static double measureListItem(const Titanium::UI::ListItemSnapshot& snapshot, const double& listWidth, const double& listHeight, const double& ppiX, const double& ppiY, const std::string& defaultUnits)
+		{
+			using namespace Titanium::LayoutEngine;
+			static const std::vector<std::tuple<std::string, ValueName, bool>> layoutNames {
+				std::make_tuple("top", Top, false),
+				std::make_tuple("bottom", Bottom, false),
+				std::make_tuple("left", Left, true),
+				std::make_tuple("right", Right, true),
+				std::make_tuple("width", Width, true),
+				std::make_tuple("minWidth", MinWidth, true),
+				std::make_tuple("height", Height, false),
+				std::make_tuple("minHeight", MinHeight, false)
+			};
+			const auto size = Titanium::UI::Constants::to_string(Titanium::UI::LAYOUT::SIZE);
+			const auto fill = Titanium::UI::Constants::to_string(Titanium::UI::LAYOUT::FILL);
+
+			Node list;
+			elementInitialize(&list.element, Composite);
+			layoutPropertiesInitialize(&list.properties);
+			list.element.measuredWidth = listWidth;
+			list.element.measuredHeight = listHeight;
+
+			Node root;
+			elementInitialize(&root.element, Composite);
+			layoutPropertiesInitialize(&root.properties);
+			root.properties.defaultWidthType = Fill;
+			root.properties.defaultHeightType = Size;
+			for (const auto& name : layoutNames) {
+				const auto found = snapshot.values.find(std::get<0>(name));
+				if (found == snapshot.values.end()) {
+					continue;
+				}
+				InputProperty property;
+				property.name = std::get<1>(name);
+				property.value = found->second == size ? "UI.SIZE" : found->second == fill ? "UI.FILL" : found->second;
+				populateLayoutProperties(property, &root.properties, std::get<2>(name) ? ppiX : ppiY, defaultUnits);
+			}
+			if (root.properties.height.valueType != Fixed && root.properties.height.valueType != Percent) {
+				return NAN;
+			}
+
+			nodeAddChild(&list, &root);
+			nodeLayout(&list);
+			return root.element.measuredHeight;
+		}
+
 		ListView::ListView(const JSContext& js_context) TITANIUM_NOEXCEPT
 			: Titanium::UI::ListView(js_context)
 		{
@@ -28,10 +83,31 @@ namespace TitaniumWindows
 		ListView::~ListView() 
 		{
 			if (listview__) {
+				listview__->Loaded -= loaded_event__;
+				listview__->SizeChanged -= sizechanged_event__;
+				if (scrollview__) {
+					scrollview__->ViewChanged -= viewchanged_event__;
+				}
 				clearListViewData();
 			}
 		}
 
+		Controls::ScrollViewer^ ListView::GetScrollView(DependencyObject^ root)
+		{
+			const auto count = Media::VisualTreeHelper::GetChildrenCount(root);
+			for (int i = 0; i < count; i++) {
+				const auto child = Media::VisualTreeHelper::GetChild(root, i);
+				auto scrollview = dynamic_cast<Controls::ScrollViewer^>(child);
+				if (!scrollview) {
+					scrollview = ListView::GetScrollView(child);
+				}
+				if (scrollview) {
+					return scrollview;
+				}
+			}
+			return nullptr;
+		}
+
 		void ListView::postCallAsConstructor(const JSContext& js_context, const std::vector<JSValue>& arguments)
 		{
 			Titanium::UI::ListView::postCallAsConstructor(js_context, arguments);	
@@ -42,6 +118,22 @@ namespace TitaniumWindows
 
 			resetListViewDataBinding();
 
+			// Since VisualTreeHelper is only available after Loaded event is fired, we need to watch the scroll viewport after that.
+			loaded_event__ = listview__->Loaded += ref new RoutedEventHandler([this](Platform::Object^ sender, RoutedEventArgs^ e) {
+				if (scrollview__) {
+					return;
+				}
+				scrollview__ = GetScrollView(Media::VisualTreeHelper::GetChild(listview__, 0));
+				TITANIUM_ASSERT(scrollview__ != nullptr);
+				viewchanged_event__ = scrollview__->ViewChanged += ref new Windows::Foundation::EventHandler<Controls::ScrollViewerViewChangedEventArgs^>([this](Platform::Object^ sender, Controls::ScrollViewerViewChangedEventArgs^ e) {
+					updateVisibleItems();
+				});
+				updateVisibleItems();
+			});
+			sizechanged_event__ = listview__->SizeChanged += ref new SizeChangedEventHandler([this](Platform::Object^ sender, SizeChangedEventArgs^ e) {
+				updateVisibleItems();
+			});
+
 			Titanium::UI::ListView::setLayoutDelegate<WindowsViewLayoutDelegate>();
 			layoutDelegate__->set_defaultWidth(Titanium::UI::LAYOUT::FILL);
 			layoutDelegate__->set_defaultHeight(Titanium::UI::LAYOUT::FILL);
@@ -65,16 +157,14 @@ namespace TitaniumWindows
 		{
 			unregisterListViewItemAsLayoutNode(section->get_headerView());
 			unregisterListViewItemAsLayoutNode(section->get_footerView());
-			const auto items = section->get_items();
-			for (const auto item : items) {
-				unregisterListViewItemAsLayoutNode(item.view);
-			}
 		}
 		void ListView::clearListViewData() 
 		{
 			for (const auto section : model__->get_sections()) {
 				unregisterSectionLayoutNode(section);
 			}
+			// Item views leave their hosts and go back to the pools
+			refreshItemViews(false);
 
 			resetListViewDataBinding();
 		}
@@ -105,7 +195,7 @@ namespace TitaniumWindows
 						const auto section = model__->getFilteredSectionAtIndex(result.sectionIndex);
 						auto this_object = get_object();
 
-						TITANIUM_ASSERT(section->get_items().size() > static_cast<std::uint32_t>(result.rowIndex));
+						TITANIUM_ASSERT(section->get_itemCount() > static_cast<std::uint32_t>(result.rowIndex));
 						const auto properties = section->getItemAt(result.rowIndex).properties;
 						if (properties.find("itemId") != properties.end()) {
 							this_object.SetProperty("_itemclick_itemId_", properties.at("itemId"));
@@ -189,6 +279,10 @@ namespace TitaniumWindows
 
 			// bind collection view again
 			bindCollectionViewSource();
+
+			// Item views of the new sections were realized before their hosts existed
+			refreshItemViews(false);
+			updateVisibleItems();
 		}
 
 		void ListView::deleteSectionAt(const uint32_t& sectionIndex, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -202,6 +296,10 @@ namespace TitaniumWindows
 
 			// bind collection view again
 			bindCollectionViewSource();
+
+			// Item views were realized into the hosts of the removed section
+			refreshItemViews(false);
+			updateVisibleItems();
 		}
 
 		void ListView::insertSectionAt(const uint32_t& sectionIndex, const std::vector<std::shared_ptr<Titanium::UI::ListSection>>& section, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
@@ -233,45 +331,38 @@ namespace TitaniumWindows
 			
 			TITANIUM_ASSERT(views);
 
+			// New items are as high as expected of their template until they are laid out
+			const auto createHost = [this, section](const std::uint32_t& i) {
+				return createItemHost(rowHeights__.Estimate(getRowTemplateId(section->getItemTemplateAt(i))));
+			};
+
 			std::uint32_t index = section->hasHeader() ? itemIndex + 1 : itemIndex;
 			if (name == "append") {
 				for (std::uint32_t i = itemIndex; i < itemIndex + itemCount; i++) {
-					const auto view = createSectionItemViewAt<TitaniumWindows::UI::View>(sectionIndex, i);
 					UIElement^ footer = nullptr;
 					if (section->hasFooter()) {
 						footer = views->GetAt(views->Size-1);
 						views->RemoveAtEnd();
 					}
-					appendListViewItemForSection(view, views);
+					views->Append(createHost(i));
 					if (footer) {
 						views->Append(footer);
 					}
-					section->setViewForSectionItem(i, view);
 				}
 			} else if (name == "update" || name == "replace") {
 				// "update" and "replace" are basically same, it removes existing content and insert new one
 				for (std::uint32_t i = itemIndex; i < itemIndex + affectedRows; i++) {
 					views->RemoveAt(index);
-					unregisterListViewItemAsLayoutNode(section->getViewForSectionItem(i));
-					section->setViewForSectionItem(i, nullptr);
 				}
 				for (std::uint32_t i = itemIndex; i < itemIndex + itemCount; i++) {
-					const auto view = createSectionItemViewAt<TitaniumWindows::UI::View>(sectionIndex, i);
-					insertListViewItemForSection(view, views, index++);
-					section->setViewForSectionItem(i, view);
+					views->InsertAt(index++, createHost(i));
 				}
 			} else if (name == "delete") {
 				TITANIUM_ASSERT(views->Size > index);
 				for (std::uint32_t i = itemIndex; i < itemIndex + itemCount; i++) {
 					views->RemoveAt(index);
-					unregisterListViewItemAsLayoutNode(section->getViewForSectionItem(i));
-					section->setViewForSectionItem(i, nullptr);
 				}
 			} else if (name == "clear") {
-				for (std::uint32_t i = itemIndex; i < itemIndex + itemCount; i++) {
-					unregisterListViewItemAsLayoutNode(section->getViewForSectionItem(i));
-					section->setViewForSectionItem(i, nullptr);
-				}
 				if (views->Size > 0) {
 					// clear section view except header view
 					const auto header = views->GetAt(0);
@@ -284,12 +375,18 @@ namespace TitaniumWindows
 				}
 			} else if (name == "insert") {
 				for (std::uint32_t i = itemIndex; i < itemIndex + itemCount; i++) {
-					const auto view = createSectionItemViewAt<TitaniumWindows::UI::View>(sectionIndex, i);
-					insertListViewItemForSection(view, views, index++);
-					section->setViewForSectionItem(i, view);
+					views->InsertAt(index++, createHost(i));
 				}
 			}
+			// Binds the realized item views again and moves them to the hosts of their items
 			Titanium::UI::ListView::fireListSectionEvent(name, section, itemIndex, itemCount, affectedRows);
+
+			// "clear" and "delete" fire before the items are removed, the viewport is realized again once they are
+			// Keep the ListView alive until the UI thread gets to it
+			const auto listview = get_object().GetPrivate<ListView>();
+			TitaniumWindows::Utility::RunOnUIThread([listview]() {
+				listview->updateVisibleItems();
+			});
 		}
 
 		Vector<UIElement^>^ ListView::createUIElementsForSection(const std::uint32_t& sectionIndex) TITANIUM_NOEXCEPT
@@ -297,9 +394,12 @@ namespace TitaniumWindows
 			auto group = ref new Vector<UIElement^>();
 
 			const auto section = model__->getSectionAtIndex(sectionIndex);
-			const auto itemsCountToBeCreated = section->get_items().size();
-			const auto views = createSectionViewAt<TitaniumWindows::UI::View>(sectionIndex);
-			TITANIUM_ASSERT(views.size() == itemsCountToBeCreated);
+			const auto itemCount = section->get_itemCount();
+			const auto position = getItemPosition(sectionIndex, 0);
+			const auto& heights = getRowHeights();
+
+			// Lets the section forward appendItems and the like to this ListView
+			section->get_object().SetProperty("listview", get_object());
 
 			// set section header
 			const auto headerView = section->get_headerView();
@@ -326,10 +426,9 @@ namespace TitaniumWindows
 				group->Append(header);
 			}
 
-			for (uint32_t itemIndex = 0; itemIndex < views.size(); itemIndex++) {
-				const auto view = views.at(itemIndex);
-				appendListViewItemForSection(view, group);
-				section->setViewForSectionItem(itemIndex, view);
+			// Item views are realized into the hosts as they scroll into view
+			for (uint32_t itemIndex = 0; itemIndex < itemCount; itemIndex++) {
+				group->Append(createItemHost(heights.get_heightAt(position + itemIndex)));
 			}
 
 			// set footer
@@ -366,7 +465,11 @@ namespace TitaniumWindows
 				return;
 			}
 			auto layoutDelegate = getViewLayoutDelegate<WindowsViewLayoutDelegate>();
-			Titanium::LayoutEngine::nodeAddChild(layoutDelegate->getLayoutNode(), view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getLayoutNode());
+			const auto node = view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getLayoutNode();
+			// Recycled item views come and go, make sure each is added once
+			if (node->parent != layoutDelegate->getLayoutNode()) {
+				Titanium::LayoutEngine::nodeAddChild(layoutDelegate->getLayoutNode(), node);
+			}
 		}
 
 		void ListView::unregisterListViewItemAsLayoutNode(const std::shared_ptr<Titanium::UI::View>& view) 
@@ -376,21 +479,160 @@ namespace TitaniumWindows
 			}
 			const auto layout = getViewLayoutDelegate<WindowsViewLayoutDelegate>();
 			const auto view_layout = view->getViewLayoutDelegate<WindowsViewLayoutDelegate>();
-			Titanium::LayoutEngine::nodeRemoveChild(layout->getLayoutNode(), view_layout->getLayoutNode());
+			if (view_layout->getLayoutNode()->parent == layout->getLayoutNode()) {
+				Titanium::LayoutEngine::nodeRemoveChild(layout->getLayoutNode(), view_layout->getLayoutNode());
+			}
 		}
 
-		void ListView::appendListViewItemForSection(const std::shared_ptr<TitaniumWindows::UI::View>& view, Vector<UIElement^>^ group)
+		Controls::Border^ ListView::createItemHost(const double& height) const
 		{
-			group->Append(view->getComponent());
-			registerListViewItemAsLayoutNode(view);
+			const auto host = ref new Controls::Border();
+			host->Height = height;
+			return host;
 		}
 
-		void ListView::insertListViewItemForSection(const std::shared_ptr<TitaniumWindows::UI::View>& view, Vector<UIElement^>^ group, const std::uint32_t& index) 
+		Controls::Border^ ListView::getItemHost(const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex) const
 		{
-			group->InsertAt(index, view->getComponent());
+			if (sectionIndex >= model__->get_sectionCount() || sectionIndex >= collectionViewItems__->Size) {
+				return nullptr;
+			}
+			const auto section = model__->getSectionAtIndex(sectionIndex);
+			if (itemIndex >= section->get_itemCount()) {
+				return nullptr;
+			}
+			const auto views = static_cast<Vector<UIElement^>^>(collectionViewItems__->GetAt(sectionIndex));
+			const auto index = section->hasHeader() ? itemIndex + 1 : itemIndex;
+			return index < views->Size ? dynamic_cast<Controls::Border^>(views->GetAt(index)) : nullptr;
+		}
+
+		void ListView::itemViewRealized(const std::shared_ptr<Titanium::UI::View>& view, const std::uint32_t& sectionIndex, const std::uint32_t& itemIndex)
+		{
+			const auto host = getItemHost(sectionIndex, itemIndex);
+			const auto component = view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getComponent();
+			if (host == nullptr || component == nullptr) {
+				return;
+			}
+			// The item sizes to its view while it holds one
+			host->Height = NAN;
+			host->Child = component;
 			registerListViewItemAsLayoutNode(view);
 		}
 
+		void ListView::itemViewReleased(const std::shared_ptr<Titanium::UI::View>& view)
+		{
+			const auto component = view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getComponent();
+			const auto host = component == nullptr ? nullptr : dynamic_cast<Controls::Border^>(component->Parent);
+			if (host) {
+				// Keep the height the item had so the list does not jump
+				host->Height = host->ActualHeight > 0 ? host->ActualHeight : rowHeights__.get_defaultHeight();
+				host->Child = nullptr;
+			}
+			unregisterListViewItemAsLayoutNode(view);
+		}
+
+		double ListView::getItemScrollOffset(const double& offset) const
+		{
+			double skipped = 0;
+			const auto sectionCount = (std::min)(model__->get_sectionCount(), collectionViewItems__->Size);
+			for (std::uint32_t sectionIndex = 0; sectionIndex < sectionCount; sectionIndex++) {
+				const auto section = model__->getSectionAtIndex(sectionIndex);
+				const auto views = static_cast<Vector<UIElement^>^>(collectionViewItems__->GetAt(sectionIndex));
+				const auto top = getItemOffset(sectionIndex, 0);
+				if (section->hasHeader() && views->Size > 0) {
+					skipped += views->GetAt(0)->RenderSize.Height;
+					if (offset < top + skipped) {
+						return top;
+					}
+				}
+				const auto bottom = getItemOffset(sectionIndex, section->get_itemCount());
+				if (offset < bottom + skipped) {
+					return offset - skipped;
+				}
+				if (section->hasFooter() && views->Size > 0) {
+					skipped += views->GetAt(views->Size - 1)->RenderSize.Height;
+					if (offset < bottom + skipped) {
+						return bottom;
+					}
+				}
+			}
+			return offset - skipped;
+		}
+
+		void ListView::updateVisibleItems()
+		{
+			if (scrollview__ == nullptr || scrollview__->ViewportHeight <= 0) {
+				return;
+			}
+			const auto offset = getItemScrollOffset(scrollview__->VerticalOffset);
+			const auto height = scrollview__->ViewportHeight;
+
+			// Items laid out since the last update tell where the viewport now is
+			const auto& heights = getRowHeights();
+			const auto last = (std::min)(heights.RowAt(offset + height) + 1, heights.size());
+			for (auto position = heights.RowAt(offset); position < last; position++) {
+				const auto index = getSectionItemIndex(position);
+				const auto view = getRealizedItemViewAt(std::get<0>(index), std::get<1>(index));
+				const auto component = view ? view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getComponent() : nullptr;
+				if (component && component->ActualHeight > 0) {
+					setItemHeight(std::get<0>(index), std::get<1>(index), component->ActualHeight);
+				}
+			}
+			setVisibleRange(offset, height);
+		}
+
+		void ListView::scrollToItem(const uint32_t& sectionIndex, const uint32_t& itemIndex, const std::shared_ptr<Titanium::UI::ListViewAnimationProperties>& animation) TITANIUM_NOEXCEPT
+		{
+			const auto host = getItemHost(sectionIndex, itemIndex);
+			if (host == nullptr) {
+				TITANIUM_LOG_WARN("ListView::scrollToItem: Invalid item ", sectionIndex, ":", itemIndex);
+				return;
+			}
+			// Realize the items at the estimated offset of the target first, so the list
+			// lands on laid out items rather than laying out everything on the way
+			if (scrollview__ != nullptr && scrollview__->ViewportHeight > 0) {
+				setVisibleRange(getItemOffset(sectionIndex, itemIndex), scrollview__->ViewportHeight);
+			}
+			listview__->ScrollIntoView(host, Controls::ScrollIntoViewAlignment::Leading);
+		}
+
+		std::function<double(const Titanium::UI::ListItemSnapshot&)> ListView::createItemMeasure()
+		{
+			const auto layout_node = getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getLayoutNode();
+			const auto listWidth = layout_node->element.measuredWidth;
+			const auto listHeight = layout_node->element.measuredHeight;
+			if (listWidth <= 0) {
+				// Not laid out yet, there is nothing to measure items against
+				return nullptr;
+			}
+
+			// Everything the worker needs is read here, on the UI thread
+			const auto info = Windows::Graphics::Display::DisplayInformation::GetForCurrentView();
+			double ppiX = info->LogicalDpi;
+			double ppiY = info->LogicalDpi;
+#if defined(IS_WINDOWS_PHONE) || defined(IS_WINDOWS_10)
+			ppiX = info->RawDpiX / info->RawPixelsPerViewPixel;
+			ppiY = info->RawDpiY / info->RawPixelsPerViewPixel;
+#endif
+			auto Titanium = static_cast<JSObject>(get_context().get_global_object().GetProperty("Titanium"));
+			auto App = static_cast<JSObject>(Titanium.GetProperty("App"));
+			const auto defaultUnits = App.GetPrivate<Titanium::AppModule>()->defaultUnit();
+
+			return [listWidth, listHeight, ppiX, ppiY, defaultUnits](const Titanium::UI::ListItemSnapshot& snapshot) {
+				return measureListItem(snapshot, listWidth, listHeight, ppiX, ppiY, defaultUnits);
+			};
+		}
+
+		void ListView::itemViewPrepared(const std::shared_ptr<Titanium::UI::View>& view, const double& height)
+		{
+			// Size the host rather than the view: itemViewRealized clears it again
+			// for the next item bound to this view, whatever its height
+			const auto component = view->getViewLayoutDelegate<WindowsViewLayoutDelegate>()->getComponent();
+			const auto host = component == nullptr ? nullptr : dynamic_cast<Controls::Border^>(component->Parent);
+			if (host) {
+				host->Height = height;
+			}
+		}
+
 		void ListView::set_sections(const std::vector<std::shared_ptr <Titanium::UI::ListSection>>& sections) TITANIUM_NOEXCEPT
 		{
 			Titanium::UI::ListView::set_sections(sections);
@@ -400,6 +642,8 @@ namespace TitaniumWindows
 			for (uint32_t sectionIndex = 0; sectionIndex < sections.size(); sectionIndex++) {
 				collectionViewItems__->Append(createUIElementsForSection(sectionIndex));
 			}
+
+			updateVisibleItems();
 		}
 	}  // namespace UI
 }  // namespace TitaniumWindows
\ No newline at end of file
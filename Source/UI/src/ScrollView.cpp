@@ -166,6 +166,10 @@ namespace TitaniumWindows
 			} else if (event_name == "scroll") {
 				scroll_event__ = scroll_viewer__->ViewChanging += ref new Windows::Foundation::EventHandler<Windows::UI::Xaml::Controls::ScrollViewerViewChangingEventArgs ^>(
 					[=](Platform::Object ^sender, Windows::UI::Xaml::Controls::ScrollViewerViewChangingEventArgs ^args) {
+						static const auto scroll = Titanium::Module::InternEvent("scroll");
+						if (!hasEventListener(scroll)) {
+							return;
+						}
 						auto eventArgs = get_context().CreateObject();
 						auto dragging = args->FinalView->HorizontalOffset != 0 || args->FinalView->VerticalOffset != 0;
 						auto zoom = args->FinalView->ZoomFactor;
@@ -173,7 +177,7 @@ namespace TitaniumWindows
 						eventArgs.SetProperty("dragging", get_context().CreateBoolean(dragging)); // test this
 						eventArgs.SetProperty("zooming", get_context().CreateBoolean(zooming)); // test this
 						eventArgs.SetProperty("curZoomScale", get_context().CreateNumber(zoom));
-						fireEvent("scroll", eventArgs);
+						fireEvent(scroll, eventArgs);
 					}
 				);
 			} else if (event_name == "scrollend" || event_name == "scrollEnd") {
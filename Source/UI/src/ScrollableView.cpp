@@ -142,11 +142,15 @@ namespace TitaniumWindows
 			} else if (event_name == "scroll") {
 				scroll_event__ = scroll_viewer__->ViewChanging += ref new Windows::Foundation::EventHandler<Windows::UI::Xaml::Controls::ScrollViewerViewChangingEventArgs ^>(
 					[=](Platform::Object ^sender, Windows::UI::Xaml::Controls::ScrollViewerViewChangingEventArgs ^args) {
+						static const auto scroll = Titanium::Module::InternEvent("scroll");
+						if (!hasEventListener(scroll)) {
+							return;
+						}
 						auto eventArgs = get_context().CreateObject();
 						eventArgs.SetProperty("currentPage", get_context().CreateNumber(get_currentPage()));
 						float currentPageAsFloat = get_currentPage() + static_cast<float>(scroll_viewer__->HorizontalOffset / scroll_viewer__->Width);
 						eventArgs.SetProperty("currentPageAsFloat", get_context().CreateNumber(currentPageAsFloat));
-						fireEvent("scroll", eventArgs);
+						fireEvent(scroll, eventArgs);
 					}
 				);
 			} else if (event_name == "scrollend") {
@@ -181,8 +181,18 @@ namespace TitaniumWindows
 
 		void TableView::set_data(const std::vector<JSObject>& data) TITANIUM_NOEXCEPT
 		{
+			// Keyed rows are updated in place through section events,
+			// all under a single rebind of the collection view source
+			unbindCollectionViewSource();
+			batchingRows__ = true;
+			const auto diffed = applyDataDiff(data);
+			batchingRows__ = false;
+			bindCollectionViewSource();
+			if (diffed) {
+				return;
+			}
 			unregisterSections();
-			Titanium::UI::TableView::set_data(data);
+			Titanium::UI::TableView::resetData(data);
 			clearTableData();
 			setTableHeader();
 			setTableFooter();
@@ -457,6 +467,10 @@ namespace TitaniumWindows
 		void TableView::registerScrollEvent()
 		{
 			scroll_event__ = scrollview__->ViewChanging += ref new EventHandler<Controls::ScrollViewerViewChangingEventArgs ^>([this](Platform::Object^ sender, Controls::ScrollViewerViewChangingEventArgs^ e) {
+				static const auto scroll = Titanium::Module::InternEvent("scroll");
+				if (!hasEventListener(scroll)) {
+					return;
+				}
 				const auto ctx = get_context();
 				auto eventArgs = ctx.CreateObject();
 
@@ -467,7 +481,7 @@ namespace TitaniumWindows
 
 				eventArgs.SetProperty("totalItemCount", ctx.CreateNumber(tableview__->Items->Size));
 
-				fireEvent("scroll", eventArgs);
+				fireEvent(scroll, eventArgs);
 			});
 		}
 
@@ -494,11 +508,17 @@ namespace TitaniumWindows
 
 		void TableView::bindCollectionViewSource()
 		{
+			if (batchingRows__) {
+				return;
+			}
 			collectionViewSource__->Source = collectionViewItems__;
 		}
 
 		void TableView::unbindCollectionViewSource()
 		{
+			if (batchingRows__) {
+				return;
+			}
 			collectionViewSource__->Source = ref new Vector<Platform::Object^>();
 		}
 
@@ -1227,7 +1227,11 @@ namespace TitaniumWindows
 			if (event_name == "touchmove") {
 				component->ManipulationMode = ManipulationModes::All;
 				touchmove_event__ = component->ManipulationDelta += ref new ManipulationDeltaEventHandler([this](Platform::Object^ sender, ManipulationDeltaRoutedEventArgs^ e) {
+					static const auto touchmove = Titanium::Module::InternEvent("touchmove");
 					const auto event_delegate = event_delegate__.lock();
+					if (event_delegate == nullptr || !event_delegate->hasEventListener(touchmove)) {
+						return;
+					}
 					auto ctx = event_delegate->get_context();
 					JSObject  delta = ctx.CreateObject();
 					delta.SetProperty("x", ctx.CreateNumber(e->Delta.Translation.X));
@@ -1238,7 +1242,7 @@ namespace TitaniumWindows
 					eventArgs.SetProperty("y", ctx.CreateNumber(e->Position.Y));
 					eventArgs.SetProperty("delta", delta);
 
-					event_delegate->fireEvent("touchmove", eventArgs);
+					event_delegate->fireEvent(touchmove, eventArgs);
 				});
 			} else if (event_name == "touchstart") {
 				component->PointerPressed += ref new PointerEventHandler([this](Platform::Object^ sender, PointerRoutedEventArgs^ e) {
@@ -1601,6 +1605,10 @@ namespace TitaniumWindows
 
 		void WindowsViewLayoutDelegate::requestLayout(const bool& fire_event)
 		{
+			if (holdLayoutRequest(fire_event)) {
+				return;
+			}
+
 			const auto root = Titanium::LayoutEngine::nodeRequestLayout(layout_node__);
 			if (root) {
 				Titanium::LayoutEngine::nodeLayout(root);
@@ -1632,6 +1640,15 @@ namespace TitaniumWindows
 			}
 		}
 
+		void WindowsViewLayoutDelegate::endLayoutUpdate() TITANIUM_NOEXCEPT
+		{
+			// The held back layout, if any, is made here
+			Titanium::UI::ViewLayoutDelegate::endLayoutUpdate();
+			if (!isUpdatingLayout()) {
+				layout_default_units__.clear();
+			}
+		}
+
 		void WindowsViewLayoutDelegate::firePostLayoutEvent()
 		{
 			if (postlayout_listening__) {
@@ -1738,10 +1755,10 @@ namespace TitaniumWindows
 			}
 #endif
 
-			// Get the defaultUnits from ti.ui.defaultUnit!
-			std::string defaultUnits = "px";
+			// Get the defaultUnits from ti.ui.defaultUnit! Looked up once while properties are set together
+			std::string defaultUnits = layout_default_units__.empty() ? "px" : layout_default_units__;
 			auto event_delegate = event_delegate__.lock();
-		 	if (event_delegate != nullptr) {
+		 	if (layout_default_units__.empty() && event_delegate != nullptr) {
 			 	JSContext js_context = event_delegate->get_context();
 
 			 	JSValue Titanium_property = js_context.get_global_object().GetProperty("Titanium");
@@ -1754,6 +1771,9 @@ namespace TitaniumWindows
 
 				const auto object_ptr = App.GetPrivate<Titanium::AppModule>();
 				defaultUnits = object_ptr->defaultUnit();
+				if (isUpdatingLayout()) {
+					layout_default_units__ = defaultUnits;
+				}
 		 	}
 			Titanium::LayoutEngine::populateLayoutProperties(prop, properties ? properties.get() : &layout_node__->properties, ppi, defaultUnits);
 
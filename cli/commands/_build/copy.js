@@ -22,6 +22,7 @@ exports.mixin = mixin;
 function mixin(WindowsBuilder) {
 	WindowsBuilder.prototype.copyResultsToProject = copyResultsToProject;
 	WindowsBuilder.prototype.copyResources = copyResources;
+	WindowsBuilder.prototype.writeRequireManifest = writeRequireManifest;
 }
 
 // Copy to original location!
@@ -608,6 +609,10 @@ function copyResources(next) {
 			);
 			this.encryptJS && jsFilesToEncrypt.push('_app_info_.json');
 
+			// write the require() resolution manifest, after everything else is in place
+			this.writeRequireManifest();
+			this.encryptJS && jsFilesToEncrypt.push('_require_manifest_.json');
+
 			if (!jsFilesToEncrypt.length) {
 				// nothing to encrypt, continue
 				return next();
@@ -617,4 +622,81 @@ function copyResources(next) {
 			this.processEncryption(next);
 		});
 	});
+}
+
+/**
+ * Normalizes a "/" separated path relative to the assets directory, the same
+ * way GlobalObject::resolvePath does at runtime.
+ *
+ * @param {String} p - The path to normalize.
+ * @returns {String} The path with "." and ".." segments removed.
+ */
+function normalizeModulePath(p) {
+	var parts = [];
+	p.split('/').forEach(function (part) {
+		if (part === '..') {
+			parts.pop();
+		} else if (part && part !== '.') {
+			parts.push(part);
+		}
+	});
+	return parts.join('/');
+}
+
+/**
+ * Writes "_require_manifest_.json" into the assets directory. It lists every
+ * JavaScript and JSON file the app ships and the resolved "main" of every
+ * package.json, so require() can resolve modules without probing the
+ * filesystem. Anything missing from it is still resolved the old way.
+ */
+function writeRequireManifest() {
+	var assetsDir = this.buildTargetAssetsDir,
+		manifestFile = path.join(assetsDir, '_require_manifest_.json'),
+		files = {},
+		packages = {};
+
+	wrench.readdirSyncRecursive(assetsDir).forEach(function (file) {
+		file = file.replace(/\\/g, '/');
+		if (/\.js(on)?$/.test(file) && file !== '_require_manifest_.json') {
+			files[file] = true;
+		}
+	});
+
+	Object.keys(files).forEach(function (file) {
+		var slash = file.lastIndexOf('/'),
+			dir = file.substring(0, slash),
+			main;
+
+		// the runtime only looks for package.json inside a module directory
+		if (slash === -1 || file.substring(slash + 1) !== 'package.json') {
+			return;
+		}
+		try {
+			main = JSON.parse(fs.readFileSync(path.join(assetsDir, file), {encoding: 'utf8'})).main;
+		} catch (e) {
+			this.logger.warn(__('Unable to parse %s, require() will read it at runtime', file.cyan));
+			return;
+		}
+		if (typeof main !== 'string') {
+			return;
+		}
+
+		main = normalizeModulePath(dir + '/' + main);
+		[main, main + '.js', main + '.json'].some(function (candidate) {
+			if (files[candidate]) {
+				packages[dir] = candidate;
+				return true;
+			}
+			return false;
+		});
+	}, this);
+
+	this.logger.debug(__('Writing require() manifest %s', manifestFile.cyan));
+	fs.writeFileSync(
+		manifestFile,
+		JSON.stringify({
+			files: Object.keys(files).sort(),
+			packages: packages
+		})
+	);
 }
\ No newline at end of file